@@ -10,6 +10,7 @@
 #include "Component/Public/ScriptComponent.h"  // FDelegateInfo 템플릿 구현용
 #include "Editor/Public/Editor.h"
 #include "Level/Public/Level.h"
+#include "Level/Public/World.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -17,6 +18,8 @@ IMPLEMENT_CLASS(AActor, UObject)
 
 AActor::AActor()
 {
+	PrimaryActorTick.Target = this;
+
 	// Delegate 등록 (Lua 자동 바인딩용)
 	RegisterDelegate(MakeDelegateInfo("OnActorBeginOverlap", &OnActorBeginOverlap));
 	RegisterDelegate(MakeDelegateInfo("OnActorEndOverlap", &OnActorEndOverlap));
@@ -71,7 +74,8 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         if (FJsonSerializer::ReadArray(InOutHandle, "Components", ComponentsJson))
         {
 			TMap<FString, FSceneCompData> ComponentMap;
-	        TArray<FSceneCompData*> LoadList;
+	        // NOTE: TMap은 삽입 시 재해시로 원소 주소가 바뀔 수 있으므로 포인터 대신 키를 보관
+	        TArray<FString> LoadList;
 	        // --- [PASS 1: Component Creation & Data Load] ---
             for (JSON& ComponentData : ComponentsJson.ArrayRange())
             {
@@ -101,14 +105,15 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
                 		LoadData.ParentName = ParentNameStd;
                     
                 		ComponentMap[NameString] = LoadData;
-                		LoadList.Add(&ComponentMap[NameString]);
+                		LoadList.Add(NameString);
                 	}
                 }
             }
             
             // --- [PASS 2: Hierarchy Rebuild] ---
-            for (FSceneCompData* LoadDataPtr : LoadList)
+            for (const FString& LoadName : LoadList)
             {
+                const FSceneCompData* LoadDataPtr = ComponentMap.Find(LoadName);
                 USceneComponent* ChildComp = LoadDataPtr->Component;
                 const FString& ParentName = LoadDataPtr->ParentName;
                 
@@ -331,6 +336,12 @@ void AActor::RegisterComponent(UActorComponent* InNewComponent)
 	}
 
 	GWorld->GetLevel()->RegisterComponent(InNewComponent);
+
+	// BeginPlay 이후에 추가된 컴포넌트는 여기서 Tick 등록
+	if (bBegunPlay)
+	{
+		InNewComponent->RegisterComponentTickFunctions(true);
+	}
 }
 
 bool AActor::RemoveComponent(UActorComponent* InComponentToDelete, bool bShouldDetachChildren)
@@ -392,6 +403,8 @@ bool AActor::RemoveComponent(UActorComponent* InComponentToDelete, bool bShouldD
 	{
 		GEditor->GetEditorModule()->SelectComponent(nullptr);
 	}
+	// 다른 스레드에서 Tick 중일 수 있으므로 삭제 전에 Tick 등록부터 해제
+	InComponentToDelete->RegisterComponentTickFunctions(false);
 	OwnedComponents.Remove(InComponentToDelete);
     SafeDelete(InComponentToDelete);
     return true;
@@ -401,6 +414,10 @@ UObject* AActor::Duplicate()
 {
 	AActor* Actor = Cast<AActor>(Super::Duplicate());
 	Actor->bCanEverTick = bCanEverTick;
+	Actor->PrimaryActorTick.TickGroup = PrimaryActorTick.TickGroup;
+	Actor->PrimaryActorTick.bRunOnAnyThread = PrimaryActorTick.bRunOnAnyThread;
+	Actor->PrimaryActorTick.bAllowSignificanceThrottling = PrimaryActorTick.bAllowSignificanceThrottling;
+	Actor->PrimaryActorTick.TickInterval = PrimaryActorTick.TickInterval;
 	return Actor;
 }
 
@@ -471,6 +488,10 @@ UObject* AActor::DuplicateForEditor()
 {
 	AActor* Actor = Cast<AActor>(NewObject(GetClass()));
 	Actor->bCanEverTick = bCanEverTick;
+	Actor->PrimaryActorTick.TickGroup = PrimaryActorTick.TickGroup;
+	Actor->PrimaryActorTick.bRunOnAnyThread = PrimaryActorTick.bRunOnAnyThread;
+	Actor->PrimaryActorTick.bAllowSignificanceThrottling = PrimaryActorTick.bAllowSignificanceThrottling;
+	Actor->PrimaryActorTick.TickInterval = PrimaryActorTick.TickInterval;
 	DuplicateSubObjectsForEditor(Actor);
 	return Actor;
 }
@@ -532,11 +553,63 @@ void AActor::DuplicateSubObjectsForEditor(UObject* DuplicatedObject)
 
 void AActor::Tick(float DeltaTimes)
 {
-	for (auto& Component : OwnedComponents)
+}
+
+void AActor::RegisterAllActorTickFunctions(bool bInRegister)
+{
+	if (bInRegister)
+	{
+		// 기존 Actor::Tick처럼 Tick하지 않는 액터는 컴포넌트도 Tick하지 않으므로 아무것도 등록하지 않음
+		UWorld* World = GetTypedOuter<UWorld>();
+		if (!World || !bCanEverTick)
+		{
+			return;
+		}
+
+		// 기존 직렬 Tick과 같은 순서(컴포넌트 -> 액터)가 되도록 컴포넌트를 먼저 등록
+		for (UActorComponent* Component : OwnedComponents)
+		{
+			if (Component)
+			{
+				Component->RegisterComponentTickFunctions(true);
+			}
+		}
+
+		PrimaryActorTick.RegisterTickFunction(&World->GetTickTaskManager());
+	}
+	else
+	{
+		PrimaryActorTick.UnRegisterTickFunction();
+		for (UActorComponent* Component : OwnedComponents)
+		{
+			if (Component)
+			{
+				Component->RegisterComponentTickFunctions(false);
+			}
+		}
+	}
+}
+
+void AActor::SetCanTick(bool InbCanEverTick)
+{
+	bCanEverTick = InbCanEverTick;
+	if (bBegunPlay)
+	{
+		// 액터 Tick을 끄면 컴포넌트 Tick 함수도 매니저에서 빼서 프레임 비용을 남기지 않음
+		RegisterAllActorTickFunctions(bCanEverTick);
+	}
+}
+
+void AActor::SetIsPendingDestroy(bool bInIsPendingDestroy)
+{
+	const bool bWasPendingDestroy = bIsPendingDestroy;
+	bIsPendingDestroy = bInIsPendingDestroy;
+
+	if (!bWasPendingDestroy && bIsPendingDestroy)
 	{
-		if (Component && Component->CanEverTick())
+		if (UWorld* World = GetTypedOuter<UWorld>())
 		{
-			Component->TickComponent(DeltaTimes);
+			World->DestroyActor(this);
 		}
 	}
 }
@@ -552,12 +625,14 @@ void AActor::BeginPlay()
 			Component->BeginPlay();
 		}
 	}
+	RegisterAllActorTickFunctions(true);
 }
 
 void AActor::EndPlay()
 {
 	if (!bBegunPlay) return;
 	bBegunPlay = false;
+	RegisterAllActorTickFunctions(false);
 	for (auto& Component : OwnedComponents)
 	{
 		if (Component)
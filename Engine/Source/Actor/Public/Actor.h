@@ -4,6 +4,7 @@
 #include "Component/Public/SceneComponent.h"
 #include "Core/Public/NewObject.h"
 #include "Core/Public/Delegate.h"
+#include "Level/Public/TickTaskManager.h"
 #include "Physics/Public/HitResult.h"
 
 class UUUIDTextComponent;
@@ -55,8 +56,21 @@ public:
 
 	virtual void BeginPlay();
 	virtual void EndPlay();
+	/**
+	 * @brief 액터 자신의 Tick (PrimaryActorTick이 호출)
+	 * 컴포넌트 Tick은 각 컴포넌트의 PrimaryComponentTick이 따로 실행하며, 같은 그룹의 컴포넌트가 모두 끝난 뒤에 호출된다
+	 */
 	virtual void Tick(float DeltaTimes);
 
+	/**
+	 * @brief 액터와 Tick하는 컴포넌트들의 Tick 함수를 World의 FTickTaskManager에 등록 / 해제
+	 * BeginPlay / EndPlay에서 호출되므로 직접 부를 일은 드묾
+	 */
+	void RegisterAllActorTickFunctions(bool bInRegister);
+
+	/** @brief 액터의 Tick 함수 (TickGroup, bRunOnAnyThread, 선행 조건 설정용) */
+	FActorTickFunction PrimaryActorTick;
+
 	// Getter & Setter
 	USceneComponent* GetRootComponent() const { return RootComponent; }
 	TArray<UActorComponent*>& GetOwnedComponents()  { return OwnedComponents; }
@@ -159,13 +173,16 @@ public:
 	bool RemoveComponent(UActorComponent* InComponentToDelete, bool bShouldDetachChildren = false);
 
 	bool CanTick() const { return bCanEverTick; }
-	void SetCanTick(bool InbCanEverTick) { bCanEverTick = InbCanEverTick; }
+	void SetCanTick(bool InbCanEverTick);
 
 	bool CanTickInEditor() const { return bTickInEditor; }
 	void SetTickInEditor(bool InbTickInEditor) { bTickInEditor = InbTickInEditor; }
 
+	bool HasActorBegunPlay() const { return bBegunPlay; }
+
 	bool IsPendingDestroy() const { return bIsPendingDestroy; }
-	void SetIsPendingDestroy(bool bInIsPendingDestroy) { bIsPendingDestroy = bInIsPendingDestroy; }
+	/** @brief 삭제 대기로 표시하면 바로 World의 삭제 목록에 넣음 (매 프레임 전체 액터를 훑지 않도록) */
+	void SetIsPendingDestroy(bool bInIsPendingDestroy);
 
 protected:
 	bool bCanEverTick = false;
@@ -5,6 +5,7 @@
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
+#include "Global/SpatialQuery.h"
 #include "Render/UI/Widget/Public/StaticMeshComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Texture/Public/Texture.h"
@@ -87,6 +88,103 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+bool UStaticMeshComponent::LineTraceComponent(const FQueryRay& InRay, FHitResult& OutHit)
+{
+	// BVH가 아직 없으면 기본 구현의 삼각형 전수 검사로 대신함
+	FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+	if (!MeshAsset || MeshAsset->BVH.IsEmpty())
+	{
+		return Super::LineTraceComponent(InRay, OutHit);
+	}
+
+	// 방향을 정규화하지 않으면 모델 공간의 레이 매개변수가 월드 거리와 같아 범위를 그대로 넘길 수 있음
+	const FMatrix& WorldInverse = GetWorldTransformMatrixInverse();
+	FRay ModelRay;
+	ModelRay.Origin = FVector4(InRay.Origin, 1.0f) * WorldInverse;
+	ModelRay.Direction = FVector4(InRay.Direction, 0.0f) * WorldInverse;
+
+	FBVHRayHit Hit;
+	if (!MeshAsset->BVH.RaycastClosest(ModelRay, 0.0f, InRay.MaxDistance, Hit))
+	{
+		return false;
+	}
+
+	FillLineTraceHit(*MeshAsset, InRay, Hit, OutHit);
+	return true;
+}
+
+int32 UStaticMeshComponent::LineTraceComponentPacket(const FQueryRay* InRays, int32 InNumRays, FHitResult* OutHits)
+{
+	FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+	if (!MeshAsset || MeshAsset->BVH.IsEmpty())
+	{
+		return Super::LineTraceComponentPacket(InRays, InNumRays, OutHits);
+	}
+
+	for (int32 Index = 0; Index < InNumRays; ++Index)
+	{
+		OutHits[Index] = FHitResult();
+	}
+
+	const FMatrix& WorldInverse = GetWorldTransformMatrixInverse();
+	FRay ModelRays[BVH_PACKET_SIZE];
+	float MaxDistances[BVH_PACKET_SIZE];
+	FBVHRayHit Hits[BVH_PACKET_SIZE];
+
+	int32 NumHits = 0;
+	for (int32 Begin = 0; Begin < InNumRays; Begin += BVH_PACKET_SIZE)
+	{
+		const int32 NumRays = std::min(InNumRays - Begin, BVH_PACKET_SIZE);
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			const FQueryRay& Ray = InRays[Begin + Index];
+			ModelRays[Index].Origin = FVector4(Ray.Origin, 1.0f) * WorldInverse;
+			ModelRays[Index].Direction = FVector4(Ray.Direction, 0.0f) * WorldInverse;
+			MaxDistances[Index] = Ray.MaxDistance;
+		}
+
+		if (MeshAsset->BVH.RaycastClosestPacket(ModelRays, NumRays, 0.0f, MaxDistances, Hits) == 0)
+		{
+			continue;
+		}
+
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			if (Hits[Index].TriangleIndex >= 0)
+			{
+				FillLineTraceHit(*MeshAsset, InRays[Begin + Index], Hits[Index], OutHits[Begin + Index]);
+				++NumHits;
+			}
+		}
+	}
+	return NumHits;
+}
+
+void UStaticMeshComponent::FillLineTraceHit(const FStaticMesh& InMeshAsset, const FQueryRay& InRay, const FBVHRayHit& InHit, FHitResult& OutHit)
+{
+	// 비균등 스케일에서도 맞도록 법선은 월드로 옮긴 꼭짓점으로 구함
+	const FMatrix& WorldTransform = GetWorldTransformMatrix();
+	const TArray<FNormalVertex>& MeshVertices = InMeshAsset.Vertices;
+	const TArray<uint32>& MeshIndices = InMeshAsset.Indices;
+	const int32 FirstIndex = InHit.TriangleIndex * 3;
+	const FVector V0 = WorldTransform.TransformPosition(MeshVertices[MeshIndices[FirstIndex]].Position);
+	const FVector V1 = WorldTransform.TransformPosition(MeshVertices[MeshIndices[FirstIndex + 1]].Position);
+	const FVector V2 = WorldTransform.TransformPosition(MeshVertices[MeshIndices[FirstIndex + 2]].Position);
+	FVector Normal = (V1 - V0).Cross(V2 - V0);
+	Normal.Normalize();
+	if (Normal.Dot(InRay.Direction) > 0.0f)
+	{
+		Normal = -Normal;
+	}
+
+	OutHit = FHitResult(InRay.Origin + InRay.Direction * InHit.Distance, Normal);
+	OutHit.Distance = InHit.Distance;
+	OutHit.FaceIndex = InHit.TriangleIndex;
+	OutHit.Actor = GetOwner();
+	OutHit.Component = this;
+	OutHit.bBlockingHit = true;
+}
+
 UClass* UStaticMeshComponent::GetSpecificWidgetClass() const
 {
 	return UStaticMeshComponentWidget::StaticClass();
@@ -16,6 +16,11 @@ public:
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
+	/** @brief 월드 레이를 모델 공간으로 옮겨 공유 메시 BVH에서 가장 가까운 삼각형을 찾음 (BVH가 없으면 삼각형 전수 검사) */
+	bool LineTraceComponent(const FQueryRay& InRay, FHitResult& OutHit) override;
+	/** @brief 레이들을 모델 공간으로 옮겨 BVH_PACKET_SIZE개씩 메시 BVH를 묶음 순회 */
+	int32 LineTraceComponentPacket(const FQueryRay* InRays, int32 InNumRays, FHitResult* OutHits) override;
+
 public:
 	UStaticMesh* GetStaticMesh() { return StaticMesh; }
 	void SetStaticMesh(const FName& InObjPath);
@@ -39,6 +44,9 @@ public:
 	bool IsNormalMapEnabled() const { return NormalMapEnabled; }
 
 private:
+	/** @brief 메시 BVH의 교차로 월드 교차 결과를 채움 */
+	void FillLineTraceHit(const FStaticMesh& InMeshAsset, const FQueryRay& InRay, const FBVHRayHit& InHit, FHitResult& OutHit);
+
 	UStaticMesh* StaticMesh;
 
 	// MaterialList
@@ -1,15 +1,19 @@
 #include "pch.h"
 #include "Component/Public/ActorComponent.h"
+#include "Actor/Public/Actor.h"
+#include "Level/Public/World.h"
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_ABSTRACT_CLASS(UActorComponent, UObject)
 
 UActorComponent::UActorComponent() : Owner(nullptr)
 {
+	PrimaryComponentTick.Target = this;
 }
 
 UActorComponent::~UActorComponent()
 {
+	RegisterComponentTickFunctions(false);
 	SetOuter(nullptr);
 }
 
@@ -49,6 +53,50 @@ void UActorComponent::EndPlay()
 
 }
 
+void UActorComponent::SetCanEverTick(bool InbCanEverTick)
+{
+	bCanEverTick = InbCanEverTick;
+	if (Owner && Owner->HasActorBegunPlay())
+	{
+		RegisterComponentTickFunctions(bCanEverTick);
+	}
+}
+
+bool UActorComponent::ShouldRegisterTickFunctions() const
+{
+	// 소유 액터가 Tick하지 않으면 컴포넌트도 Tick하지 않음 (AActor::SetCanTick(true)에서 다시 등록)
+	return bCanEverTick && Owner && Owner->CanTick();
+}
+
+void UActorComponent::RegisterComponentTickFunctions(bool bInRegister)
+{
+	if (bInRegister)
+	{
+		if (!ShouldRegisterTickFunctions())
+		{
+			return;
+		}
+
+		UWorld* World = Owner->GetTypedOuter<UWorld>();
+		if (!World)
+		{
+			return;
+		}
+
+		PrimaryComponentTick.RegisterTickFunction(&World->GetTickTaskManager());
+		// 기존 Actor::Tick처럼 액터 자신의 Tick은 컴포넌트 Tick이 끝난 뒤에 실행
+		Owner->PrimaryActorTick.AddPrerequisite(&PrimaryComponentTick);
+	}
+	else
+	{
+		PrimaryComponentTick.UnRegisterTickFunction();
+		if (Owner)
+		{
+			Owner->PrimaryActorTick.RemovePrerequisite(&PrimaryComponentTick);
+		}
+	}
+}
+
 
 void UActorComponent::OnSelected()
 {
@@ -65,6 +113,10 @@ UObject* UActorComponent::Duplicate()
 {
 	UActorComponent* ActorComponent = Cast<UActorComponent>(Super::Duplicate());
 	ActorComponent->bCanEverTick = bCanEverTick;
+	ActorComponent->PrimaryComponentTick.TickGroup = PrimaryComponentTick.TickGroup;
+	ActorComponent->PrimaryComponentTick.bRunOnAnyThread = PrimaryComponentTick.bRunOnAnyThread;
+	ActorComponent->PrimaryComponentTick.bAllowSignificanceThrottling = PrimaryComponentTick.bAllowSignificanceThrottling;
+	ActorComponent->PrimaryComponentTick.TickInterval = PrimaryComponentTick.TickInterval;
 	ActorComponent->bIsEditorOnly = bIsEditorOnly;
 	ActorComponent->bIsVisualizationComponent = bIsVisualizationComponent;
 
@@ -14,6 +14,8 @@ IMPLEMENT_CLASS(UDecalComponent, UPrimitiveComponent)
 
 UDecalComponent::UDecalComponent()
 {
+	// 페이드를 Tick에서 진행
+	bCanEverTick = true;
 	bOwnsBoundingBox = true;
     BoundingBox = new FOBB(FVector(0.f, 0.f, 0.f), FVector(0.5f, 0.5f, 0.5f), FMatrix::Identity());
 
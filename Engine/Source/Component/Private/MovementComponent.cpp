@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "Component/Public/MovementComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Level/Public/World.h"
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_ABSTRACT_CLASS(UMovementComponent, UActorComponent)
@@ -31,13 +32,13 @@ void UMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponen
     {
         UpdatedComponent = NewUpdatedComponent;
         UpdatedPrimitive = Cast<UPrimitiveComponent>(UpdatedComponent);
-        bCanEverTick = true;
+        SetCanEverTick(true);
     }
     else
     {
         UpdatedComponent = nullptr;
         UpdatedPrimitive = nullptr;
-        bCanEverTick = false;
+        SetCanEverTick(false);
     }
 }
 
@@ -45,11 +46,18 @@ void UMovementComponent::MoveUpdatedComponent(const FVector& NewDelta, const FQu
 {
     if (UpdatedComponent)
     {
-        UpdatedComponent->SetWorldLocation(UpdatedComponent->GetWorldLocation() + NewDelta);
-        UpdatedComponent->SetWorldRotation(NewRotation);
+        // 위치와 회전을 따로 설정하면 Octree 갱신과 Overlap 검사가 두 번 일어나므로 한 번에 설정
+        UpdatedComponent->SetWorldLocationAndRotation(UpdatedComponent->GetWorldLocation() + NewDelta, NewRotation);
     }
 }
 
+FMovementBatchManager* UMovementComponent::FindMovementBatchManager() const
+{
+    AActor* Owner = GetOwner();
+    UWorld* World = Owner ? Owner->GetTypedOuter<UWorld>() : nullptr;
+    return World ? &World->GetMovementBatchManager() : nullptr;
+}
+
 void UMovementComponent::StopMovementImmediately()
 {
     Velocity = FVector::Zero();
@@ -8,18 +8,18 @@
 #include "Physics/Public/BoundingSphere.h"
 #include "Physics/Public/Capsule.h"
 #include "Physics/Public/Bounds.h"
-#include "Physics/Public/CollisionHelper.h"
+#include "Global/SpatialQuery.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Actor/Public/Actor.h"
 #include "Level/Public/Level.h"
-#include "Global/Octree.h"
-#include <unordered_set>
+#include "Level/Public/World.h"
 
 IMPLEMENT_ABSTRACT_CLASS(UPrimitiveComponent, USceneComponent)
 
 UPrimitiveComponent::UPrimitiveComponent()
 {
-	bCanEverTick = true;
+	// 기본 프리미티브는 Tick에서 하는 일이 없으므로 등록하지 않음 (Tick이 필요한 하위 클래스만 켬)
+	bCanEverTick = false;
 }
 
 void UPrimitiveComponent::TickComponent(float DeltaTime)
@@ -181,25 +181,122 @@ void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
 	OutMax = CachedWorldMax;
 }
 
+bool UPrimitiveComponent::LineTraceComponent(const FQueryRay& InRay, FHitResult& OutHit)
+{
+	// BVH가 없는 프리미티브는 UObjectPicker처럼 모든 삼각형을 검사
+	if (!Vertices || Vertices->IsEmpty() || Topology != D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST)
+	{
+		return false;
+	}
+
+	// 방향을 정규화하지 않으면 모델 공간의 레이 매개변수가 월드 거리와 같음
+	const FMatrix& WorldInverse = GetWorldTransformMatrixInverse();
+	const FVector4 ModelOrigin4 = FVector4(InRay.Origin, 1.0f) * WorldInverse;
+	const FVector4 ModelDirection4 = FVector4(InRay.Direction, 0.0f) * WorldInverse;
+	const FVector ModelOrigin(ModelOrigin4.X, ModelOrigin4.Y, ModelOrigin4.Z);
+	const FVector ModelDirection(ModelDirection4.X, ModelDirection4.Y, ModelDirection4.Z);
+
+	const int32 NumTriangles = Indices ? Indices->Num() / 3 : Vertices->Num() / 3;
+	int32 ClosestTriangle = -1;
+	float ClosestDistance = InRay.MaxDistance;
+	FVector ClosestV0, ClosestV1, ClosestV2;
+	for (int32 TriIndex = 0; TriIndex < NumTriangles; ++TriIndex)
+	{
+		const int32 FirstIndex = TriIndex * 3;
+		const FVector& V0 = (*Vertices)[Indices ? (*Indices)[FirstIndex] : FirstIndex].Position;
+		const FVector& V1 = (*Vertices)[Indices ? (*Indices)[FirstIndex + 1] : FirstIndex + 1].Position;
+		const FVector& V2 = (*Vertices)[Indices ? (*Indices)[FirstIndex + 2] : FirstIndex + 2].Position;
+
+		// Möller–Trumbore (양면)
+		const FVector E1 = V1 - V0;
+		const FVector E2 = V2 - V0;
+		const FVector P = ModelDirection.Cross(E2);
+		const float Determinant = E1.Dot(P);
+		if (std::fabs(Determinant) <= 1e-8f)
+		{
+			continue;
+		}
+
+		const float InvDeterminant = 1.0f / Determinant;
+		const FVector S = ModelOrigin - V0;
+		const float U = S.Dot(P) * InvDeterminant;
+		if (U < 0.0f || U > 1.0f)
+		{
+			continue;
+		}
+
+		const FVector Q = S.Cross(E1);
+		const float V = ModelDirection.Dot(Q) * InvDeterminant;
+		if (V < 0.0f || U + V > 1.0f)
+		{
+			continue;
+		}
+
+		const float T = E2.Dot(Q) * InvDeterminant;
+		if (T >= 0.0f && T <= ClosestDistance)
+		{
+			ClosestDistance = T;
+			ClosestTriangle = TriIndex;
+			ClosestV0 = V0;
+			ClosestV1 = V1;
+			ClosestV2 = V2;
+		}
+	}
+
+	if (ClosestTriangle < 0)
+	{
+		return false;
+	}
+
+	// 비균등 스케일에서도 맞도록 법선은 월드로 옮긴 꼭짓점으로 구함
+	const FMatrix& WorldTransform = GetWorldTransformMatrix();
+	const FVector V0 = WorldTransform.TransformPosition(ClosestV0);
+	FVector Normal = (WorldTransform.TransformPosition(ClosestV1) - V0).Cross(WorldTransform.TransformPosition(ClosestV2) - V0);
+	Normal.Normalize();
+	if (Normal.Dot(InRay.Direction) > 0.0f)
+	{
+		Normal = -Normal;
+	}
+
+	OutHit = FHitResult(InRay.Origin + InRay.Direction * ClosestDistance, Normal);
+	OutHit.Distance = ClosestDistance;
+	OutHit.FaceIndex = ClosestTriangle;
+	OutHit.Actor = GetOwner();
+	OutHit.Component = this;
+	OutHit.bBlockingHit = true;
+	return true;
+}
+
+int32 UPrimitiveComponent::LineTraceComponentPacket(const FQueryRay* InRays, int32 InNumRays, FHitResult* OutHits)
+{
+	int32 NumHits = 0;
+	for (int32 Index = 0; Index < InNumRays; ++Index)
+	{
+		OutHits[Index] = FHitResult();
+		if (LineTraceComponent(InRays[Index], OutHits[Index]))
+		{
+			++NumHits;
+		}
+	}
+	return NumHits;
+}
+
 void UPrimitiveComponent::MarkAsDirty()
 {
 	bIsAABBCacheDirty = true;
 	Super::MarkAsDirty();
 
-	// Update octree position first, then check for overlaps
-	// This ensures that when this component queries the octree, it has the latest positions
+	// Octree 재배치와 Overlap 검사는 Level이 모아 두었다가 프레임 동기화 지점에서 한 번에 처리
+	// 그 전에 Octree를 쿼리하면 대기 중인 재배치가 먼저 적용되므로 항상 최신 위치가 보인다
 	AActor* Owner = GetOwner();
 	if (Owner && Owner->GetOuter())
 	{
 		ULevel* Level = Cast<ULevel>(Owner->GetOuter());
 		if (Level)
 		{
-			Level->UpdatePrimitiveInOctree(this);
+			Level->MarkPrimitiveDirty(this);
 		}
 	}
-
-	// Now update overlaps with the latest octree data
-	UpdateOverlaps();
 }
 
 
@@ -278,99 +375,33 @@ bool UPrimitiveComponent::IsOverlappingActor(const AActor* OtherActor) const
 	return false;
 }
 
-void UPrimitiveComponent::UpdateOverlaps()
-{
-	AActor* MyOwner = GetOwner();
-	if (!MyOwner)
-		return;
-
-	ULevel* Level = Cast<ULevel>(MyOwner->GetOuter());
-	if (!Level || !Level->GetStaticOctree())
-		return;
-
-	// === PHASE 1: Broad Phase (Spatial Query) ===
-	// Use FBounds for fast AABB-based octree query
-	FBounds MyBounds = CalcBounds();
-	FAABB MyAABB(MyBounds.Min, MyBounds.Max);
-
-	TArray<UPrimitiveComponent*> Candidates;
-	Level->GetStaticOctree()->QueryAABB(MyAABB, Candidates);
-
-	// Also check dynamic primitives (objects outside octree bounds)
-	TArray<UPrimitiveComponent*>& DynamicPrims = Level->GetDynamicPrimitives();
-	Candidates.Append(DynamicPrims);
-
-	// Store previous overlaps for comparison
-	TArray<FOverlapInfo> PreviousOverlaps = OverlappingComponents;
-
-	// === PHASE 2: Narrow Phase (Precise Collision) ===
-	// Use actual collision shapes for accurate overlap testing
-	TArray<FOverlapInfo> NewOverlaps;
-	const IBoundingVolume* MyShape = GetCollisionShape();
+// === Event Notification Helpers ===
 
-	for (UPrimitiveComponent* Candidate : Candidates)
+namespace
+{
+	/**
+	 * @brief 월드가 이벤트를 지연 중이면 월드 큐에 넣고, 아니면 바로 Broadcast
+	 * @param InOwner 델리게이트를 소유한 객체 (큐에 있는 동안 삭제되면 이벤트를 건너뜀)
+	 */
+	template<typename... Args, typename... CallArgs>
+	void BroadcastEvent(UWorld* InWorld, UObject* InOwner, TDelegate<Args...>& InDelegate, CallArgs&&... InArgs)
 	{
-		// Skip self
-		if (Candidate == this)
-			continue;
-
-		// Skip same actor components
-		if (Candidate->GetOwner() == MyOwner)
-			continue;
-
-		// Broad phase AABB rejection (per-primitive level)
-		// Note: Octree::QueryAABB() returns all primitives in overlapping nodes,
-		// so we need to test individual primitive AABBs here
-		FBounds CandidateBounds = Candidate->CalcBounds();
-		if (!MyBounds.Overlaps(CandidateBounds))
-			continue;
-
-		// Narrow phase: Precise shape-to-shape test
-		const IBoundingVolume* OtherShape = Candidate->GetCollisionShape();
-		if (FCollisionHelper::TestOverlap(MyShape, OtherShape))
+		if (!InDelegate.IsBound())
 		{
-			NewOverlaps.Add(FOverlapInfo(Candidate));
+			return;
 		}
-	}
-
-	// 5. Detect Begin Overlaps (in NewOverlaps but not in PreviousOverlaps)
-	// Optimize: Use unordered_set for O(1) lookup instead of O(N) linear search
-	std::unordered_set<FOverlapInfo> PreviousSet(PreviousOverlaps.begin(), PreviousOverlaps.end());
 
-	for (const FOverlapInfo& NewInfo : NewOverlaps)
-	{
-		// This is a new overlap - fire BeginOverlap event
-		if (PreviousSet.find(NewInfo) == PreviousSet.end() && NewInfo.IsValid())
+		if (InWorld && InWorld->IsDeferringEvents())
 		{
-			FHitResult HitResult;
-			HitResult.Actor = NewInfo.GetActor();
-			HitResult.Component = NewInfo.OverlapComponent.Get();
-			// Note: For simple overlap detection, we don't have detailed hit info
-			// In a physics engine with continuous collision detection, you'd fill this in
-
-			NotifyComponentBeginOverlap(NewInfo.OverlapComponent.Get(), HitResult);
+			InWorld->GetDeferredEventQueue().Enqueue(InOwner, InDelegate, std::forward<CallArgs>(InArgs)...);
 		}
-	}
-
-	// 6. Detect End Overlaps (in PreviousOverlaps but not in NewOverlaps)
-	// Optimize: Use unordered_set for O(1) lookup instead of O(N) linear search
-	std::unordered_set<FOverlapInfo> NewSet(NewOverlaps.begin(), NewOverlaps.end());
-
-	for (const FOverlapInfo& PrevInfo : PreviousOverlaps)
-	{
-		// Overlap ended - fire EndOverlap event
-		if (NewSet.find(PrevInfo) == NewSet.end() && PrevInfo.IsValid())
+		else
 		{
-			NotifyComponentEndOverlap(PrevInfo.OverlapComponent.Get());
+			InDelegate.Broadcast(std::forward<CallArgs>(InArgs)...);
 		}
 	}
-
-	// 7. Update overlap list
-	OverlappingComponents = NewOverlaps;
 }
 
-// === Event Notification Helpers ===
-
 void UPrimitiveComponent::NotifyComponentBeginOverlap(UPrimitiveComponent* OtherComp, const FHitResult& SweepResult)
 {
 	if (!OtherComp)
@@ -378,6 +409,7 @@ void UPrimitiveComponent::NotifyComponentBeginOverlap(UPrimitiveComponent* Other
 
 	AActor* MyOwner = GetOwner();
 	AActor* OtherOwner = OtherComp->GetOwner();
+	UWorld* World = GetTypedOuter<UWorld>();
 
 	// 1. Broadcast component-level events (bidirectional)
 	// Log and broadcast for THIS component
@@ -386,7 +418,7 @@ void UPrimitiveComponent::NotifyComponentBeginOverlap(UPrimitiveComponent* Other
 		GetName().ToString().c_str(),
 		OtherOwner ? OtherOwner->GetName().ToString().c_str() : "None",
 		OtherComp->GetName().ToString().c_str());
-	OnComponentBeginOverlap.Broadcast(this, OtherOwner, OtherComp, SweepResult);
+	BroadcastEvent(World, this, OnComponentBeginOverlap, this, OtherOwner, OtherComp, SweepResult);
 
 	// Log and broadcast for OTHER component
 	UE_LOG("BeginOverlap: [%s]%s overlaps with [%s]%s",
@@ -394,16 +426,16 @@ void UPrimitiveComponent::NotifyComponentBeginOverlap(UPrimitiveComponent* Other
 		OtherComp->GetName().ToString().c_str(),
 		MyOwner ? MyOwner->GetName().ToString().c_str() : "None",
 		GetName().ToString().c_str());
-	OtherComp->OnComponentBeginOverlap.Broadcast(OtherComp, MyOwner, this, SweepResult);
+	BroadcastEvent(World, OtherComp, OtherComp->OnComponentBeginOverlap, OtherComp, MyOwner, this, SweepResult);
 
 	// 2. Broadcast actor-level events (bidirectional)
 	if (MyOwner)
 	{
-		MyOwner->OnActorBeginOverlap.Broadcast(MyOwner, OtherOwner);
+		BroadcastEvent(World, MyOwner, MyOwner->OnActorBeginOverlap, MyOwner, OtherOwner);
 	}
 	if (OtherOwner)
 	{
-		OtherOwner->OnActorBeginOverlap.Broadcast(OtherOwner, MyOwner);
+		BroadcastEvent(World, OtherOwner, OtherOwner->OnActorBeginOverlap, OtherOwner, MyOwner);
 	}
 }
 
@@ -414,6 +446,7 @@ void UPrimitiveComponent::NotifyComponentEndOverlap(UPrimitiveComponent* OtherCo
 
 	AActor* MyOwner = GetOwner();
 	AActor* OtherOwner = OtherComp->GetOwner();
+	UWorld* World = GetTypedOuter<UWorld>();
 
 	// 1. Broadcast component-level events (bidirectional)
 	// Log and broadcast for THIS component
@@ -422,7 +455,7 @@ void UPrimitiveComponent::NotifyComponentEndOverlap(UPrimitiveComponent* OtherCo
 		GetName().ToString().c_str(),
 		OtherOwner ? OtherOwner->GetName().ToString().c_str() : "None",
 		OtherComp->GetName().ToString().c_str());
-	OnComponentEndOverlap.Broadcast(this, OtherOwner, OtherComp);
+	BroadcastEvent(World, this, OnComponentEndOverlap, this, OtherOwner, OtherComp);
 
 	// Log and broadcast for OTHER component
 	UE_LOG("EndOverlap: [%s]%s stopped overlapping with [%s]%s",
@@ -430,16 +463,16 @@ void UPrimitiveComponent::NotifyComponentEndOverlap(UPrimitiveComponent* OtherCo
 		OtherComp->GetName().ToString().c_str(),
 		MyOwner ? MyOwner->GetName().ToString().c_str() : "None",
 		GetName().ToString().c_str());
-	OtherComp->OnComponentEndOverlap.Broadcast(OtherComp, MyOwner, this);
+	BroadcastEvent(World, OtherComp, OtherComp->OnComponentEndOverlap, OtherComp, MyOwner, this);
 
 	// 2. Broadcast actor-level events (bidirectional)
 	if (MyOwner)
 	{
-		MyOwner->OnActorEndOverlap.Broadcast(MyOwner, OtherOwner);
+		BroadcastEvent(World, MyOwner, MyOwner->OnActorEndOverlap, MyOwner, OtherOwner);
 	}
 	if (OtherOwner)
 	{
-		OtherOwner->OnActorEndOverlap.Broadcast(OtherOwner, MyOwner);
+		BroadcastEvent(World, OtherOwner, OtherOwner->OnActorEndOverlap, OtherOwner, MyOwner);
 	}
 }
 
@@ -450,19 +483,20 @@ void UPrimitiveComponent::NotifyComponentHit(UPrimitiveComponent* OtherComp, con
 
 	AActor* MyOwner = GetOwner();
 	AActor* OtherOwner = OtherComp->GetOwner();
+	UWorld* World = GetTypedOuter<UWorld>();
 
 	// 1. Broadcast component-level events (bidirectional)
 	// Note: NormalImpulse is negated for the other component
-	OnComponentHit.Broadcast(this, OtherOwner, OtherComp, NormalImpulse, Hit);
-	OtherComp->OnComponentHit.Broadcast(OtherComp, MyOwner, this, -NormalImpulse, Hit);
+	BroadcastEvent(World, this, OnComponentHit, this, OtherOwner, OtherComp, NormalImpulse, Hit);
+	BroadcastEvent(World, OtherComp, OtherComp->OnComponentHit, OtherComp, MyOwner, this, -NormalImpulse, Hit);
 
 	// 2. Broadcast actor-level events (bidirectional)
 	if (MyOwner)
 	{
-		MyOwner->OnActorHit.Broadcast(MyOwner, OtherOwner, NormalImpulse, Hit);
+		BroadcastEvent(World, MyOwner, MyOwner->OnActorHit, MyOwner, OtherOwner, NormalImpulse, Hit);
 	}
 	if (OtherOwner)
 	{
-		OtherOwner->OnActorHit.Broadcast(OtherOwner, MyOwner, -NormalImpulse, Hit);
+		BroadcastEvent(World, OtherOwner, OtherOwner->OnActorHit, OtherOwner, MyOwner, -NormalImpulse, Hit);
 	}
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "Component/Public/ProjectileMovementComponent.h"
+#include "Level/Public/MovementBatchManager.h"
 #include "Render/UI/Widget/Public/ProjectileMovementComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
@@ -10,6 +11,14 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     Velocity = {1, 0, 0};
 }
 
+UProjectileMovementComponent::~UProjectileMovementComponent()
+{
+    // UActorComponent 소멸자에서는 이 클래스의 RegisterComponentTickFunctions가 불리지 않으므로 여기서 해제
+    if (MovementBatch)
+    {
+        MovementBatch->UnregisterComponent(this);
+    }
+}
 
 void UProjectileMovementComponent::BeginPlay()
 {
@@ -44,6 +53,26 @@ void UProjectileMovementComponent::TickComponent(float DeltaTime)
     MoveUpdatedComponent(Delta, NewRotation);
 }
 
+void UProjectileMovementComponent::RegisterComponentTickFunctions(bool bInRegister)
+{
+    if (bInRegister)
+    {
+        if (!ShouldRegisterTickFunctions())
+        {
+            return;
+        }
+
+        if (FMovementBatchManager* BatchManager = FindMovementBatchManager())
+        {
+            BatchManager->RegisterComponent(this);
+        }
+    }
+    else if (MovementBatch)
+    {
+        MovementBatch->UnregisterComponent(this);
+    }
+}
+
 void UProjectileMovementComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
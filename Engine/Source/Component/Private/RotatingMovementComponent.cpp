@@ -1,10 +1,27 @@
 ﻿#include "pch.h"
 #include "Component/Public/RotatingMovementComponent.h"
+#include "Level/Public/MovementBatchManager.h"
 #include "Render/UI/Widget/Public/RotatingMovementComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_CLASS(URotatingMovementComponent, UMovementComponent)
 
+URotatingMovementComponent::URotatingMovementComponent()
+{
+    // 건너뛴 프레임의 시간만큼 한 번에 회전하므로 카메라에서 먼 컴포넌트는 덜 자주 Tick해도 됨
+    // (일괄 이동에서도 이 Tick 함수의 설정으로 간격을 정함)
+    PrimaryComponentTick.bAllowSignificanceThrottling = true;
+}
+
+URotatingMovementComponent::~URotatingMovementComponent()
+{
+    // UActorComponent 소멸자에서는 이 클래스의 RegisterComponentTickFunctions가 불리지 않으므로 여기서 해제
+    if (MovementBatch)
+    {
+        MovementBatch->UnregisterComponent(this);
+    }
+}
+
 void URotatingMovementComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -27,6 +44,26 @@ void URotatingMovementComponent::TickComponent(float DeltaTime)
     MoveUpdatedComponent(DeltaLocation, NewRotation);
 }
 
+void URotatingMovementComponent::RegisterComponentTickFunctions(bool bInRegister)
+{
+    if (bInRegister)
+    {
+        if (!ShouldRegisterTickFunctions())
+        {
+            return;
+        }
+
+        if (FMovementBatchManager* BatchManager = FindMovementBatchManager())
+        {
+            BatchManager->RegisterComponent(this);
+        }
+    }
+    else if (MovementBatch)
+    {
+        MovementBatch->UnregisterComponent(this);
+    }
+}
+
 void URotatingMovementComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
@@ -218,6 +218,21 @@ void USceneComponent::SetWorldRotation(const FQuaternion& NewRotation)
 	}
 }
 
+void USceneComponent::SetWorldLocationAndRotation(const FVector& NewLocation, const FQuaternion& NewRotation)
+{
+	if (AttachParent)
+	{
+		RelativeLocation = AttachParent->GetWorldTransformMatrixInverse().TransformPosition(NewLocation);
+		RelativeRotation = NewRotation * AttachParent->GetWorldRotationAsQuaternion().Inverse();
+	}
+	else
+	{
+		RelativeLocation = NewLocation;
+		RelativeRotation = NewRotation;
+	}
+	MarkAsDirty();
+}
+
 void USceneComponent::SetWorldRotationPreservingChildren(const FVector& NewRotation)
 {
 	SetWorldRotationPreservingChildren(FQuaternion::FromEuler(NewRotation));
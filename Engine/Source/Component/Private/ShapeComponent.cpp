@@ -1,9 +1,197 @@
 #include "pch.h"
 #include "Component/Public/ShapeComponent.h"
+#include "Physics/Public/AABB.h"
+#include "Physics/Public/OBB.h"
+#include "Physics/Public/BoundingSphere.h"
+#include "Physics/Public/Capsule.h"
+#include "Global/SpatialQuery.h"
+#include <algorithm>
+#include <cmath>
 
 IMPLEMENT_ABSTRACT_CLASS(UShapeComponent, UPrimitiveComponent)
 
+namespace
+{
+	/** @brief 레이가 구에 들어가는 거리 (원점이 구 안이면 0), MaxDistance 안에서 만나지 않으면 false */
+	bool GetSphereEntryDistance(const FQueryRay& InRay, const FVector& InCenter, float InRadius, float& OutDistance)
+	{
+		const FVector M = InRay.Origin - InCenter;
+		const float C = M.Dot(M) - InRadius * InRadius;
+		if (C <= 0.0f)
+		{
+			OutDistance = 0.0f;
+			return true;
+		}
+
+		const float A = InRay.Direction.Dot(InRay.Direction);
+		const float B = M.Dot(InRay.Direction);
+		const float Discriminant = B * B - A * C;
+		if (B > 0.0f || Discriminant < 0.0f || A <= 0.0f)
+		{
+			return false;
+		}
+
+		OutDistance = (-B - std::sqrt(Discriminant)) / A;
+		return OutDistance <= InRay.MaxDistance;
+	}
+
+	FVector GetClosestPointOnSegment(const FVector& InPoint, const FVector& InStart, const FVector& InEnd)
+	{
+		const FVector Segment = InEnd - InStart;
+		const float SegmentLengthSquared = Segment.Dot(Segment);
+		if (SegmentLengthSquared <= 0.0f)
+		{
+			return InStart;
+		}
+
+		const float T = std::clamp((InPoint - InStart).Dot(Segment) / SegmentLengthSquared, 0.0f, 1.0f);
+		return InStart + Segment * T;
+	}
+
+	/** @brief 레이가 캡슐(선분 InStart-InEnd에서 InRadius 이내)에 들어가는 거리, 몸통 원기둥과 양 끝 반구 중 가장 가까운 교차 */
+	bool GetCapsuleEntryDistance(const FQueryRay& InRay, const FVector& InStart, const FVector& InEnd, float InRadius, float& OutDistance)
+	{
+		const FVector ClosestPoint = GetClosestPointOnSegment(InRay.Origin, InStart, InEnd);
+		if ((InRay.Origin - ClosestPoint).LengthSquared() <= InRadius * InRadius)
+		{
+			OutDistance = 0.0f;
+			return true;
+		}
+
+		bool bHit = false;
+		OutDistance = InRay.MaxDistance;
+
+		// 몸통: 축에 수직인 성분의 길이가 InRadius가 되는 T (축 방향 위치가 선분 안일 때만)
+		const FVector Axis = InEnd - InStart;
+		const FVector Offset = InRay.Origin - InStart;
+		const float AxisDotAxis = Axis.Dot(Axis);
+		const float AxisDotDirection = Axis.Dot(InRay.Direction);
+		const float AxisDotOffset = Axis.Dot(Offset);
+		const float A = AxisDotAxis * InRay.Direction.Dot(InRay.Direction) - AxisDotDirection * AxisDotDirection;
+		if (A > 1e-8f)
+		{
+			const float B = AxisDotAxis * Offset.Dot(InRay.Direction) - AxisDotOffset * AxisDotDirection;
+			const float C = AxisDotAxis * (Offset.Dot(Offset) - InRadius * InRadius) - AxisDotOffset * AxisDotOffset;
+			const float Discriminant = B * B - A * C;
+			if (Discriminant >= 0.0f)
+			{
+				const float T = (-B - std::sqrt(Discriminant)) / A;
+				const float AxisPosition = AxisDotOffset + T * AxisDotDirection;
+				if (T >= 0.0f && T <= OutDistance && AxisPosition > 0.0f && AxisPosition < AxisDotAxis)
+				{
+					OutDistance = T;
+					bHit = true;
+				}
+			}
+		}
+
+		// 양 끝 반구 (원점이 캡슐 밖이므로 두 구 모두 밖에서 들어감)
+		float SphereDistance;
+		if (GetSphereEntryDistance(InRay, InStart, InRadius, SphereDistance) && SphereDistance <= OutDistance)
+		{
+			OutDistance = SphereDistance;
+			bHit = true;
+		}
+		if (GetSphereEntryDistance(InRay, InEnd, InRadius, SphereDistance) && SphereDistance <= OutDistance)
+		{
+			OutDistance = SphereDistance;
+			bHit = true;
+		}
+		return bHit;
+	}
+}
+
 UShapeComponent::UShapeComponent()
 {
 	bCanEverTick = false;
 }
+
+bool UShapeComponent::LineTraceComponent(const FQueryRay& InRay, FHitResult& OutHit)
+{
+	const IBoundingVolume* Shape = GetCollisionShape();
+	if (!Shape)
+	{
+		return false;
+	}
+
+	// 반지름과 높이는 로컬 값이므로 CalcBounds / RenderDebugShape와 같은 규칙으로 스케일을 적용
+	const FVector Scale = GetWorldScale3D();
+	float Distance = 0.0f;
+	FVector Normal;
+
+	switch (Shape->GetType())
+	{
+	case EBoundingVolumeType::Sphere:
+	{
+		const FBoundingSphere* Sphere = static_cast<const FBoundingSphere*>(Shape);
+		const float Radius = Sphere->Radius * std::max(std::max(Scale.X, Scale.Y), Scale.Z);
+		if (!GetSphereEntryDistance(InRay, Sphere->Center, Radius, Distance))
+		{
+			return false;
+		}
+		Normal = InRay.Origin + InRay.Direction * Distance - Sphere->Center;
+		break;
+	}
+	case EBoundingVolumeType::Capsule:
+	{
+		const FCapsule* Capsule = static_cast<const FCapsule*>(Shape);
+		const float Radius = Capsule->Radius * std::max(Scale.X, Scale.Y);
+		const FVector HalfAxis = Capsule->Rotation.RotateVector(FVector(0.0f, 0.0f, 1.0f)) * (Capsule->HalfHeight * Scale.Z);
+		const FVector Start = Capsule->Center - HalfAxis;
+		const FVector End = Capsule->Center + HalfAxis;
+		if (!GetCapsuleEntryDistance(InRay, Start, End, Radius, Distance))
+		{
+			return false;
+		}
+		const FVector HitLocation = InRay.Origin + InRay.Direction * Distance;
+		Normal = HitLocation - GetClosestPointOnSegment(HitLocation, Start, End);
+		break;
+	}
+	case EBoundingVolumeType::OBB:
+	{
+		// ScaleRotation의 역으로 상자 공간에 옮기면 축 정렬 상자와의 슬랩 검사가 되고, 방향을 정규화하지 않으므로 거리는 그대로
+		const FOBB* Box = static_cast<const FOBB*>(Shape);
+		const FMatrix BoxInverse = Box->ScaleRotation.Inverse();
+		const FQueryRay BoxRay(BoxInverse.TransformVector(InRay.Origin - Box->Center), BoxInverse.TransformVector(InRay.Direction), InRay.MaxDistance);
+		if (!BoxRay.GetEntryDistance(FAABB(-Box->Extents, Box->Extents), Distance))
+		{
+			return false;
+		}
+
+		// 들어간 면은 상자 공간에서 크기 대비 가장 바깥에 있는 축, 월드 법선은 역행렬의 전치로 옮김
+		const FVector BoxHit = BoxRay.Origin + BoxRay.Direction * Distance;
+		const float* HitAxes = &BoxHit.X;
+		const float* ExtentAxes = &Box->Extents.X;
+		int32 FaceAxis = 0;
+		float FaceRatio = -1.0f;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float Ratio = ExtentAxes[Axis] > 0.0f ? std::fabs(HitAxes[Axis]) / ExtentAxes[Axis] : 1.0f;
+			if (Ratio > FaceRatio)
+			{
+				FaceRatio = Ratio;
+				FaceAxis = Axis;
+			}
+		}
+		const float FaceSign = HitAxes[FaceAxis] < 0.0f ? -1.0f : 1.0f;
+		Normal = FVector(BoxInverse.Data[0][FaceAxis], BoxInverse.Data[1][FaceAxis], BoxInverse.Data[2][FaceAxis]) * FaceSign;
+		break;
+	}
+	default:
+		return Super::LineTraceComponent(InRay, OutHit);
+	}
+
+	// 원점이 모양 안에 있으면 거리 0에서 막히고 법선은 레이의 반대 방향
+	if (Distance <= 0.0f || Normal.LengthSquared() <= 0.0f)
+	{
+		Normal = -InRay.Direction;
+	}
+	Normal.Normalize();
+
+	OutHit = FHitResult(InRay.Origin + InRay.Direction * Distance, Normal);
+	OutHit.Distance = Distance;
+	OutHit.Actor = GetOwner();
+	OutHit.Component = this;
+	OutHit.bBlockingHit = true;
+	return true;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Level/Public/TickTaskManager.h"
 
 class AActor;
 class UWidget;
@@ -35,9 +36,22 @@ public:
 	AActor* GetOwner() const { return Owner; }
 
 	bool CanEverTick() const { return bCanEverTick; }
-	void SetCanEverTick(bool InbCanEverTick) { bCanEverTick = InbCanEverTick; }
+	void SetCanEverTick(bool InbCanEverTick);
+
+	/**
+	 * @brief 소유 액터가 속한 World의 FTickTaskManager에 Tick 함수 등록 / 해제
+	 * Tick하지 않는 컴포넌트(bCanEverTick == false)나 Tick하지 않는 액터의 컴포넌트는 등록하지 않는다
+	 * @note 다른 방식으로 갱신되는 컴포넌트(일괄 이동 등)는 재정의해서 자신의 시스템에 등록할 것
+	 */
+	virtual void RegisterComponentTickFunctions(bool bInRegister);
+
+	/** @brief 컴포넌트의 Tick 함수 (TickGroup, bRunOnAnyThread, 선행 조건 설정용) */
+	FActorComponentTickFunction PrimaryComponentTick;
 
 protected:
+	/** @brief 컴포넌트와 소유 액터가 모두 Tick할 수 있을 때만 true (RegisterComponentTickFunctions 재정의에서도 사용) */
+	bool ShouldRegisterTickFunctions() const;
+
 	bool bCanEverTick = false;
 
 private:
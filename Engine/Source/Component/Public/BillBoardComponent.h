@@ -17,6 +17,9 @@ public:
 
 	void FaceCamera(const FVector& CameraForward);
 
+	// Sprites only face the camera and have no collision geometry, so line traces pass through them
+	bool LineTraceComponent(const FQueryRay& InRay, FHitResult& OutHit) override { return false; }
+
 	UTexture* GetSprite() const;
 	void SetSprite(UTexture* Sprite);
 
@@ -3,6 +3,7 @@
 
 class USceneComponent;
 class UPrimitiveComponent;
+class FMovementBatchManager;
 
 class UMovementComponent : public UActorComponent
 {
@@ -15,11 +16,23 @@ public:
     virtual void BeginPlay() override;
     void SetUpdatedComponent(USceneComponent* NewUpdatedComponent);
     void MoveUpdatedComponent(const FVector& Delta, const FQuaternion& NewRotation);
+    USceneComponent* GetUpdatedComponent() const { return UpdatedComponent; }
     
 protected:
     USceneComponent* UpdatedComponent = nullptr;
     UPrimitiveComponent* UpdatedPrimitive = nullptr;
 
+// Movement Batch Section
+protected:
+    friend class FMovementBatchManager;
+
+    /** @brief 소유 액터가 속한 World의 일괄 이동 시스템 (World가 없으면 nullptr) */
+    FMovementBatchManager* FindMovementBatchManager() const;
+
+    /** @brief 등록된 일괄 이동 시스템과 그 안에서의 위치 (-1이면 등록되지 않음) */
+    FMovementBatchManager* MovementBatch = nullptr;
+    int32 MovementBatchIndex = -1;
+
 // Velocity Section
 public:
     const FVector& GetVelocity() const { return Velocity; }
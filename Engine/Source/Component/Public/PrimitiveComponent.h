@@ -5,6 +5,8 @@
 #include "Core/Public/Delegate.h"
 #include "Physics/Public/HitResult.h"
 
+struct FQueryRay;
+
 // Component-level overlap event signatures
 DECLARE_DELEGATE(FComponentBeginOverlapSignature,
 	UPrimitiveComponent*, /* OverlappedComponent */
@@ -76,6 +78,14 @@ public:
 	virtual const IBoundingVolume* GetBoundingBox();
 	void GetWorldAABB(FVector& OutMin, FVector& OutMax);
 
+	// Line trace: closest hit of a world-space ray within InRay.MaxDistance (narrow phase of ULevel::LineTraceSingle / Multi)
+	// Default tests every triangle of Vertices / Indices; static meshes override this with their BVH, shapes with their collision shape
+	virtual bool LineTraceComponent(const FQueryRay& InRay, FHitResult& OutHit);
+
+	// Line trace of several rays at once (narrow phase of ULevel::LineTraceBatch); OutHits[i].bBlockingHit is false for rays that miss
+	// Default traces the rays one at a time
+	virtual int32 LineTraceComponentPacket(const FQueryRay* InRays, int32 InNumRays, FHitResult* OutHits);
+
 	// === Collision Event Delegates ===
 	// Public so users can bind to these events
 	FComponentBeginOverlapSignature OnComponentBeginOverlap;
@@ -87,9 +97,6 @@ public:
 	bool IsOverlappingComponent(const UPrimitiveComponent* OtherComp) const;
 	bool IsOverlappingActor(const AActor* OtherActor) const;
 
-	// Update overlaps (called by Level or when component moves)
-	void UpdateOverlaps();
-
 	virtual void MarkAsDirty() override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 	// 데칼에 덮일 수 있는가
@@ -124,9 +131,13 @@ protected:
 	mutable FVector CachedWorldMax;
 	mutable bool bIsAABBCacheDirty = true;
 
-	// Overlap tracking
+	// Overlap tracking (kept in sync with ULevel's overlap pair cache by its per-frame overlap phase)
 	TArray<FOverlapInfo> OverlappingComponents;
 
+	// 레벨의 동적 AABB 트리에서의 프록시 번호 (-1이면 정적 Octree에 있음, ULevel이 관리)
+	friend class ULevel;
+	int32 DynamicTreeProxyId = -1;
+
 	// === Event Notification Helpers ===
 	void NotifyComponentBeginOverlap(UPrimitiveComponent* OtherComp, const FHitResult& SweepResult);
 	void NotifyComponentEndOverlap(UPrimitiveComponent* OtherComp);
@@ -7,9 +7,16 @@ class UProjectileMovementComponent : public UMovementComponent
 
 public:
     UProjectileMovementComponent();
+    ~UProjectileMovementComponent() override;
     virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime) override;
 
+    /**
+     * @brief 컴포넌트별 Tick 대신 World의 FMovementBatchManager에 등록 / 해제
+     * 등록된 동안에는 TickComponent가 호출되지 않고 일괄 이동에서 같은 계산으로 움직인다
+     */
+    void RegisterComponentTickFunctions(bool bInRegister) override;
+
     float GetInitialSpeed() const { return InitialSpeed; }
     void SetInitialSpeed(float Speed) { InitialSpeed = Speed; }
     float GetMaxSpeed() const { return MaxSpeed; }
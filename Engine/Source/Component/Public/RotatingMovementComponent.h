@@ -6,7 +6,17 @@ class URotatingMovementComponent : public UMovementComponent
 	DECLARE_CLASS(URotatingMovementComponent, UMovementComponent)
 	
 public:
+	URotatingMovementComponent();
+	~URotatingMovementComponent() override;
+
 	virtual void TickComponent(float DeltaTime) override;
+
+	/**
+	 * @brief 컴포넌트별 Tick 대신 World의 FMovementBatchManager에 등록 / 해제
+	 * 등록된 동안에는 TickComponent가 호출되지 않고 일괄 이동에서 같은 계산으로 움직인다
+	 * PrimaryComponentTick의 TickInterval과 bAllowSignificanceThrottling은 일괄 이동에서도 그대로 적용된다
+	 */
+	void RegisterComponentTickFunctions(bool bInRegister) override;
 	
 	FVector RotationRate;
 	FVector PivotTranslation;
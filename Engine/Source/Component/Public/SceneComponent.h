@@ -41,6 +41,8 @@ public:
     void SetWorldLocation(const FVector& NewLocation);
     void SetWorldRotation(const FVector& NewRotation);
     void SetWorldRotation(const FQuaternion& NewRotation);
+    /** @brief 위치와 회전을 함께 바꾸고 MarkAsDirty는 한 번만 호출 */
+    void SetWorldLocationAndRotation(const FVector& NewLocation, const FQuaternion& NewRotation);
     void SetWorldRotationPreservingChildren(const FVector& NewRotation);
     void SetWorldRotationPreservingChildren(const FQuaternion& NewRotation);
     void SetRelativeRotationPreservingChildren(const FQuaternion& NewRotation);
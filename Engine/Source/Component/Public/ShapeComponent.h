@@ -16,4 +16,7 @@ public:
 
 	// Render debug visualization for this shape in world space
 	virtual void RenderDebugShape(UBatchLines& BatchLines) = 0;
+
+	// Line trace against the collision shape (sphere / box / capsule) instead of triangles
+	bool LineTraceComponent(const FQueryRay& InRay, FHitResult& OutHit) override;
 };
@@ -60,41 +60,44 @@ TArray<UClass*>& UClass::GetAllClasses()
  */
 UClass::UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract)
 	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor), bIsAbstract(InIsAbstract)
+	, ClassDepth(InSuperClass ? InSuperClass->ClassDepth + 1 : 0), Ancestors{}
 {
-	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToString().data());
-}
-
-/**
- * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
- * @param InClass 확인할 클래스
- * @return 하위 클래스이거나 같은 클래스면 true
- */
-bool UClass::IsChildOf(UClass* InClass) const
-{
-	if (!InClass)
+	// 테이블보다 깊은 클래스도 앞쪽 조상은 테이블에 두고, 그보다 깊은 조상과의 비교만 부모 체인을 따라감
+	const uint32 NumTableAncestors = ClassDepth < MaxClassDepth ? ClassDepth : MaxClassDepth;
+	for (uint32 Depth = 0; Depth < NumTableAncestors; ++Depth)
 	{
-		return false;
+		Ancestors[Depth] = SuperClass->Ancestors[Depth];
 	}
-
-	// 자기 자신과 같은 클래스인 경우
-	if (this == InClass)
+	if (ClassDepth < MaxClassDepth)
 	{
-		return true;
+		Ancestors[ClassDepth] = this;
 	}
-
-	// 부모 클래스들을 거슬러 올라가면서 확인
-	const UClass* CurrentClass = this;
-	while (CurrentClass)
+	else
 	{
-		if (CurrentClass->ClassName == InClass->ClassName)
-		{
-			return true;
-		}
+		UE_LOG_WARNING("UClass: %s의 상속 깊이 %u가 조상 테이블 크기(%u) 이상이라 일부 IsA가 부모 체인을 따라갑니다",
+			ClassName.ToString().data(), ClassDepth, MaxClassDepth);
+	}
 
-		CurrentClass = CurrentClass->SuperClass;
+	// 부모 클래스는 인자로 StaticClass()가 먼저 평가되어 이미 생성되어 있으므로, 조상마다 하위 클래스 목록에 자신을 추가
+	for (UClass* Class = this; Class; Class = Class->SuperClass)
+	{
+		Class->DerivedClasses.Add(this);
 	}
 
-	return false;
+	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToString().data());
+
+	// StaticClass()의 정적 지역 변수로 한 번만 생성되므로 등록도 생성 시점에 한 번만 수행
+	SignUpClass(this);
+}
+
+bool UClass::IsChildOfDeepClass(const UClass* InClass) const
+{
+	const UClass* Class = this;
+	for (uint32 Depth = ClassDepth; Depth > InClass->ClassDepth; --Depth)
+	{
+		Class = Class->SuperClass;
+	}
+	return Class == InClass;
 }
 
 /**
@@ -16,6 +16,8 @@
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 #include "Manager/UI/Public/ViewportManager.h"
+#include "Runtime/Core/Public/Memory/MemStack.h"
+#include "Runtime/Core/Public/Async/TaskGraph.h"
 
 #ifdef IS_OBJ_VIEWER
 #include "Utility/Public/FileDialog.h"
@@ -88,7 +90,14 @@ int FClientApp::InitializeSystem() const
 	UInputManager::GetInstance();
 	
 	auto& Renderer = URenderer::GetInstance();
-	Renderer.Init(Window->GetWindowHandle());
+	{
+		LLM_SCOPE(Renderer);
+		Renderer.Init(Window->GetWindowHandle());
+	}
+
+	// 워커 스레드 생성 (이 스레드가 게임 스레드가 됨)
+	// 에셋 로드 중 메시 BVH를 워커에서 나누어 구축하므로 AssetManager보다 먼저 생성
+	FTaskGraph::Get().Initialize();
 
 	UAssetManager::GetInstance().Initialize();
 
@@ -103,9 +112,13 @@ int FClientApp::InitializeSystem() const
 	GEditor = NewObject<UEditorEngine>();  // UEditor 생성자가 ViewportManager::GetClients()를 사용
 	
 	// UIManager Initialize
-	auto& UIManager = UUIManager::GetInstance();
-	UIManager.Initialize(Window->GetWindowHandle());
-	UUIWindowFactory::CreateDefaultUILayout();
+	{
+		LLM_SCOPE(UI);
+		auto& UIManager = UUIManager::GetInstance();
+		UIManager.Initialize(Window->GetWindowHandle());
+		UUIWindowFactory::CreateDefaultUILayout();
+	}
+
 	return S_OK;
 }
 
@@ -118,10 +131,16 @@ void FClientApp::UpdateSystem() const
 	auto& InputManager = UInputManager::GetInstance();
 	auto& UIManager = UUIManager::GetInstance();
 	auto& Renderer = URenderer::GetInstance();
+	FMemStack& FrameMemStack = FMemStack::Get();
+	FrameMemStack.BeginFrame();
 	{
 		TIME_PROFILE(TimeManager)
 		TimeManager.Update();
 	}
+	{
+		TIME_PROFILE(TaskGraph)
+		FTaskGraph::Get().ProcessGameThreadTasks();
+	}
 	{
 		TIME_PROFILE(InputManager)
 		InputManager.Update(Window);
@@ -132,17 +151,22 @@ void FClientApp::UpdateSystem() const
 	}
 	{
 		TIME_PROFILE(GEditor)
+		LLM_SCOPE(Editor);
 		GEditor->Tick(DT);
 	}
 	{
 		TIME_PROFILE(UIManager)
+		LLM_SCOPE(UI);
 		UIManager.Update();
 	}	
 	{
 		TIME_PROFILE(Renderer)
+		LLM_SCOPE(Renderer);
 		Renderer.Update();
 	}
 	UInputManager::GetInstance().ClearMouseWheelDelta();
+	FrameMemStack.EndFrame();
+	FLowLevelMemTracker::EndFrame();
 }
 
 /**
@@ -198,6 +222,9 @@ void FClientApp::MainLoop()
  */
 void FClientApp::ShutdownSystem() const
 {
+	// 태스크가 참조할 수 있는 시스템을 정리하기 전에 남은 태스크를 모두 처리하고 워커 종료
+	FTaskGraph::Get().Shutdown();
+
 	delete GEditor;
 	delete Window;
 	
@@ -0,0 +1,88 @@
+#include "pch.h"
+#include "Core/Public/Delegate.h"
+
+FDeferredEventQueue::~FDeferredEventQueue()
+{
+	ResetEvents();
+
+	for (uint8* Block : Blocks)
+	{
+		delete[] Block;
+	}
+	Blocks.Empty();
+}
+
+void FDeferredEventQueue::Dispatch()
+{
+	// 핸들러 안에서 다시 Dispatch를 호출하면 바깥 Dispatch가 이어서 처리
+	if (bIsDispatching)
+	{
+		return;
+	}
+
+	bIsDispatching = true;
+
+	// 실행 중 Enqueue로 배열이 재할당될 수 있으므로 참조 대신 인덱스로 순회
+	for (int32 Index = 0; Index < Events.Num(); ++Index)
+	{
+		const FQueuedEvent Event = Events[Index];
+		if (Event.bHasOwner && !Event.Owner.IsValid())
+		{
+			continue;
+		}
+
+		Event.Dispatch(Event.Payload);
+	}
+
+	ResetEvents();
+	bIsDispatching = false;
+}
+
+void FDeferredEventQueue::Clear()
+{
+	// Dispatch 도중에는 남은 이벤트만 건너뛰도록 Dispatch의 정리에 맡김
+	if (bIsDispatching)
+	{
+		for (FQueuedEvent& Event : Events)
+		{
+			Event.bHasOwner = true;
+			Event.Owner = nullptr;
+		}
+		return;
+	}
+
+	ResetEvents();
+}
+
+void* FDeferredEventQueue::AllocatePayload(size_t InSize, size_t InAlignment)
+{
+	size_t AlignedOffset = (BlockOffset + InAlignment - 1) & ~(InAlignment - 1);
+	if (CurrentBlock >= Blocks.Num() || AlignedOffset + InSize > BlockSize)
+	{
+		if (CurrentBlock < Blocks.Num())
+		{
+			++CurrentBlock;
+		}
+
+		if (CurrentBlock == Blocks.Num())
+		{
+			Blocks.Add(new uint8[BlockSize]);
+		}
+		AlignedOffset = 0;
+	}
+
+	BlockOffset = AlignedOffset + InSize;
+	return Blocks[CurrentBlock] + AlignedOffset;
+}
+
+void FDeferredEventQueue::ResetEvents()
+{
+	for (FQueuedEvent& Event : Events)
+	{
+		Event.Destroy(Event.Payload);
+	}
+	Events.Empty();
+
+	CurrentBlock = 0;
+	BlockOffset = 0;
+}
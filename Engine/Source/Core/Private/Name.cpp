@@ -1,7 +1,6 @@
 #include "pch.h"
 #include "Core/Public/Name.h"
-#include <algorithm> // for std::transform
-#include <cctype>    // for std::tolower
+#include <shared_mutex>
 
 FName::FName()
     : ComparisonIndex(0),
@@ -18,8 +17,13 @@ FName::FName(const FString& Str)
     Number = -1;
 }
 
-FName::FName(const char* Str) : FName(FString(Str))
+FName::FName(const char* Str)
 {
+    // 임시 FString 없이 바로 테이블 탐색
+    TPair<int32, int32> Indices = FNameTable::GetInstance().FindOrAddName(Str, strlen(Str));
+    ComparisonIndex = Indices.first;
+    DisplayIndex = Indices.second;
+    Number = -1;
 }
 
 /**
@@ -81,18 +85,266 @@ FName FName::GetNone()
 const FName FName::None(0, 0, -1);
 
 // FNameTable
+namespace
+{
+    constexpr int32 NameIndexNone = -1;
+
+    /** @brief 아레나 블록 크기 (이보다 긴 문자열은 전용 블록을 사용) */
+    constexpr size_t NameArenaBlockSize = 64 * 1024;
+
+    char ToLowerAscii(char C)
+    {
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C + ('a' - 'A')) : C;
+    }
+
+    constexpr uint64 RepeatByte(uint8 InByte)
+    {
+        return 0x0101010101010101ull * InByte;
+    }
+
+    /**
+     * @brief 8바이트 안의 ASCII 대문자를 한 번에 소문자로 변환 (SWAR)
+     * 'A' 이상이면서 'Z' 이하인 바이트의 최상위 비트를 구한 뒤 0x20 자리로 내려 OR 한다 (ASCII가 아닌 바이트는 그대로)
+     */
+    uint64 ToLowerAscii8(uint64 InWord)
+    {
+        const uint64 Heptets = InWord & RepeatByte(0x7f);
+        const uint64 AtLeastA = Heptets + RepeatByte(0x80 - 'A');
+        const uint64 AboveZ = Heptets + RepeatByte(0x80 - 'Z' - 1);
+        const uint64 IsUpper = AtLeastA & ~AboveZ & ~InWord & RepeatByte(0x80);
+        return InWord | (IsUpper >> 2);
+    }
+
+    uint64 MixNameWord(uint64 InHash, uint64 InWord)
+    {
+        InHash ^= InWord * 0x87c37b91114253d5ull;
+        InHash = (InHash << 31) | (InHash >> 33);
+        return InHash * 0x4cf5ad432745937full;
+    }
+
+    uint32 FinalizeNameHash(uint64 InHash, size_t InLength)
+    {
+        // 샤드 선택에 상위 비트를 쓰므로 끝에서 전체 비트를 섞는다 (murmur3 fmix64)
+        InHash ^= static_cast<uint64>(InLength);
+        InHash ^= InHash >> 33;
+        InHash *= 0xff51afd7ed558ccdull;
+        InHash ^= InHash >> 33;
+        InHash *= 0xc4ceb9fe1a85ec53ull;
+        InHash ^= InHash >> 33;
+        return static_cast<uint32>(InHash);
+    }
+
+    /**
+     * @brief 대소문자 구분 / 무시 해시를 문자열을 복사하지 않고 한 번에 계산
+     * 8바이트 단위로 읽으며, 대소문자 무시 해시는 같은 워드를 ToLowerAscii8로 변환해 섞는다
+     */
+    void HashName(const char* InString, size_t InLength, uint32& OutDisplayHash, uint32& OutComparisonHash)
+    {
+        uint64 DisplayHash = 0;
+        uint64 ComparisonHash = 0;
+
+        size_t Offset = 0;
+        for (; Offset + sizeof(uint64) <= InLength; Offset += sizeof(uint64))
+        {
+            uint64 Word;
+            memcpy(&Word, InString + Offset, sizeof(uint64));
+            DisplayHash = MixNameWord(DisplayHash, Word);
+            ComparisonHash = MixNameWord(ComparisonHash, ToLowerAscii8(Word));
+        }
+
+        if (Offset < InLength)
+        {
+            uint64 Word = 0;
+            memcpy(&Word, InString + Offset, InLength - Offset);
+            DisplayHash = MixNameWord(DisplayHash, Word);
+            ComparisonHash = MixNameWord(ComparisonHash, ToLowerAscii8(Word));
+        }
+
+        OutDisplayHash = FinalizeNameHash(DisplayHash, InLength);
+        OutComparisonHash = FinalizeNameHash(ComparisonHash, InLength);
+    }
+}
+
 /**
-* @brief FString 객체를 받아 풀에 없으면 반환
-* @param Str FName으로 등록되었는지 확인할 FString
-* @return DisplayIndex, ComparisonIndex
-*/
+ * @brief 아레나에 저장되는 이름 엔트리. 문자열(널 종료)이 구조체 바로 뒤에 이어진다
+ */
+struct FNameTable::FNameEntry
+{
+    std::atomic<int32> NextNumber{0};
+    int32 ComparisonIndex = 0;
+    uint32 Length = 0;
+
+    const char* GetString() const { return reinterpret_cast<const char*>(this + 1); }
+    char* GetString() { return reinterpret_cast<char*>(this + 1); }
+
+    bool Equals(const char* InString, size_t InLength) const
+    {
+        return Length == InLength && memcmp(GetString(), InString, InLength) == 0;
+    }
+
+    bool EqualsIgnoreCase(const char* InString, size_t InLength) const
+    {
+        if (Length != InLength)
+        {
+            return false;
+        }
+
+        const char* String = GetString();
+        for (size_t Index = 0; Index < InLength; ++Index)
+        {
+            if (ToLowerAscii(String[Index]) != ToLowerAscii(InString[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief 해시 상위 비트로 나눈 이름 테이블 조각 (stripe)
+ * 선형 탐사 해시 테이블과, 이 샤드에서 만든 엔트리를 담는 문자열 아레나를 가진다
+ */
+struct FNameTable::FNameShard
+{
+    // 탐사 중 엔트리 포인터 청크를 거치지 않도록 엔트리 포인터도 함께 저장
+    struct FSlot
+    {
+        uint32 Hash;
+        int32 Index;
+        const FNameEntry* Entry;
+    };
+
+    mutable std::shared_mutex Lock;
+
+    FSlot* Slots = nullptr;
+    uint32 Capacity = 0;
+    uint32 NumSlotsUsed = 0;
+
+    uint8* ArenaTop = nullptr;
+    uint8* ArenaEnd = nullptr;
+    TArray<uint8*> ArenaBlocks;
+
+    ~FNameShard()
+    {
+        delete[] Slots;
+        for (uint8* Block : ArenaBlocks)
+        {
+            ::operator delete(Block);
+        }
+    }
+
+    /** @return 찾은 슬롯 (없으면 nullptr) */
+    template<typename PredicateType>
+    const FSlot* Find(uint32 InHash, const PredicateType& InPredicate) const
+    {
+        if (Capacity == 0)
+        {
+            return nullptr;
+        }
+
+        for (uint32 SlotIndex = InHash & (Capacity - 1); ; SlotIndex = (SlotIndex + 1) & (Capacity - 1))
+        {
+            const FSlot& Slot = Slots[SlotIndex];
+            if (Slot.Index == NameIndexNone)
+            {
+                return nullptr;
+            }
+            if (Slot.Hash == InHash && InPredicate(*Slot.Entry))
+            {
+                return &Slot;
+            }
+        }
+    }
+
+    void Insert(uint32 InHash, int32 InIndex, const FNameEntry* InEntry)
+    {
+        // 부하율 50%를 넘기 전에 두 배로 확장
+        if ((NumSlotsUsed + 1) * 2 > Capacity)
+        {
+            Grow(Capacity ? Capacity * 2 : 256);
+        }
+
+        InsertNoGrow({ InHash, InIndex, InEntry });
+        ++NumSlotsUsed;
+    }
+
+    void* AllocateFromArena(size_t InSize)
+    {
+        InSize = (InSize + alignof(FNameEntry) - 1) & ~(alignof(FNameEntry) - 1);
+        if (ArenaTop == nullptr || static_cast<size_t>(ArenaEnd - ArenaTop) < InSize)
+        {
+            const size_t BlockSize = InSize > NameArenaBlockSize ? InSize : NameArenaBlockSize;
+            ArenaTop = static_cast<uint8*>(::operator new(BlockSize));
+            ArenaEnd = ArenaTop + BlockSize;
+            ArenaBlocks.Add(ArenaTop);
+        }
+
+        void* Result = ArenaTop;
+        ArenaTop += InSize;
+        return Result;
+    }
+
+private:
+    void InsertNoGrow(const FSlot& InSlot)
+    {
+        uint32 SlotIndex = InSlot.Hash & (Capacity - 1);
+        while (Slots[SlotIndex].Index != NameIndexNone)
+        {
+            SlotIndex = (SlotIndex + 1) & (Capacity - 1);
+        }
+        Slots[SlotIndex] = InSlot;
+    }
+
+    void Grow(uint32 InNewCapacity)
+    {
+        FSlot* OldSlots = Slots;
+        const uint32 OldCapacity = Capacity;
+
+        Slots = new FSlot[InNewCapacity];
+        Capacity = InNewCapacity;
+        for (uint32 SlotIndex = 0; SlotIndex < Capacity; ++SlotIndex)
+        {
+            Slots[SlotIndex] = { 0, NameIndexNone, nullptr };
+        }
+
+        for (uint32 SlotIndex = 0; SlotIndex < OldCapacity; ++SlotIndex)
+        {
+            if (OldSlots[SlotIndex].Index != NameIndexNone)
+            {
+                InsertNoGrow(OldSlots[SlotIndex]);
+            }
+        }
+        delete[] OldSlots;
+    }
+};
+
 FNameTable::FNameTable()
+    : DisplayShards(new FNameShard[NumShards])
+    , ComparisonShards(new FNameShard[NumShards])
+    , NumEntries(0)
 {
-    ComparisonMap["None"] = 0;
-    DisplayMap["None"] = 0;
+    for (std::atomic<std::atomic<FNameEntry*>*>& Chunk : EntryChunks)
+    {
+        Chunk.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // 인덱스 0은 None으로 예약
+    FindOrAddName("None", 4);
 }
 
-FNameTable::~FNameTable() = default;
+FNameTable::~FNameTable()
+{
+    for (std::atomic<std::atomic<FNameEntry*>*>& Chunk : EntryChunks)
+    {
+        delete[] Chunk.exchange(nullptr, std::memory_order_relaxed);
+    }
+    NumEntries.store(0, std::memory_order_relaxed);
+
+    // 엔트리 메모리는 샤드의 아레나가 함께 해제
+    delete[] DisplayShards;
+    delete[] ComparisonShards;
+}
 
 FNameTable& FNameTable::GetInstance()
 {
@@ -100,36 +352,66 @@ FNameTable& FNameTable::GetInstance()
     return Instance;
 }
 
-TPair<int32, int32> FNameTable::FindOrAddName(const FString& Str)
+/**
+* @brief 문자열이 등록되어 있으면 인덱스를 반환하고, 없으면 새로 등록
+* 이미 등록된 이름은 표시 샤드의 읽기 잠금만으로 끝난다
+* @param InString 찾을 문자열 (널 종료가 아니어도 됨)
+* @param InLength 문자열 길이
+* @return ComparisonIndex, DisplayIndex
+*/
+TPair<int32, int32> FNameTable::FindOrAddName(const char* InString, size_t InLength)
 {
-    FString LowerStr = ToLower(Str);
+    uint32 DisplayHash;
+    uint32 ComparisonHash;
+    HashName(InString, InLength, DisplayHash, ComparisonHash);
 
-    int32 ComparisonIndex;
-    int32* FoundCompIndexPtr = ComparisonMap.Find(LowerStr);
+    auto MatchDisplay = [InString, InLength](const FNameEntry& InEntry)
+    {
+        return InEntry.Equals(InString, InLength);
+    };
 
-    if (FoundCompIndexPtr)
+    FNameShard& DisplayShard = DisplayShards[DisplayHash >> (32 - NumShardBits)];
     {
-        ComparisonIndex = *FoundCompIndexPtr;
+        std::shared_lock<std::shared_mutex> ReadLock(DisplayShard.Lock);
+        if (const FNameShard::FSlot* Found = DisplayShard.Find(DisplayHash, MatchDisplay))
+        {
+            return { Found->Entry->ComparisonIndex, Found->Index };
+        }
     }
-    else
+
+    // 새 이름 등록: 표시 샤드 -> 비교 샤드 순서로만 잠가 교착을 피한다
+    std::unique_lock<std::shared_mutex> DisplayLock(DisplayShard.Lock);
+    if (const FNameShard::FSlot* Found = DisplayShard.Find(DisplayHash, MatchDisplay))
     {
-        ComparisonIndex = ComparisonStringPool.Num();
-        ComparisonStringPool.Add(LowerStr);
-        ComparisonMap[LowerStr] = ComparisonIndex;
+        // 잠금을 기다리는 사이 다른 스레드가 등록함
+        return { Found->Entry->ComparisonIndex, Found->Index };
     }
 
-    int32 DisplayIndex;
-    int32* FoundDisplayIndexPtr = DisplayMap.Find(Str);
-    if (FoundDisplayIndexPtr)
+    FNameShard& ComparisonShard = ComparisonShards[ComparisonHash >> (32 - NumShardBits)];
+    std::unique_lock<std::shared_mutex> ComparisonLock(ComparisonShard.Lock);
+    const FNameShard::FSlot* ComparisonSlot = ComparisonShard.Find(ComparisonHash, [InString, InLength](const FNameEntry& InEntry)
     {
-        DisplayIndex = *FoundDisplayIndexPtr;
-    }
-    else
+        return InEntry.EqualsIgnoreCase(InString, InLength);
+    });
+
+    const int32 DisplayIndex = AllocateEntryIndex();
+    const bool bNewComparisonName = ComparisonSlot == nullptr;
+    const int32 ComparisonIndex = bNewComparisonName ? DisplayIndex : ComparisonSlot->Index;
+
+    FNameEntry* Entry = new (DisplayShard.AllocateFromArena(sizeof(FNameEntry) + InLength + 1)) FNameEntry;
+    Entry->ComparisonIndex = ComparisonIndex;
+    Entry->Length = static_cast<uint32>(InLength);
+    memcpy(Entry->GetString(), InString, InLength);
+    Entry->GetString()[InLength] = '\0';
+
+    // 다른 스레드가 샤드에서 인덱스를 찾기 전에 엔트리를 먼저 게시
+    EntryChunks[DisplayIndex / NumEntriesPerChunk].load(std::memory_order_acquire)[DisplayIndex % NumEntriesPerChunk].store(Entry, std::memory_order_release);
+
+    if (bNewComparisonName)
     {
-        DisplayIndex = DisplayStringPool.Num();
-        DisplayStringPool.Add(Str);
-        DisplayMap[Str] = DisplayIndex;
+        ComparisonShard.Insert(ComparisonHash, DisplayIndex, Entry);
     }
+    DisplayShard.Insert(DisplayHash, DisplayIndex, Entry);
 
     return { ComparisonIndex, DisplayIndex };
 }
@@ -140,26 +422,57 @@ FName FNameTable::GetUniqueName(const FString& BaseStr)
     int32 DisplayIndex = Indices.second;
     int32 ComparisonIndex = Indices.first;
 
-    int32 Number = NextNumberMap[BaseStr];
-    NextNumberMap[BaseStr]++;
+    // 같은 표시 문자열마다 번호를 따로 증가
+    int32 Number = GetEntry(DisplayIndex)->NextNumber.fetch_add(1, std::memory_order_relaxed);
 
     return FName(DisplayIndex, ComparisonIndex, Number);
 }
 
 FString FNameTable::GetDisplayString(int32 Idx) const
 {
-    if (Idx >= 0 && Idx < DisplayStringPool.Num())
+    if (Idx >= 0 && Idx < NumEntries.load(std::memory_order_acquire))
     {
-        return DisplayStringPool[Idx];
+        if (const FNameEntry* Entry = GetEntry(Idx))
+        {
+            return FString(std::string(Entry->GetString(), Entry->Length));
+        }
     }
     static const FString EmptyString = "None";
     return EmptyString;
 }
 
-FString FNameTable::ToLower(const FString& Str) const
+int32 FNameTable::GetNumEntries() const
+{
+    return NumEntries.load(std::memory_order_relaxed);
+}
+
+FNameTable::FNameEntry* FNameTable::GetEntry(int32 InIndex) const
+{
+    const std::atomic<FNameEntry*>* Chunk = EntryChunks[InIndex / NumEntriesPerChunk].load(std::memory_order_acquire);
+    return Chunk ? Chunk[InIndex % NumEntriesPerChunk].load(std::memory_order_acquire) : nullptr;
+}
+
+int32 FNameTable::AllocateEntryIndex()
 {
-    FString LowerStr = Str;
-    std::ranges::transform(LowerStr, LowerStr.begin(),
-                           [](unsigned char C) { return std::tolower(C); });
-    return LowerStr;
+    const int32 Index = NumEntries.fetch_add(1, std::memory_order_relaxed);
+    const uint32 ChunkIndex = static_cast<uint32>(Index) / NumEntriesPerChunk;
+    assert(ChunkIndex < MaxEntryChunks && "FNameTable: 최대 이름 개수를 초과했습니다");
+
+    std::atomic<std::atomic<FNameEntry*>*>& Chunk = EntryChunks[ChunkIndex];
+    if (!Chunk.load(std::memory_order_acquire))
+    {
+        // 여러 샤드가 동시에 새 청크를 만들 수 있으므로 먼저 게시한 쪽을 사용
+        std::atomic<FNameEntry*>* NewChunk = new std::atomic<FNameEntry*>[NumEntriesPerChunk];
+        for (uint32 Slot = 0; Slot < NumEntriesPerChunk; ++Slot)
+        {
+            NewChunk[Slot].store(nullptr, std::memory_order_relaxed);
+        }
+
+        std::atomic<FNameEntry*>* Expected = nullptr;
+        if (!Chunk.compare_exchange_strong(Expected, NewChunk, std::memory_order_acq_rel))
+        {
+            delete[] NewChunk;
+        }
+    }
+    return Index;
 }
@@ -7,18 +7,6 @@
 
 uint32 UEngineStatics::NextUUID = 0;
 
-TArray<FUObjectItem>& GetUObjectArray()
-{
-	static TArray<FUObjectItem> GUObjectArray;
-	return GUObjectArray;
-}
-
-TArray<uint32>& GetFreeObjectIndices()
-{
-	static TArray<uint32> GFreeObjectIndices;
-	return GFreeObjectIndices;
-}
-
 IMPLEMENT_CLASS_BASE(UObject)
 
 UObject::UObject()
@@ -26,45 +14,21 @@ UObject::UObject()
 {
 	UUID = UEngineStatics::GenUUID();
 
-	TArray<uint32>& FreeIndices = GetFreeObjectIndices();
-
-	if (!FreeIndices.IsEmpty())
-	{
-		// 삭제된 슬롯 재사용 (LIFO 스택)
-		InternalIndex = FreeIndices.Last();
-		FreeIndices.Pop();
-
-		FUObjectItem& Item = GetUObjectArray()[InternalIndex];
-		Item.Object = this;
-		// SerialNumber는 이미 증가된 상태 유지 (슬롯 재사용 감지용)
-	}
-	else
-	{
-		// 새 슬롯 할당
-		FUObjectItem NewItem(this, 0);
-		GetUObjectArray().Emplace(NewItem);
-		InternalIndex = static_cast<uint32>(GetUObjectArray().Num()) - 1;
-	}
+	// 이 시점에는 파생 클래스를 알 수 없으므로 클래스 버킷 등록은 NewObject 또는 FlushPendingClasses에서 처리
+	InternalIndex = GetUObjectArray().AllocateIndex(this);
 }
 
 UObject::~UObject()
 {
-	if (InternalIndex < GetUObjectArray().Num())
-	{
-		FUObjectItem& Item = GetUObjectArray()[InternalIndex];
-		Item.Object = nullptr;
-		Item.SerialNumber++;  // 슬롯 재사용 감지를 위해 세대 번호 증가
-
-		// FreeList에 추가 (LIFO 스택)
-		GetFreeObjectIndices().Add(InternalIndex);
-	}
+	GetUObjectArray().FreeIndex(InternalIndex);
 }
 
 uint32 UObject::GetSerialNumber() const
 {
-	if (InternalIndex < GetUObjectArray().Num())
+	const FUObjectArray& ObjectArray = GetUObjectArray();
+	if (ObjectArray.IsValidIndex(InternalIndex))
 	{
-		return GetUObjectArray()[InternalIndex].SerialNumber;
+		return ObjectArray[InternalIndex].SerialNumber;
 	}
 	return 0;
 }
@@ -157,22 +121,6 @@ void UObject::PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta)
 	}
 }
 
-/**
- * @brief 해당 클래스가 현재 내 클래스의 조상 클래스인지 판단하는 함수
- * 내부적으로 재귀를 활용해서 부모를 계속 탐색한 뒤 결과를 반환한다
- * @param InClass 판정할 Class
- * @return 판정 결과
- */
-bool UObject::IsA(UClass* InClass) const
-{
-	if (!InClass)
-	{
-		return false;
-	}
-
-	return GetClass()->IsChildOf(InClass);
-}
-
 /**
  * @brief 해당 클래스가 현재 내 클래스와 동일한지 판단하는 함수
  * @return 판정 결과
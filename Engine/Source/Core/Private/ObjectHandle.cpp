@@ -25,14 +25,14 @@ UObject* FObjectHandle::Get() const
 	}
 
 	// 배열 범위 체크
-	TArray<FUObjectItem>& ObjectArray = GetUObjectArray();
-	if (ObjectIndex >= ObjectArray.Num())
+	const FUObjectArray& ObjectArray = GetUObjectArray();
+	if (!ObjectArray.IsValidIndex(ObjectIndex))
 	{
 		return nullptr;
 	}
 
 	// 해당 슬롯의 아이템 가져오기
-	FUObjectItem& Item = ObjectArray[ObjectIndex];
+	const FUObjectItem& Item = ObjectArray[ObjectIndex];
 
 	// 세대 번호가 일치하지 않으면 다른 객체가 슬롯을 재사용한 것
 	if (Item.SerialNumber != SerialNumber)
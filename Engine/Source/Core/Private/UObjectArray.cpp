@@ -0,0 +1,185 @@
+#include "pch.h"
+#include "Core/Public/UObjectArray.h"
+
+#include "Core/Public/Object.h"
+
+FUObjectArray& GetUObjectArray()
+{
+	static FUObjectArray GUObjectArray;
+	return GUObjectArray;
+}
+
+FUObjectArray::~FUObjectArray()
+{
+	for (uint32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		delete[] Chunks[ChunkIndex];
+		Chunks[ChunkIndex] = nullptr;
+	}
+
+	// 종료 중에 늦게 소멸하는 객체가 해제된 청크에 접근하지 않도록 비워 둔다
+	NumChunks = 0;
+	NumElements = 0;
+}
+
+uint32 FUObjectArray::AllocateIndex(UObject* InObject)
+{
+	uint32 Index;
+	if (!FreeIndices.IsEmpty())
+	{
+		// 삭제된 슬롯 재사용 (LIFO 스택)
+		// SerialNumber는 이미 증가된 상태 유지 (슬롯 재사용 감지용)
+		Index = FreeIndices.Last();
+		FreeIndices.Pop();
+	}
+	else
+	{
+		if (NumElements == NumChunks * NumElementsPerChunk)
+		{
+			assert(NumChunks < MaxChunks && "FUObjectArray: 최대 객체 수를 초과했습니다");
+			Chunks[NumChunks++] = new FUObjectItem[NumElementsPerChunk];
+		}
+		Index = NumElements++;
+	}
+
+	FUObjectItem& Item = (*this)[Index];
+	Item.Object = InObject;
+	Item.Class = nullptr;
+	Item.ClassBucketIndex = -1;
+
+	PendingClassItems.Add({ Index, Item.SerialNumber });
+	return Index;
+}
+
+void FUObjectArray::FreeIndex(uint32 InIndex)
+{
+	if (!IsValidIndex(InIndex))
+	{
+		return;
+	}
+
+	FUObjectItem& Item = (*this)[InIndex];
+
+	if (NumActiveIterators > 0)
+	{
+		// 순회 중에는 다른 객체의 버킷 위치가 바뀌지 않도록 자리만 비우고, 정리와 슬롯 재사용은 순회가 끝난 뒤로 미룸
+		if (UClass* Class = Item.Class)
+		{
+			Class->ObjectIndices[Item.ClassBucketIndex] = InvalidObjectIndex;
+			ClassesToCompact.AddUnique(Class);
+		}
+
+		Item.Object = nullptr;
+		Item.Class = nullptr;
+		Item.ClassBucketIndex = -1;
+		Item.SerialNumber++;
+		DeferredFreeIndices.Add(InIndex);
+		return;
+	}
+
+	// 클래스 버킷에서 swap-remove 후 옮겨진 객체의 버킷 위치 갱신
+	if (UClass* Class = Item.Class)
+	{
+		TArray<uint32>& Bucket = Class->ObjectIndices;
+		const int32 LastBucketIndex = Bucket.Num() - 1;
+		if (Item.ClassBucketIndex != LastBucketIndex)
+		{
+			const uint32 MovedIndex = Bucket[LastBucketIndex];
+			Bucket[Item.ClassBucketIndex] = MovedIndex;
+			(*this)[MovedIndex].ClassBucketIndex = Item.ClassBucketIndex;
+		}
+		Bucket.Pop();
+	}
+
+	Item.Object = nullptr;
+	Item.Class = nullptr;
+	Item.ClassBucketIndex = -1;
+	Item.SerialNumber++;  // 슬롯 재사용 감지를 위해 세대 번호 증가
+
+	// FreeList에 추가 (LIFO 스택)
+	FreeIndices.Add(InIndex);
+}
+
+void FUObjectArray::AssignClass(uint32 InIndex)
+{
+	if (!AddToClassBucket(InIndex))
+	{
+		return;
+	}
+
+	// 방금 생성된 객체는 대기 목록의 마지막 항목인 경우가 대부분이므로 바로 제거
+	if (!PendingClassItems.IsEmpty() && PendingClassItems.Last().Index == InIndex)
+	{
+		PendingClassItems.Pop();
+	}
+}
+
+void FUObjectArray::FlushPendingClasses()
+{
+	for (const FPendingItem& Pending : PendingClassItems)
+	{
+		// 대기 중에 삭제되었거나 다른 객체가 슬롯을 재사용한 항목은 건너뜀
+		if (IsValidIndex(Pending.Index) && (*this)[Pending.Index].SerialNumber == Pending.SerialNumber)
+		{
+			AddToClassBucket(Pending.Index);
+		}
+	}
+	PendingClassItems.Empty();
+}
+
+void FUObjectArray::EndIteration()
+{
+	assert(NumActiveIterators > 0 && "FUObjectArray: BeginIteration 없이 EndIteration이 호출되었습니다");
+	if (--NumActiveIterators > 0)
+	{
+		return;
+	}
+
+	for (UClass* Class : ClassesToCompact)
+	{
+		CompactClassBucket(Class);
+	}
+	ClassesToCompact.Empty();
+
+	FreeIndices.Append(DeferredFreeIndices);
+	DeferredFreeIndices.Empty();
+}
+
+void FUObjectArray::CompactClassBucket(UClass* InClass)
+{
+	TArray<uint32>& Bucket = InClass->ObjectIndices;
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < Bucket.Num(); ++ReadIndex)
+	{
+		const uint32 ObjectIndex = Bucket[ReadIndex];
+		if (ObjectIndex == InvalidObjectIndex)
+		{
+			continue;
+		}
+
+		Bucket[WriteIndex] = ObjectIndex;
+		(*this)[ObjectIndex].ClassBucketIndex = WriteIndex;
+		++WriteIndex;
+	}
+	Bucket.SetNum(WriteIndex);
+}
+
+bool FUObjectArray::AddToClassBucket(uint32 InIndex)
+{
+	if (!IsValidIndex(InIndex))
+	{
+		return false;
+	}
+
+	FUObjectItem& Item = (*this)[InIndex];
+	if (!Item.Object || Item.Class)
+	{
+		return false;
+	}
+
+	UClass* Class = Item.Object->GetClass();
+	Item.Class = Class;
+	Item.ClassBucketIndex = Class->ObjectIndices.Num();
+	Class->ObjectIndices.Add(InIndex);
+	return true;
+}
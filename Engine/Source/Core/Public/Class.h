@@ -30,17 +30,60 @@ public:
     UClass* GetSuperClass() const { return SuperClass; }
     size_t GetClassSize() const { return ClassSize; }
     
-    bool IsChildOf(UClass* InClass) const;
+    /**
+     * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
+     * 조상 테이블의 InClass 깊이 자리만 비교하므로 상속 깊이와 무관하게 O(1)
+     * InClass가 테이블보다 깊은(MaxClassDepth 이상) 클래스면 부모 체인을 따라 올라가며 비교한다
+     * @param InClass 확인할 클래스
+     * @return 하위 클래스이거나 같은 클래스면 true
+     */
+    bool IsChildOf(const UClass* InClass) const
+    {
+        if (!InClass || InClass->ClassDepth > ClassDepth)
+        {
+            return false;
+        }
+        if (InClass->ClassDepth < MaxClassDepth)
+        {
+            return Ancestors[InClass->ClassDepth] == InClass;
+        }
+        return IsChildOfDeepClass(InClass);
+    }
+
     UObject* CreateDefaultObject() const;
 
     bool IsAbstract() const { return bIsAbstract; }
 
+    /** @brief 상속 깊이 (UObject = 0) */
+    uint32 GetClassDepth() const { return ClassDepth; }
+
+    /** @brief 이 클래스와 모든 하위 클래스 (자기 자신이 첫 번째 원소) */
+    const TArray<UClass*>& GetDerivedClasses() const { return DerivedClasses; }
+
+    /** @brief 정확히 이 클래스인 객체들의 GUObjectArray 인덱스 (순서 보장 없음, 순회 중 삭제된 자리는 FUObjectArray::InvalidObjectIndex) */
+    const TArray<uint32>& GetObjectIndices() const { return ObjectIndices; }
+
 private:
+    friend class FUObjectArray;
+
+    /** @brief 조상 테이블에 들어가지 않는 깊이의 InClass에 대해 부모 체인을 따라 비교 */
+    bool IsChildOfDeepClass(const UClass* InClass) const;
+
     FName ClassName;
     UClass* SuperClass;
     size_t ClassSize;
     ClassConstructorType Constructor;
     bool bIsAbstract;
+
+    /** @brief 조상 테이블의 최대 길이 (가장 깊은 엔진 클래스 USpotLightComponent의 깊이는 6) */
+    static constexpr uint32 MaxClassDepth = 16;
+
+    // Ancestors[N]은 깊이 N의 조상 클래스이며 Ancestors[ClassDepth]는 자기 자신 (MaxClassDepth 미만의 깊이만 저장)
+    uint32 ClassDepth;
+    const UClass* Ancestors[MaxClassDepth];
+
+    TArray<UClass*> DerivedClasses;
+    TArray<uint32> ObjectIndices;
 };
 
 /**
@@ -77,7 +120,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -101,7 +143,6 @@ UClass* ClassName::StaticClass() \
         nullptr, \
         true \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -142,7 +183,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         nullptr /* 싱글톤은 동적 생성을 지원하지 않으므로 생성자 포인터를 null로 전달 */ \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -172,7 +212,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -1,7 +1,15 @@
 #pragma once
 #include "WeakObjectPtr.h"
-#include <functional>
-#include <vector>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+/**
+ * @brief Broadcast가 핸들러에 인자를 넘기는 타입
+ * 참조와 포인터 / 정수 같은 스칼라는 그대로, 나머지(FVector 등)는 복사하지 않도록 const 참조로 넘긴다
+ */
+template<typename ArgType>
+using TDelegateParam = std::conditional_t<std::is_reference_v<ArgType> || std::is_scalar_v<ArgType>, ArgType, const ArgType&>;
 
 /**
  * @brief 다중 바인딩을 지원하는 델리게이트 템플릿 클래스
@@ -13,6 +21,10 @@
  * - AddDynamic(): UObject 멤버 함수 등록 (안전한 약한 참조 사용)
  * - Broadcast(): 모든 핸들러 실행
  *
+ * 바인딩은 하나의 평탄한 배열에 저장되며, InlineSize 이하의 호출 가능 객체(람다 캡처, 멤버 함수 포인터)는
+ * 힙 할당 없이 바인딩 내부 버퍼에 보관됩니다. Broadcast는 바인딩이나 핸들러를 복사하지 않고 인자를 참조로 전달합니다.
+ * Broadcast 도중의 Add / Remove는 가장 바깥 Broadcast가 끝난 뒤에 반영됩니다.
+ *
  * 사용 예시:
  * @code
  * DECLARE_DELEGATE(FOnDamaged, int, float);
@@ -36,29 +48,59 @@ template<typename... Args>
 class TDelegate
 {
 public:
-	using HandlerType = std::function<void(Args...)>;
+	/** @brief 바인딩 내부에 힙 할당 없이 보관할 수 있는 호출 가능 객체의 최대 크기 */
+	static constexpr size_t InlineSize = 64;
+
+	TDelegate() = default;
+	~TDelegate() = default;
+
+	TDelegate(const TDelegate& Other)
+		: Bindings(Other.Bindings)
+		, NextDelegateID(Other.NextDelegateID)
+		, bHasPendingRemovals(Other.bHasPendingRemovals)
+	{
+		Bindings.Append(Other.PendingBindings);
+	}
+
+	TDelegate& operator=(const TDelegate& Other)
+	{
+		if (this != &Other)
+		{
+			Bindings = Other.Bindings;
+			Bindings.Append(Other.PendingBindings);
+			PendingBindings.Empty();
+			NextDelegateID = Other.NextDelegateID;
+			bHasPendingRemovals = Other.bHasPendingRemovals;
+		}
+		return *this;
+	}
 
 	/**
 	 * @brief 일반 함수나 람다를 등록
 	 * @param Handler 등록할 핸들러 (람다, 함수 포인터, functor 등)
 	 * @return 바인딩 ID (나중에 Remove에 사용)
 	 */
-	uint32 Add(const HandlerType& Handler)
+	template<typename FunctorType>
+	uint32 Add(FunctorType&& Handler)
 	{
+		using DecayedType = std::decay_t<FunctorType>;
+		static_assert(std::is_invocable_v<DecayedType&, TDelegateParam<Args>...>, "Add: Handler는 델리게이트 인자로 호출 가능해야 합니다");
+
 		FDelegateBinding Binding;
-		Binding.Handler = Handler;
-		Binding.WeakObject = nullptr;  // 일반 핸들러는 객체 없음
+		TFunctorOps<DecayedType>::Construct(Binding.Storage, std::forward<FunctorType>(Handler));
+		Binding.Ops = &TFunctorOps<DecayedType>::Ops;
+		Binding.Invoke = &TFunctorOps<DecayedType>::Invoke;
 		Binding.DelegateID = NextDelegateID++;
 
-		Bindings.push_back(Binding);
-		return Binding.DelegateID;
+		AddBinding(std::move(Binding));
+		return NextDelegateID - 1;
 	}
 
 	/**
 	 * @brief UObject 멤버 함수를 안전하게 바인딩
 	 *
-	 * WeakObjectPtr를 사용하여 객체가 삭제되면 자동으로
-	 * 바인딩을 건너뛰어 크래시를 방지합니다.
+	 * 멤버 함수 포인터를 바인딩 내부에 그대로 저장하고, 호출할 때마다
+	 * 약한 참조로 객체를 확인하여 삭제된 객체의 바인딩은 자동으로 제거합니다.
 	 *
 	 * @tparam T UObject를 상속받는 타입
 	 * @param Instance 객체 인스턴스
@@ -77,61 +119,31 @@ public:
 		}
 
 		FDelegateBinding Binding;
-
-		// WeakObjectPtr로 안전하게 저장
+		TMethodOps<T>::Construct(Binding.Storage, Func);
+		Binding.Ops = &TMethodOps<T>::Ops;
+		Binding.Invoke = &TMethodOps<T>::Invoke;
 		Binding.WeakObject = Instance;
-
-		// 람다로 멤버 함수 호출을 래핑
-		// WeakObject를 캡처하여 실행 시마다 유효성 검사
-		Binding.Handler = [WeakObj = TWeakObjectPtr<T>(Instance), Func](Args... args)
-		{
-			if (T* Obj = WeakObj.Get())
-			{
-				(Obj->*Func)(args...);
-			}
-		};
-
+		Binding.bIsObjectBinding = true;
 		Binding.DelegateID = NextDelegateID++;
-		Bindings.push_back(Binding);
 
-		return Binding.DelegateID;
+		AddBinding(std::move(Binding));
+		return NextDelegateID - 1;
 	}
 
 	/**
 	 * @brief 모든 바인딩된 핸들러를 실행
 	 *
 	 * 실행 중 삭제된 객체의 바인딩은 자동으로 제거됩니다.
-	 * 역순으로 순회하여 안전하게 제거합니다.
+	 * 등록의 역순으로 호출합니다.
+	 * 인자는 복사하지 않고 TDelegateParam 타입으로 한 번만 변환해 모든 핸들러에 같은 값을 넘깁니다.
 	 *
-	 * @param args 핸들러에 전달할 인자들
+	 * @param InArgs 핸들러에 전달할 인자들
 	 */
-	void Broadcast(Args... args)
+	template<typename... CallArgs>
+	void Broadcast(CallArgs&&... InArgs)
 	{
-		// 역순으로 순회하며 무효한 바인딩 제거
-		for (int i = static_cast<int>(Bindings.size()) - 1; i >= 0; --i)
-		{
-			FDelegateBinding& Binding = Bindings[i];
-
-			// UObject 바인딩인 경우 유효성 검사
-			if (Binding.WeakObject != nullptr)
-			{
-				if (Binding.WeakObject.IsValid())
-				{
-					// 객체가 살아있으면 실행
-					Binding.Handler(args...);
-				}
-				else
-				{
-					// 객체가 삭제되었으면 바인딩 제거
-					Bindings.erase(Bindings.begin() + i);
-				}
-			}
-			else
-			{
-				// 일반 핸들러 (람다 등) - 그냥 실행
-				Binding.Handler(args...);
-			}
-		}
+		static_assert(sizeof...(CallArgs) == sizeof...(Args), "Broadcast: 인자 수가 델리게이트 시그니처와 다릅니다");
+		BroadcastInternal(std::forward<CallArgs>(InArgs)...);
 	}
 
 	/**
@@ -140,13 +152,10 @@ public:
 	 */
 	void Remove(uint32 DelegateID)
 	{
-		Bindings.erase(
-			std::remove_if(Bindings.begin(), Bindings.end(),
-				[DelegateID](const FDelegateBinding& B) {
-					return B.DelegateID == DelegateID;
-				}),
-			Bindings.end()
-		);
+		RemoveBindings([DelegateID](const FDelegateBinding& B)
+		{
+			return B.DelegateID == DelegateID;
+		});
 	}
 
 	/**
@@ -160,13 +169,10 @@ public:
 			return;
 		}
 
-		Bindings.erase(
-			std::remove_if(Bindings.begin(), Bindings.end(),
-				[Object](const FDelegateBinding& B) {
-					return B.WeakObject.Get() == Object;
-				}),
-			Bindings.end()
-		);
+		RemoveBindings([Object](const FDelegateBinding& B)
+		{
+			return B.bIsObjectBinding && B.WeakObject.Get() == Object;
+		});
 	}
 
 	/**
@@ -174,7 +180,10 @@ public:
 	 */
 	void Clear()
 	{
-		Bindings.clear();
+		RemoveBindings([](const FDelegateBinding&)
+		{
+			return true;
+		});
 	}
 
 	/**
@@ -183,7 +192,7 @@ public:
 	 */
 	bool IsBound() const
 	{
-		return !Bindings.empty();
+		return Num() > 0;
 	}
 
 	/**
@@ -192,29 +201,327 @@ public:
 	 */
 	size_t Num() const
 	{
-		return Bindings.size();
+		if (!bHasPendingRemovals)
+		{
+			return static_cast<size_t>(Bindings.Num() + PendingBindings.Num());
+		}
+
+		size_t Count = PendingBindings.Num();
+		for (const FDelegateBinding& Binding : Bindings)
+		{
+			Count += Binding.bPendingRemove ? 0 : 1;
+		}
+		return Count;
 	}
 
 private:
+	/**
+	 * @brief 저장된 호출 가능 객체를 호출하는 함수. Object는 UObject 바인딩일 때만 유효하다
+	 */
+	using FInvokeFunction = void (*)(void* Storage, UObject* Object, TDelegateParam<Args>... InArgs);
+
+	/**
+	 * @brief 저장된 호출 가능 객체의 수명을 다루는 함수 테이블 (타입 소거)
+	 */
+	struct FBindingOps
+	{
+		void (*MoveConstruct)(void* Dest, void* Source);
+		void (*CopyConstruct)(void* Dest, const void* Source);
+		void (*Destroy)(void* Storage);
+	};
+
+	/**
+	 * @brief 람다 / functor 바인딩. InlineSize를 넘는 타입만 힙에 할당한다
+	 * FString처럼 이동 생성자가 없는 캡처도 인라인으로 보관하며, 이 경우 바인딩 배열이 커질 때 복사로 옮겨진다
+	 */
+	template<typename FunctorType>
+	struct TFunctorOps
+	{
+		static constexpr bool bIsInline = sizeof(FunctorType) <= InlineSize
+			&& alignof(FunctorType) <= alignof(std::max_align_t);
+
+		static FunctorType* Get(void* Storage)
+		{
+			if constexpr (bIsInline)
+			{
+				return static_cast<FunctorType*>(Storage);
+			}
+			else
+			{
+				return *static_cast<FunctorType**>(Storage);
+			}
+		}
+
+		template<typename ValueType>
+		static void Construct(void* Storage, ValueType&& Value)
+		{
+			if constexpr (bIsInline)
+			{
+				new (Storage) FunctorType(std::forward<ValueType>(Value));
+			}
+			else
+			{
+				*static_cast<FunctorType**>(Storage) = new FunctorType(std::forward<ValueType>(Value));
+			}
+		}
+
+		static void Invoke(void* Storage, UObject*, TDelegateParam<Args>... InArgs)
+		{
+			(*Get(Storage))(InArgs...);
+		}
+
+		static void MoveConstruct(void* Dest, void* Source)
+		{
+			if constexpr (bIsInline)
+			{
+				new (Dest) FunctorType(std::move(*Get(Source)));
+				Get(Source)->~FunctorType();
+			}
+			else
+			{
+				*static_cast<FunctorType**>(Dest) = Get(Source);
+			}
+		}
+
+		static void CopyConstruct(void* Dest, const void* Source)
+		{
+			if constexpr (std::is_copy_constructible_v<FunctorType>)
+			{
+				Construct(Dest, *Get(const_cast<void*>(Source)));
+			}
+			else
+			{
+				assert(!"TDelegate: 복사할 수 없는 핸들러가 바인딩된 델리게이트는 복사할 수 없습니다");
+			}
+		}
+
+		static void Destroy(void* Storage)
+		{
+			if constexpr (bIsInline)
+			{
+				Get(Storage)->~FunctorType();
+			}
+			else
+			{
+				delete Get(Storage);
+			}
+		}
+
+		static constexpr FBindingOps Ops = { &MoveConstruct, &CopyConstruct, &Destroy };
+	};
+
+	/**
+	 * @brief UObject 멤버 함수 바인딩. 멤버 함수 포인터만 저장하고 객체는 약한 참조로 찾는다
+	 */
+	template<typename T>
+	struct TMethodOps
+	{
+		using MethodType = void (T::*)(Args...);
+		static_assert(sizeof(MethodType) <= InlineSize, "TDelegate: 멤버 함수 포인터가 InlineSize보다 큽니다");
+
+		static void Construct(void* Storage, MethodType Func)
+		{
+			new (Storage) MethodType(Func);
+		}
+
+		static void Invoke(void* Storage, UObject* Object, TDelegateParam<Args>... InArgs)
+		{
+			(static_cast<T*>(Object)->**static_cast<MethodType*>(Storage))(InArgs...);
+		}
+
+		static void MoveConstruct(void* Dest, void* Source)
+		{
+			new (Dest) MethodType(*static_cast<MethodType*>(Source));
+		}
+
+		static void CopyConstruct(void* Dest, const void* Source)
+		{
+			new (Dest) MethodType(*static_cast<const MethodType*>(Source));
+		}
+
+		static void Destroy(void*)
+		{
+		}
+
+		static constexpr FBindingOps Ops = { &MoveConstruct, &CopyConstruct, &Destroy };
+	};
+
 	/**
 	 * @brief 델리게이트 바인딩 정보를 저장하는 구조체
 	 */
 	struct FDelegateBinding
 	{
-		HandlerType Handler;                      // 실제 호출할 함수
-		TWeakObjectPtr<UObject> WeakObject;       // AddDynamic용 약한 참조
-		uint32 DelegateID;                         // 고유 식별자
+		alignas(std::max_align_t) uint8 Storage[InlineSize];  // 호출 가능 객체 (또는 힙 객체 포인터)
+		FInvokeFunction Invoke = nullptr;                     // Broadcast에서 한 번의 간접 호출로 실행
+		const FBindingOps* Ops = nullptr;                     // Storage의 이동 / 복사 / 소멸
+		TWeakObjectPtr<UObject> WeakObject;                   // AddDynamic용 약한 참조
+		uint32 DelegateID = 0;                                // 고유 식별자
+		bool bIsObjectBinding = false;
+		bool bPendingRemove = false;                          // Broadcast가 끝난 뒤 제거
+
+		FDelegateBinding() = default;
+
+		FDelegateBinding(FDelegateBinding&& Other) noexcept
+			: Invoke(Other.Invoke)
+			, Ops(Other.Ops)
+			, WeakObject(Other.WeakObject)
+			, DelegateID(Other.DelegateID)
+			, bIsObjectBinding(Other.bIsObjectBinding)
+			, bPendingRemove(Other.bPendingRemove)
+		{
+			if (Ops)
+			{
+				Ops->MoveConstruct(Storage, Other.Storage);
+				Other.Ops = nullptr;
+			}
+		}
 
-		FDelegateBinding()
-			: Handler(nullptr)
-			, WeakObject(nullptr)
-			, DelegateID(0)
+		FDelegateBinding(const FDelegateBinding& Other)
+			: Invoke(Other.Invoke)
+			, Ops(Other.Ops)
+			, WeakObject(Other.WeakObject)
+			, DelegateID(Other.DelegateID)
+			, bIsObjectBinding(Other.bIsObjectBinding)
+			, bPendingRemove(Other.bPendingRemove)
 		{
+			if (Ops)
+			{
+				Ops->CopyConstruct(Storage, Other.Storage);
+			}
+		}
+
+		FDelegateBinding& operator=(FDelegateBinding&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				this->~FDelegateBinding();
+				new (this) FDelegateBinding(std::move(Other));
+			}
+			return *this;
+		}
+
+		FDelegateBinding& operator=(const FDelegateBinding& Other)
+		{
+			if (this != &Other)
+			{
+				this->~FDelegateBinding();
+				new (this) FDelegateBinding(Other);
+			}
+			return *this;
+		}
+
+		~FDelegateBinding()
+		{
+			if (Ops)
+			{
+				Ops->Destroy(Storage);
+				Ops = nullptr;
+			}
 		}
 	};
 
-	std::vector<FDelegateBinding> Bindings;  // 모든 바인딩 저장
-	uint32 NextDelegateID = 1;                // 다음 할당할 ID (0은 무효)
+	/** @brief Broadcast 본체 (인자를 핸들러에 넘길 타입으로 한 번만 변환해 받음) */
+	void BroadcastInternal(TDelegateParam<Args>... InArgs)
+	{
+		++BroadcastDepth;
+
+		for (int32 Index = Bindings.Num() - 1; Index >= 0; --Index)
+		{
+			FDelegateBinding& Binding = Bindings[Index];
+			if (Binding.bPendingRemove)
+			{
+				continue;
+			}
+
+			// UObject 바인딩인 경우 유효성 검사
+			UObject* Object = nullptr;
+			if (Binding.bIsObjectBinding)
+			{
+				Object = Binding.WeakObject.Get();
+				if (!Object)
+				{
+					// 객체가 삭제되었으면 바인딩 제거
+					MarkPendingRemove(Binding);
+					continue;
+				}
+			}
+
+			Binding.Invoke(Binding.Storage, Object, InArgs...);
+		}
+
+		if (--BroadcastDepth == 0)
+		{
+			FlushPendingChanges();
+		}
+	}
+
+	void AddBinding(FDelegateBinding&& InBinding)
+	{
+		// Broadcast 도중에는 배열이 재할당되어 실행 중인 핸들러가 이동하지 않도록 따로 모아 둔다
+		if (BroadcastDepth > 0)
+		{
+			PendingBindings.Emplace(std::move(InBinding));
+		}
+		else
+		{
+			Bindings.Emplace(std::move(InBinding));
+		}
+	}
+
+	void MarkPendingRemove(FDelegateBinding& InBinding)
+	{
+		InBinding.bPendingRemove = true;
+		bHasPendingRemovals = true;
+	}
+
+	template<typename PredicateType>
+	void RemoveBindings(const PredicateType& InPredicate)
+	{
+		PendingBindings.RemoveAll(InPredicate);
+
+		if (BroadcastDepth > 0)
+		{
+			for (FDelegateBinding& Binding : Bindings)
+			{
+				if (!Binding.bPendingRemove && InPredicate(Binding))
+				{
+					MarkPendingRemove(Binding);
+				}
+			}
+		}
+		else
+		{
+			Bindings.RemoveAll(InPredicate);
+		}
+	}
+
+	/** @brief Broadcast 도중 미뤄 둔 제거 / 추가 반영 */
+	void FlushPendingChanges()
+	{
+		if (bHasPendingRemovals)
+		{
+			Bindings.RemoveAll([](const FDelegateBinding& B)
+			{
+				return B.bPendingRemove;
+			});
+			bHasPendingRemovals = false;
+		}
+
+		if (!PendingBindings.IsEmpty())
+		{
+			for (FDelegateBinding& Binding : PendingBindings)
+			{
+				Bindings.Emplace(std::move(Binding));
+			}
+			PendingBindings.Empty();
+		}
+	}
+
+	TArray<FDelegateBinding> Bindings;         // 모든 바인딩 저장
+	TArray<FDelegateBinding> PendingBindings;  // Broadcast 도중 추가된 바인딩
+	uint32 NextDelegateID = 1;                 // 다음 할당할 ID (0은 무효)
+	int32 BroadcastDepth = 0;                  // 중첩 Broadcast 깊이
+	bool bHasPendingRemovals = false;
 };
 
 /**
@@ -236,6 +543,160 @@ private:
 #define DECLARE_DELEGATE(DelegateName, ...) \
 	typedef TDelegate<__VA_ARGS__> DelegateName
 
+/**
+ * @brief 델리게이트 Broadcast를 모아 두었다가 정해진 시점에 한꺼번에 실행하는 큐
+ *
+ * Enqueue는 대상 델리게이트와 인자 복사본을 블록 아레나에 기록만 하고, Dispatch에서 큐에 들어온 순서대로 Broadcast합니다.
+ * 큐에 들어간 뒤 Owner가 삭제되면 그 이벤트는 건너뛰므로, Owner는 델리게이트를 소유한 객체로 지정해야 합니다.
+ * UObject 포인터 인자(OtherActor, OtherComp 등)는 약한 참조로 보관하며, 큐에 있는 동안 그 객체가 삭제되어도 이벤트를 건너뜁니다.
+ * UWorld가 하나를 소유하며 액터 Tick이 끝난 뒤 Dispatch합니다.
+ *
+ * 사용 예시:
+ * @code
+ * World->GetDeferredEventQueue().Enqueue(Actor, Actor->OnActorBeginOverlap, Actor, OtherActor);
+ * @endcode
+ *
+ * @note 게임 스레드 전용
+ */
+class FDeferredEventQueue
+{
+public:
+	/** @brief 인자 복사본을 보관하는 아레나 블록 하나의 크기 */
+	static constexpr size_t BlockSize = 16 * 1024;
+
+	FDeferredEventQueue() = default;
+	~FDeferredEventQueue();
+
+	FDeferredEventQueue(const FDeferredEventQueue&) = delete;
+	FDeferredEventQueue& operator=(const FDeferredEventQueue&) = delete;
+
+	/**
+	 * @brief Broadcast를 큐에 추가
+	 * @param InOwner 델리게이트를 소유한 객체 (삭제되면 이벤트를 건너뜀, nullptr이면 항상 실행)
+	 * @param InDelegate 대상 델리게이트
+	 * @param InArgs Broadcast 인자 (값으로 복사되어 보관, UObject 포인터는 약한 참조로 보관)
+	 */
+	template<typename... Args, typename... CallArgs>
+	void Enqueue(UObject* InOwner, TDelegate<Args...>& InDelegate, CallArgs&&... InArgs)
+	{
+		using PayloadType = TDeferredPayload<Args...>;
+		static_assert(sizeof(PayloadType) <= BlockSize, "FDeferredEventQueue: 인자가 블록 크기보다 큽니다");
+
+		void* Memory = AllocatePayload(sizeof(PayloadType), alignof(PayloadType));
+		new (Memory) PayloadType(InDelegate, std::forward<CallArgs>(InArgs)...);
+
+		FQueuedEvent& Event = Events[Events.Emplace()];
+		Event.Dispatch = &PayloadType::Dispatch;
+		Event.Destroy = &PayloadType::Destroy;
+		Event.Payload = Memory;
+		Event.Owner = InOwner;
+		Event.bHasOwner = InOwner != nullptr;
+	}
+
+	/**
+	 * @brief 큐에 쌓인 이벤트를 순서대로 실행하고 큐를 비움
+	 * 실행 도중 추가된 이벤트도 같은 Dispatch 안에서 실행된다
+	 */
+	void Dispatch();
+
+	/** @brief 실행하지 않고 큐를 비움 */
+	void Clear();
+
+	int32 Num() const { return Events.Num(); }
+	bool IsEmpty() const { return Events.IsEmpty(); }
+
+private:
+	/** @brief 큐에 보관하는 인자 하나 (UObject 포인터가 아니면 값 복사본) */
+	template<typename ArgType, typename = void>
+	struct TDeferredArgument
+	{
+		using StorageType = std::decay_t<ArgType>;
+
+		static bool IsStale(const StorageType&) { return false; }
+		static const StorageType& Get(const StorageType& InStored) { return InStored; }
+	};
+
+	/** @brief UObject 포인터 인자는 약한 참조로 보관 (nullptr로 넘긴 인자는 삭제된 것으로 보지 않음) */
+	template<typename ArgType>
+	struct TDeferredArgument<ArgType, std::enable_if_t<std::is_pointer_v<std::decay_t<ArgType>>
+		&& std::is_base_of_v<UObject, std::remove_cv_t<std::remove_pointer_t<std::decay_t<ArgType>>>>>>
+	{
+		using PointerType = std::decay_t<ArgType>;
+
+		struct StorageType
+		{
+			StorageType(PointerType InObject)
+				: Object(const_cast<UObject*>(static_cast<const UObject*>(InObject)))
+				, bWasSet(InObject != nullptr)
+			{
+			}
+
+			TWeakObjectPtr<UObject> Object;
+			bool bWasSet;
+		};
+
+		static bool IsStale(const StorageType& InStored) { return InStored.bWasSet && !InStored.Object.IsValid(); }
+		static PointerType Get(const StorageType& InStored) { return static_cast<PointerType>(InStored.Object.Get()); }
+	};
+
+	/** @brief 대상 델리게이트와 인자 복사본 */
+	template<typename... Args>
+	struct TDeferredPayload
+	{
+		TDelegate<Args...>* Delegate;
+		std::tuple<typename TDeferredArgument<Args>::StorageType...> Arguments;
+
+		template<typename... CallArgs>
+		TDeferredPayload(TDelegate<Args...>& InDelegate, CallArgs&&... InArgs)
+			: Delegate(&InDelegate)
+			, Arguments(std::forward<CallArgs>(InArgs)...)
+		{
+		}
+
+		template<size_t... Indices>
+		void Broadcast(std::index_sequence<Indices...>)
+		{
+			// 인자로 넘긴 객체가 큐에 있는 동안 삭제되었다면 이벤트를 건너뜀
+			if ((TDeferredArgument<Args>::IsStale(std::get<Indices>(Arguments)) || ...))
+			{
+				return;
+			}
+			Delegate->Broadcast(TDeferredArgument<Args>::Get(std::get<Indices>(Arguments))...);
+		}
+
+		static void Dispatch(void* InPayload)
+		{
+			static_cast<TDeferredPayload*>(InPayload)->Broadcast(std::index_sequence_for<Args...>());
+		}
+
+		static void Destroy(void* InPayload)
+		{
+			static_cast<TDeferredPayload*>(InPayload)->~TDeferredPayload();
+		}
+	};
+
+	struct FQueuedEvent
+	{
+		void (*Dispatch)(void* Payload) = nullptr;
+		void (*Destroy)(void* Payload) = nullptr;
+		void* Payload = nullptr;
+		TWeakObjectPtr<UObject> Owner;
+		bool bHasOwner = false;
+	};
+
+	/** @brief 아레나에서 페이로드 메모리 할당 (블록은 Dispatch / Clear 이후에도 재사용) */
+	void* AllocatePayload(size_t InSize, size_t InAlignment);
+
+	/** @brief 모든 페이로드를 소멸시키고 아레나를 처음 블록으로 되돌림 */
+	void ResetEvents();
+
+	TArray<FQueuedEvent> Events;
+	TArray<uint8*> Blocks;
+	int32 CurrentBlock = 0;
+	size_t BlockOffset = 0;
+	bool bIsDispatching = false;
+};
+
 // Forward declaration
 class UScriptComponent;
 
@@ -56,6 +56,30 @@ namespace std {
 }
 
 
+/**
+ * @brief TMap / TSet용 FName 해시 특수화
+ * ComparisonIndex와 Number를 하나의 64비트 정수로 합치기만 하고, 비트 분산은 해시 테이블의 Mix에 맡긴다
+ */
+template <>
+struct TFlatHash<FName>
+{
+	size_t operator()(const FName& Name) const noexcept
+	{
+		return static_cast<size_t>((static_cast<uint64>(static_cast<uint32>(Name.GetComparisonIndex())) << 32) |
+			static_cast<uint32>(Name.GetUniqueNumber()));
+	}
+};
+
+
+/**
+ * @brief FName 문자열을 관리하는 전역 이름 테이블 (언리얼 FNamePool 스타일)
+ * 문자열은 청크 단위 아레나에 한 번만 저장되고, 인덱스 -> 엔트리 테이블도 청크로 나뉘어 있어 이미 발급된 인덱스의 조회는 잠금 없이 동작한다
+ * 탐색은 문자열을 복사하지 않고 대소문자 구분 / 무시 해시를 한 번에 계산하며, 해시 상위 비트로 고른 샤드(stripe)의 읽기 잠금만 잡는다
+ * 새 이름 추가만 해당 샤드의 쓰기 잠금을 잡으므로 비동기 에셋 / 레벨 로딩 스레드에서도 FName을 만들 수 있다
+ *
+ * DisplayIndex는 입력 그대로의 문자열 엔트리, ComparisonIndex는 대소문자를 무시했을 때 처음 등록된 엔트리의 인덱스이다
+ * 인덱스 0은 "None"으로 예약되어 있다
+ */
 class FNameTable
 {
 public:
@@ -64,18 +88,44 @@ public:
 public:
 	FNameTable();
 	~FNameTable();
-	TPair<int32, int32> FindOrAddName(const FString& Str);
+
+	FNameTable(const FNameTable&) = delete;
+	FNameTable& operator=(const FNameTable&) = delete;
+
+	/**
+	 * @brief 문자열을 찾거나 새로 등록
+	 * @return ComparisonIndex, DisplayIndex
+	 */
+	TPair<int32, int32> FindOrAddName(const char* InString, size_t InLength);
+	TPair<int32, int32> FindOrAddName(const FString& Str) { return FindOrAddName(Str.data(), Str.size()); }
+
+	/** @brief 같은 표시 문자열마다 0부터 증가하는 번호를 붙인 FName 생성 (스레드 안전) */
 	FName GetUniqueName(const FString& BaseStr);
 
 	FString GetDisplayString(int32 Idx) const;
 
+	/** @brief 등록된 엔트리(표시 문자열) 개수 */
+	int32 GetNumEntries() const;
+
 private:
-	FString ToLower(const FString& Str) const;
+	struct FNameEntry;
+	struct FNameShard;
+
+	static constexpr uint32 NumShardBits = 5;
+	static constexpr uint32 NumShards = 1u << NumShardBits;
+	static constexpr uint32 NumEntriesPerChunk = 16 * 1024;
+	static constexpr uint32 MaxEntryChunks = 1024;
 
-	TArray<FString> ComparisonStringPool;
-	TArray<FString> DisplayStringPool;
+	FNameEntry* GetEntry(int32 InIndex) const;
 
-	TMap<FString, int32> ComparisonMap;
-	TMap<FString, int32> DisplayMap;
-	TMap<FString, int32> NextNumberMap;
-};
\ No newline at end of file
+	/** @brief 새 엔트리의 인덱스를 발급하고 엔트리 포인터 청크를 준비 */
+	int32 AllocateEntryIndex();
+
+	// 입력 그대로 비교하는 샤드와 대소문자를 무시하고 비교하는 샤드
+	FNameShard* DisplayShards;
+	FNameShard* ComparisonShards;
+
+	// 엔트리 포인터 청크. 청크와 엔트리 모두 한 번 게시(publish)되면 바뀌지 않는다
+	std::atomic<std::atomic<FNameEntry*>*> EntryChunks[MaxEntryChunks];
+	std::atomic<int32> NumEntries;
+};
@@ -12,15 +12,18 @@ template <typename T>
 T* NewObject(UObject* InOuter = nullptr)
 {
 	static_assert(is_base_of_v<UObject, T>, "생성할 클래스는 UObject를 반드시 상속 받아야 합니다");
+	LLM_SCOPE(UObject);
 	T* NewObject = new T();
 	NewObject->SetName(FNameTable::GetInstance().GetUniqueName(NewObject->GetClass()->GetName().ToString()));
 	NewObject->SetOuter(InOuter);
+	GetUObjectArray().AssignClass(NewObject->GetObjectIndex());
 	return NewObject;
 }
 
 inline UObject* NewObject(UClass* ClassToCreate, UObject* InOuter = nullptr)
 {
 	if (!ClassToCreate) { return nullptr; }
+	LLM_SCOPE(UObject);
 	UObject* NewObject = ClassToCreate->CreateDefaultObject();
        
 	if (NewObject)
@@ -28,6 +31,7 @@ inline UObject* NewObject(UClass* ClassToCreate, UObject* InOuter = nullptr)
 		FName NewName = FNameTable::GetInstance().GetUniqueName(ClassToCreate->GetName().ToString());
 		NewObject->SetName(NewName);
 		NewObject->SetOuter(InOuter);
+		GetUObjectArray().AssignClass(NewObject->GetObjectIndex());
 	}
 
 	return NewObject;
@@ -1,28 +1,11 @@
 #pragma once
 #include "Class.h"
 #include "Name.h"
+#include "UObjectArray.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
 
-// Forward declaration for FUObjectItem
-class UObject;
-
-/**
- * @brief Object 배열의 각 항목을 나타내는 구조체
- * Object 포인터와 세대(generation) 번호를 함께 저장하여
- * 삭제된 객체의 슬롯 재사용을 안전하게 추적합니다.
- */
-struct FUObjectItem
-{
-	UObject* Object;
-	uint32 SerialNumber;  // 슬롯이 재사용될 때마다 증가
-
-	FUObjectItem() : Object(nullptr), SerialNumber(0) {}
-	FUObjectItem(UObject* InObject, uint32 InSerialNumber)
-		: Object(InObject), SerialNumber(InSerialNumber) {}
-};
-
 UCLASS()
 class UObject
 {
@@ -84,9 +67,20 @@ private:
 	void PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta);
 };
 
+/**
+ * @brief 해당 클래스가 현재 내 클래스의 조상 클래스인지 판단하는 함수
+ * UClass의 조상 테이블을 사용하므로 상속 깊이와 무관하게 O(1)이며, Cast<T>에서 인라인되도록 헤더에 정의한다
+ * @param InClass 판정할 Class
+ * @return 판정 결과
+ */
+inline bool UObject::IsA(UClass* InClass) const
+{
+	return GetClass()->IsChildOf(InClass);
+}
+
 /**
  * @brief 안전한 타입 캐스팅 함수 (원시 포인터용)
- * UClass::IsChildOf를 사용한 런타임 타입 체크
+ * UClass::IsChildOf(조상 테이블 비교)를 사용한 O(1) 런타임 타입 체크
  * @tparam T 캐스팅할 대상 타입
  * @param InObject 캐스팅할 원시 포인터
  * @return 캐스팅 성공시 T*, 실패시 nullptr
@@ -211,17 +205,3 @@ bool IsValid(const UObject* InObject)
 {
 	return InObject && IsA<T>(InObject);
 }
-
-/**
- * @brief 전역 UObject 배열을 반환하는 함수
- * FUObjectItem 구조체로 객체 포인터와 세대 번호를 함께 관리합니다.
- * @return GUObjectArray 참조
- */
-TArray<FUObjectItem>& GetUObjectArray();
-
-/**
- * @brief 삭제된 Object 슬롯의 인덱스 목록 (재사용 가능한 슬롯)
- * LIFO 스택으로 사용: 최근 삭제된 슬롯을 먼저 재사용 (캐시 친화적)
- * @return GFreeObjectIndices 참조
- */
-TArray<uint32>& GetFreeObjectIndices();
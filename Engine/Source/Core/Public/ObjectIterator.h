@@ -1,16 +1,45 @@
 #pragma once
 
 #include "Core/Public/Object.h"
+
+/**
+ * @brief TObject와 하위 클래스의 객체만 순회하는 반복자
+ * 전체 GUObjectArray를 IsA로 검사하지 않고, TObject::StaticClass()의 하위 클래스 목록을 따라 클래스별 객체 버킷만 방문한다
+ * 반복자가 살아 있는 동안 FUObjectArray는 삭제된 객체의 버킷 자리를 비워 두기만 하므로,
+ * 순회 중에 객체를 삭제해도 남은 객체를 건너뛰거나 두 번 방문하지 않는다 (비워진 자리는 건너뜀)
+ * @note 순회 중에 생성된 객체는 방문할 수도, 하지 않을 수도 있다
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
-	TObjectIterator() : UObjectArray(GetUObjectArray())
+	TObjectIterator()
+		: ObjectArray(&GetUObjectArray())
+		, BaseClass(TObject::StaticClass())
 	{
-		CurrentIndex = 0;
+		ObjectArray->FlushPendingClasses();
+		ObjectArray->BeginIteration();
 		AdvanceToNextValidObject();
 	}
 
+	TObjectIterator(const TObjectIterator& Other)
+		: ObjectArray(Other.ObjectArray)
+		, BaseClass(Other.BaseClass)
+		, ClassIndex(Other.ClassIndex)
+		, BucketIndex(Other.BucketIndex)
+		, CurrentObject(Other.CurrentObject)
+	{
+		ObjectArray->BeginIteration();
+	}
+
+	// 모든 반복자가 같은 GUObjectArray를 참조하므로 대입해도 순회 수는 그대로
+	TObjectIterator& operator=(const TObjectIterator& Other) = default;
+
+	~TObjectIterator()
+	{
+		ObjectArray->EndIteration();
+	}
+
 	explicit operator bool() const
 	{
 		return CurrentObject != nullptr;
@@ -28,7 +57,7 @@ public:
 
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		++BucketIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -49,23 +78,37 @@ public:
 	{
 		return CurrentObject != Other.CurrentObject;
 	}
+
 private:
 	void AdvanceToNextValidObject()
 	{
 		CurrentObject = nullptr;
-		while (CurrentIndex < UObjectArray.Num())
+
+		const TArray<UClass*>& DerivedClasses = BaseClass->GetDerivedClasses();
+		while (ClassIndex < DerivedClasses.Num())
 		{
-			UObject* Obj = UObjectArray[CurrentIndex].Object;  // FUObjectItem에서 Object 필드 접근
-			if (Obj && Obj->IsA(TObject::StaticClass()))
+			const TArray<uint32>& ObjectIndices = DerivedClasses[ClassIndex]->GetObjectIndices();
+			while (BucketIndex < ObjectIndices.Num())
 			{
-				CurrentObject = Cast<TObject>(Obj);
-				return;
+				// 순회 중에 삭제된 자리는 건너뜀
+				const uint32 ObjectIndex = ObjectIndices[BucketIndex];
+				if (ObjectIndex != FUObjectArray::InvalidObjectIndex)
+				{
+					// 버킷에는 살아 있는 객체만 들어 있으므로 타입 검사 없이 변환
+					CurrentObject = static_cast<TObject*>((*ObjectArray)[ObjectIndex].Object);
+					return;
+				}
+				++BucketIndex;
 			}
-			++CurrentIndex;
+
+			++ClassIndex;
+			BucketIndex = 0;
 		}
 	}
 
-	int32 CurrentIndex;
+	FUObjectArray* ObjectArray;
+	UClass* BaseClass;
+	int32 ClassIndex = 0;
+	int32 BucketIndex = 0;
 	TObject* CurrentObject = nullptr;
-	TArray<FUObjectItem>& UObjectArray;  // FUObjectItem 배열로 변경
 };
@@ -0,0 +1,124 @@
+#pragma once
+
+class UObject;
+class UClass;
+
+/**
+ * @brief Object 배열의 각 항목을 나타내는 구조체
+ * Object 포인터와 세대(generation) 번호를 함께 저장하여
+ * 삭제된 객체의 슬롯 재사용을 안전하게 추적합니다.
+ */
+struct FUObjectItem
+{
+	UObject* Object;
+	uint32 SerialNumber;  // 슬롯이 재사용될 때마다 증가
+
+	// 객체가 등록된 클래스 버킷과 버킷 안의 위치 (클래스 등록 전에는 nullptr / -1)
+	UClass* Class;
+	int32 ClassBucketIndex;
+
+	FUObjectItem() : Object(nullptr), SerialNumber(0), Class(nullptr), ClassBucketIndex(-1) {}
+	FUObjectItem(UObject* InObject, uint32 InSerialNumber)
+		: Object(InObject), SerialNumber(InSerialNumber), Class(nullptr), ClassBucketIndex(-1) {}
+};
+
+/**
+ * @brief 모든 UObject 슬롯을 관리하는 전역 배열 (언리얼 FChunkedFixedUObjectArray 스타일)
+ * 슬롯은 NumElementsPerChunk 단위의 고정 크기 청크에 저장되므로, 배열이 커져도 기존 FUObjectItem의 주소가 바뀌지 않고
+ * 슬롯 추가가 전체 복사 없이 끝난다
+ * 객체는 생성 이후 UClass별 인덱스 버킷에도 등록되어, TObjectIterator<T>가 T와 하위 클래스의 객체만 순회할 수 있다
+ *
+ * UObject 생성자 시점에는 파생 클래스의 GetClass()를 호출할 수 없으므로, 슬롯은 클래스 대기 목록에 먼저 들어가고
+ * NewObject 완료 시점(AssignClass) 또는 클래스 버킷을 읽기 직전(FlushPendingClasses)에 버킷으로 옮겨진다
+ *
+ * 반복자가 순회 중일 때(BeginIteration ~ EndIteration) 삭제된 객체는 버킷에서 swap-remove하지 않고
+ * InvalidObjectIndex로 표시만 하며, 슬롯 재사용도 미뤄 두었다가 마지막 순회가 끝날 때 한꺼번에 정리한다
+ * 그래서 순회 중에 객체를 삭제해도 아직 방문하지 않은 객체의 버킷 위치가 바뀌지 않는다
+ * @note 게임 스레드 전용
+ */
+class FUObjectArray
+{
+public:
+	/** @brief 청크 하나의 슬롯 수 */
+	static constexpr uint32 NumElementsPerChunk = 64 * 1024;
+	/** @brief 최대 청크 수 (최대 슬롯 수 = NumElementsPerChunk * MaxChunks) */
+	static constexpr uint32 MaxChunks = 1024;
+	/** @brief 순회 중 삭제된 객체의 클래스 버킷 자리에 남는 값 */
+	static constexpr uint32 InvalidObjectIndex = 0xFFFFFFFF;
+
+	FUObjectArray() = default;
+	~FUObjectArray();
+
+	FUObjectArray(const FUObjectArray&) = delete;
+	FUObjectArray& operator=(const FUObjectArray&) = delete;
+
+	/**
+	 * @brief 객체에 슬롯 할당 (삭제된 슬롯을 LIFO로 재사용하고, 없으면 새 슬롯 추가)
+	 * @return 슬롯 인덱스
+	 */
+	uint32 AllocateIndex(UObject* InObject);
+
+	/** @brief 슬롯 해제. 세대 번호를 올리고 클래스 버킷에서 제거한다 */
+	void FreeIndex(uint32 InIndex);
+
+	/** @brief 생성이 끝난 객체를 자신의 클래스 버킷에 등록 (이미 등록되어 있으면 무시) */
+	void AssignClass(uint32 InIndex);
+
+	/** @brief 클래스 대기 목록의 객체들을 클래스 버킷에 등록 */
+	void FlushPendingClasses();
+
+	/**
+	 * @brief 클래스 버킷 순회 시작 / 끝 (TObjectIterator가 호출, 중첩 가능)
+	 * 마지막 순회가 끝나면 순회 중에 삭제된 버킷 항목을 정리하고 미뤄 둔 슬롯을 재사용 목록에 넣는다
+	 */
+	void BeginIteration() { ++NumActiveIterators; }
+	void EndIteration();
+
+	int32 Num() const { return static_cast<int32>(NumElements); }
+	bool IsValidIndex(uint32 InIndex) const { return InIndex < NumElements; }
+
+	FUObjectItem& operator[](uint32 InIndex)
+	{
+		return Chunks[InIndex / NumElementsPerChunk][InIndex % NumElementsPerChunk];
+	}
+
+	const FUObjectItem& operator[](uint32 InIndex) const
+	{
+		return Chunks[InIndex / NumElementsPerChunk][InIndex % NumElementsPerChunk];
+	}
+
+private:
+	struct FPendingItem
+	{
+		uint32 Index;
+		uint32 SerialNumber;
+	};
+
+	/** @brief 슬롯의 객체를 클래스 버킷 끝에 추가 (이미 등록된 슬롯이면 false) */
+	bool AddToClassBucket(uint32 InIndex);
+
+	/** @brief 순회 중 삭제로 InvalidObjectIndex가 남은 버킷을 순서를 유지하며 당기고 버킷 위치 갱신 */
+	void CompactClassBucket(UClass* InClass);
+
+	FUObjectItem* Chunks[MaxChunks] = {};
+	uint32 NumChunks = 0;
+	uint32 NumElements = 0;
+
+	/** @brief 삭제된 슬롯의 인덱스 (LIFO 스택: 최근 삭제된 슬롯을 먼저 재사용) */
+	TArray<uint32> FreeIndices;
+	/** @brief 아직 클래스 버킷에 등록되지 않은 슬롯 (세대 번호로 이미 삭제된 항목을 걸러냄) */
+	TArray<FPendingItem> PendingClassItems;
+
+	/** @brief 진행 중인 클래스 버킷 순회 수 */
+	int32 NumActiveIterators = 0;
+	/** @brief 순회 중에 해제되어 재사용을 미룬 슬롯 */
+	TArray<uint32> DeferredFreeIndices;
+	/** @brief 순회 중 삭제로 InvalidObjectIndex 항목이 생긴 클래스 */
+	TArray<UClass*> ClassesToCompact;
+};
+
+/**
+ * @brief 전역 UObject 배열을 반환하는 함수
+ * @return GUObjectArray 참조
+ */
+FUObjectArray& GetUObjectArray();
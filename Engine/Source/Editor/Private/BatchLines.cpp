@@ -70,7 +70,7 @@ void UBatchLines::UpdateOctreeVertices(const FOctree* InOctree)
 	OctreeLines.Empty();
 	if (InOctree)
 	{
-		TraverseOctree(InOctree);
+		TraverseOctree(InOctree, InOctree->GetRootIndex());
 	}
 	bChangedVertices = true;
 }
@@ -180,19 +180,20 @@ void UBatchLines::UpdateConeVertices(const FVector& InCenter, float InGenerating
 }
 
 
-void UBatchLines::TraverseOctree(const FOctree* InNode)
+void UBatchLines::TraverseOctree(const FOctree* InOctree, int32 InNodeIndex)
 {
-	if (!InNode) { return; }
+	const FOctreeNode& Node = InOctree->GetNode(InNodeIndex);
 
 	UBoundingBoxLines BoxLines;
-	BoxLines.UpdateVertices(&InNode->GetBoundingBox());
+	BoxLines.UpdateVertices(&Node.Bounds);
 	OctreeLines.Add(BoxLines);
 
-	if (!InNode->IsLeafNode())
+	// 프리미티브가 있는 자식 노드만 그림
+	for (int32 Index = 0; Index < 8; ++Index)
 	{
-		for (const auto& Child : InNode->GetChildren())
+		if (Node.HasChild(Index))
 		{
-			TraverseOctree(Child);
+			TraverseOctree(InOctree, Node.FirstChild + Index);
 		}
 	}
 }
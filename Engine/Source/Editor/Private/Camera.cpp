@@ -154,8 +154,7 @@ void UCamera::Update(const D3D11_VIEWPORT& InViewport)
     if (CurrentLevel)
     {
         ViewVolumeCuller.Cull(
-            CurrentLevel->GetStaticOctree(),
-            CurrentLevel->GetDynamicPrimitives(),
+            CurrentLevel,
             CameraConstants
         );
     }
@@ -7,6 +7,9 @@
 #include "Manager/Lua/Public/LuaManager.h"
 #include "Manager/Path/Public/PathManager.h"
 #include "Manager/UI/Public/ViewportManager.h"
+#include "Render/UI/Viewport/Public/Viewport.h"
+#include "Render/UI/Viewport/Public/ViewportClient.h"
+#include "Editor/Public/Camera.h"
 
 IMPLEMENT_CLASS(UEditorEngine, UObject)
 UEditorEngine* GEditor = nullptr;
@@ -65,8 +68,10 @@ void UEditorEngine::Tick(float DeltaSeconds)
         UWorld* World = Context.World();
         if (World)
         {
+            UViewportManager& ViewportManager = UViewportManager::GetInstance();
             if (World->GetWorldType() == EWorldType::Editor)
             {
+                UpdateTickViewLocation(World, ViewportManager.GetActiveIndex());
                 World->Tick(DeltaSeconds);
             }
             else if (World->GetWorldType() == EWorldType::PIE)
@@ -74,6 +79,7 @@ void UEditorEngine::Tick(float DeltaSeconds)
                 // PIE 상태가 Playing일 때만 틱을 실행
                 if (PIEState == EPIEState::Playing)
                 {
+                    UpdateTickViewLocation(World, ViewportManager.GetPIEActiveViewportIndex());
                     World->Tick(DeltaSeconds);
                 }
             }
@@ -88,6 +94,28 @@ void UEditorEngine::Tick(float DeltaSeconds)
     ULuaManager::GetInstance().Update(DeltaSeconds);
 }
 
+/**
+ * @brief 뷰포트 카메라 위치를 World의 Tick 간격 조절 기준으로 설정
+ * 카메라를 찾지 못하면 기준을 지워 모든 Tick 함수를 원래 간격으로 실행
+ */
+void UEditorEngine::UpdateTickViewLocation(UWorld* InWorld, int32 InViewportIndex)
+{
+    FTickTaskManager& TickTaskManager = InWorld->GetTickTaskManager();
+    TArray<FViewport*>& Viewports = UViewportManager::GetInstance().GetViewports();
+
+    if (InViewportIndex >= 0 && InViewportIndex < Viewports.Num() && Viewports[InViewportIndex])
+    {
+        FViewportClient* ViewportClient = Viewports[InViewportIndex]->GetViewportClient();
+        if (ViewportClient && ViewportClient->GetCamera())
+        {
+            TickTaskManager.SetViewLocation(ViewportClient->GetCamera()->GetLocation());
+            return;
+        }
+    }
+
+    TickTaskManager.ClearViewLocation();
+}
+
 /**
  * @brief PIE가 활성화되어 있는지 확인
  */
@@ -4,7 +4,7 @@
 #include "Editor/Public/Gizmo.h"
 #include "Editor/Public/GizmoMath.h"
 #include "Component/Public/PrimitiveComponent.h"
-#include "Global/Octree.h"
+#include "Level/Public/Level.h"
 #include "Physics/Public/AABB.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Manager/UI/Public/ViewportManager.h"
@@ -354,6 +354,16 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 	const TArray<uint32>* Indices = Primitive->GetIndicesData();
 
 	FRay ModelRay = GetModelRay(WorldRay, Primitive);
+
+	// 정적 메시는 BVH에서 가장 가까운 교차 하나만 찾음
+	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
+	{
+		FStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh()->GetStaticMeshAsset();
+		if (StaticMesh && !StaticMesh->BVH.IsEmpty())
+		{
+			return IsRayStaticMeshCollided(InActiveCamera, ModelRay, StaticMesh->BVH, ModelMatrix, ShortestDistance);
+		}
+	}
 	
 	// 충돌 가능성 있는 삼각형 인덱스 수집
 	// Triangle Ordinal(인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호)로 반환
@@ -386,6 +396,29 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 	return bIsHit;
 }
 
+bool UObjectPicker::IsRayStaticMeshCollided(UCamera* InActiveCamera, const FRay& ModelRay, const FBVH& BVH, const FMatrix& ModelMatrix,
+	float* ShortestDistance)
+{
+	// IsRayTriangleCollided와 같은 near / far 판정을 레이 매개변수 범위로 바꿔 BVH 순회 중에 먼 교차를 버림
+	// 모델 좌표계의 T만큼 나아가면 월드 좌표계에서는 WorldStep * T만큼 이동하므로, 카메라 전방 거리는 T에 비례함
+	const FVector4 ModelDirection{ ModelRay.Direction.X, ModelRay.Direction.Y, ModelRay.Direction.Z, 0.0f };
+	const FVector4 WorldStep = ModelDirection * ModelMatrix;
+	const float ForwardStep = WorldStep.Dot3(InActiveCamera->GetForward());
+	if (ForwardStep <= 0.0f)
+	{
+		return false; // 카메라 뒤쪽을 향하는 레이
+	}
+
+	FBVHRayHit Hit;
+	if (!BVH.RaycastClosest(ModelRay, InActiveCamera->GetNearZ() / ForwardStep, InActiveCamera->GetFarZ() / ForwardStep, Hit))
+	{
+		return false;
+	}
+
+	*ShortestDistance = std::min(*ShortestDistance, Hit.Distance * WorldStep.Length());
+	return true;
+}
+
 bool UObjectPicker::IsRayTriangleCollided(UCamera* InActiveCamera, const FRay& Ray, const FVector& Vertex1, const FVector& Vertex2, const FVector& Vertex3,
                            const FMatrix& ModelMatrix, float* Distance)
 {
@@ -472,50 +505,24 @@ bool UObjectPicker::IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoi
 }
 
 /**
- * 레이와 충돌하는 후보 노드들을 찾아 그 안의 프리미티브들을 OutCandidate에 담습니다.
+ * 레벨의 공간 인덱스에서 경계가 레이와 교차하는 프리미티브들을 OutCandidate에 담습니다.
  * @return 후보를 찾았으면 true, 못 찾았으면 false를 반환합니다.
  */
-bool UObjectPicker::FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
+bool UObjectPicker::FindCandidateFromLevel(ULevel* InLevel, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
 {
 	// 0. nullptr인지 검사.
-	if (!Node) { return false; }
-
-	// 1. 레이가 현재 노드와 겹치지 않으면 검사 생략.
-	if (CheckIntersectionRayBox(WorldRay, Node->GetBoundingBox()) == false) { return false; }
-
-	// 2. 현재 노드와 레이가 교차하므로, 이 노드에 직접 포함된 프리미티브들을 후보에 추가합니다.
-	const auto& CurrentNodePrimitives = Node->GetPrimitives();
-	if (!CurrentNodePrimitives.IsEmpty())
-	{
-		OutCandidate.Append(Node->GetPrimitives());
-	}
+	if (!InLevel) { return false; }
 
-	// 3. 리프 노드가 아니라면, 자식 노드를 재귀적으로 탐색합니다.
-	if (!Node->IsLeafNode())
-	{
-		for (FOctree* Child : Node->GetChildren())
-		{
-			FindCandidateFromOctree(Child, WorldRay, OutCandidate);
-		}
-	}
+	// 1. 정적 Octree와 동적 트리를 함께 순회하며 레이와 겹치지 않는 노드는 하위까지 검사를 생략합니다.
+	const int32 NumCandidates = OutCandidate.Num();
+	InLevel->GatherPrimitives(FQueryRay(WorldRay), OutCandidate);
 
-	return true;
+	return OutCandidate.Num() > NumCandidates;
 }
 
 void UObjectPicker::GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateIndices)
 {
-	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
-	{
-		if (FStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh()->GetStaticMeshAsset())
-		{
-			if (StaticMesh->BVH.TraverseRay(ModelRay, OutCandidateIndices))
-            {
-				return;
-            }
-		}
-	}
-
-	// fallback: 전체 삼각형 인덱스 채우기
+	// BVH가 없는 프리미티브는 전체 삼각형 인덱스 채우기
 	const TArray<FNormalVertex>* Vertices = Primitive->GetVerticesData();
 	const TArray<uint32>* Indices = Primitive->GetIndicesData();
 
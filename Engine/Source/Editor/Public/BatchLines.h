@@ -60,7 +60,7 @@ private:
 	void RenderOctree();             // Octree
 	void SetIndices();
 
-	void TraverseOctree(const FOctree* InNode);
+	void TraverseOctree(const FOctree* InOctree, int32 InNodeIndex);
 
 	/*void AddWorldGridVerticesAndConstData();
 	void AddBoundingBoxVertices();*/
@@ -67,6 +67,8 @@ private:
     FWorldContext* GetPIEWorldContext();
     // 현재 PIE 세션 중인지 확인하고, 그렇다면 현재 WorldContext를 반환
     FWorldContext* GetActiveWorldContext();
+    // 뷰포트 카메라 위치를 World의 Tick 간격 조절 기준으로 설정
+    void UpdateTickViewLocation(UWorld* InWorld, int32 InViewportIndex);
     
     EPIEState PIEState = EPIEState::Stopped;
     TArray<FWorldContext> WorldContexts;
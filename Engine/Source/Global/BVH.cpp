@@ -2,380 +2,835 @@
 #include "Global/BVH.h"
 
 #include "Component/Mesh/Public/StaticMesh.h"
+#include "Runtime/Core/Public/Async/ParallelFor.h"
 
-FBVH::FBVH(FStaticMesh* InMesh)
+namespace
 {
-	Build(InMesh);
-}
+	/** @brief 노드 하나를 지날 때의 비용 (삼각형 하나와 교차 검사하는 비용이 1) */
+	constexpr float BVH_TRAVERSAL_COST = 1.0f;
+	/** @brief 나누는 축이 한쪽으로만 쏠리는 퇴화 입력에서 재귀가 끝없이 깊어지지 않도록 막는 깊이 */
+	constexpr int32 BVH_MAX_DEPTH = 64;
+
+	/**
+	 * @brief 구축 중에만 쓰는 축 정렬 경계
+	 * 축 번호로 바로 접근하고 FVector 생성자 호출 없이 넓히기 위해 float 배열로 둠
+	 */
+	struct FBuildBounds
+	{
+		float Min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float Max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
 
-const FNode& FBVH::GetNode(uint32 Index) const
-{
-	assert(Index < Nodes.Num());
-	return Nodes[Index];
-}
+		void Grow(const FBuildBounds& InOther)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Min[Axis] = std::min(Min[Axis], InOther.Min[Axis]);
+				Max[Axis] = std::max(Max[Axis], InOther.Max[Axis]);
+			}
+		}
 
-FNode& FBVH::GetNode(uint32 Index)
-{
-	assert(Index < Nodes.Num());
-	return Nodes[Index];
-}
+		void Grow(const float* InPoint)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Min[Axis] = std::min(Min[Axis], InPoint[Axis]);
+				Max[Axis] = std::max(Max[Axis], InPoint[Axis]);
+			}
+		}
 
-void FBVH::Clear()
-{
-	Mesh = nullptr;
-	Nodes.Empty();
-	RootIndex = -1;
-	Cost = 0.0f;
-}
+		/** @brief 표면적의 절반 (비용 비교에만 쓰므로 상수배는 무시), 빈 경계는 0 */
+		float GetHalfArea() const
+		{
+			const float X = Max[0] - Min[0];
+			const float Y = Max[1] - Min[1];
+			const float Z = Max[2] - Min[2];
+			if (X < 0.0f || Y < 0.0f || Z < 0.0f)
+			{
+				return 0.0f;
+			}
+			return X * Y + Y * Z + Z * X;
+		}
 
-int32 FBVH::InsertLeaf(int32 InTriangleBaseIndex)
-{
-	if(!Mesh)
-	{
-		std::cerr << "FBVH::InsertLeaf: Mesh is null. Cannot insert leaf node." << std::endl;
-		return -1;
-	}
+		FAABB ToAABB() const
+		{
+			return FAABB(FVector(Min[0], Min[1], Min[2]), FVector(Max[0], Max[1], Max[2]));
+		}
+	};
 
-	if(InTriangleBaseIndex < 0 || InTriangleBaseIndex + 2 >= Mesh->Indices.Num() || InTriangleBaseIndex % 3 != 0)
+	/** @brief 구축 중에만 쓰는 삼각형 경계와 중심 */
+	struct FBuildTriangle
 	{
-		std::cerr << "FBVH::InsertLeaf: Invalid triangle base index." << std::endl;
-		return -1;
-	}
-
-	// 1. 새 Leaf node의 AABB 계산
-	FNormalVertex V0 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex]];
-	FNormalVertex V1 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex + 1]];
-	FNormalVertex V2 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex + 2]];
-	FAABB LeafAABB = GetTriangleAABB(V0, V1, V2);
-
-	// 2. 새 Leaf node 생성
-	FNode NewNode;
-	NewNode.ObjectIndex = Nodes.Num();
-	NewNode.ParentIndex = -1; // Parent는 InsertInternalNode에서 설정
-	NewNode.Child1 = -1;
-	NewNode.Child2 = -1;
-	NewNode.bIsLeaf = true;
-	NewNode.Box = LeafAABB;
-	NewNode.TriangleBaseIndex = InTriangleBaseIndex;
-	// 빈 트리인 경우 새 노드를 루트로 설정하고 종료
-	if (NewNode.ObjectIndex == 0)
-	{
-		Nodes.Add(NewNode);
-		RootIndex = 0;
-		Cost = GetCost(RootIndex);
-		return 0;
-	}
-
-	// 3. 새 Leaf node를 삽입할 최적의 sibling node 찾기;
-	int32 SiblingIndex = FindBestSibling(NewNode.Box);
+		FBuildBounds Bounds;
+		float Centroid[3];
+	};
 
-	// 4. 새 leaf node와 sibling의 새로운 부모 node 생성
-	Nodes.Add(NewNode);
-	InsertInternalNode(NewNode.ObjectIndex, SiblingIndex);
+	struct FBuildBin
+	{
+		FBuildBounds Bounds;
+		int32 Count = 0;
+	};
 
-	// 5. 새 node가 추가되었으므로 부모 거슬러올라가며 AABB 리피팅
-	// NewNode의 부모가 InsertInternalNode에서 설정했고, 부모의 AABB도 끝내둠.
-	// 리핏은 ParentIndex부터 시작
-	RefitAncestors(Nodes[SiblingIndex].ParentIndex);
+	/** @brief 넓은 노드로 접기 전의 이진 트리 노드 */
+	struct FBuildNode
+	{
+		FBuildBounds Bounds;
+		/** @brief 내부 노드의 두 자식 (연속으로 할당되어 Child2 = Child1 + 1), 리프는 -1 */
+		int32 Child1 = -1;
+		int32 Child2 = -1;
+		/** @brief 리프의 삼각형이 TriangleIndices에서 차지하는 구간 */
+		int32 FirstTriangle = 0;
+		int32 NumTriangles = 0;
+
+		bool IsLeaf() const { return Child1 < 0; }
+	};
 
-	return NewNode.ObjectIndex;
-}
+	struct FBuildContext
+	{
+		const FBuildTriangle* Triangles;
+		/** @brief 노드마다 자기 구간만 다시 정렬하므로 여러 스레드가 동시에 써도 겹치지 않음 */
+		int32* TriangleIndices;
+		bool bParallel;
+	};
 
-float FBVH::GetCost(int32 SubTreeRootIndex, bool bInternalOnly) const
-{
-	// 인덱스 벗어난 경우 0 반환
-	if (SubTreeRootIndex >= Nodes.Num() || SubTreeRootIndex < 0)
+	int32 GetBinIndex(float InCentroid, float InCentroidMin, float InBinScale)
 	{
-		return 0.0f;
+		const int32 Bin = static_cast<int32>((InCentroid - InCentroidMin) * InBinScale);
+		return std::min(std::max(Bin, 0), BVH_NUM_BINS - 1);
 	}
 
-	const FNode& SubTreeRoot = Nodes[SubTreeRootIndex];
-	if (SubTreeRoot.bIsLeaf)
+	/**
+	 * @brief InNodeIndex 노드를 [InBegin, InEnd) 삼각형 구간으로 채우고, 나눠야 하면 자식 두 개를 OutNodes 끝에 붙여 재귀
+	 * 충분히 큰 구간은 한쪽 자식을 태스크로 맡겨 별도 배열에 만든 뒤 OutNodes 끝에 옮겨 붙임
+	 */
+	void BuildNode(const FBuildContext& InContext, TArray<FBuildNode>& OutNodes, int32 InNodeIndex, int32 InBegin, int32 InEnd, int32 InDepth)
 	{
-		// InternalOnly면 leaf node의 cost는 0으로 계산
-		// 새 노드 삽입시 최적 위치 계산하는 경우는 leaf node의 cost가 상수이기 때문
-		if (bInternalOnly)
+		const FBuildTriangle* Triangles = InContext.Triangles;
+		const int32* Indices = InContext.TriangleIndices;
+
+		// 1. 노드 경계와 삼각형 중심의 범위
+		FBuildBounds Bounds;
+		FBuildBounds CentroidBounds;
+		for (int32 Index = InBegin; Index < InEnd; ++Index)
 		{
-			return 0.0f;
+			const FBuildTriangle& Triangle = Triangles[Indices[Index]];
+			Bounds.Grow(Triangle.Bounds);
+			CentroidBounds.Grow(Triangle.Centroid);
 		}
 
-		return SubTreeRoot.Box.GetSurfaceArea();
-	}
-
-	return SubTreeRoot.Box.GetSurfaceArea() + GetCost(SubTreeRoot.Child1, bInternalOnly) + GetCost(SubTreeRoot.Child2, bInternalOnly);
-}
+		const int32 NumTriangles = InEnd - InBegin;
+		OutNodes[InNodeIndex].Bounds = Bounds;
 
-int32 FBVH::FindBestSibling(const FAABB& NewLeafAABB)
-{
-	int32 BestSiblingIndex = -1;
-	float MinCostIncrease = FLT_MAX;
+		auto MakeLeaf = [&OutNodes, InNodeIndex, InBegin, NumTriangles]()
+		{
+			FBuildNode& Node = OutNodes[InNodeIndex];
+			Node.Child1 = -1;
+			Node.Child2 = -1;
+			Node.FirstTriangle = InBegin;
+			Node.NumTriangles = NumTriangles;
+		};
+
+		if (NumTriangles == 1 || InDepth >= BVH_MAX_DEPTH)
+		{
+			MakeLeaf();
+			return;
+		}
 
-	// Branch and Bound 최적화를 위한 스택 기반 순회
-	// 루트부터 시작하여 더 나은 후보가 있을 수 있는 노드들만 방문
-	TArray<int32> CandidateStack;
-	CandidateStack.Add(RootIndex);
+		// 2. 세 축의 빈에 삼각형을 한 번에 모은 뒤, 축마다 양쪽에서 누적해 빈 경계마다 SAH 비용 계산
+		float BinScales[3];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float Extent = CentroidBounds.Max[Axis] - CentroidBounds.Min[Axis];
+			BinScales[Axis] = Extent > 0.0f ? BVH_NUM_BINS / Extent : 0.0f;
+		}
 
-	while (!CandidateStack.IsEmpty())
-	{
-		int32 CurrentIndex = CandidateStack.Last();
-		CandidateStack.Pop();
+		FBuildBin Bins[3][BVH_NUM_BINS];
+		for (int32 Index = InBegin; Index < InEnd; ++Index)
+		{
+			const FBuildTriangle& Triangle = Triangles[Indices[Index]];
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				FBuildBin& Bin = Bins[Axis][GetBinIndex(Triangle.Centroid[Axis], CentroidBounds.Min[Axis], BinScales[Axis])];
+				Bin.Bounds.Grow(Triangle.Bounds);
+				++Bin.Count;
+			}
+		}
 
-		if (CurrentIndex < 0 || CurrentIndex >= Nodes.Num())
+		int32 BestAxis = -1;
+		int32 BestSplit = 0;
+		float BestCost = FLT_MAX;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
 		{
-			continue;
+			// 중심이 한 평면에 모인 축은 나눌 수 없음
+			if (BinScales[Axis] <= 0.0f)
+			{
+				continue;
+			}
+
+			// RightCosts[Split]: 빈 Split+1 .. 끝의 면적 x 개수
+			float RightCosts[BVH_NUM_BINS - 1];
+			FBuildBounds RightBounds;
+			int32 RightCount = 0;
+			for (int32 Split = BVH_NUM_BINS - 2; Split >= 0; --Split)
+			{
+				RightBounds.Grow(Bins[Axis][Split + 1].Bounds);
+				RightCount += Bins[Axis][Split + 1].Count;
+				RightCosts[Split] = RightBounds.GetHalfArea() * RightCount;
+			}
+
+			FBuildBounds LeftBounds;
+			int32 LeftCount = 0;
+			for (int32 Split = 0; Split < BVH_NUM_BINS - 1; ++Split)
+			{
+				LeftBounds.Grow(Bins[Axis][Split].Bounds);
+				LeftCount += Bins[Axis][Split].Count;
+				if (LeftCount == 0 || LeftCount == NumTriangles)
+				{
+					continue;
+				}
+
+				const float SplitCost = LeftBounds.GetHalfArea() * LeftCount + RightCosts[Split];
+				if (SplitCost < BestCost)
+				{
+					BestCost = SplitCost;
+					BestAxis = Axis;
+					BestSplit = Split;
+				}
+			}
 		}
 
-		const FNode& CurrentNode = Nodes[CurrentIndex];
-		FAABB CombinedAABB = Union(NewLeafAABB, CurrentNode.Box);
+		// 3. 나누는 비용이 리프로 두는 비용보다 크면 리프 (단, 최대 크기를 넘으면 나눔)
+		const float NodeArea = Bounds.GetHalfArea();
+		const float LeafCost = static_cast<float>(NumTriangles);
+		const float SplitCost = NodeArea > 0.0f ? BVH_TRAVERSAL_COST + BestCost / NodeArea : FLT_MAX;
+		if (NumTriangles <= BVH_MAX_LEAF_TRIANGLES && (BestAxis < 0 || SplitCost >= LeafCost))
+		{
+			MakeLeaf();
+			return;
+		}
 
-		// 하한 비용 계산: 이 서브트리의 어떤 리프를 선택하더라도 최소한 발생하는 '증가' 비용
-		float DirectIncrease = CombinedAABB.GetSurfaceArea() - CurrentNode.Box.GetSurfaceArea();
-		float InheritedIncrease = 0.0f;
-		int32 AncestorIndex = CurrentNode.ParentIndex;
-		int32 CurrentChildIndex = CurrentIndex;
-		FAABB CurrentAABB = CombinedAABB;
-		while(AncestorIndex != -1)
+		int32 Mid = InBegin + NumTriangles / 2;
+		if (BestAxis >= 0)
 		{
-			const FNode& AncestorNode = Nodes[AncestorIndex];
-			int32 SiblingOfCurrentChildIndex = (AncestorNode.Child1 == CurrentChildIndex)
-				? AncestorNode.Child2
-				: AncestorNode.Child1;
-			const FNode& SiblingOfCurrentChild = Nodes[SiblingOfCurrentChildIndex];
+			const float AxisMin = CentroidBounds.Min[BestAxis];
+			const float BinScale = BinScales[BestAxis];
+			int32* RangeBegin = InContext.TriangleIndices + InBegin;
+			int32* RangeEnd = InContext.TriangleIndices + InEnd;
+			const int32 PartitionMid = static_cast<int32>(std::partition(RangeBegin, RangeEnd, [=](int32 InTriangle)
+			{
+				return GetBinIndex(Triangles[InTriangle].Centroid[BestAxis], AxisMin, BinScale) <= BestSplit;
+			}) - InContext.TriangleIndices);
 
-			FAABB AncestorNewAABB = Union(SiblingOfCurrentChild.Box, CurrentAABB);
-			InheritedIncrease += AncestorNewAABB.GetSurfaceArea() - AncestorNode.Box.GetSurfaceArea();
-			AncestorIndex = AncestorNode.ParentIndex;
-			CurrentChildIndex = AncestorNode.ObjectIndex;
-			CurrentAABB = AncestorNewAABB;
+			// 중심이 모두 같은 점이라 나눌 기준이 없을 때는 구간을 반으로 자른 그대로 둠
+			if (PartitionMid > InBegin && PartitionMid < InEnd)
+			{
+				Mid = PartitionMid;
+			}
 		}
-		float LowerBoundIncrease = DirectIncrease + InheritedIncrease;
 
-		// 하한 비용이 현재 최적 증가 비용 이상이면 이 서브트리에서는 더 나은 해를 찾을 수 없으므로 탐색 중단
-		if (LowerBoundIncrease >= MinCostIncrease)
+		// 4. 자식 두 개를 연속으로 할당하고 재귀
+		const int32 Child1 = OutNodes.Num();
+		OutNodes.SetNum(Child1 + 2);
+		OutNodes[InNodeIndex].Child1 = Child1;
+		OutNodes[InNodeIndex].Child2 = Child1 + 1;
+		OutNodes[InNodeIndex].FirstTriangle = 0;
+		OutNodes[InNodeIndex].NumTriangles = 0;
+
+		if (!InContext.bParallel || NumTriangles < BVH_PARALLEL_MIN_TRIANGLES)
 		{
-			continue; // 조기 포기
+			BuildNode(InContext, OutNodes, Child1, InBegin, Mid, InDepth + 1);
+			BuildNode(InContext, OutNodes, Child1 + 1, Mid, InEnd, InDepth + 1);
+			return;
 		}
 
-		if (CurrentNode.bIsLeaf)
+		// 왼쪽 하위 트리는 워커가 자기 배열에 만들고, 오른쪽은 이 스레드가 OutNodes에 바로 만듦
+		TArray<FBuildNode> LeftNodes;
+		LeftNodes.SetNum(1);
+		const FBuildContext* Context = &InContext;
+		FGraphEventRef LeftTask = FTaskGraph::Get().Launch([Context, &LeftNodes, InBegin, Mid, InDepth]()
 		{
-			// 리프 노드인 경우: 전체 비용 증가 계산
-			float TotalCostIncrease = CalculateCostIncrease(CurrentIndex, NewLeafAABB);
-
-			if (TotalCostIncrease < MinCostIncrease)
+			BuildNode(*Context, LeftNodes, 0, InBegin, Mid, InDepth + 1);
+		});
+		BuildNode(InContext, OutNodes, Child1 + 1, Mid, InEnd, InDepth + 1);
+		FTaskGraph::Get().Wait(LeftTask);
+
+		// 왼쪽 배열의 루트는 Child1 자리로, 나머지는 OutNodes 끝으로 옮기며 자식 인덱스를 바꿈 (배열 안의 1번 -> Offset번)
+		const int32 Offset = OutNodes.Num();
+		auto Relocate = [Offset](FBuildNode& InOutNode)
+		{
+			if (!InOutNode.IsLeaf())
 			{
-				MinCostIncrease = TotalCostIncrease;
-				BestSiblingIndex = CurrentIndex;
+				InOutNode.Child1 += Offset - 1;
+				InOutNode.Child2 += Offset - 1;
 			}
+		};
+
+		OutNodes[Child1] = LeftNodes[0];
+		Relocate(OutNodes[Child1]);
+		OutNodes.Reserve(Offset + LeftNodes.Num() - 1);
+		for (int32 Index = 1; Index < LeftNodes.Num(); ++Index)
+		{
+			OutNodes.Add(LeftNodes[Index]);
+			Relocate(OutNodes.Last());
+		}
+	}
+
+	/** @brief 레이가 삼각형 평면과 평행하다고 보는 행렬식 크기 (단위 방향 기준, 넓이 제곱 단위) */
+	constexpr float BVH_DETERMINANT_EPSILON = 1e-12f;
+
+	/** @brief 묶음으로 순회할 레이들의 방향이 평균 방향과 이루는 최소 코사인 (약 25도, 벗어나면 레이마다 순회) */
+	constexpr float BVH_PACKET_MIN_COHERENCE = 0.9f;
+
+	/**
+	 * @brief 슬롯을 비움
+	 * 경계를 뒤집어 두면 가까운 면은 +FLT_MAX, 먼 면은 -FLT_MAX 쪽에 놓여 어떤 레이의 슬랩 검사도 통과하지 못함
+	 */
+	void ClearSlot(FBVHNode& OutNode, int32 InSlot)
+	{
+		OutNode.MinX[InSlot] = FLT_MAX;
+		OutNode.MinY[InSlot] = FLT_MAX;
+		OutNode.MinZ[InSlot] = FLT_MAX;
+		OutNode.MaxX[InSlot] = -FLT_MAX;
+		OutNode.MaxY[InSlot] = -FLT_MAX;
+		OutNode.MaxZ[InSlot] = -FLT_MAX;
+		OutNode.Child[InSlot] = -1;
+		OutNode.NumTriangles[InSlot] = 0;
+	}
+
+	void SetSlot(FBVHNode& OutNode, int32 InSlot, const FBuildBounds& InBounds, int32 InChild, int32 InNumTriangles)
+	{
+		OutNode.MinX[InSlot] = InBounds.Min[0];
+		OutNode.MinY[InSlot] = InBounds.Min[1];
+		OutNode.MinZ[InSlot] = InBounds.Min[2];
+		OutNode.MaxX[InSlot] = InBounds.Max[0];
+		OutNode.MaxY[InSlot] = InBounds.Max[1];
+		OutNode.MaxZ[InSlot] = InBounds.Max[2];
+		OutNode.Child[InSlot] = InChild;
+		OutNode.NumTriangles[InSlot] = InNumTriangles;
+	}
+
+	/**
+	 * @brief InBinaryIndex 이진 노드 아래를 넓은 노드 하나로 접고 그 인덱스를 반환
+	 * 자식이 BVH_WIDTH개가 될 때까지 표면적이 가장 큰 내부 자식을 그 두 자식으로 바꾼 뒤, 남은 내부 자식을 재귀로 접음
+	 */
+	int32 CollapseNode(const TArray<FBuildNode>& InBinaryNodes, int32 InBinaryIndex, TArray<FBVHNode>& OutNodes, float& InOutCost)
+	{
+		int32 Slots[BVH_WIDTH];
+		int32 NumSlots = 0;
+		const FBuildNode& BinaryNode = InBinaryNodes[InBinaryIndex];
+		if (BinaryNode.IsLeaf())
+		{
+			// 삼각형이 적어 루트가 리프인 경우 리프 하나를 가진 노드가 됨
+			Slots[NumSlots++] = InBinaryIndex;
 		}
 		else
 		{
-			// 내부 노드인 경우: 자식들을 스택에 추가
-			// 하지만 Lower Bound가 현재 최적해보다 좋을 때만
+			Slots[NumSlots++] = BinaryNode.Child1;
+			Slots[NumSlots++] = BinaryNode.Child2;
+		}
 
-			if (LowerBoundIncrease < MinCostIncrease)
+		while (NumSlots < BVH_WIDTH)
+		{
+			int32 BestSlot = -1;
+			float BestArea = -1.0f;
+			for (int32 Slot = 0; Slot < NumSlots; ++Slot)
 			{
-				// 자식 노드들을 후보에 추가
-				if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < Nodes.Num())
-				{
-					CandidateStack.Add(CurrentNode.Child1);
-				}
-				if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < Nodes.Num())
+				const FBuildNode& Candidate = InBinaryNodes[Slots[Slot]];
+				if (!Candidate.IsLeaf() && Candidate.Bounds.GetHalfArea() > BestArea)
 				{
-					CandidateStack.Add(CurrentNode.Child2);
+					BestArea = Candidate.Bounds.GetHalfArea();
+					BestSlot = Slot;
 				}
 			}
-			// else: 이 서브트리는 더 이상 탐색하지 않음 (Bound)
+			if (BestSlot < 0)
+			{
+				break;
+			}
+
+			const FBuildNode& Opened = InBinaryNodes[Slots[BestSlot]];
+			Slots[BestSlot] = Opened.Child1;
+			Slots[NumSlots++] = Opened.Child2;
 		}
-	}
 
-	return BestSiblingIndex;
-}
+		// 재귀가 OutNodes를 늘리므로 노드는 참조로 잡아 두지 않고 매번 인덱스로 접근
+		const int32 NodeIndex = OutNodes.Num();
+		OutNodes.SetNum(NodeIndex + 1);
+		for (int32 Slot = 0; Slot < BVH_WIDTH; ++Slot)
+		{
+			if (Slot >= NumSlots)
+			{
+				ClearSlot(OutNodes[NodeIndex], Slot);
+				continue;
+			}
 
-float FBVH::CalculateCostIncrease(int32 CandidateIndex, const FAABB& NewLeafAABB) const
-{
-	if (CandidateIndex < 0 || CandidateIndex >= Nodes.Num())
-	{
-		return FLT_MAX;
+			const FBuildNode& Child = InBinaryNodes[Slots[Slot]];
+			InOutCost += 2.0f * Child.Bounds.GetHalfArea();
+			if (Child.IsLeaf())
+			{
+				SetSlot(OutNodes[NodeIndex], Slot, Child.Bounds, Child.FirstTriangle, Child.NumTriangles);
+			}
+			else
+			{
+				const int32 ChildIndex = CollapseNode(InBinaryNodes, Slots[Slot], OutNodes, InOutCost);
+				SetSlot(OutNodes[NodeIndex], Slot, Child.Bounds, ChildIndex, 0);
+			}
+		}
+		return NodeIndex;
 	}
 
-	const FNode& CandidateNode = Nodes[CandidateIndex];
-	const FAABB& SiblingAABB = CandidateNode.Box;
+	/**
+	 * @brief Möller–Trumbore 레이 / 삼각형 교차 (양면 판정)
+	 * [InMinDistance, InOutDistance) 범위에서 교차하면 InOutDistance를 교차 거리로 줄이고 true
+	 */
+	bool IntersectTriangle(const FBVHTriangle& InTriangle, const float* InOrigin, const float* InDirection, float InMinDistance,
+		float& InOutDistance)
+	{
+		const float* Edge1 = InTriangle.Edge1;
+		const float* Edge2 = InTriangle.Edge2;
+
+		// P = Direction x Edge2
+		const float PX = InDirection[1] * Edge2[2] - InDirection[2] * Edge2[1];
+		const float PY = InDirection[2] * Edge2[0] - InDirection[0] * Edge2[2];
+		const float PZ = InDirection[0] * Edge2[1] - InDirection[1] * Edge2[0];
+		const float Determinant = Edge1[0] * PX + Edge1[1] * PY + Edge1[2] * PZ;
+		if (std::fabs(Determinant) < BVH_DETERMINANT_EPSILON)
+		{
+			return false;
+		}
+		const float InvDeterminant = 1.0f / Determinant;
 
-	// 새 리프와 sibling을 묶는 새 internal node의 AABB 계산
-	FAABB CombinedAABB = Union(NewLeafAABB, SiblingAABB);
+		const float SX = InOrigin[0] - InTriangle.V0[0];
+		const float SY = InOrigin[1] - InTriangle.V0[1];
+		const float SZ = InOrigin[2] - InTriangle.V0[2];
+		const float U = (SX * PX + SY * PY + SZ * PZ) * InvDeterminant;
+		if (U < 0.0f || U > 1.0f)
+		{
+			return false;
+		}
 
-	// Cost 증가 계산: 새 internal node의 surface area
-	// (기존 sibling의 cost는 leaf이므로 변화 없음)
-	float CostIncrease = CombinedAABB.GetSurfaceArea();
+		// Q = S x Edge1
+		const float QX = SY * Edge1[2] - SZ * Edge1[1];
+		const float QY = SZ * Edge1[0] - SX * Edge1[2];
+		const float QZ = SX * Edge1[1] - SY * Edge1[0];
+		const float V = (InDirection[0] * QX + InDirection[1] * QY + InDirection[2] * QZ) * InvDeterminant;
+		if (V < 0.0f || U + V > 1.0f)
+		{
+			return false;
+		}
 
-	// Sibling이 가지고 있던 부모 노드가 있다면
-	// 부모부터 루트까지 올라가며 추가 cost 계산
-	int32 AncestorIndex = CandidateNode.ParentIndex;
-	int32 CurrentChildIndex = CandidateIndex;
-	FAABB CurrentAABB = CombinedAABB;
-	while (AncestorIndex != -1 && AncestorIndex < Nodes.Num())
-	{
-		const FNode& AncestorNode = Nodes[AncestorIndex];
+		const float Distance = (Edge2[0] * QX + Edge2[1] * QY + Edge2[2] * QZ) * InvDeterminant;
+		if (Distance < InMinDistance || Distance >= InOutDistance)
+		{
+			return false;
+		}
 
-		// 형제 노드의 AABB와 합쳐서 새로운 조상 AABB 계산
-		int32 SiblingOfCurrentChildIndex = (AncestorNode.Child1 == CurrentChildIndex)
-			? AncestorNode.Child2
-			: AncestorNode.Child1;
+		InOutDistance = Distance;
+		return true;
+	}
 
-		if (SiblingOfCurrentChildIndex >= 0 && SiblingOfCurrentChildIndex < Nodes.Num())
+	/** @brief 순회에 쓰는 레이 (축마다 레이가 먼저 만나는 면을 방향 부호로 미리 골라 둠) */
+	struct FTraversalRay
+	{
+		float Origin[3];
+		float Direction[3];
+		__m128 Origin4[3];
+		__m128 InvDirection4[3];
+		bool bNegative[3];
+
+		void Set(const FRay& InRay)
 		{
-			const FAABB& SiblingOfCurrentChild = Nodes[SiblingOfCurrentChildIndex].Box;
-			FAABB NewAncestorAABB = Union(CurrentAABB, SiblingOfCurrentChild);
-			CostIncrease += NewAncestorAABB.GetSurfaceArea() - AncestorNode.Box.GetSurfaceArea();
-			CurrentAABB = NewAncestorAABB;
+			Origin[0] = InRay.Origin.X;
+			Origin[1] = InRay.Origin.Y;
+			Origin[2] = InRay.Origin.Z;
+			Direction[0] = InRay.Direction.X;
+			Direction[1] = InRay.Direction.Y;
+			Direction[2] = InRay.Direction.Z;
+
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				// 방향 성분이 0이면 역수 대신 큰 값을 써서 슬랩 계산에 NaN이 생기지 않게 함
+				const float InvDirection = std::fabs(Direction[Axis]) > 1e-30f ? 1.0f / Direction[Axis] : (Direction[Axis] < 0.0f ? -1e30f : 1e30f);
+				Origin4[Axis] = _mm_set1_ps(Origin[Axis]);
+				InvDirection4[Axis] = _mm_set1_ps(InvDirection);
+				bNegative[Axis] = InvDirection < 0.0f;
+			}
 		}
-		
-		CurrentChildIndex = AncestorIndex;
-		AncestorIndex = AncestorNode.ParentIndex;
+	};
+
+	/**
+	 * @brief 넓은 노드의 자식 4개와 레이의 슬랩 검사를 한 번에 수행
+	 * 축마다 레이가 먼저 만나는 면은 방향이 양수면 Min, 음수면 Max (슬롯마다 min / max로 고를 필요가 없음)
+	 * @return 교차한 슬롯의 비트 마스크 (OutNear는 슬롯마다 경계에 들어가는 거리)
+	 */
+	int32 IntersectChildren(const FBVHNode& InNode, const FTraversalRay& InRay, const __m128& InMinDistance, float InMaxDistance,
+		__m128& OutNear)
+	{
+		const __m128 NearX = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(InRay.bNegative[0] ? InNode.MaxX : InNode.MinX), InRay.Origin4[0]), InRay.InvDirection4[0]);
+		const __m128 NearY = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(InRay.bNegative[1] ? InNode.MaxY : InNode.MinY), InRay.Origin4[1]), InRay.InvDirection4[1]);
+		const __m128 NearZ = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(InRay.bNegative[2] ? InNode.MaxZ : InNode.MinZ), InRay.Origin4[2]), InRay.InvDirection4[2]);
+		const __m128 FarX = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(InRay.bNegative[0] ? InNode.MinX : InNode.MaxX), InRay.Origin4[0]), InRay.InvDirection4[0]);
+		const __m128 FarY = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(InRay.bNegative[1] ? InNode.MinY : InNode.MaxY), InRay.Origin4[1]), InRay.InvDirection4[1]);
+		const __m128 FarZ = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(InRay.bNegative[2] ? InNode.MinZ : InNode.MaxZ), InRay.Origin4[2]), InRay.InvDirection4[2]);
+
+		OutNear = _mm_max_ps(_mm_max_ps(NearX, NearY), _mm_max_ps(NearZ, InMinDistance));
+		const __m128 Far = _mm_min_ps(_mm_min_ps(FarX, FarY), _mm_min_ps(FarZ, _mm_set1_ps(InMaxDistance)));
+		return _mm_movemask_ps(_mm_cmple_ps(OutNear, Far));
 	}
 
-	return CostIncrease;
-}
+	/**
+	 * @brief 레이 하나로 InChild(NumTriangles가 0이면 노드, 아니면 리프)부터 가장 가까운 삼각형을 찾아 내려감
+	 * InOutDistance보다 가까운 교차를 찾으면 InOutDistance와 InOutTriangle을 갱신
+	 */
+	void TraverseClosest(const FBVHNode* InNodes, const FBVHTriangle* InTriangles, const int32* InTriangleIndices, int32 InChild,
+		int32 InNumTriangles, const FTraversalRay& InRay, float InMinDistance, float& InOutDistance, int32& InOutTriangle)
+	{
+		const __m128 MinDistance4 = _mm_set1_ps(InMinDistance);
 
-void FBVH::InsertInternalNode(int32 NewLeafIndex, int32 SiblingIndex)
-{
-	// 새 부모(Internal) 노드 구성
-	FNode NewParent;
-	int32 OldParentIndex = Nodes[SiblingIndex].ParentIndex;
-	NewParent.ParentIndex = OldParentIndex;
-	NewParent.Child1 = SiblingIndex;
-	NewParent.Child2 = NewLeafIndex;
-	NewParent.bIsLeaf = false;
-	NewParent.TriangleBaseIndex = -1; // Internal 노드는 삼각형 인덱스 없음
+		// 리프도 스택에 넣어 가까운 순서대로 꺼내며, 꺼낼 때 이미 찾은 교차보다 멀면 건너뜀
+		struct FStackEntry
+		{
+			int32 Child;
+			int32 NumTriangles;
+			float NearDistance;
+		};
+		TArray<FStackEntry, TInlineAllocator<64>> Stack;
+		Stack.Add({ InChild, InNumTriangles, InMinDistance });
+
+		while (!Stack.IsEmpty())
+		{
+			const FStackEntry Entry = Stack.Last();
+			Stack.Pop();
+			if (Entry.NearDistance > InOutDistance)
+			{
+				continue;
+			}
+
+			if (Entry.NumTriangles > 0)
+			{
+				for (int32 Index = Entry.Child; Index < Entry.Child + Entry.NumTriangles; ++Index)
+				{
+					if (IntersectTriangle(InTriangles[Index], InRay.Origin, InRay.Direction, InMinDistance, InOutDistance))
+					{
+						InOutTriangle = InTriangleIndices[Index];
+					}
+				}
+				continue;
+			}
+
+			// 자식 4개의 슬랩 검사를 한 번에 수행
+			const FBVHNode& Node = InNodes[Entry.Child];
+			__m128 Near;
+			const int32 HitMask = IntersectChildren(Node, InRay, MinDistance4, InOutDistance, Near);
+			if (HitMask == 0)
+			{
+				continue;
+			}
+
+			float NearDistances[BVH_WIDTH];
+			_mm_storeu_ps(NearDistances, Near);
+
+			// 먼 자식부터 쌓아 가까운 자식이 먼저 꺼내지도록 거리 내림차순으로 정렬 (최대 4개라 삽입 정렬)
+			FStackEntry Hits[BVH_WIDTH];
+			int32 NumHits = 0;
+			for (int32 Slot = 0; Slot < BVH_WIDTH; ++Slot)
+			{
+				if ((HitMask & (1 << Slot)) == 0)
+				{
+					continue;
+				}
 
-	// 부모 AABB는 두 자식의 합집합
-	FAABB NewLeafAABB = Nodes[NewLeafIndex].Box;
-	FAABB SiblingAABB = Nodes[SiblingIndex].Box;
-	NewParent.Box = Union(NewLeafAABB, SiblingAABB);
+				const FStackEntry Hit = { Node.Child[Slot], Node.NumTriangles[Slot], NearDistances[Slot] };
+				int32 Position = NumHits++;
+				while (Position > 0 && Hits[Position - 1].NearDistance < Hit.NearDistance)
+				{
+					Hits[Position] = Hits[Position - 1];
+					--Position;
+				}
+				Hits[Position] = Hit;
+			}
 
-	// 새 부모 노드를 push하고 인덱스 확정
-	int32 NewParentIndex = Nodes.Num();
-	NewParent.ObjectIndex = NewParentIndex;
-	Nodes.Add(NewParent);
+			for (int32 Index = 0; Index < NumHits; ++Index)
+			{
+				Stack.Add(Hits[Index]);
+			}
+		}
+	}
 
-	// 자식들의 부모 갱신
-	Nodes[SiblingIndex].ParentIndex = NewParentIndex;
-	Nodes[NewLeafIndex].ParentIndex = NewParentIndex;
+	uint32 CountTrailingZeros64(uint64 InMask)
+	{
+#ifdef _MSC_VER
+		unsigned long Index;
+		_BitScanForward64(&Index, InMask);
+		return static_cast<uint32>(Index);
+#else
+		return static_cast<uint32>(__builtin_ctzll(InMask));
+#endif
+	}
 
-	// 이전 부모가 있었다면 그 부모의 자식 포인터를 새 부모로 교체
-	if (OldParentIndex != -1)
+	/** @brief 모든 레이의 방향이 평균 방향에서 BVH_PACKET_MIN_COHERENCE 안에 모여 있는지 (방향은 정규화되지 않아도 됨) */
+	bool IsCoherentPacket(const FRay* InRays, int32 InNumRays)
 	{
-		FNode& OldParent = Nodes[OldParentIndex];
-		if (OldParent.Child1 == SiblingIndex)
+		float Average[3] = { 0.0f, 0.0f, 0.0f };
+		float InvLengths[BVH_PACKET_SIZE];
+		for (int32 RayIndex = 0; RayIndex < InNumRays; ++RayIndex)
 		{
-			OldParent.Child1 = NewParentIndex;
+			const FVector4& Direction = InRays[RayIndex].Direction;
+			const float Length = std::sqrt(Direction.X * Direction.X + Direction.Y * Direction.Y + Direction.Z * Direction.Z);
+			InvLengths[RayIndex] = Length > 0.0f ? 1.0f / Length : 0.0f;
+			Average[0] += Direction.X * InvLengths[RayIndex];
+			Average[1] += Direction.Y * InvLengths[RayIndex];
+			Average[2] += Direction.Z * InvLengths[RayIndex];
 		}
-		else if (OldParent.Child2 == SiblingIndex)
+
+		const float AverageLength = std::sqrt(Average[0] * Average[0] + Average[1] * Average[1] + Average[2] * Average[2]);
+		if (AverageLength <= 0.0f)
 		{
-			OldParent.Child2 = NewParentIndex;
+			return false;
 		}
-		else
+
+		const float MinDot = BVH_PACKET_MIN_COHERENCE * AverageLength;
+		for (int32 RayIndex = 0; RayIndex < InNumRays; ++RayIndex)
 		{
-			// 혹시 모를 오류 (OldParent가 SiblingIndex를 자식으로 가지고 있지 않는 경우) 대비
-			throw std::runtime_error("OldParent does not reference SiblingIndex as a child.");
+			const FVector4& Direction = InRays[RayIndex].Direction;
+			const float Dot = (Direction.X * Average[0] + Direction.Y * Average[1] + Direction.Z * Average[2]) * InvLengths[RayIndex];
+			if (Dot < MinDot)
+			{
+				return false;
+			}
 		}
+		return true;
 	}
-	// sibling이 루트였던 경우, 새 부모가 루트가 됨
-	else
+
+	/**
+	 * @brief 레이 묶음으로 루트부터 순회 (InRayMask의 레이만, 레이마다 InOutDistances보다 가까운 교차를 찾으면 갱신)
+	 * 노드는 묶음이 함께 방문하고 자식마다 그 경계와 만난 레이만 마스크로 넘겨 내려감
+	 */
+	void TraversePacket(const FBVHNode* InNodes, const FBVHTriangle* InTriangles, const int32* InTriangleIndices, const FTraversalRay* InRays,
+		uint64 InRayMask, float InMinDistance, float* InOutDistances, FBVHRayHit* InOutHits)
 	{
-		RootIndex = NewParentIndex;
+		const __m128 MinDistance4 = _mm_set1_ps(InMinDistance);
+
+		// 스택 항목마다 그 노드(또는 리프)의 경계와 만난 레이를 비트로 들고 내려감
+		struct FPacketStackEntry
+		{
+			int32 Child;
+			int32 NumTriangles;
+			uint64 RayMask;
+		};
+		TArray<FPacketStackEntry, TInlineAllocator<64>> Stack;
+		Stack.Add({ 0, 0, InRayMask });
+
+		while (!Stack.IsEmpty())
+		{
+			const FPacketStackEntry Entry = Stack.Last();
+			Stack.Pop();
+
+			// 레이가 하나만 남은 하위 트리는 묶음으로 얻을 것이 없으므로 레이 하나의 순회로 넘겨 가까운 순서의 가지치기를 받음
+			if ((Entry.RayMask & (Entry.RayMask - 1)) == 0)
+			{
+				const uint32 RayIndex = CountTrailingZeros64(Entry.RayMask);
+				TraverseClosest(InNodes, InTriangles, InTriangleIndices, Entry.Child, Entry.NumTriangles,
+					InRays[RayIndex], InMinDistance, InOutDistances[RayIndex], InOutHits[RayIndex].TriangleIndex);
+				continue;
+			}
+
+			if (Entry.NumTriangles > 0)
+			{
+				// 삼각형을 바깥 루프에 두어 삼각형 하나를 읽은 채로 묶음의 레이를 모두 검사
+				for (int32 Index = Entry.Child; Index < Entry.Child + Entry.NumTriangles; ++Index)
+				{
+					const FBVHTriangle& Triangle = InTriangles[Index];
+					for (uint64 Mask = Entry.RayMask; Mask != 0; Mask &= Mask - 1)
+					{
+						const uint32 RayIndex = CountTrailingZeros64(Mask);
+						const FTraversalRay& Ray = InRays[RayIndex];
+						if (IntersectTriangle(Triangle, Ray.Origin, Ray.Direction, InMinDistance, InOutDistances[RayIndex]))
+						{
+							InOutHits[RayIndex].TriangleIndex = InTriangleIndices[Index];
+						}
+					}
+				}
+				continue;
+			}
+
+			// 레이마다 자식 4개를 검사해 자식별로 만난 레이를 모으고, 정렬 기준으로 쓸 가장 가까운 진입 거리를 함께 구함
+			// 이미 찾은 교차보다 먼 자식은 그 레이의 슬랩 검사에서 떨어지므로 묶음이 내려갈수록 레이가 줄어든다
+			const FBVHNode& Node = InNodes[Entry.Child];
+			uint64 ChildMasks[BVH_WIDTH] = {};
+			float ChildNear[BVH_WIDTH] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+			for (uint64 Mask = Entry.RayMask; Mask != 0; Mask &= Mask - 1)
+			{
+				const uint32 RayIndex = CountTrailingZeros64(Mask);
+				__m128 Near;
+				const int32 HitMask = IntersectChildren(Node, InRays[RayIndex], MinDistance4, InOutDistances[RayIndex], Near);
+				if (HitMask == 0)
+				{
+					continue;
+				}
+
+				float NearDistances[BVH_WIDTH];
+				_mm_storeu_ps(NearDistances, Near);
+				for (int32 Slot = 0; Slot < BVH_WIDTH; ++Slot)
+				{
+					if (HitMask & (1 << Slot))
+					{
+						ChildMasks[Slot] |= 1ull << RayIndex;
+						ChildNear[Slot] = std::min(ChildNear[Slot], NearDistances[Slot]);
+					}
+				}
+			}
+
+			// RaycastClosest와 같이 먼 자식부터 쌓아 가까운 자식이 먼저 꺼내지도록 함
+			struct FSortedChild
+			{
+				FPacketStackEntry Entry;
+				float NearDistance;
+			};
+			FSortedChild Children[BVH_WIDTH];
+			int32 NumChildren = 0;
+			for (int32 Slot = 0; Slot < BVH_WIDTH; ++Slot)
+			{
+				if (ChildMasks[Slot] == 0)
+				{
+					continue;
+				}
+
+				const FSortedChild Child = { { Node.Child[Slot], Node.NumTriangles[Slot], ChildMasks[Slot] }, ChildNear[Slot] };
+				int32 Position = NumChildren++;
+				while (Position > 0 && Children[Position - 1].NearDistance < Child.NearDistance)
+				{
+					Children[Position] = Children[Position - 1];
+					--Position;
+				}
+				Children[Position] = Child;
+			}
+
+			for (int32 Index = 0; Index < NumChildren; ++Index)
+			{
+				Stack.Add(Children[Index].Entry);
+			}
+		}
 	}
 }
 
-void FBVH::RefitAncestors(int32 RefitStartIndex)
+FBVH::FBVH(FStaticMesh* InMesh)
 {
-	// 시작점의 부모부터 루트까지 올라가며 InternalBox를 리핏
-	if (RefitStartIndex < 0 || RefitStartIndex >= Nodes.Num())
-	{
-		return;
-	}
-
-	int32 CurrentIndex = Nodes[RefitStartIndex].ParentIndex; // 부모부터 시작
-	while (CurrentIndex != -1)
-	{
-		FNode& Current = Nodes[CurrentIndex];
-		// 두 자식의 AABB 합집합으로 현재 InternalBox 갱신
-		FAABB Child1AABB = Nodes[Current.Child1].Box;
-		FAABB Child2AABB = Nodes[Current.Child2].Box;
-		Current.Box = Union(Child1AABB, Child2AABB);
+	Build(InMesh);
+}
 
-		CurrentIndex = Current.ParentIndex;
-	}
+const FBVHNode& FBVH::GetNode(int32 InIndex) const
+{
+	assert(InIndex >= 0 && InIndex < Nodes.Num());
+	return Nodes[InIndex];
+}
 
-	// 전체 비용 갱신
-	Cost = GetCost(RootIndex);
+void FBVH::Clear()
+{
+	Mesh = nullptr;
+	Nodes.Empty();
+	TriangleIndices.Empty();
+	Triangles.Empty();
+	Bounds = FAABB();
+	Cost = 0.0f;
 }
 
 bool FBVH::CheckValidity() const
 {
-	// 1. 루트의 인덱스가 유효한지 확인
-	if ((RootIndex < 0 && !Nodes.IsEmpty()) || RootIndex >= static_cast<int32>(Nodes.Num()))
+	// 1. 비어있는 트리의 경우 값이 정상적인지 확인
+	if (Nodes.IsEmpty())
+	{
+		return TriangleIndices.IsEmpty() && Triangles.IsEmpty();
+	}
+	if (!Mesh || Triangles.Num() != TriangleIndices.Num() || TriangleIndices.Num() != Mesh->Indices.Num() / 3)
 	{
 		return false;
 	}
+	const uint32 NumVertices = static_cast<uint32>(Mesh->Vertices.Num());
 
-	// 2. 비어있는 트리의 경우 값이 정상적인지 확인
-	if (Nodes.IsEmpty())
+	// 2. 루트에서 닿는 노드마다 자식 인덱스와 경계 포함 관계를 확인하고, 리프의 삼각형을 센다
+	struct FCheckEntry
 	{
-		if (RootIndex != -1 || Cost != 0.0f)
-		{
-			return false;
-		}
-	}
+		int32 NodeIndex;
+		FAABB Bounds;
+	};
 
-	// 3. 각 노드의 부모-자식 관계가 일관적인지 확인
-	for (int32 i = 0; i < Nodes.Num(); ++i)
+	TArray<int32> TriangleVisitCounts;
+	TriangleVisitCounts.SetNumZeroed(TriangleIndices.Num());
+	int32 NumVisitedNodes = 0;
+
+	TArray<FCheckEntry, TInlineAllocator<64>> NodeStack;
+	NodeStack.Add({ 0, Bounds });
+	while (!NodeStack.IsEmpty())
 	{
-		const FNode& Node = Nodes[i];
-		if (Node.bIsLeaf) // Leaf node 인 경우 자식이 없어야 함
+		const FCheckEntry Entry = NodeStack.Last();
+		NodeStack.Pop();
+		const FBVHNode& Node = Nodes[Entry.NodeIndex];
+		++NumVisitedNodes;
+
+		int32 NumUsedSlots = 0;
+		for (int32 Slot = 0; Slot < BVH_WIDTH; ++Slot)
 		{
-			if (Node.Child1 != -1 || Node.Child2 != -1)
-			{
-				return false;
-			}
-			if (Node.TriangleBaseIndex < 0 || Node.TriangleBaseIndex % 3 != 0)
+			if (Node.IsEmptySlot(Slot))
 			{
-				return false; // 리프 노드는 반드시 유효한 인덱스 배열의 인덱스를 가져야 함
+				continue;
 			}
-		}
-		else // Internal Node 인 경우 자식이 있어야 함
-		{
-			if (Node.Child1 == -1 || Node.Child2 == -1)
+			++NumUsedSlots;
+
+			const FAABB ChildBounds = Node.GetChildBounds(Slot);
+			if (!Entry.Bounds.IsContains(ChildBounds))
 			{
 				return false;
 			}
-			if (Node.TriangleBaseIndex != -1)
+
+			if (!Node.IsLeafSlot(Slot))
 			{
-				return false; // 내부 노드는 인덱스를 가져선 안됨
+				// 넓은 노드는 깊이 우선으로 할당되므로 자식은 항상 부모 뒤에 있음
+				if (Node.Child[Slot] <= Entry.NodeIndex || Node.Child[Slot] >= Nodes.Num())
+				{
+					return false;
+				}
+				NodeStack.Add({ Node.Child[Slot], ChildBounds });
+				continue;
 			}
-			// 자식 노드들이 올바른 부모 인덱스를 가리키는지 확인
-			if (Node.Child1 < 0 || Node.Child1 >= Nodes.Num() ||
-				Node.Child2 < 0 || Node.Child2 >= Nodes.Num())
+
+			const int32 FirstTriangle = Node.Child[Slot];
+			const int32 NumTriangles = Node.NumTriangles[Slot];
+			if (FirstTriangle < 0 || FirstTriangle > TriangleIndices.Num() - NumTriangles)
 			{
 				return false;
 			}
-			const FNode& Child1 = Nodes[Node.Child1];
-			const FNode& Child2 = Nodes[Node.Child2];
-			if (Child1.ParentIndex != i || Child2.ParentIndex != i)
+
+			for (int32 Index = FirstTriangle; Index < FirstTriangle + NumTriangles; ++Index)
 			{
-				return false;
+				if (TriangleIndices[Index] < 0 || TriangleIndices[Index] >= TriangleIndices.Num())
+				{
+					return false;
+				}
+				++TriangleVisitCounts[TriangleIndices[Index]];
+
+				// 삼각형이 리프 경계 안에 있어야 함
+				const uint32* VertexIndices = Mesh->Indices.GetData() + TriangleIndices[Index] * 3;
+				if (VertexIndices[0] < NumVertices && VertexIndices[1] < NumVertices && VertexIndices[2] < NumVertices &&
+					!ChildBounds.IsContains(GetTriangleAABB(Mesh->Vertices[VertexIndices[0]], Mesh->Vertices[VertexIndices[1]], Mesh->Vertices[VertexIndices[2]])))
+				{
+					return false;
+				}
 			}
 		}
 
-		// 부모 인덱스가 유효한지 확인 (루트는 제외)
-		if (Node.ParentIndex != -1)
+		if (NumUsedSlots == 0)
 		{
-			if (Node.ParentIndex < 0 || Node.ParentIndex >= Nodes.Num())
-			{
-				return false;
-			}
+			return false;
 		}
-		else if (i != RootIndex) // 루트가 아닌데 부모가 없는 경우
+	}
+
+	// 3. 모든 노드가 한 번씩 닿고, 모든 삼각형이 정확히 한 리프에 있어야 함
+	if (NumVisitedNodes != Nodes.Num())
+	{
+		return false;
+	}
+	for (int32 Count : TriangleVisitCounts)
+	{
+		if (Count != 1)
 		{
 			return false;
 		}
@@ -398,59 +853,78 @@ FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FN
 	return FAABB(Min, Max);
 }
 
-bool FBVH::TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
+bool FBVH::RaycastClosest(const FRay& Ray, float MinDistance, float MaxDistance, FBVHRayHit& OutHit) const
 {
-	OutTriangleIndices.Empty();
-	
-	// 빈 트리이거나 루트가 유효하지 않은 경우
-	if (RootIndex < 0 || RootIndex >= Nodes.Num())
+	if (Nodes.IsEmpty() || MinDistance > MaxDistance)
 	{
-		return false; // Traverse failed
+		return false;
 	}
-	
-	// 스택을 사용한 반복적 순회로 구현 (재귀보다 성능상 유리)
-	TArray<int32> NodeStack;
-	NodeStack.Add(RootIndex);
-	
-	while (!NodeStack.IsEmpty())
+
+	FTraversalRay TraversalRay;
+	TraversalRay.Set(Ray);
+
+	float ClosestDistance = MaxDistance;
+	int32 ClosestTriangle = -1;
+	TraverseClosest(Nodes.GetData(), Triangles.GetData(), TriangleIndices.GetData(), 0, 0, TraversalRay, MinDistance, ClosestDistance, ClosestTriangle);
+	if (ClosestTriangle < 0)
 	{
-		int32 CurrentNodeIndex = NodeStack.Last();
-		NodeStack.Pop();
-		
-		const FNode& CurrentNode = Nodes[CurrentNodeIndex];
-		
-		// Ray와 현재 노드의 AABB 교차 검사
-		if (!CheckIntersectionRayBox(Ray, CurrentNode.Box))
+		return false;
+	}
+
+	OutHit.Distance = ClosestDistance;
+	OutHit.TriangleIndex = ClosestTriangle;
+	return true;
+}
+
+int32 FBVH::RaycastClosestPacket(const FRay* Rays, int32 NumRays, float MinDistance, const float* MaxDistances, FBVHRayHit* OutHits) const
+{
+	assert(NumRays <= BVH_PACKET_SIZE && "FBVH::RaycastClosestPacket: too many rays in one packet");
+	NumRays = std::min(NumRays, BVH_PACKET_SIZE);
+
+	float ClosestDistances[BVH_PACKET_SIZE];
+	FTraversalRay TraversalRays[BVH_PACKET_SIZE];
+	uint64 ActiveMask = 0;
+	for (int32 RayIndex = 0; RayIndex < NumRays; ++RayIndex)
+	{
+		OutHits[RayIndex] = FBVHRayHit();
+		TraversalRays[RayIndex].Set(Rays[RayIndex]);
+		ClosestDistances[RayIndex] = MaxDistances[RayIndex];
+		if (MinDistance <= MaxDistances[RayIndex])
 		{
-			continue; // AABB와 교차하지 않으면 이 노드의 자식들도 건너뜀
+			ActiveMask |= 1ull << RayIndex;
 		}
-		
-		if (CurrentNode.bIsLeaf)
+	}
+
+	if (Nodes.IsEmpty() || ActiveMask == 0)
+	{
+		return 0;
+	}
+
+	// 묶음은 모든 레이가 같은 자식 순서로 내려가므로 방향이 흩어져 있으면 레이마다 가까운 순서로 순회하는 편이 빠름
+	if (!IsCoherentPacket(Rays, NumRays))
+	{
+		for (uint64 Mask = ActiveMask; Mask != 0; Mask &= Mask - 1)
 		{
-			// 리프 노드인 경우 삼각형 인덱스 추가
-			// ------------------------------------------------------------------------------------
-			// 주의: BVH 내부에서는 삼각형 인덱스 = 인덱스 배열에서 삼각형을 이루는 첫 인덱스의 위치이지만(Index buffer offset),
-			// BVH 외부에서는 삼각형 인덱스 = 인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호를 의미하므로(Triangle ordinal)
-			// 의미 통일을 위해 외부 반환시 3으로 나누어 사용
-			// ------------------------------------------------------------------------------------
-			OutTriangleIndices.Add(CurrentNode.TriangleBaseIndex / 3);
+			const uint32 RayIndex = CountTrailingZeros64(Mask);
+			TraverseClosest(Nodes.GetData(), Triangles.GetData(), TriangleIndices.GetData(), 0, 0, TraversalRays[RayIndex], MinDistance,
+				ClosestDistances[RayIndex], OutHits[RayIndex].TriangleIndex);
 		}
-		else
+	}
+	else
+	{
+		TraversePacket(Nodes.GetData(), Triangles.GetData(), TriangleIndices.GetData(), TraversalRays, ActiveMask, MinDistance, ClosestDistances, OutHits);
+	}
+
+	int32 NumHits = 0;
+	for (int32 RayIndex = 0; RayIndex < NumRays; ++RayIndex)
+	{
+		if (OutHits[RayIndex].TriangleIndex >= 0)
 		{
-			// 내부 노드인 경우 자식들을 스택에 추가
-			// 자식 인덱스가 유효한지 확인
-			if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < Nodes.Num())
-			{
-				NodeStack.Add(CurrentNode.Child1);
-			}
-			if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < Nodes.Num())
-			{
-				NodeStack.Add(CurrentNode.Child2);
-			}
+			OutHits[RayIndex].Distance = ClosestDistances[RayIndex];
+			++NumHits;
 		}
 	}
-	
-	return true; // Traverse successful
+	return NumHits;
 }
 
 void FBVH::Build(FStaticMesh* InMesh)
@@ -462,19 +936,78 @@ void FBVH::Build(FStaticMesh* InMesh)
 	}
 	Clear();
 	Mesh = InMesh;
-	// 모든 삼각형에 대해 Leaf 노드 삽입
-	int32 TriangleCount = Mesh->Indices.Num() / 3;
-	for (int32 i = 0; i < TriangleCount; ++i)
+
+	const int32 TriangleCount = Mesh->Indices.Num() / 3;
+	if (TriangleCount == 0)
 	{
-		int32 TriangleBaseIndex = i * 3;
-		InsertLeaf(TriangleBaseIndex);
+		return;
 	}
-	// 전체 비용 계산
-	Cost = GetCost(RootIndex);
-	// 유효성 검사
-	if (!CheckValidity())
+
+	// 1. 삼각형마다 경계와 중심을 미리 계산 (정점 인덱스가 범위를 벗어난 삼각형은 정점 0으로 대체)
+	TArray<FBuildTriangle> BuildTriangles;
+	BuildTriangles.SetNum(TriangleCount);
+	const int32 NumVertices = Mesh->Vertices.Num();
+	auto GetVertexIndex = [this, NumVertices](int32 InTriangle, int32 InCorner)
+	{
+		const uint32 VertexIndex = Mesh->Indices[InTriangle * 3 + InCorner];
+		return VertexIndex < static_cast<uint32>(NumVertices) ? VertexIndex : 0;
+	};
+	ParallelFor(TriangleCount, [this, &BuildTriangles, &GetVertexIndex](int32 TriangleIndex)
 	{
-		std::cerr << "FBVH::Build: BVH structure is invalid after build." << '\n';
+		FBuildTriangle& Triangle = BuildTriangles[TriangleIndex];
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const FVector& Position = Mesh->Vertices[GetVertexIndex(TriangleIndex, Corner)].Position;
+			const float Point[3] = { Position.X, Position.Y, Position.Z };
+			Triangle.Bounds.Grow(Point);
+		}
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Triangle.Centroid[Axis] = (Triangle.Bounds.Min[Axis] + Triangle.Bounds.Max[Axis]) * 0.5f;
+		}
+	}, 4096);
+
+	TriangleIndices.SetNum(TriangleCount);
+	for (int32 Index = 0; Index < TriangleCount; ++Index)
+	{
+		TriangleIndices[Index] = Index;
 	}
-}
 
+	// 2. 루트부터 위에서 아래로 이진 트리 구축 (리프마다 삼각형이 몇 개씩 들어가므로 노드 수는 대략 삼각형 수의 절반)
+	FBuildContext Context;
+	Context.Triangles = BuildTriangles.GetData();
+	Context.TriangleIndices = TriangleIndices.GetData();
+	Context.bParallel = FTaskGraph::Get().IsInitialized() && FTaskGraph::Get().GetNumWorkers() > 0;
+
+	TArray<FBuildNode> BinaryNodes;
+	BinaryNodes.Reserve(TriangleCount / 2 + 1);
+	BinaryNodes.SetNum(1);
+	BuildNode(Context, BinaryNodes, 0, 0, TriangleCount, 0);
+	Bounds = BinaryNodes[0].Bounds.ToAABB();
+
+	// 3. 넓은 노드로 접기 (노드 수는 이진 트리의 약 1/3)
+	Nodes.Reserve(BinaryNodes.Num() / 3 + 1);
+	CollapseNode(BinaryNodes, 0, Nodes, Cost);
+	Nodes.Shrink();
+
+	// 4. 교차 검사에 쓸 삼각형을 리프 순서로 복사해 리프의 삼각형이 메모리에 붙어 있게 함
+	Triangles.SetNum(TriangleCount);
+	ParallelFor(TriangleCount, [this, &GetVertexIndex](int32 Index)
+	{
+		const int32 TriangleIndex = TriangleIndices[Index];
+		const FVector& V0 = Mesh->Vertices[GetVertexIndex(TriangleIndex, 0)].Position;
+		const FVector& V1 = Mesh->Vertices[GetVertexIndex(TriangleIndex, 1)].Position;
+		const FVector& V2 = Mesh->Vertices[GetVertexIndex(TriangleIndex, 2)].Position;
+
+		FBVHTriangle& Triangle = Triangles[Index];
+		Triangle.V0[0] = V0.X;
+		Triangle.V0[1] = V0.Y;
+		Triangle.V0[2] = V0.Z;
+		Triangle.Edge1[0] = V1.X - V0.X;
+		Triangle.Edge1[1] = V1.Y - V0.Y;
+		Triangle.Edge1[2] = V1.Z - V0.Z;
+		Triangle.Edge2[0] = V2.X - V0.X;
+		Triangle.Edge2[1] = V2.Y - V0.Y;
+		Triangle.Edge2[2] = V2.Z - V0.Z;
+	}, 4096);
+}
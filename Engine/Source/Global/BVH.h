@@ -5,18 +5,70 @@
 class UPrimitiveComponent;
 struct FStaticMesh;
 
-struct FNode
+/** @brief 리프 하나에 넣을 최대 삼각형 수 (SAH가 나누지 않는 편이 낫다고 판단해도 이보다 많으면 나눔) */
+constexpr int32 BVH_MAX_LEAF_TRIANGLES = 8;
+/** @brief SAH 분할 위치를 고를 때 축마다 나누는 빈(Bin) 수 */
+constexpr int32 BVH_NUM_BINS = 16;
+/** @brief 이보다 큰 하위 트리는 워커 스레드에서 나누어 구축 */
+constexpr int32 BVH_PARALLEL_MIN_TRIANGLES = 8192;
+/** @brief 노드 하나의 자식 수 (SSE 레지스터 하나에 자식 4개의 경계를 한 축씩 담음) */
+constexpr int32 BVH_WIDTH = 4;
+/** @brief RaycastClosestPacket이 한 번의 순회로 검사하는 최대 레이 수 (레이마다 64비트 마스크의 한 비트) */
+constexpr int32 BVH_PACKET_SIZE = 64;
+
+/**
+ * @brief 자식 4개의 경계를 축별로 모은(SoA) 넓은 BVH 노드
+ * 자식 슬롯은 내부 노드(NumTriangles == 0, Child = 노드 인덱스), 리프(NumTriangles > 0, Child = 첫 삼각형 위치),
+ * 빈 슬롯(Child == -1, 경계가 뒤집혀 있어 어떤 레이와도 교차하지 않음) 중 하나
+ */
+struct FBVHNode
+{
+	float MinX[BVH_WIDTH];
+	float MinY[BVH_WIDTH];
+	float MinZ[BVH_WIDTH];
+	float MaxX[BVH_WIDTH];
+	float MaxY[BVH_WIDTH];
+	float MaxZ[BVH_WIDTH];
+	int32 Child[BVH_WIDTH];
+	int32 NumTriangles[BVH_WIDTH];
+
+	bool IsEmptySlot(int32 InSlot) const { return Child[InSlot] < 0; }
+	bool IsLeafSlot(int32 InSlot) const { return NumTriangles[InSlot] > 0; }
+	FAABB GetChildBounds(int32 InSlot) const
+	{
+		return FAABB(FVector(MinX[InSlot], MinY[InSlot], MinZ[InSlot]), FVector(MaxX[InSlot], MaxY[InSlot], MaxZ[InSlot]));
+	}
+};
+
+/** @brief 리프 순서로 저장한 삼각형 (교차 검사에 바로 쓰도록 한 꼭짓점과 두 변으로 보관) */
+struct FBVHTriangle
+{
+	float V0[3];
+	float Edge1[3];
+	float Edge2[3];
+};
+
+/** @brief FBVH::RaycastClosest 결과 */
+struct FBVHRayHit
 {
-	int32 ObjectIndex;
-	int32 ParentIndex;
-	int32 Child1;
-	int32 Child2;
-	bool bIsLeaf;
-	FAABB Box;
-	int32 TriangleBaseIndex; // �ε��� ���ۿ��� �ﰢ���� ���� �ε���
+	/** @brief 레이 원점에서 교차점까지의 매개변수 (방향이 단위 벡터면 거리) */
+	float Distance = FLT_MAX;
+	/** @brief 삼각형 번호 (인덱스 버퍼를 3개 단위로 묶었을 때의 번호) */
+	int32 TriangleIndex = -1;
 };
 
-//  Phase Picking에 사용되는 BVH (Bounding Volume Hierarchy)
+/**
+ * @brief Phase Picking에 사용되는 메시 BVH (Bounding Volume Hierarchy)
+ *
+ * 위에서부터 삼각형 구간을 둘로 나누며 이진 트리를 만든다
+ * 나눌 위치는 삼각형 중심을 축마다 BVH_NUM_BINS개의 빈에 모아 표면적 휴리스틱(SAH) 비용이 가장 작은 경계로 고르고,
+ * 나누는 비용이 더 크면 삼각형 여러 개를 한 리프에 둔다
+ * 큰 하위 트리는 태스크 그래프로 동시에 구축하므로 백만 삼각형 메시도 로드 중에 바로 만들 수 있다
+ *
+ * 이진 트리는 표면적이 큰 자식부터 펼쳐 자식 4개짜리 넓은 노드로 접으며,
+ * 레이 순회는 SSE로 자식 4개의 슬랩 검사를 한 번에 하고 가까운 자식부터 내려가
+ * 리프에서 바로 삼각형 교차를 구해 찾은 거리보다 먼 노드는 건너뛴다
+ */
 class FBVH
 {
 public:
@@ -24,62 +76,52 @@ public:
 	explicit FBVH(FStaticMesh* InMesh);
 
 	void Build(FStaticMesh* InMesh);
-	int32 GetRootIndex() const { return RootIndex; }
+	bool IsEmpty() const { return Nodes.IsEmpty(); }
+	/** @brief 넓은 노드 수 (루트는 항상 0번) */
 	int32 GetNodeCount() const { return Nodes.Num(); }
-	const FNode& GetNode(uint32 Index) const;
-	FNode& GetNode(uint32 Index);
+	const FBVHNode& GetNode(int32 InIndex) const;
+	/** @brief 메시 전체를 감싸는 경계 (모델 좌표계) */
+	const FAABB& GetBounds() const { return Bounds; }
 	void Clear();
 
-	/**
-	* @brief 서브트리의 cost(노드가 가진 AABB의 표면적 합)을 계산.
-	* @param SubTreeRootIndex: cost 계산 시작 노드 인덱스
-	* @param bInternalOnly: true로 설정하면 leaf의 코스트는 포함 안시킴
-	* @return cost 값
-	*/
-	float GetCost(int32 SubTreeRootIndex, bool bInternalOnly = false) const;
+	/** @brief 마지막 Build의 전체 cost (모든 자식 경계의 표면적 합, 작을수록 레이가 적은 노드를 방문) */
+	float GetTotalCost() const { return Cost; }
 
 	/**
-	* @brief: 트리의 유효성 검사.
+	* @brief: 트리의 유효성 검사 (자식 연결, 경계 포함 관계, 모든 삼각형이 정확히 한 리프에 있는지)
 	*/
 	bool CheckValidity() const;
 
 	/**
-	* @brief: Ray와 BVH를 순회하여 교차하는 삼각형들의 인덱스 리스트를 반환
+	* @brief: Ray와 가장 먼저 만나는 삼각형 검색 (양면 판정)
 	* @param Ray: 교차 검사를 수행할 Ray (Local 좌표계)
-	* @param OutTriangleIndices: 교차하는 삼각형들의 base index 리스트 (output)
-	* @return: 교차하는 삼각형이 있으면 true, 없으면 false
+	* @param MinDistance, MaxDistance: 교차로 인정하는 Ray 매개변수 범위
+	* @param OutHit: 가장 가까운 교차 (output)
+	* @return: 범위 안에서 교차했으면 true
 	*/
-	bool TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const;
+	bool RaycastClosest(const FRay& Ray, float MinDistance, float MaxDistance, FBVHRayHit& OutHit) const;
 
 	/**
-	* @brief: 새 리프 노드를 특정 노드의 형제로 추가했을 때 전체 뉱업 트리의 비용 증가량 계산
-	* @param CandidateIndex: 후보 형제 노드 인덱스
-	* @param NewLeafAABB: 새로운 리프 노드의 AABB
-	* @return: 비용 증가량
+	* @brief: Ray 묶음(Packet)을 트리 한 번의 순회로 검사해 Ray마다 가장 먼저 만나는 삼각형 검색
+	* 노드는 묶음이 함께 방문하고 자식마다 그 경계와 만난 Ray만 마스크로 넘겨 내려가므로,
+	* 비슷한 방향의 Ray들은 같은 노드와 삼각형을 한 번만 읽는다 (방향이 흩어진 묶음은 Ray마다 RaycastClosest와 같이 순회)
+	* @param Rays: 교차 검사를 수행할 Ray 배열 (Local 좌표계, 최대 BVH_PACKET_SIZE개)
+	* @param MinDistance: 교차로 인정하는 최소 Ray 매개변수 (모든 Ray 공통)
+	* @param MaxDistances: Ray마다 교차로 인정하는 최대 Ray 매개변수
+	* @param OutHits: Ray마다 가장 가까운 교차, 교차하지 않으면 TriangleIndex가 -1 (output)
+	* @return: 교차한 Ray 수
 	*/
-	float CalculateCostIncrease(int32 CandidateIndex, const FAABB& NewLeafAABB) const;
+	int32 RaycastClosestPacket(const FRay* Rays, int32 NumRays, float MinDistance, const float* MaxDistances, FBVHRayHit* OutHits) const;
 
 private:
-	/**
-	* @brief 새로운 leaf node를 삽입.
-	* @note cost가 가장 낮아지는 최적의 sibling node를 찾아서 삽입되도록 함.
-	* @return 삽입된 leaf node의 인덱스, 실패 시 -1 반환
-	*/
-	int32 InsertLeaf(int32 InTriangleBaseIndex);
-
-	// --- 새 leaf node 삽입 과정 보조 메소드들 ---
-
-	//@brief 새로운 leaf node가 추가되었을 때 cost가 가장 조금 증가하는 sibling node 탐색.
-	int32 FindBestSibling(const FAABB& NewLeafAABB);
-	//@brief 새로운 leaf node와 기존 sibling node를 묶는 internal node를 생성하고 트리에 삽입.
-	void InsertInternalNode(int32 LeafIndex, int32 SiblingIndex);
-	//@brief 주어진 노드의 '부모'부터 루트까지 올라가며 AABB Refit 수행.
-	void RefitAncestors(int32 RefitStartIndex);
-
 	FStaticMesh* Mesh = nullptr; // BVH 원본 메시
-	TArray<FNode> Nodes;
-	int32 RootIndex = -1;
+	TArray<FBVHNode> Nodes;
+	/** @brief 리프 순서로 정렬된 삼각형 번호 (인덱스 버퍼를 3개 단위로 묶었을 때의 번호) */
+	TArray<int32> TriangleIndices;
+	/** @brief TriangleIndices와 같은 순서의 삼각형 정점 */
+	TArray<FBVHTriangle> Triangles;
+	FAABB Bounds;
 	float Cost = 0.0f;
 };
 
-FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
\ No newline at end of file
+FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
@@ -0,0 +1,409 @@
+#include "pch.h"
+#include "Global/DynamicAABBTree.h"
+
+namespace
+{
+	/** @brief NaN은 비교가 항상 실패하므로 Min <= Max 검사에서 함께 걸러진다 */
+	bool IsValidBounds(const FAABB& InBounds)
+	{
+		return std::isfinite(InBounds.Min.X) && std::isfinite(InBounds.Min.Y) && std::isfinite(InBounds.Min.Z) &&
+			std::isfinite(InBounds.Max.X) && std::isfinite(InBounds.Max.Y) && std::isfinite(InBounds.Max.Z) &&
+			InBounds.Min.X <= InBounds.Max.X && InBounds.Min.Y <= InBounds.Max.Y && InBounds.Min.Z <= InBounds.Max.Z;
+	}
+
+	/** @brief 실제 경계를 여유만큼 넓힌 뒤 이동 방향으로 예측 이동량만큼 더 넓힘 */
+	FAABB MakeFatBounds(const FAABB& InBounds, const FVector& InDisplacement)
+	{
+		const FVector Margin(DYNAMIC_TREE_AABB_MARGIN, DYNAMIC_TREE_AABB_MARGIN, DYNAMIC_TREE_AABB_MARGIN);
+		FAABB FatBounds(InBounds.Min - Margin, InBounds.Max + Margin);
+
+		const FVector Prediction = InDisplacement * DYNAMIC_TREE_DISPLACEMENT_MULTIPLIER;
+		(Prediction.X < 0.0f ? FatBounds.Min.X : FatBounds.Max.X) += Prediction.X;
+		(Prediction.Y < 0.0f ? FatBounds.Min.Y : FatBounds.Max.Y) += Prediction.Y;
+		(Prediction.Z < 0.0f ? FatBounds.Min.Z : FatBounds.Max.Z) += Prediction.Z;
+		return FatBounds;
+	}
+}
+
+int32 FDynamicAABBTree::CreateProxy(UPrimitiveComponent* InPrimitive, const FAABB& InBounds)
+{
+	if (!InPrimitive || !IsValidBounds(InBounds)) { return -1; }
+
+	const int32 ProxyId = AllocateNode();
+	FDynamicTreeNode& Leaf = Nodes[ProxyId];
+	Leaf.Bounds = MakeFatBounds(InBounds, FVector(0.0f, 0.0f, 0.0f));
+	Leaf.TightMin = InBounds.Min;
+	Leaf.TightMax = InBounds.Max;
+	Leaf.Primitive = InPrimitive;
+	Leaf.Height = 0;
+
+	InsertLeaf(ProxyId);
+	++NumProxies;
+	return ProxyId;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 InProxyId)
+{
+	assert(InProxyId >= 0 && InProxyId < Nodes.Num() && Nodes[InProxyId].Height == 0);
+
+	RemoveLeaf(InProxyId);
+	FreeNode(InProxyId);
+	--NumProxies;
+}
+
+bool FDynamicAABBTree::MoveProxy(int32 InProxyId, const FAABB& InBounds)
+{
+	assert(InProxyId >= 0 && InProxyId < Nodes.Num() && Nodes[InProxyId].Height == 0);
+
+	if (!IsValidBounds(InBounds)) { return false; }
+
+	FDynamicTreeNode& Leaf = Nodes[InProxyId];
+	const FVector Displacement = (InBounds.Min + InBounds.Max - Leaf.TightMin - Leaf.TightMax) * 0.5f;
+	Leaf.TightMin = InBounds.Min;
+	Leaf.TightMax = InBounds.Max;
+
+	const FAABB FatBounds = MakeFatBounds(InBounds, Displacement);
+	if (Leaf.Bounds.IsContains(InBounds))
+	{
+		// 빠르게 움직이다 멈춘 객체의 커진 경계가 계속 남아 쿼리를 방해하지 않도록 새로 만들 경계보다 지나치게 큰 경우에만 다시 삽입해 줄인다
+		// 같은 속도로 계속 움직이는 동안은 지나온 쪽에 남는 예측 길이만큼을 허용해 예측 구간을 다 쓸 때까지 다시 삽입하지 않는다
+		const float PredictionScale = DYNAMIC_TREE_DISPLACEMENT_MULTIPLIER;
+		const FVector HugeMargin(4.0f * DYNAMIC_TREE_AABB_MARGIN + fabsf(Displacement.X) * PredictionScale,
+			4.0f * DYNAMIC_TREE_AABB_MARGIN + fabsf(Displacement.Y) * PredictionScale,
+			4.0f * DYNAMIC_TREE_AABB_MARGIN + fabsf(Displacement.Z) * PredictionScale);
+		const FAABB HugeBounds(FatBounds.Min - HugeMargin, FatBounds.Max + HugeMargin);
+		if (HugeBounds.IsContains(Leaf.Bounds))
+		{
+			return false;
+		}
+	}
+
+	RemoveLeaf(InProxyId);
+	Nodes[InProxyId].Bounds = FatBounds;
+	InsertLeaf(InProxyId);
+	return true;
+}
+
+void FDynamicAABBTree::Clear()
+{
+	Nodes.Empty();
+	RootIndex = -1;
+	FreeListHead = -1;
+	NumProxies = 0;
+}
+
+float FDynamicAABBTree::GetAreaRatio() const
+{
+	if (RootIndex < 0) { return 0.0f; }
+
+	const float RootArea = Nodes[RootIndex].Bounds.GetSurfaceArea();
+	if (RootArea <= 0.0f) { return 0.0f; }
+
+	float TotalArea = 0.0f;
+	for (const FDynamicTreeNode& Node : Nodes)
+	{
+		if (Node.Height > 0)
+		{
+			TotalArea += Node.Bounds.GetSurfaceArea();
+		}
+	}
+	return TotalArea / RootArea;
+}
+
+bool FDynamicAABBTree::CheckValidity() const
+{
+	if (RootIndex < 0) { return NumProxies == 0; }
+	if (Nodes[RootIndex].Parent != -1) { return false; }
+
+	int32 NumLeaves = 0;
+	TArray<int32, TInlineAllocator<DYNAMIC_TREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add(RootIndex);
+
+	while (!NodeStack.IsEmpty())
+	{
+		const int32 NodeIndex = NodeStack.Last();
+		NodeStack.Pop();
+
+		const FDynamicTreeNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			if (Node.Height != 0 || !Node.Bounds.IsContains(FAABB(Node.TightMin, Node.TightMax))) { return false; }
+			++NumLeaves;
+			continue;
+		}
+
+		const FDynamicTreeNode& Child1 = Nodes[Node.Child1];
+		const FDynamicTreeNode& Child2 = Nodes[Node.Child2];
+		if (Child1.Parent != NodeIndex || Child2.Parent != NodeIndex) { return false; }
+		if (Node.Height != 1 + std::max(Child1.Height, Child2.Height)) { return false; }
+		if (!Node.Bounds.IsContains(Child1.Bounds) || !Node.Bounds.IsContains(Child2.Bounds)) { return false; }
+
+		NodeStack.Add(Node.Child1);
+		NodeStack.Add(Node.Child2);
+	}
+
+	return NumLeaves == NumProxies;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+	int32 NodeIndex;
+	if (FreeListHead >= 0)
+	{
+		NodeIndex = FreeListHead;
+		FreeListHead = Nodes[NodeIndex].Parent;
+	}
+	else
+	{
+		NodeIndex = Nodes.Num();
+		Nodes.Add(FDynamicTreeNode());
+	}
+
+	FDynamicTreeNode& Node = Nodes[NodeIndex];
+	Node.Primitive = nullptr;
+	Node.Parent = -1;
+	Node.Child1 = -1;
+	Node.Child2 = -1;
+	Node.Height = 0;
+	return NodeIndex;
+}
+
+void FDynamicAABBTree::FreeNode(int32 InNodeIndex)
+{
+	FDynamicTreeNode& Node = Nodes[InNodeIndex];
+	Node.Primitive = nullptr;
+	Node.Child1 = -1;
+	Node.Child2 = -1;
+	Node.Height = -1;
+	Node.Parent = FreeListHead;
+	FreeListHead = InNodeIndex;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 InLeafIndex)
+{
+	if (RootIndex < 0)
+	{
+		RootIndex = InLeafIndex;
+		Nodes[RootIndex].Parent = -1;
+		return;
+	}
+
+	// 1. 형제 노드를 고르고 둘을 묶는 새 부모를 형제 자리에 넣음
+	const FAABB LeafBounds = Nodes[InLeafIndex].Bounds;
+	const int32 SiblingIndex = FindBestSibling(LeafBounds);
+	const int32 OldParentIndex = Nodes[SiblingIndex].Parent;
+
+	const int32 NewParentIndex = AllocateNode();
+	FDynamicTreeNode& NewParent = Nodes[NewParentIndex];
+	NewParent.Parent = OldParentIndex;
+	NewParent.Child1 = SiblingIndex;
+	NewParent.Child2 = InLeafIndex;
+	NewParent.Bounds = Union(LeafBounds, Nodes[SiblingIndex].Bounds);
+	NewParent.Height = Nodes[SiblingIndex].Height + 1;
+
+	Nodes[SiblingIndex].Parent = NewParentIndex;
+	Nodes[InLeafIndex].Parent = NewParentIndex;
+
+	if (OldParentIndex >= 0)
+	{
+		ReplaceChild(OldParentIndex, SiblingIndex, NewParentIndex);
+	}
+	else
+	{
+		RootIndex = NewParentIndex;
+	}
+
+	// 2. 조상 경계를 넓히며 회전으로 트리 품질 유지
+	RefitAncestors(NewParentIndex);
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 InLeafIndex)
+{
+	if (InLeafIndex == RootIndex)
+	{
+		RootIndex = -1;
+		return;
+	}
+
+	// 부모를 없애고 형제를 부모 자리로 올림
+	const int32 ParentIndex = Nodes[InLeafIndex].Parent;
+	const int32 GrandParentIndex = Nodes[ParentIndex].Parent;
+	const int32 SiblingIndex = Nodes[ParentIndex].Child1 == InLeafIndex ? Nodes[ParentIndex].Child2 : Nodes[ParentIndex].Child1;
+
+	Nodes[SiblingIndex].Parent = GrandParentIndex;
+	Nodes[InLeafIndex].Parent = -1;
+	FreeNode(ParentIndex);
+
+	if (GrandParentIndex >= 0)
+	{
+		ReplaceChild(GrandParentIndex, ParentIndex, SiblingIndex);
+		RefitAncestors(GrandParentIndex);
+	}
+	else
+	{
+		RootIndex = SiblingIndex;
+	}
+}
+
+int32 FDynamicAABBTree::FindBestSibling(const FAABB& InLeafBounds) const
+{
+	int32 NodeIndex = RootIndex;
+	while (!Nodes[NodeIndex].IsLeaf())
+	{
+		const FDynamicTreeNode& Node = Nodes[NodeIndex];
+		const float Area = Node.Bounds.GetSurfaceArea();
+		const float CombinedArea = Union(Node.Bounds, InLeafBounds).GetSurfaceArea();
+
+		// 이 노드를 형제로 삼을 때의 비용 (새 부모의 표면적)
+		const float DirectCost = 2.0f * CombinedArea;
+		// 더 내려가면 이 노드부터 위의 조상이 모두 새 리프를 감싸도록 넓어지는 비용
+		const float InheritedCost = 2.0f * (CombinedArea - Area);
+
+		auto GetDescendCost = [&](int32 InChildIndex)
+		{
+			const FDynamicTreeNode& Child = Nodes[InChildIndex];
+			const float ChildCombinedArea = Union(Child.Bounds, InLeafBounds).GetSurfaceArea();
+			if (Child.IsLeaf())
+			{
+				return ChildCombinedArea + InheritedCost;
+			}
+			// 자식 아래 어딘가에 붙어도 최소한 자식 경계가 늘어나는 만큼은 든다
+			return ChildCombinedArea - Child.Bounds.GetSurfaceArea() + InheritedCost;
+		};
+
+		const float Cost1 = GetDescendCost(Node.Child1);
+		const float Cost2 = GetDescendCost(Node.Child2);
+
+		if (DirectCost < Cost1 && DirectCost < Cost2)
+		{
+			break;
+		}
+
+		NodeIndex = Cost1 < Cost2 ? Node.Child1 : Node.Child2;
+	}
+
+	return NodeIndex;
+}
+
+void FDynamicAABBTree::RefitAncestors(int32 InNodeIndex)
+{
+	int32 NodeIndex = InNodeIndex;
+	while (NodeIndex >= 0)
+	{
+		UpdateNode(NodeIndex);
+		RotateNodes(NodeIndex);
+		NodeIndex = Nodes[NodeIndex].Parent;
+	}
+}
+
+void FDynamicAABBTree::UpdateNode(int32 InNodeIndex)
+{
+	FDynamicTreeNode& Node = Nodes[InNodeIndex];
+	const FDynamicTreeNode& Child1 = Nodes[Node.Child1];
+	const FDynamicTreeNode& Child2 = Nodes[Node.Child2];
+	Node.Bounds = Union(Child1.Bounds, Child2.Bounds);
+	Node.Height = 1 + std::max(Child1.Height, Child2.Height);
+}
+
+void FDynamicAABBTree::RotateNodes(int32 InNodeIndex)
+{
+	const FDynamicTreeNode& A = Nodes[InNodeIndex];
+	if (A.Height < 2)
+	{
+		return;
+	}
+
+	// A의 자식은 B, C이고 B의 자식은 D, E, C의 자식은 F, G
+	const int32 IndexB = A.Child1;
+	const int32 IndexC = A.Child2;
+	const FDynamicTreeNode& B = Nodes[IndexB];
+	const FDynamicTreeNode& C = Nodes[IndexC];
+
+	// 자리를 바꾸면 바뀌는 내부 노드(B, C)의 표면적이 가장 많이 줄어드는 회전을 고름
+	float BestReduction = 0.0f;
+	int32 SwapIndexA = -1;
+	int32 SwapIndexB = -1;
+
+	auto Consider = [&](float InReduction, int32 InIndexA, int32 InIndexB)
+	{
+		if (InReduction > BestReduction)
+		{
+			BestReduction = InReduction;
+			SwapIndexA = InIndexA;
+			SwapIndexB = InIndexB;
+		}
+	};
+
+	if (!C.IsLeaf())
+	{
+		const FDynamicTreeNode& F = Nodes[C.Child1];
+		const FDynamicTreeNode& G = Nodes[C.Child2];
+		const float AreaC = C.Bounds.GetSurfaceArea();
+
+		// B <-> F 이면 C = B + G, B <-> G 이면 C = B + F
+		Consider(AreaC - Union(B.Bounds, G.Bounds).GetSurfaceArea(), IndexB, C.Child1);
+		Consider(AreaC - Union(B.Bounds, F.Bounds).GetSurfaceArea(), IndexB, C.Child2);
+	}
+
+	if (!B.IsLeaf())
+	{
+		const FDynamicTreeNode& D = Nodes[B.Child1];
+		const FDynamicTreeNode& E = Nodes[B.Child2];
+		const float AreaB = B.Bounds.GetSurfaceArea();
+
+		// C <-> D 이면 B = C + E, C <-> E 이면 B = C + D
+		Consider(AreaB - Union(C.Bounds, E.Bounds).GetSurfaceArea(), IndexC, B.Child1);
+		Consider(AreaB - Union(C.Bounds, D.Bounds).GetSurfaceArea(), IndexC, B.Child2);
+
+		if (!C.IsLeaf())
+		{
+			const FDynamicTreeNode& F = Nodes[C.Child1];
+			const FDynamicTreeNode& G = Nodes[C.Child2];
+			const float AreaBC = AreaB + C.Bounds.GetSurfaceArea();
+
+			// D <-> F 이면 B = F + E, C = D + G / D <-> G 이면 B = G + E, C = F + D
+			Consider(AreaBC - Union(F.Bounds, E.Bounds).GetSurfaceArea() - Union(D.Bounds, G.Bounds).GetSurfaceArea(),
+				B.Child1, C.Child1);
+			Consider(AreaBC - Union(G.Bounds, E.Bounds).GetSurfaceArea() - Union(F.Bounds, D.Bounds).GetSurfaceArea(),
+				B.Child1, C.Child2);
+		}
+	}
+
+	if (SwapIndexA < 0)
+	{
+		return;
+	}
+
+	SwapSubtrees(SwapIndexA, SwapIndexB);
+
+	// 자리가 바뀐 두 노드의 새 부모(A 아래의 내부 노드)부터 갱신한 뒤 A의 높이 갱신
+	const int32 ParentA = Nodes[SwapIndexA].Parent;
+	const int32 ParentB = Nodes[SwapIndexB].Parent;
+	if (ParentA != InNodeIndex) { UpdateNode(ParentA); }
+	if (ParentB != InNodeIndex) { UpdateNode(ParentB); }
+	UpdateNode(InNodeIndex);
+}
+
+void FDynamicAABBTree::SwapSubtrees(int32 InIndexA, int32 InIndexB)
+{
+	const int32 ParentA = Nodes[InIndexA].Parent;
+	const int32 ParentB = Nodes[InIndexB].Parent;
+
+	ReplaceChild(ParentA, InIndexA, InIndexB);
+	ReplaceChild(ParentB, InIndexB, InIndexA);
+	Nodes[InIndexA].Parent = ParentB;
+	Nodes[InIndexB].Parent = ParentA;
+}
+
+void FDynamicAABBTree::ReplaceChild(int32 InParentIndex, int32 InOldChild, int32 InNewChild)
+{
+	FDynamicTreeNode& Parent = Nodes[InParentIndex];
+	if (Parent.Child1 == InOldChild)
+	{
+		Parent.Child1 = InNewChild;
+	}
+	else
+	{
+		Parent.Child2 = InNewChild;
+	}
+}
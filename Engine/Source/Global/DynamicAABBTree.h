@@ -0,0 +1,204 @@
+#pragma once
+
+#include "Physics/Public/AABB.h"
+
+class UPrimitiveComponent;
+
+/** @brief 리프의 뚱뚱한 경계를 실제 경계보다 넓히는 여유 (각 방향) */
+constexpr float DYNAMIC_TREE_AABB_MARGIN = 0.1f;
+/** @brief 이동 방향으로 이번 이동량의 몇 배만큼 더 넓힐지 (다음 몇 프레임의 이동을 미리 덮음) */
+constexpr float DYNAMIC_TREE_DISPLACEMENT_MULTIPLIER = 4.0f;
+/**
+ * @brief 순회 스택의 인라인 크기 (깊이 우선 순회는 높이 + 1칸이면 충분)
+ * 회전으로 균형을 맞추므로 실제 높이는 이보다 훨씬 낮지만 보장된 상한은 아니어서, 넘는 트리는 힙으로 넘어가고 디버그 빌드에서 assert로 알린다
+ */
+constexpr int32 DYNAMIC_TREE_TRAVERSAL_STACK_SIZE = 64;
+
+/**
+ * @brief 동적 AABB 트리 노드 (노드 풀의 인덱스로 연결)
+ */
+struct FDynamicTreeNode
+{
+	/** @brief 리프는 뚱뚱한 경계, 내부 노드는 두 자식 경계의 합 */
+	FAABB Bounds;
+	/** @brief 리프의 실제 경계 (쿼리의 최종 판정과 이동량 계산에 사용) */
+	FVector TightMin;
+	FVector TightMax;
+	UPrimitiveComponent* Primitive = nullptr;
+	/** @brief 부모 노드, 빈 노드는 다음 빈 노드 */
+	int32 Parent = -1;
+	int32 Child1 = -1;
+	int32 Child2 = -1;
+	/** @brief 리프는 0, 빈 노드는 -1 */
+	int32 Height = -1;
+
+	bool IsLeaf() const { return Child1 < 0; }
+};
+
+/**
+ * @brief 움직이는 프리미티브를 위한 동적 AABB 트리 (Box2D b2DynamicTree / Bullet btDbvt 방식의 이진 BVH)
+ *
+ * 리프는 실제 경계를 여유와 이동 방향 예측만큼 넓힌 뚱뚱한(Fat) 경계를 가지며,
+ * 실제 경계가 그 안에 머무는 동안은 MoveProxy가 트리를 건드리지 않는다
+ * 벗어나면 리프를 빼서 표면적 증가가 가장 작은 형제 옆에 다시 넣고,
+ * 루트까지 올라가며 조상 경계를 갱신할 때 자식과 손자의 자리를 바꾸는 회전으로 표면적 합을 줄인다
+ *
+ * 노드는 포인터 없이 노드 풀(Nodes)에 놓이며, 프록시 번호는 리프 노드의 인덱스라 재삽입해도 바뀌지 않는다
+ */
+class FDynamicAABBTree
+{
+public:
+	FDynamicAABBTree() = default;
+
+	/**
+	 * @brief 프리미티브를 실제 경계로 삽입
+	 * @return 프록시 번호, 경계가 NaN이거나 무한대면 -1
+	 */
+	int32 CreateProxy(UPrimitiveComponent* InPrimitive, const FAABB& InBounds);
+	void DestroyProxy(int32 InProxyId);
+
+	/**
+	 * @brief 프록시의 실제 경계 갱신
+	 * 뚱뚱한 경계 안에서 움직였다면 실제 경계만 바꾸고, 벗어났거나 멈춰서 뚱뚱한 경계가 지나치게 크다면 다시 삽입한다
+	 * @return 트리에 다시 삽입했으면 true (경계가 유효하지 않으면 아무것도 바꾸지 않고 false)
+	 */
+	bool MoveProxy(int32 InProxyId, const FAABB& InBounds);
+
+	/** @brief 모든 프록시와 노드를 비움 */
+	void Clear();
+
+	/** @brief 실제 경계가 QueryBox와 겹치는 프리미티브를 모두 수집 */
+	template<typename AllocatorType>
+	void QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*, AllocatorType>& OutResults) const;
+	/** @brief 실제 경계가 Ray와 교차하는 프리미티브를 모두 수집 */
+	template<typename AllocatorType>
+	void QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*, AllocatorType>& OutResults) const;
+	template<typename AllocatorType>
+	void GetAllPrimitives(TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const;
+
+	UPrimitiveComponent* GetPrimitive(int32 InProxyId) const { return Nodes[InProxyId].Primitive; }
+	const FAABB& GetFatBounds(int32 InProxyId) const { return Nodes[InProxyId].Bounds; }
+	int32 GetNumProxies() const { return NumProxies; }
+
+	/** @brief 루트 노드 인덱스, 비어 있으면 -1 */
+	int32 GetRootIndex() const { return RootIndex; }
+	int32 GetNodeCount() const { return Nodes.Num(); }
+	const FDynamicTreeNode& GetNode(int32 InIndex) const { return Nodes[InIndex]; }
+	int32 GetHeight() const { return RootIndex < 0 ? 0 : Nodes[RootIndex].Height; }
+
+	/** @brief 모든 내부 노드의 표면적 합 / 루트 표면적 (트리 품질 지표, 작을수록 쿼리가 적은 노드를 방문) */
+	float GetAreaRatio() const;
+
+	/** @brief 부모 / 자식 연결, 높이, 경계 포함 관계 검사 */
+	bool CheckValidity() const;
+
+private:
+	int32 AllocateNode();
+	void FreeNode(int32 InNodeIndex);
+
+	void InsertLeaf(int32 InLeafIndex);
+	void RemoveLeaf(int32 InLeafIndex);
+
+	/** @brief 새 리프의 형제로 삼았을 때 표면적 합이 가장 적게 늘어나는 노드 (루트부터 비용이 작은 쪽으로 내려감) */
+	int32 FindBestSibling(const FAABB& InLeafBounds) const;
+
+	/** @brief InNodeIndex부터 루트까지 경계와 높이를 갱신하며 각 노드에서 회전 */
+	void RefitAncestors(int32 InNodeIndex);
+	/** @brief 두 자식의 경계와 높이로 내부 노드 갱신 */
+	void UpdateNode(int32 InNodeIndex);
+	/**
+	 * @brief 자식 하나와 다른 쪽 손자(또는 양쪽 손자끼리)의 자리를 바꿔 표면적 합이 가장 많이 줄어드는 회전 적용
+	 * InNodeIndex의 경계는 같은 리프를 감싸므로 바뀌지 않는다
+	 */
+	void RotateNodes(int32 InNodeIndex);
+	/** @brief 서로의 조상이 아닌 두 노드의 부모를 맞바꿈 */
+	void SwapSubtrees(int32 InIndexA, int32 InIndexB);
+	void ReplaceChild(int32 InParentIndex, int32 InOldChild, int32 InNewChild);
+
+	TArray<FDynamicTreeNode> Nodes;
+	int32 RootIndex = -1;
+	int32 FreeListHead = -1;
+	int32 NumProxies = 0;
+};
+
+template<typename AllocatorType>
+void FDynamicAABBTree::QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*, AllocatorType>& OutResults) const
+{
+	if (RootIndex < 0) { return; }
+
+	assert(GetHeight() < DYNAMIC_TREE_TRAVERSAL_STACK_SIZE);
+	TArray<int32, TInlineAllocator<DYNAMIC_TREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add(RootIndex);
+
+	while (!NodeStack.IsEmpty())
+	{
+		const FDynamicTreeNode& Node = Nodes[NodeStack.Last()];
+		NodeStack.Pop();
+
+		if (!Node.Bounds.IsIntersected(QueryBox))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			// 뚱뚱한 경계는 후보만 거르고, 실제 경계가 겹칠 때만 결과에 넣음
+			if (Node.TightMin.X <= QueryBox.Max.X && Node.TightMax.X >= QueryBox.Min.X &&
+				Node.TightMin.Y <= QueryBox.Max.Y && Node.TightMax.Y >= QueryBox.Min.Y &&
+				Node.TightMin.Z <= QueryBox.Max.Z && Node.TightMax.Z >= QueryBox.Min.Z)
+			{
+				OutResults.Add(Node.Primitive);
+			}
+			continue;
+		}
+
+		NodeStack.Add(Node.Child1);
+		NodeStack.Add(Node.Child2);
+	}
+}
+
+template<typename AllocatorType>
+void FDynamicAABBTree::QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*, AllocatorType>& OutResults) const
+{
+	if (RootIndex < 0) { return; }
+
+	assert(GetHeight() < DYNAMIC_TREE_TRAVERSAL_STACK_SIZE);
+	TArray<int32, TInlineAllocator<DYNAMIC_TREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add(RootIndex);
+
+	while (!NodeStack.IsEmpty())
+	{
+		const FDynamicTreeNode& Node = Nodes[NodeStack.Last()];
+		NodeStack.Pop();
+
+		if (!CheckIntersectionRayBox(InRay, Node.Bounds))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			if (CheckIntersectionRayBox(InRay, FAABB(Node.TightMin, Node.TightMax)))
+			{
+				OutResults.Add(Node.Primitive);
+			}
+			continue;
+		}
+
+		NodeStack.Add(Node.Child1);
+		NodeStack.Add(Node.Child2);
+	}
+}
+
+template<typename AllocatorType>
+void FDynamicAABBTree::GetAllPrimitives(TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const
+{
+	// 리프는 노드 풀에 흩어져 있으므로 트리를 타지 않고 풀을 그대로 훑음
+	for (const FDynamicTreeNode& Node : Nodes)
+	{
+		if (Node.Height == 0)
+		{
+			OutPrimitives.Add(Node.Primitive);
+		}
+	}
+}
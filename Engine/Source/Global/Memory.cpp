@@ -1,33 +1,101 @@
 #include "pch.h"
 #include "Global/Memory.h"
+#include "Runtime/Core/Public/Memory/MallocBinned.h"
+#include "Runtime/Core/Public/Memory/LowLevelMemTracker.h"
 
 #include <new>
 
 using std::align_val_t;
+using std::nothrow_t;
+using std::bad_alloc;
 
-// XXX(KHJ): Atomic 처리할 필요가 있을까?
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
+std::atomic<uint64> TotalAllocationBytes{0};
+std::atomic<uint64> TotalAllocationCount{0};
+
+namespace
+{
+	/**
+	 * @brief 모든 operator new가 거치는 공통 할당 함수
+	 * 할당은 현재 스레드의 LLM 태그로 집계되고, 태그는 해제 때 쓰도록 블록에 기록해 둔다
+	 * @param InSize 할당 size
+	 * @param InAlignment 정렬 (기본 new는 FMallocBinned::DefaultAlignment)
+	 * @return 할당된 메모리. 실패하면 nullptr
+	 */
+	void* AllocateTracked(size_t InSize, size_t InAlignment)
+	{
+		void* Memory = FMallocBinned::Malloc(InSize, InAlignment);
+		if (Memory)
+		{
+			const size_t AllocSize = FMallocBinned::GetAllocationSize(Memory);
+			const uint8 Tag = static_cast<uint8>(FLowLevelMemTracker::GetCurrentTag());
+			FMallocBinned::SetAllocationTag(Memory, Tag);
+			FLowLevelMemTracker::OnAlloc(Tag, AllocSize);
+
+			TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+			TotalAllocationBytes.fetch_add(AllocSize, std::memory_order_relaxed);
+		}
+		return Memory;
+	}
+
+	void* AllocateTrackedOrThrow(size_t InSize, size_t InAlignment)
+	{
+		void* Memory = AllocateTracked(InSize, InAlignment);
+		if (!Memory)
+		{
+			throw bad_alloc();
+		}
+		return Memory;
+	}
+
+	/**
+	 * @brief 모든 operator delete가 거치는 공통 해제 함수
+	 * 크기 / 정렬 정보는 블록 헤더에 있으므로 sized / aligned delete도 여기로 모인다
+	 * @param InMemory 처음에 객체 할당용으로 제공된 메모리 주소
+	 */
+	void FreeTracked(void* InMemory) noexcept
+	{
+		if (!InMemory)
+		{
+			return;
+		}
+
+		const uint64 MemoryAllocSize = FMallocBinned::GetAllocationSize(InMemory);
+		const uint64 PreviousCount = TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+		const uint64 PreviousBytes = TotalAllocationBytes.fetch_sub(MemoryAllocSize, std::memory_order_relaxed);
+		assert(PreviousCount > 0 && u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
+		assert(PreviousBytes >= MemoryAllocSize && u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
+		(void)PreviousCount;
+		(void)PreviousBytes;
+
+		FLowLevelMemTracker::OnFree(FMallocBinned::GetAllocationTag(InMemory), MemoryAllocSize);
+		FMallocBinned::Free(InMemory);
+	}
+}
 
 /**
  * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
+ * 실제 할당은 FMallocBinned가 담당한다 (작은 객체는 크기 클래스 풀, 큰 객체는 OS 직접 할당)
  * @param InSize 할당 size
- * @return 할당한 공간에서 할당 공간 정보를 저장한 헤더를 제외한 나머지 공간의 첫 메모리 주소
+ * @return 할당한 메모리 주소
  */
 void* operator new(size_t InSize)
 {
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	return AllocateTrackedOrThrow(InSize, FMallocBinned::DefaultAlignment);
+}
 
-	// Debug Print
-	// printf("New: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        InSize, TotalAllocationBytes, TotalAllocationCount);
+void* operator new[](size_t InSize)
+{
+	return AllocateTrackedOrThrow(InSize, FMallocBinned::DefaultAlignment);
+}
 
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(malloc(sizeof(AllocHeader) + InSize));
-	MemoryHeader->size = InSize;
-	MemoryHeader->bIsAligned = false;
+void* operator new(size_t InSize, const nothrow_t&) noexcept
+{
+	return AllocateTracked(InSize, FMallocBinned::DefaultAlignment);
+}
 
-	return MemoryHeader + 1;
+void* operator new[](size_t InSize, const nothrow_t&) noexcept
+{
+	return AllocateTracked(InSize, FMallocBinned::DefaultAlignment);
 }
 
 /**
@@ -36,97 +104,83 @@ void* operator new(size_t InSize)
  */
 void operator delete(void* InMemory) noexcept
 {
-	if (!InMemory)
-	{
-		return;
-	}
-
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(InMemory) - 1;
-	size_t MemoryAllocSize = MemoryHeader->size;
-
-	// Debug Print
-	// printf("Delete: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        MemoryAllocSize, TotalAllocationBytes, TotalAllocationCount);
+	FreeTracked(InMemory);
+}
 
-	if (TotalAllocationCount > 0)
-	{
-		--TotalAllocationCount;
-	}
-	else
-	{
-		assert(!u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
-	}
+void operator delete[](void* InMemory) noexcept
+{
+	FreeTracked(InMemory);
+}
 
-	if (TotalAllocationBytes >= MemoryAllocSize)
-	{
-		TotalAllocationBytes -= static_cast<uint32>(MemoryAllocSize);
-	}
-	else
-	{
-		assert(!u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
-	}
+void operator delete(void* InMemory, size_t) noexcept
+{
+	FreeTracked(InMemory);
+}
 
-	if (MemoryHeader->bIsAligned)
-	{
-		_aligned_free(MemoryHeader);
-	}
-	else
-	{
-		free(MemoryHeader);
-	}
+void operator delete[](void* InMemory, size_t) noexcept
+{
+	FreeTracked(InMemory);
 }
 
-/**
- * 배열에 대한 메모리 할당자 오버로딩 함수
- * @param InSize 할당 size
- * 세부 처리는 new 단일 객체 처리로 진행된다
- */
-void* operator new[](size_t InSize)
+void operator delete(void* InMemory, const nothrow_t&) noexcept
 {
-	return ::operator new(InSize);
+	FreeTracked(InMemory);
 }
 
-/**
- * 배열에 대한 메모리 할당 해제 오버로딩 함수
- * @param InMemory 제공된 메모리 주소
- * 세부 처리는 delete 단일 객체 처리로 진행된다
- */
-void operator delete[](void* InMemory) noexcept
+void operator delete[](void* InMemory, const nothrow_t&) noexcept
 {
-	::operator delete(InMemory);
+	FreeTracked(InMemory);
 }
 
-// C++17에서 추가로 제공된 Align된 메모리에 대한 오버로딩 함수
-// SIMD 타입이 추후 필요한 것으로 보고 미리 구현해 둠
+// C++17 over-aligned 타입(alignas(32) SIMD 타입 등)용 오버로딩 함수
+// 정렬은 크기 클래스 선택(64바이트 이하) 또는 큰 할당의 헤더 오프셋으로 보장되므로 별도 헤더가 필요 없다
 
 void* operator new(size_t InSize, align_val_t InAlignment)
 {
-	size_t Alignment = static_cast<size_t>(InAlignment);
+	return AllocateTrackedOrThrow(InSize, static_cast<size_t>(InAlignment));
+}
 
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+void* operator new[](size_t InSize, align_val_t InAlignment)
+{
+	return AllocateTrackedOrThrow(InSize, static_cast<size_t>(InAlignment));
+}
+
+void* operator new(size_t InSize, align_val_t InAlignment, const nothrow_t&) noexcept
+{
+	return AllocateTracked(InSize, static_cast<size_t>(InAlignment));
+}
 
-	// XXX(KHJ): 헤더 크기도 정렬에 맞춰 패딩을 고려해야 할 수 있음
-	size_t TotalSize = sizeof(AllocHeader) + InSize;
+void* operator new[](size_t InSize, align_val_t InAlignment, const nothrow_t&) noexcept
+{
+	return AllocateTracked(InSize, static_cast<size_t>(InAlignment));
+}
+
+void operator delete(void* InMemory, align_val_t) noexcept
+{
+	FreeTracked(InMemory);
+}
 
-	// aligned_alloc 사용
-	// 크기는 정렬값의 배수로 처리해야 함
-	size_t AlignedTotalSize = (TotalSize + Alignment - 1) & ~(Alignment - 1);
+void operator delete[](void* InMemory, align_val_t) noexcept
+{
+	FreeTracked(InMemory);
+}
 
-#ifdef _MSC_VER
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(_aligned_malloc(AlignedTotalSize, Alignment));
-#else
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(aligned_malloc(Alignment, AlignedTotalSize));
-#endif
+void operator delete(void* InMemory, size_t, align_val_t) noexcept
+{
+	FreeTracked(InMemory);
+}
 
-	// 실제 할당된 크기를 저장
-	MemoryHeader->size = InSize;
-	MemoryHeader->bIsAligned = true;
+void operator delete[](void* InMemory, size_t, align_val_t) noexcept
+{
+	FreeTracked(InMemory);
+}
 
-	return MemoryHeader + 1;
+void operator delete(void* InMemory, align_val_t, const nothrow_t&) noexcept
+{
+	FreeTracked(InMemory);
 }
 
-void operator delete(void* InMemory, align_val_t InAlignment) noexcept
+void operator delete[](void* InMemory, align_val_t, const nothrow_t&) noexcept
 {
-	::operator delete(InMemory);
+	FreeTracked(InMemory);
 }
@@ -1,11 +1,6 @@
 #pragma once
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
-
-struct AllocHeader
-{
-	size_t size;
-	bool bIsAligned;
-};
-
+// 전역 operator new / delete로 할당된 메모리 통계 (여러 스레드에서 갱신되므로 atomic)
+// 바이트는 FMallocBinned가 실제로 내어 준 크기(크기 클래스 단위) 기준
+extern std::atomic<uint64> TotalAllocationBytes;
+extern std::atomic<uint64> TotalAllocationCount;
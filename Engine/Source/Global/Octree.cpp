@@ -2,8 +2,7 @@
 #include "Global/Octree.h"
 #include "Component/Public/UUIDTextComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
-
-#include "Level/Public/Level.h"
+#include "Core/Public/Archive.h"
 
 namespace
 {
@@ -14,33 +13,79 @@ namespace
 
 		return FAABB(Min, Max);
 	}
-}
 
-FOctree::FOctree()
-	: BoundingBox(), Depth(0)
-{
-	Children.SetNum(8);
+	FOctreeElement MakeElement(UPrimitiveComponent* InPrimitive, const FAABB& InBounds)
+	{
+		FOctreeElement Element;
+		Element.Min = InBounds.Min;
+		Element.Max = InBounds.Max;
+		Element.Primitive = InPrimitive;
+		return Element;
+	}
+
+	/** @brief Morton 코드의 축당 비트 수 (3축 63비트) */
+	constexpr int32 MORTON_BITS = 21;
+	constexpr uint32 MORTON_MAX = (1u << MORTON_BITS) - 1;
+
+	/** @brief 21비트 값을 3비트 간격으로 펼침 */
+	uint64 ExpandMortonBits(uint32 InValue)
+	{
+		uint64 Bits = InValue & MORTON_MAX;
+		Bits = (Bits | Bits << 32) & 0x001f00000000ffffull;
+		Bits = (Bits | Bits << 16) & 0x001f0000ff0000ffull;
+		Bits = (Bits | Bits << 8) & 0x100f00f00f00f00full;
+		Bits = (Bits | Bits << 4) & 0x10c30c30c30c30c3ull;
+		Bits = (Bits | Bits << 2) & 0x1249249249249249ull;
+		return Bits;
+	}
+
+	uint32 QuantizeMorton(float InValue, float InMin, float InScale)
+	{
+		const float Scaled = (InValue - InMin) * InScale;
+		if (Scaled <= 0.0f) { return 0; }
+		if (Scaled >= static_cast<float>(MORTON_MAX)) { return MORTON_MAX; }
+		return static_cast<uint32>(Scaled);
+	}
+
+	/** @brief 파일에 저장하는 노드 (FAABB는 가상 함수 테이블이 있어 그대로 쓸 수 없으므로 값만 옮김) */
+	struct FSavedOctreeNode
+	{
+		FVector BoundsMin;
+		FVector BoundsMax;
+		FVector Center;
+		float HalfSize;
+		int32 FirstChild;
+		uint32 ChildMask;
+		int32 FirstElement;
+		int32 NumElements;
+		int32 NumSubtreeElements;
+	};
+
+	/** @brief 파일에 저장하는 프리미티브 (포인터 대신 호출자가 넘긴 배열에서의 번호) */
+	struct FSavedOctreeElement
+	{
+		FVector Min;
+		FVector Max;
+		int32 PrimitiveIndex;
+	};
 }
 
-FOctree::FOctree(const FAABB& InBoundingBox, int InDepth)
-	: BoundingBox(InBoundingBox), Depth(InDepth)
+/** @brief Build에서 정렬하는 항목 */
+struct FOctree::FBuildItem
 {
-	Children.SetNum(8);
-}
+	uint64 MortonCode;
+	FOctreeElement Element;
+};
 
-FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth)
-	: Depth(InDepth)
+FOctree::FOctree()
+	: FOctree(FVector(0, 0, 0), 1000.0f)
 {
-	const float HalfSize = InSize * 0.5f;
-	BoundingBox.Min = InPosition - FVector(HalfSize, HalfSize, HalfSize);
-	BoundingBox.Max = InPosition + FVector(HalfSize, HalfSize, HalfSize);
-	Children.SetNum(8);
 }
 
-FOctree::~FOctree()
+FOctree::FOctree(const FVector& InCenter, float InSize)
 {
-	Primitives.Empty();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	Nodes.SetNum(1);
+	InitNode(RootIndex, InCenter, InSize * 0.5f);
 }
 
 bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
@@ -48,40 +93,66 @@ bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
 	// nullptr 체크
 	if (!InPrimitive) { return false; }
 
-	// 0. 영역 내에 객체가 없으면 종료
-	if (BoundingBox.IsIntersected(GetPrimitiveBoundingBox(InPrimitive)) == false) { return false; }
+	return Insert(InPrimitive, GetPrimitiveBoundingBox(InPrimitive));
+}
 
-	if (IsLeaf())
+bool FOctree::Insert(UPrimitiveComponent* InPrimitive, const FAABB& InBounds)
+{
+	if (!InPrimitive) { return false; }
+
+	const FVector PrimitiveCenter = (InBounds.Min + InBounds.Max) * 0.5f;
+
+	// 0. 중심이 루트 셀을 벗어났거나 느슨한 경계에 들어가지 않으면 객체 쪽으로 루트를 키움
+	// 느슨한 경계에만 들어가는 경우도 키워야 중심이 속한 자식을 따라 내려갈 수 있다 (NaN 경계는 비교가 항상 실패)
+	while (!IsInCell(Nodes[RootIndex], PrimitiveCenter) || !Nodes[RootIndex].Bounds.IsContains(InBounds))
 	{
-		// 리프 노드이며, 여유 공간이 있거나 최대 깊이에 도달했다면
-		if (Primitives.Num() < MAX_PRIMITIVES || Depth == MAX_DEPTH)
-		{
-			Primitives.Add(InPrimitive); // 해당 객체를 추가한다
-			return true;
-		}
-		else // 여유 공간이 없고, 최대 깊이에 도달하지 않았다면
-		{
-			// 분할 및 재귀적 추가를 한다
-			Subdivide(InPrimitive);
-			return true;
-		}
+		if (Nodes[RootIndex].HalfSize * 2.0f >= OCTREE_MAX_ROOT_SIZE) { return false; }
+		Grow(PrimitiveCenter);
 	}
-	else
+
+	InsertFromNode(RootIndex, MakeElement(InPrimitive, InBounds));
+	return true;
+}
+
+void FOctree::InsertFromNode(int32 InStartNodeIndex, const FOctreeElement& InElement)
+{
+	const FAABB ElementBox(InElement.Min, InElement.Max);
+	const FVector ElementCenter = (InElement.Min + InElement.Max) * 0.5f;
+
+	int32 NodeIndex = InStartNodeIndex;
+	++Nodes[NodeIndex].NumSubtreeElements;
+
+	while (true)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		const FOctreeNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
 		{
-			// 자식 노드를 보유하고 있고, 영역 내에 해당 객체가 존재한다면
-			if (Children[Index] && Children[Index]->BoundingBox.IsContains(GetPrimitiveBoundingBox(InPrimitive)))
+			// 리프 노드이며, 여유 공간이 있거나 최소 셀 크기에 도달했다면 해당 객체를 추가한다
+			if (Node.NumElements < MAX_PRIMITIVES || Node.HalfSize * 2.0f <= OCTREE_MIN_CELL_SIZE)
 			{
-				return Children[Index]->Insert(InPrimitive); // 자식 노드에게 넘겨준다
+				AddElement(NodeIndex, InElement);
+				return;
 			}
+
+			// 분할한 뒤 같은 노드에서 다시 내려간다
+			Subdivide(NodeIndex);
+			continue;
 		}
 
-		Primitives.Add(InPrimitive);
-		return true;
-	}
+		// 중심이 속한 자식의 느슨한 경계에 들어가면 자식 노드에게 넘겨준다
+		const int32 ChildSlot = GetChildIndex(Node, ElementCenter);
+		const int32 ChildIndex = Node.FirstChild + ChildSlot;
+		if (!Nodes[ChildIndex].Bounds.IsContains(ElementBox))
+		{
+			// 자식 셀보다 큰 객체만 현재 노드에 남음
+			AddElement(NodeIndex, InElement);
+			return;
+		}
 
-	return false;
+		Nodes[NodeIndex].ChildMask |= static_cast<uint8>(1 << ChildSlot);
+		NodeIndex = ChildIndex;
+		++Nodes[NodeIndex].NumSubtreeElements;
+	}
 }
 
 bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
@@ -91,241 +162,825 @@ bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
 		return false;
 	}
 
-	// 경계 검사를 수행하지 않고 바로 탐색 시작
-    
-	// 1-A. 리프 노드인 경우 (현재 노드만 검사하면 됨)
-	if (IsLeaf())
+	// 경계가 바뀌었을 수 있으므로 원래 등록되었던 위치를 알 수 없어 하위 트리를 탐색 (빈 하위 트리는 건너뜀)
+	return RemoveRecursive(RootIndex, InPrimitive);
+}
+
+bool FOctree::RemoveRecursive(int32 InNodeIndex, UPrimitiveComponent* InPrimitive)
+{
+	// 제거 중에는 노드를 새로 할당하지 않으므로 참조가 유지된다
+	FOctreeNode& Node = Nodes[InNodeIndex];
+	if (Node.NumSubtreeElements == 0)
+	{
+		return false;
+	}
+
+	// 1. 현재 노드의 프리미티브 목록에서 제거 시도
+	for (int32 Index = 0; Index < Node.NumElements; ++Index)
 	{
-		// O(N) 탐색을 통해 프리미티브 목록에서 제거를 시도합니다.
-		if (Primitives.RemoveSwap(InPrimitive) > 0)
+		if (Elements[Node.FirstElement + Index].Primitive == InPrimitive)
 		{
+			RemoveElementAt(InNodeIndex, Index);
+			--Node.NumSubtreeElements;
 			return true;
 		}
-		return false; // 리프 노드에서 발견하지 못했으므로 탐색 종료
 	}
-    
-	// 1-B. 자식 노드가 있는 경우 (내부 노드)
-	else
+
+	// 2. 프리미티브가 있는 자식 노드 순회
+	for (int32 Index = 0; Index < 8; ++Index)
 	{
-		// 2. 현재 노드의 Primitives 목록에서 제거 시도 (선택 사항: 일부 트리는 내부 노드에도 프리미티브를 저장함)
-		if (Primitives.RemoveSwap(InPrimitive) > 0)
+		if (Node.HasChild(Index) && RemoveRecursive(Node.FirstChild + Index, InPrimitive))
 		{
+			--Node.NumSubtreeElements;
+			if (Nodes[Node.FirstChild + Index].NumSubtreeElements == 0)
+			{
+				Node.ChildMask &= static_cast<uint8>(~(1 << Index));
+			}
+
+			// 3. 자식 노드에서 무언가 제거되었다면, 현재 노드를 합칠 수 있는지 검사
+			TryMerge(InNodeIndex);
 			return true;
 		}
-       
-		// 3. 자식 노드 순회 (원래 등록되었을 위치를 재귀적으로 탐색)
-		bool bIsRemoved = false;
+	}
+
+	return false;
+}
+
+void FOctree::RemovePrimitives(const TSet<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>& OutRemoved)
+{
+	int32 NumRemaining = InPrimitives.Num();
+	if (NumRemaining > 0)
+	{
+		RemovePrimitivesRecursive(RootIndex, InPrimitives, OutRemoved, NumRemaining);
+	}
+}
+
+int32 FOctree::RemovePrimitivesRecursive(int32 InNodeIndex, const TSet<UPrimitiveComponent*>& InPrimitives,
+	TArray<UPrimitiveComponent*>& OutRemoved, int32& InOutNumRemaining)
+{
+	FOctreeNode& Node = Nodes[InNodeIndex];
+	if (Node.NumSubtreeElements == 0)
+	{
+		return 0;
+	}
+
+	int32 NumRemoved = 0;
+	for (int32 Index = Node.NumElements - 1; Index >= 0 && InOutNumRemaining > 0; --Index)
+	{
+		UPrimitiveComponent* Primitive = Elements[Node.FirstElement + Index].Primitive;
+		if (InPrimitives.Contains(Primitive))
+		{
+			OutRemoved.Add(Primitive);
+			RemoveElementAt(InNodeIndex, Index);
+			--InOutNumRemaining;
+			++NumRemoved;
+		}
+	}
+	Node.NumSubtreeElements -= NumRemoved;
 
-		for (int Index = 0; Index < 8; ++Index)
+	if (!Node.IsLeaf())
+	{
+		// 모두 찾았다면 남은 자식은 방문하지 않음
+		int32 NumRemovedFromChildren = 0;
+		for (int32 Index = 0; Index < 8 && InOutNumRemaining > 0; ++Index)
 		{
-			// 💡 Children[Index]->Remove(InPrimitive) 호출 시, 
-			//    자식 노드 내부에서 다시 경계 검사가 수행되지 않도록 보장해야 합니다.
-			if (Children[Index] && Children[Index]->Remove(InPrimitive))
+			if (!Node.HasChild(Index))
 			{
-				bIsRemoved = true;
-				break;
+				continue;
 			}
-		}
 
-		// 4. 자식 노드에서 무언가 제거되었다면, 현재 노드를 합칠 수 있는지 검사
-		if (bIsRemoved) { TryMerge(); }
+			const int32 ChildIndex = Node.FirstChild + Index;
+			NumRemovedFromChildren += RemovePrimitivesRecursive(ChildIndex, InPrimitives, OutRemoved, InOutNumRemaining);
+			if (Nodes[ChildIndex].NumSubtreeElements == 0)
+			{
+				Node.ChildMask &= static_cast<uint8>(~(1 << Index));
+			}
+		}
 
-		return bIsRemoved;
+		// Remove와 마찬가지로 자식에서 제거되었다면 합칠 수 있는지 검사 (자식이 먼저 합쳐지므로 아래에서 위로 진행)
+		if (NumRemovedFromChildren > 0)
+		{
+			Node.NumSubtreeElements -= NumRemovedFromChildren;
+			NumRemoved += NumRemovedFromChildren;
+			TryMerge(InNodeIndex);
+		}
 	}
 
+	return NumRemoved;
 }
 
-void FOctree::Clear()
+void FOctree::Build(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>* OutRejected)
 {
-	Primitives.Empty();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	TArray<FOctreeElement> BuildElements;
+	BuildElements.Reserve(InPrimitives.Num());
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		if (Primitive)
+		{
+			BuildElements.Add(MakeElement(Primitive, GetPrimitiveBoundingBox(Primitive)));
+		}
+	}
+
+	Build(BuildElements, OutRejected);
 }
 
-void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
+void FOctree::Build(const TArray<FOctreeElement>& InElements, TArray<UPrimitiveComponent*>* OutRejected)
 {
-	// 1. 현재 노드가 가진 프리미티브를 결과 배열에 추가합니다.
-	OutPrimitives.Append(Primitives);
+	Clear();
+
+	// 1. 유효한 경계만 골라 중심의 범위와 가장 큰 반지름을 구함 (NaN은 비교가 실패하므로 걸러짐)
+	FVector CenterMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector CenterMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	float MaxHalfExtent = 0.0f;
+	int32 NumValid = 0;
+	for (const FOctreeElement& Element : InElements)
+	{
+		if (!(Element.Min.X <= Element.Max.X && Element.Min.Y <= Element.Max.Y && Element.Min.Z <= Element.Max.Z))
+		{
+			continue;
+		}
+
+		const FVector Center = (Element.Min + Element.Max) * 0.5f;
+		CenterMin = FVector(std::min(CenterMin.X, Center.X), std::min(CenterMin.Y, Center.Y), std::min(CenterMin.Z, Center.Z));
+		CenterMax = FVector(std::max(CenterMax.X, Center.X), std::max(CenterMax.Y, Center.Y), std::max(CenterMax.Z, Center.Z));
+		const FVector HalfExtent = (Element.Max - Element.Min) * 0.5f;
+		MaxHalfExtent = std::max(MaxHalfExtent, std::max(HalfExtent.X, std::max(HalfExtent.Y, HalfExtent.Z)));
+		++NumValid;
+	}
 
-	// 2. 리프 노드가 아니라면, 모든 자식 노드에 대해 재귀적으로 함수를 호출합니다.
-	if (!IsLeaf())
+	// 2. Insert와 같은 규칙으로 루트를 키움 (빈 루트는 셀만 커짐)
+	if (NumValid > 0)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		while (Nodes[RootIndex].HalfSize * 2.0f < OCTREE_MAX_ROOT_SIZE)
 		{
-			if (Children[Index])
+			const FOctreeNode& Root = Nodes[RootIndex];
+			if (!IsInCell(Root, CenterMin))
 			{
-				Children[Index]->GetAllPrimitives(OutPrimitives);
+				Grow(CenterMin);
 			}
+			else if (!IsInCell(Root, CenterMax) || Root.HalfSize * (OCTREE_LOOSENESS - 1.0f) < MaxHalfExtent)
+			{
+				Grow(CenterMax);
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+
+	// 3. 루트 셀 기준으로 중심을 양자화해 Morton 코드 계산
+	const FOctreeNode& Root = Nodes[RootIndex];
+	const FVector CellMin = Root.Center - FVector(Root.HalfSize, Root.HalfSize, Root.HalfSize);
+	const float Scale = static_cast<float>(MORTON_MAX + 1) / (Root.HalfSize * 2.0f);
+
+	TArray<FBuildItem> Items;
+	Items.Reserve(InElements.Num());
+	for (const FOctreeElement& Element : InElements)
+	{
+		const FAABB ElementBox(Element.Min, Element.Max);
+		const FVector Center = (Element.Min + Element.Max) * 0.5f;
+		if (!IsInCell(Root, Center) || !Root.Bounds.IsContains(ElementBox))
+		{
+			if (OutRejected && Element.Primitive)
+			{
+				OutRejected->Add(Element.Primitive);
+			}
+			continue;
 		}
+
+		FBuildItem Item;
+		Item.MortonCode = ExpandMortonBits(QuantizeMorton(Center.X, CellMin.X, Scale)) |
+			(ExpandMortonBits(QuantizeMorton(Center.Y, CellMin.Y, Scale)) << 1) |
+			(ExpandMortonBits(QuantizeMorton(Center.Z, CellMin.Z, Scale)) << 2);
+		Item.Element = Element;
+		Items.Add(Item);
+	}
+
+	if (Items.IsEmpty())
+	{
+		return;
+	}
+
+	std::sort(Items.begin(), Items.end(), [](const FBuildItem& A, const FBuildItem& B)
+	{
+		return A.MortonCode < B.MortonCode;
+	});
+
+	// 4. 위에서부터 Morton 구간을 8개로 나누며 깊이 우선 순서로 노드와 프리미티브 구간을 채움
+	Elements.Reserve(Items.Num());
+	BuildNode(RootIndex, Items.GetData(), Items.Num(), 0);
+}
+
+void FOctree::BuildNode(int32 InNodeIndex, FBuildItem* InItems, int32 InNumItems, int32 InDepth)
+{
+	Nodes[InNodeIndex].NumSubtreeElements = InNumItems;
+
+	auto AppendElements = [this, InNodeIndex](const FBuildItem* InBegin, const FBuildItem* InEnd)
+	{
+		FOctreeNode& Node = Nodes[InNodeIndex];
+		Node.FirstElement = Elements.Num();
+		for (const FBuildItem* Item = InBegin; Item < InEnd; ++Item)
+		{
+			Elements.Add(Item->Element);
+		}
+		Node.NumElements = static_cast<int32>(InEnd - InBegin);
+		Node.ElementCapacity = Node.NumElements;
+	};
+
+	if (InNumItems <= MAX_PRIMITIVES || Nodes[InNodeIndex].HalfSize * 2.0f <= OCTREE_MIN_CELL_SIZE || InDepth >= MORTON_BITS)
+	{
+		AppendElements(InItems, InItems + InNumItems);
+		return;
+	}
+
+	const int32 FirstChild = AllocateChildren(InNodeIndex);
+	const int32 Shift = 3 * (MORTON_BITS - 1 - InDepth);
+
+	// Morton 코드가 가리키는 자식의 느슨한 경계에 들어가지 않는 큰 객체는 이 노드에 남김 (순서를 유지해 정렬 상태 보존)
+	// 대부분의 노드에는 남는 객체가 없으므로 먼저 찾아보고 있을 때만 나눔
+	FBuildItem* ItemsEnd = InItems + InNumItems;
+	auto StaysInNode = [this, FirstChild, Shift](const FBuildItem& Item)
+	{
+		const int32 ChildSlot = static_cast<int32>((Item.MortonCode >> Shift) & 7);
+		return !Nodes[FirstChild + ChildSlot].Bounds.IsContains(FAABB(Item.Element.Min, Item.Element.Max));
+	};
+
+	FBuildItem* ChildItems = InItems;
+	if (std::find_if(InItems, ItemsEnd, StaysInNode) != ItemsEnd)
+	{
+		ChildItems = std::stable_partition(InItems, ItemsEnd, StaysInNode);
+	}
+	AppendElements(InItems, ChildItems);
+
+	FBuildItem* SlotBegin = ChildItems;
+	for (int32 ChildSlot = 0; ChildSlot < 8 && SlotBegin < ItemsEnd; ++ChildSlot)
+	{
+		FBuildItem* SlotEnd = SlotBegin;
+		while (SlotEnd < ItemsEnd && static_cast<int32>((SlotEnd->MortonCode >> Shift) & 7) == ChildSlot)
+		{
+			++SlotEnd;
+		}
+
+		if (SlotEnd > SlotBegin)
+		{
+			Nodes[InNodeIndex].ChildMask |= static_cast<uint8>(1 << ChildSlot);
+			BuildNode(FirstChild + ChildSlot, SlotBegin, static_cast<int32>(SlotEnd - SlotBegin), InDepth + 1);
+		}
+		SlotBegin = SlotEnd;
 	}
 }
 
-TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount)
+void FOctree::Clear()
 {
-	TArray<UPrimitiveComponent*> Candidates = GWorld->GetLevel()->GetDynamicPrimitives();
-	Candidates.Reserve(MaxPrimitiveCount);
+	const FVector RootCenter = Nodes[RootIndex].Center;
+	const float RootHalfSize = Nodes[RootIndex].HalfSize;
+
+	Nodes.Empty();
+	Nodes.SetNum(1);
+	RootIndex = 0;
+	InitNode(RootIndex, RootCenter, RootHalfSize);
+
+	FreeChildBlocks.Empty();
+	Elements.Empty();
+	NumWastedElements = 0;
+}
+
+void FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount, TArray<UPrimitiveComponent*>& OutCandidates)
+{
+	OutCandidates.Empty();
+	OutCandidates.Reserve(MaxPrimitiveCount);
+
+	FMemMark Mark(FMemStack::Get());
 	FNodeQueue NodeQueue;
 
 	float RootDistance = this->GetBoundingBox().GetCenterDistanceSquared(FindPos);
-	NodeQueue.push({ RootDistance, this });
+	NodeQueue.push({ RootDistance, RootIndex });
 
-	while (!NodeQueue.empty() && Candidates.Num() < MaxPrimitiveCount)
+	while (!NodeQueue.empty() && OutCandidates.Num() < MaxPrimitiveCount)
 	{
-		FOctree* CurrentNode = NodeQueue.top().second;
+		const FOctreeNode& CurrentNode = Nodes[NodeQueue.top().second];
 		NodeQueue.pop();
 
-		if (CurrentNode->IsLeafNode())
+		// 느슨한 Octree는 자식 셀보다 큰 객체를 내부 노드에 두므로 내부 노드의 프리미티브도 후보에 넣음
+		const FOctreeElement* NodeElements = GetNodeElements(CurrentNode);
+		for (int32 Index = 0; Index < CurrentNode.NumElements; ++Index)
 		{
-			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
-			{
-				Candidates.Add(Primitive);
-			}
+			OutCandidates.Add(NodeElements[Index].Primitive);
 		}
-		else
+
+		for (int32 Index = 0; Index < 8; ++Index)
 		{
-			for (int i = 0; i < 8; ++i)
+			if (CurrentNode.HasChild(Index))
 			{
-				FOctree* Child = CurrentNode->Children[i];
-				if (Child)
-				{
-					float ChildDistance = Child->GetBoundingBox().GetCenterDistanceSquared(FindPos);
-					NodeQueue.push({ ChildDistance, Child });
-				}
+				const int32 ChildIndex = CurrentNode.FirstChild + Index;
+				float ChildDistance = Nodes[ChildIndex].Bounds.GetCenterDistanceSquared(FindPos);
+				NodeQueue.push({ ChildDistance, ChildIndex });
 			}
 		}
 	}
+}
 
-	return Candidates;
+void FOctree::InitNode(int32 InNodeIndex, const FVector& InCenter, float InHalfSize)
+{
+	FOctreeNode& Node = Nodes[InNodeIndex];
+	Node = FOctreeNode();
+	Node.Center = InCenter;
+	Node.HalfSize = InHalfSize;
+
+	const float LooseHalfSize = InHalfSize * OCTREE_LOOSENESS;
+	Node.Bounds.Min = InCenter - FVector(LooseHalfSize, LooseHalfSize, LooseHalfSize);
+	Node.Bounds.Max = InCenter + FVector(LooseHalfSize, LooseHalfSize, LooseHalfSize);
 }
 
-void FOctree::Subdivide(UPrimitiveComponent* InPrimitive)
+bool FOctree::IsInCell(const FOctreeNode& InNode, const FVector& InPosition)
 {
-	const FVector& Min = BoundingBox.Min;
-	const FVector& Max = BoundingBox.Max;
-	const FVector Center = (Min + Max) * 0.5f;
+	return InPosition.X >= InNode.Center.X - InNode.HalfSize && InPosition.X <= InNode.Center.X + InNode.HalfSize &&
+		InPosition.Y >= InNode.Center.Y - InNode.HalfSize && InPosition.Y <= InNode.Center.Y + InNode.HalfSize &&
+		InPosition.Z >= InNode.Center.Z - InNode.HalfSize && InPosition.Z <= InNode.Center.Z + InNode.HalfSize;
+}
 
-	Children[0] = new FOctree(FAABB(FVector(Min.X, Center.Y, Min.Z), FVector(Center.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Left
-	Children[1] = new FOctree(FAABB(FVector(Center.X, Center.Y, Min.Z), FVector(Max.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Right
-	Children[2] = new FOctree(FAABB(FVector(Min.X, Center.Y, Center.Z), FVector(Center.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Left
-	Children[3] = new FOctree(FAABB(FVector(Center.X, Center.Y, Center.Z), FVector(Max.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Right
-	Children[4] = new FOctree(FAABB(FVector(Min.X, Min.Y, Min.Z), FVector(Center.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Left
-	Children[5] = new FOctree(FAABB(FVector(Center.X, Min.Y, Min.Z), FVector(Max.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Right
-	Children[6] = new FOctree(FAABB(FVector(Min.X, Min.Y, Center.Z), FVector(Center.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Left
-	Children[7] = new FOctree(FAABB(FVector(Center.X, Min.Y, Center.Z), FVector(Max.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Right
+int32 FOctree::GetChildIndex(const FOctreeNode& InNode, const FVector& InPosition)
+{
+	return (InPosition.X >= InNode.Center.X ? 1 : 0) | (InPosition.Y >= InNode.Center.Y ? 2 : 0) | (InPosition.Z >= InNode.Center.Z ? 4 : 0);
+}
 
-	TArray<UPrimitiveComponent*> primitivesToMove = Primitives;
-	primitivesToMove.Add(InPrimitive);
-	Primitives.Empty();
+int32 FOctree::AllocateChildren(int32 InNodeIndex)
+{
+	int32 FirstChild;
+	if (!FreeChildBlocks.IsEmpty())
+	{
+		FirstChild = FreeChildBlocks.Last();
+		FreeChildBlocks.Pop();
+	}
+	else
+	{
+		FirstChild = Nodes.Num();
+		Nodes.SetNum(FirstChild + 8);
+	}
 
-	for (UPrimitiveComponent* prim : primitivesToMove)
+	const FVector Center = Nodes[InNodeIndex].Center;
+	const float ChildHalfSize = Nodes[InNodeIndex].HalfSize * 0.5f;
+	for (int32 Index = 0; Index < 8; ++Index)
 	{
-		Insert(prim);
+		const FVector ChildCenter(
+			Center.X + ((Index & 1) ? ChildHalfSize : -ChildHalfSize),
+			Center.Y + ((Index & 2) ? ChildHalfSize : -ChildHalfSize),
+			Center.Z + ((Index & 4) ? ChildHalfSize : -ChildHalfSize));
+		InitNode(FirstChild + Index, ChildCenter, ChildHalfSize);
 	}
+
+	Nodes[InNodeIndex].FirstChild = FirstChild;
+	Nodes[InNodeIndex].ChildMask = 0;
+	return FirstChild;
 }
 
-void FOctree::TryMerge()
+void FOctree::FreeChildren(int32 InNodeIndex)
 {
-	// Case 1. 자식 노드가 존재하지 않으므로 종료
-	if (IsLeaf())
+	FOctreeNode& Node = Nodes[InNodeIndex];
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		NumWastedElements += Nodes[Node.FirstChild + Index].ElementCapacity;
+	}
+
+	FreeChildBlocks.Add(Node.FirstChild);
+	Node.FirstChild = -1;
+	Node.ChildMask = 0;
+}
+
+void FOctree::Grow(const FVector& InTarget)
+{
+	const FOctreeNode OldRoot = Nodes[RootIndex];
+	const float OldHalfSize = OldRoot.HalfSize;
+
+	// 목표 쪽으로 각 축을 기존 셀 크기의 절반만큼 옮기면 기존 셀이 새 셀의 한 옥탄트가 된다
+	const FVector NewCenter(
+		OldRoot.Center.X + (InTarget.X >= OldRoot.Center.X ? OldHalfSize : -OldHalfSize),
+		OldRoot.Center.Y + (InTarget.Y >= OldRoot.Center.Y ? OldHalfSize : -OldHalfSize),
+		OldRoot.Center.Z + (InTarget.Z >= OldRoot.Center.Z ? OldHalfSize : -OldHalfSize));
+
+	// 리프라면 커진 느슨한 경계가 기존 경계를 감싸므로 셀만 키우면 됨
+	if (OldRoot.IsLeaf())
+	{
+		InitNode(RootIndex, NewCenter, OldHalfSize * 2.0f);
+		Nodes[RootIndex].FirstElement = OldRoot.FirstElement;
+		Nodes[RootIndex].NumElements = OldRoot.NumElements;
+		Nodes[RootIndex].ElementCapacity = OldRoot.ElementCapacity;
+		Nodes[RootIndex].NumSubtreeElements = OldRoot.NumSubtreeElements;
+		return;
+	}
+
+	// 새 루트 셀의 자식 블록을 만들고, 기존 루트는 자신의 셀에 해당하는 자식 자리로 옮김
+	InitNode(RootIndex, NewCenter, OldHalfSize * 2.0f);
+	const int32 FirstChild = AllocateChildren(RootIndex);
+	const int32 OldRootSlot = GetChildIndex(Nodes[RootIndex], OldRoot.Center);
+	Nodes[FirstChild + OldRootSlot] = OldRoot;
+
+	FOctreeNode& NewRoot = Nodes[RootIndex];
+	NewRoot.NumSubtreeElements = OldRoot.NumSubtreeElements;
+	if (OldRoot.NumSubtreeElements > 0)
+	{
+		NewRoot.ChildMask = static_cast<uint8>(1 << OldRootSlot);
+	}
+}
+
+void FOctree::Subdivide(int32 InNodeIndex)
+{
+	AllocateChildren(InNodeIndex);
+
+	// 리프의 프리미티브를 꺼내 다시 분배 (구간은 남겨 두어 자식에 못 들어가는 큰 객체가 다시 씀)
+	TArray<FOctreeElement, TInlineAllocator<MAX_PRIMITIVES>> ElementsToMove;
+	const FOctreeNode& Node = Nodes[InNodeIndex];
+	ElementsToMove.Append(GetNodeElements(Node), Node.NumElements);
+
+	Nodes[InNodeIndex].NumElements = 0;
+	Nodes[InNodeIndex].NumSubtreeElements -= ElementsToMove.Num();
+
+	for (const FOctreeElement& Element : ElementsToMove)
+	{
+		InsertFromNode(InNodeIndex, Element);
+	}
+}
+
+void FOctree::TryMerge(int32 InNodeIndex)
+{
+	const FOctreeNode& Node = Nodes[InNodeIndex];
+
+	// Case 1. 자식 노드가 존재하지 않거나 합쳐도 최대치를 넘으면 종료
+	if (Node.IsLeaf() || Node.NumSubtreeElements > MAX_PRIMITIVES)
 	{
 		return;
 	}
 
 	// 모든 자식 노드가 리프 노드인지 확인
-	for (int Index = 0; Index < 8; ++Index)
+	for (int32 Index = 0; Index < 8; ++Index)
 	{
-		if (!Children[Index]->IsLeaf())
+		if (!Nodes[Node.FirstChild + Index].IsLeaf())
 		{
 			return; // 하나라도 리프가 아니면 합치지 않음
 		}
 	}
 
-	// 모든 자식 노드에 있는 프리미티브의 총 개수를 계산
-	uint32 TotalPrimitives = static_cast<uint32>(Primitives.Num());
-	for (int Index = 0; Index < 8; ++Index)
+	// 자식 노드의 프리미티브를 모아 현재 노드로 옮긴 뒤 자식 블록 해제
+	TArray<FOctreeElement, TInlineAllocator<MAX_PRIMITIVES>> ChildElements;
+	for (int32 Index = 0; Index < 8; ++Index)
 	{
-		TotalPrimitives += static_cast<uint32>(Children[Index]->Primitives.Num());
+		const FOctreeNode& Child = Nodes[Node.FirstChild + Index];
+		ChildElements.Append(GetNodeElements(Child), Child.NumElements);
 	}
 
-	// 프리미티브 총 개수가 최대치보다 작으면 합치기 수행
-	if (TotalPrimitives <= MAX_PRIMITIVES)
+	FreeChildren(InNodeIndex);
+	for (const FOctreeElement& Element : ChildElements)
 	{
-		for (int Index = 0; Index < 8; ++Index)
-		{
-			Primitives.Append(Children[Index]->Primitives);
-		}
+		AddElement(InNodeIndex, Element);
+	}
+}
+
+void FOctree::AddElement(int32 InNodeIndex, const FOctreeElement& InElement)
+{
+	FOctreeNode& Node = Nodes[InNodeIndex];
 
-		// 모든 자식 노드를 메모리에서 해제
-		for (int Index = 0; Index < 8; ++Index)
+	// 구간이 가득 찼다면 두 배 크기로 배열 끝에 옮김 (기존 구간은 버려진 칸으로 남음)
+	if (Node.NumElements == Node.ElementCapacity)
+	{
+		const int32 NewCapacity = Node.ElementCapacity > 0 ? Node.ElementCapacity * 2 : 4;
+		const int32 NewFirstElement = Elements.Num();
+		Elements.SetNum(NewFirstElement + NewCapacity);
+		for (int32 Index = 0; Index < Node.NumElements; ++Index)
 		{
-			SafeDelete(Children[Index]);
+			Elements[NewFirstElement + Index] = Elements[Node.FirstElement + Index];
 		}
+
+		NumWastedElements += Node.ElementCapacity;
+		Node.FirstElement = NewFirstElement;
+		Node.ElementCapacity = NewCapacity;
 	}
+
+	Elements[Node.FirstElement + Node.NumElements] = InElement;
+	++Node.NumElements;
+
+	CompactElementsIfNeeded();
 }
 
-void FOctree::DeepCopy(FOctree* OutOctree) const
+void FOctree::RemoveElementAt(int32 InNodeIndex, int32 InLocalIndex)
 {
-	if (!OutOctree)
+	FOctreeNode& Node = Nodes[InNodeIndex];
+	const int32 LastElement = Node.FirstElement + Node.NumElements - 1;
+
+	Elements[Node.FirstElement + InLocalIndex] = Elements[LastElement];
+	Elements[LastElement] = FOctreeElement();
+	--Node.NumElements;
+}
+
+void FOctree::CompactElementsIfNeeded()
+{
+	constexpr int32 MIN_WASTED_ELEMENTS_TO_COMPACT = 1024;
+	if (NumWastedElements < MIN_WASTED_ELEMENTS_TO_COMPACT || NumWastedElements * 2 < Elements.Num())
 	{
 		return;
 	}
 
-	// 1) 필드 복사
-	OutOctree->BoundingBox = BoundingBox;
-	OutOctree->Depth = Depth;
+	TArray<FOctreeElement> CompactedElements;
+	CompactedElements.Reserve(Elements.Num() - NumWastedElements);
+
+	// Build와 같은 깊이 우선 순서로 다시 채워 하위 트리의 프리미티브가 다시 모이도록 함
+	// 빈 자식도 구간이 예전 배열을 가리키지 않도록 모두 방문
+	TArray<int32, TInlineAllocator<OCTREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add(RootIndex);
+	while (!NodeStack.IsEmpty())
+	{
+		FOctreeNode& Node = Nodes[NodeStack.Last()];
+		NodeStack.Pop();
+
+		const int32 NewFirstElement = CompactedElements.Num();
+		CompactedElements.Append(GetNodeElements(Node), Node.NumElements);
+		Node.FirstElement = NewFirstElement;
+		Node.ElementCapacity = Node.NumElements;
+
+		if (!Node.IsLeaf())
+		{
+			for (int32 Index = 7; Index >= 0; --Index)
+			{
+				NodeStack.Add(Node.FirstChild + Index);
+			}
+			assert(NodeStack.Num() <= OCTREE_TRAVERSAL_STACK_SIZE);
+		}
+	}
+
+	Elements = std::move(CompactedElements);
+	NumWastedElements = 0;
+}
 
-	// 2) 기존 대상의 프리미티브/자식 정리 후 초기화
-	//    - 프리미티브는 대입으로 교체
-	OutOctree->Primitives = Primitives; // shallow copy of pointers
+void FOctree::Save(FArchive& Ar, const TArray<UPrimitiveComponent*>& InPrimitives) const
+{
+	TMap<UPrimitiveComponent*, int32> PrimitiveIndices(InPrimitives.Num());
+	for (int32 Index = 0; Index < InPrimitives.Num(); ++Index)
+	{
+		PrimitiveIndices.Add(InPrimitives[Index], Index);
+	}
 
-	//    - 기존 자식 노드 메모리 해제
-	for (FOctree* Child : OutOctree->Children)
+	// 해제된 자식 블록의 노드는 빈 구간으로 저장
+	TArray<FSavedOctreeNode> SavedNodes;
+	SavedNodes.SetNum(Nodes.Num());
+	for (int32 Index = 0; Index < Nodes.Num(); ++Index)
 	{
-		SafeDelete(Child);
+		const FOctreeNode& Node = Nodes[Index];
+		FSavedOctreeNode& SavedNode = SavedNodes[Index];
+		SavedNode.BoundsMin = Node.Bounds.Min;
+		SavedNode.BoundsMax = Node.Bounds.Max;
+		SavedNode.Center = Node.Center;
+		SavedNode.HalfSize = Node.HalfSize;
+		SavedNode.FirstChild = Node.FirstChild;
+		SavedNode.ChildMask = Node.ChildMask;
+		SavedNode.FirstElement = 0;
+		SavedNode.NumElements = 0;
+		SavedNode.NumSubtreeElements = Node.NumSubtreeElements;
 	}
-	OutOctree->Children.Empty();
-	OutOctree->Children.SetNum(8, nullptr);
 
-	// 3) 자식 재귀 복사
-	if (!IsLeaf())
+	// 프리미티브는 CompactElementsIfNeeded와 같은 깊이 우선 순서로 버려진 칸 없이 저장
+	TArray<FSavedOctreeElement> SavedElements;
+	SavedElements.Reserve(Nodes[RootIndex].NumSubtreeElements);
+	TArray<int32, TInlineAllocator<OCTREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add(RootIndex);
+	while (!NodeStack.IsEmpty())
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		const int32 NodeIndex = NodeStack.Last();
+		NodeStack.Pop();
+
+		const FOctreeNode& Node = Nodes[NodeIndex];
+		SavedNodes[NodeIndex].FirstElement = SavedElements.Num();
+		SavedNodes[NodeIndex].NumElements = Node.NumElements;
+
+		const FOctreeElement* NodeElements = GetNodeElements(Node);
+		for (int32 Index = 0; Index < Node.NumElements; ++Index)
 		{
-			if (Children[Index] != nullptr)
+			FSavedOctreeElement SavedElement;
+			SavedElement.Min = NodeElements[Index].Min;
+			SavedElement.Max = NodeElements[Index].Max;
+			SavedElement.PrimitiveIndex = PrimitiveIndices.FindRef(NodeElements[Index].Primitive, -1);
+			SavedElements.Add(SavedElement);
+		}
+
+		if (!Node.IsLeaf())
+		{
+			for (int32 Index = 7; Index >= 0; --Index)
 			{
-				// 자식 노드 생성 후 재귀 복사
-				OutOctree->Children[Index] = new FOctree(Children[Index]->BoundingBox, Children[Index]->Depth);
-				Children[Index]->DeepCopy(OutOctree->Children[Index]);
+				NodeStack.Add(Node.FirstChild + Index);
 			}
+			assert(NodeStack.Num() <= OCTREE_TRAVERSAL_STACK_SIZE);
 		}
 	}
+
+	int32 SavedRootIndex = RootIndex;
+	int32 NumNodes = SavedNodes.Num();
+	int32 NumElements = SavedElements.Num();
+	int32 NumFreeChildBlocks = FreeChildBlocks.Num();
+	Ar << SavedRootIndex << NumNodes << NumElements << NumFreeChildBlocks;
+	Ar.Serialize(SavedNodes.GetData(), sizeof(FSavedOctreeNode) * NumNodes);
+	Ar.Serialize(SavedElements.GetData(), sizeof(FSavedOctreeElement) * NumElements);
+	Ar.Serialize(const_cast<int32*>(FreeChildBlocks.GetData()), sizeof(int32) * NumFreeChildBlocks);
 }
 
-void FOctree::QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutResults) const
+bool FOctree::Load(FArchive& Ar, const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>* OutRejected)
 {
-	// Early out: If this node's AABB doesn't intersect the query box, skip it
-	if (!BoundingBox.IsIntersected(QueryBox))
+	int32 SavedRootIndex = 0;
+	int32 NumNodes = 0;
+	int32 NumElements = 0;
+	int32 NumFreeChildBlocks = 0;
+	Ar << SavedRootIndex << NumNodes << NumElements << NumFreeChildBlocks;
+
+	// 깨진 파일의 개수로 큰 배열을 잡지 않도록 프리미티브 수로 상한을 둠 (원소마다 최대 깊이만큼의 자식 블록)
+	const int32 MaxNumNodes = 1 + 8 * (MORTON_BITS + 1) * (InPrimitives.Num() + 1);
+	if (NumNodes <= 0 || NumNodes > MaxNumNodes || SavedRootIndex < 0 || SavedRootIndex >= NumNodes ||
+		NumElements < 0 || NumElements > InPrimitives.Num() || NumFreeChildBlocks < 0 || NumFreeChildBlocks * 8 > NumNodes)
 	{
-		return;
+		return false;
+	}
+
+	TArray<FSavedOctreeNode> SavedNodes;
+	SavedNodes.SetNum(NumNodes);
+	Ar.Serialize(SavedNodes.GetData(), sizeof(FSavedOctreeNode) * NumNodes);
+	TArray<FSavedOctreeElement> SavedElements;
+	SavedElements.SetNum(NumElements);
+	Ar.Serialize(SavedElements.GetData(), sizeof(FSavedOctreeElement) * NumElements);
+	TArray<int32> SavedFreeChildBlocks;
+	SavedFreeChildBlocks.SetNum(NumFreeChildBlocks);
+	Ar.Serialize(SavedFreeChildBlocks.GetData(), sizeof(int32) * NumFreeChildBlocks);
+
+	// 1. 노드 구조가 배열 범위 안에 있는지 확인하며 노드 풀 복원
+	for (int32 FreeChildBlock : SavedFreeChildBlocks)
+	{
+		if (FreeChildBlock <= 0 || FreeChildBlock > NumNodes - 8)
+		{
+			return false;
+		}
+	}
+
+	TArray<FOctreeNode> LoadedNodes;
+	LoadedNodes.SetNum(NumNodes);
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		const FSavedOctreeNode& SavedNode = SavedNodes[Index];
+		if ((SavedNode.FirstChild != -1 && (SavedNode.FirstChild <= 0 || SavedNode.FirstChild > NumNodes - 8)) ||
+			SavedNode.ChildMask > 0xFF || SavedNode.NumSubtreeElements < 0 || SavedNode.NumSubtreeElements > NumElements ||
+			SavedNode.FirstElement < 0 || SavedNode.NumElements < 0 || SavedNode.FirstElement > NumElements - SavedNode.NumElements)
+		{
+			return false;
+		}
+
+		FOctreeNode& Node = LoadedNodes[Index];
+		Node.Bounds = FAABB(SavedNode.BoundsMin, SavedNode.BoundsMax);
+		Node.Center = SavedNode.Center;
+		Node.HalfSize = SavedNode.HalfSize;
+		Node.FirstChild = SavedNode.FirstChild;
+		Node.ChildMask = static_cast<uint8>(SavedNode.ChildMask);
+		Node.FirstElement = SavedNode.FirstElement;
+		Node.NumElements = SavedNode.NumElements;
+		Node.ElementCapacity = SavedNode.NumElements;
+		Node.NumSubtreeElements = SavedNode.NumSubtreeElements;
+	}
+
+	// 2. 루트에서 도달하는 노드가 Save가 남긴 모양의 트리인지 확인
+	// 자식 블록은 해제 후 재사용되므로 자식이 부모보다 뒤에 있다는 보장이 없어, 방문 표시로 순환과 공유 블록을 걸러낸다
+	// 루트가 OCTREE_MAX_ROOT_SIZE 두 배 미만이고 자식이 정확히 절반 크기이며 최소 셀보다 큰 노드만 나뉘었다면
+	// 깊이가 OCTREE_MAX_DEPTH 안에 들어 순회 스택도 넘치지 않는다
+	enum : uint8 { NodeUnused = 0, NodeInTree = 1, NodeInFreeBlock = 2 };
+	TArray<uint8> NodeStates;
+	NodeStates.SetNumZeroed(NumNodes);
+	for (int32 FreeChildBlock : SavedFreeChildBlocks)
+	{
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			if (NodeStates[FreeChildBlock + Index] != NodeUnused)
+			{
+				return false;
+			}
+			NodeStates[FreeChildBlock + Index] = NodeInFreeBlock;
+		}
+	}
+
+	const FOctreeNode& LoadedRoot = LoadedNodes[SavedRootIndex];
+	if (!(LoadedRoot.HalfSize > 0.0f) || LoadedRoot.HalfSize >= OCTREE_MAX_ROOT_SIZE ||
+		LoadedRoot.NumSubtreeElements != NumElements || NodeStates[SavedRootIndex] != NodeUnused)
+	{
+		return false;
+	}
+	NodeStates[SavedRootIndex] = NodeInTree;
+
+	// Save와 같은 순서로 순회하면 각 노드의 프리미티브 구간이 빈틈과 겹침 없이 이어져야 한다
+	int32 NumVisitedElements = 0;
+	TArray<int32, TInlineAllocator<OCTREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add(SavedRootIndex);
+	while (!NodeStack.IsEmpty())
+	{
+		const FOctreeNode& Node = LoadedNodes[NodeStack.Last()];
+		NodeStack.Pop();
+
+		if (Node.FirstElement != NumVisitedElements)
+		{
+			return false;
+		}
+		NumVisitedElements += Node.NumElements;
+
+		if (Node.IsLeaf())
+		{
+			if (Node.ChildMask != 0 || Node.NumSubtreeElements != Node.NumElements)
+			{
+				return false;
+			}
+			continue;
+		}
+
+		if (Node.HalfSize * 2.0f <= OCTREE_MIN_CELL_SIZE)
+		{
+			return false;
+		}
+
+		// ChildMask는 프리미티브가 있는 자식과 정확히 일치해야 함 (쿼리와 제거가 마스크로 자식을 건너뜀)
+		int32 NumChildElements = 0;
+		for (int32 Index = 7; Index >= 0; --Index)
+		{
+			const int32 ChildIndex = Node.FirstChild + Index;
+			const FOctreeNode& Child = LoadedNodes[ChildIndex];
+			if (NodeStates[ChildIndex] != NodeUnused || Child.HalfSize != Node.HalfSize * 0.5f ||
+				Node.HasChild(Index) != (Child.NumSubtreeElements > 0))
+			{
+				return false;
+			}
+
+			NodeStates[ChildIndex] = NodeInTree;
+			NumChildElements += Child.NumSubtreeElements;
+			NodeStack.Add(ChildIndex);
+		}
+		assert(NodeStack.Num() <= OCTREE_TRAVERSAL_STACK_SIZE);
+
+		if (Node.NumSubtreeElements != Node.NumElements + NumChildElements)
+		{
+			return false;
+		}
+	}
+
+	if (NumVisitedElements != NumElements)
+	{
+		return false;
 	}
 
-	// Add all primitives in this node
-	for (UPrimitiveComponent* Prim : Primitives)
+	// 3. 프리미티브를 번호로 다시 연결하고, 저장된 경계가 지금의 경계와 같은지 확인
+	TArray<uint8> bIndexed;
+	bIndexed.SetNumZeroed(InPrimitives.Num());
+	TArray<FOctreeElement> LoadedElements;
+	LoadedElements.SetNum(NumElements);
+	for (int32 Index = 0; Index < NumElements; ++Index)
 	{
-		if (Prim)
+		const FSavedOctreeElement& SavedElement = SavedElements[Index];
+		if (SavedElement.PrimitiveIndex < 0 || SavedElement.PrimitiveIndex >= InPrimitives.Num() || bIndexed[SavedElement.PrimitiveIndex])
 		{
-			OutResults.Add(Prim);
+			return false;
 		}
+
+		UPrimitiveComponent* Primitive = InPrimitives[SavedElement.PrimitiveIndex];
+		if (!Primitive)
+		{
+			return false;
+		}
+
+		const FAABB Bounds = GetPrimitiveBoundingBox(Primitive);
+		if (Bounds.Min != SavedElement.Min || Bounds.Max != SavedElement.Max)
+		{
+			return false;
+		}
+
+		bIndexed[SavedElement.PrimitiveIndex] = 1;
+		LoadedElements[Index] = MakeElement(Primitive, Bounds);
 	}
 
-	// Recursively query children
-	if (!IsLeaf())
+	Nodes = std::move(LoadedNodes);
+	Elements = std::move(LoadedElements);
+	FreeChildBlocks = std::move(SavedFreeChildBlocks);
+	RootIndex = SavedRootIndex;
+	NumWastedElements = 0;
+
+	if (OutRejected)
 	{
-		for (int i = 0; i < 8; ++i)
+		for (int32 Index = 0; Index < InPrimitives.Num(); ++Index)
 		{
-			if (Children[i] != nullptr)
+			if (!bIndexed[Index] && InPrimitives[Index])
 			{
-				Children[i]->QueryAABB(QueryBox, OutResults);
+				OutRejected->Add(InPrimitives[Index]);
 			}
 		}
 	}
+
+	return true;
+}
+
+void FOctree::DeepCopy(FOctree* OutOctree) const
+{
+	if (!OutOctree)
+	{
+		return;
+	}
+
+	// 노드와 프리미티브가 모두 인덱스로 연결되어 있으므로 배열 복사만으로 충분함 (프리미티브는 포인터만 복사)
+	*OutOctree = *this;
 }
@@ -1,52 +1,274 @@
 #pragma once
 
 #include "Physics/Public/AABB.h"
+#include "Runtime/Core/Public/Memory/MemStack.h"
 
 class UPrimitiveComponent;
+struct FArchive;
 
 constexpr int MAX_PRIMITIVES = 16;
-constexpr int MAX_DEPTH = 9;  // Increased from 5 to support larger world (1000 units with similar precision)      
+/** @brief 노드의 느슨한 경계는 셀 크기의 LOOSENESS배 (2이면 셀보다 작은 객체는 중심이 속한 자식에 항상 들어간다) */
+constexpr float OCTREE_LOOSENESS = 2.0f;
+/** @brief 더 나누지 않는 최소 셀 크기 (1000 크기 루트를 9단계 나눈 것과 같은 정밀도) */
+constexpr float OCTREE_MIN_CELL_SIZE = 1000.0f / 512.0f;
+/** @brief 루트가 커질 수 있는 최대 셀 크기 (이를 넘는 객체나 NaN 경계는 삽입 실패) */
+constexpr float OCTREE_MAX_ROOT_SIZE = 1048576.0f;
 
+/**
+ * @brief 노드의 최대 깊이 (루트는 OCTREE_MAX_ROOT_SIZE보다 작을 때만 두 배로 커지므로 그 두 배 미만)
+ * 셀이 OCTREE_MIN_CELL_SIZE보다 클 때만 나뉘므로 그런 셀의 수만큼 아래로 내려갈 수 있다
+ */
+constexpr int32 GetOctreeMaxDepth()
+{
+	int32 Depth = 0;
+	for (float CellSize = OCTREE_MAX_ROOT_SIZE * 2.0f; CellSize > OCTREE_MIN_CELL_SIZE; CellSize *= 0.5f)
+	{
+		++Depth;
+	}
+	return Depth;
+}
+constexpr int32 OCTREE_MAX_DEPTH = GetOctreeMaxDepth();
+/** @brief 깊이 우선 순회 스택의 최대 크기 (노드 하나를 꺼내고 자식을 최대 8개 넣으므로 깊이마다 7칸씩 늘어남) */
+constexpr int32 OCTREE_TRAVERSAL_STACK_SIZE = 1 + 7 * OCTREE_MAX_DEPTH;
+
+/**
+ * @brief Octree에 저장된 프리미티브와 삽입 시점의 월드 AABB
+ * 쿼리는 컴포넌트를 역참조하지 않고 이 경계만으로 걸러낸다
+ */
+struct FOctreeElement
+{
+	FVector Min;
+	FVector Max;
+	UPrimitiveComponent* Primitive = nullptr;
+};
+
+/**
+ * @brief Octree 노드 (노드 풀의 인덱스로 연결)
+ */
+struct FOctreeNode
+{
+	/** @brief 느슨한 경계 (이 노드와 하위 노드의 모든 프리미티브를 감쌈) */
+	FAABB Bounds;
+	FVector Center;
+	float HalfSize = 0.0f;
+	/** @brief 자식 8개가 연속으로 놓인 첫 노드 인덱스, 리프면 -1 */
+	int32 FirstChild = -1;
+	/** @brief 하위에 프리미티브가 있는 자식 비트 (자식 번호는 X, Y, Z 각 축이 중심 이상이면 1, 2, 4 비트) */
+	uint8 ChildMask = 0;
+	/** @brief 이 노드의 프리미티브가 Elements에서 차지하는 구간 */
+	int32 FirstElement = 0;
+	int32 NumElements = 0;
+	int32 ElementCapacity = 0;
+	/** @brief 이 노드와 하위 노드의 프리미티브 수 */
+	int32 NumSubtreeElements = 0;
+
+	bool IsLeaf() const { return FirstChild < 0; }
+	bool HasChild(int32 InChildIndex) const { return (ChildMask >> InChildIndex) & 1; }
+};
+
+/**
+ * @brief 느슨한(Loose) 선형 Octree
+ *
+ * 각 노드는 셀(Center, HalfSize)과 셀을 OCTREE_LOOSENESS배로 넓힌 느슨한 경계를 가진다
+ * 객체는 중심이 속한 자식의 느슨한 경계에 들어가면 아래로 내려가므로 자식 경계에 걸친 작은 객체가 상위 노드에 쌓이지 않는다
+ * 루트를 벗어나는 객체가 들어오면 루트가 그 방향으로 두 배씩 커지므로 월드 크기 제한 없이 모든 프리미티브가 트리 안에 있다
+ *
+ * 노드는 포인터 없이 하나의 노드 풀(Nodes)에 놓이며, 자식 8개는 연속된 블록으로 할당되어 FirstChild와 ChildMask로 찾는다
+ * 프리미티브는 하나의 배열(Elements)에 노드별 구간으로 저장되고, 구간이 가득 차면 배열 끝으로 옮긴 뒤
+ * 버려진 칸이 많아지면 깊이 우선 순서로 다시 채운다
+ * Build는 프리미티브를 Morton 코드로 정렬해 트리를 한 번에 만들며, 하위 트리의 프리미티브가 연속으로 놓인다
+ */
 class FOctree
 {
 public:
 	FOctree();
-	FOctree(const FVector& InPosition, float InSize, int InDepth);
-	FOctree(const FAABB& InBoundingBox, int InDepth);
-	~FOctree();
+	FOctree(const FVector& InCenter, float InSize);
 
+	/** @brief 객체가 루트를 벗어나면 루트를 키운 뒤 삽입 */
 	bool Insert(UPrimitiveComponent* InPrimitive);
+	/** @brief 이미 계산된 월드 AABB로 삽입 */
+	bool Insert(UPrimitiveComponent* InPrimitive, const FAABB& InBounds);
 	bool Remove(UPrimitiveComponent* InPrimitive);
+	/**
+	 * @brief InPrimitives에 든 프리미티브를 트리를 한 번만 순회하며 모두 제거
+	 * 하나씩 Remove하면 찾을 때마다 트리 전체를 탐색하므로 여러 개를 한꺼번에 옮길 때 사용
+	 * @param OutRemoved 트리에 있어서 실제로 제거된 프리미티브
+	 */
+	void RemovePrimitives(const TSet<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>& OutRemoved);
+
+	/**
+	 * @brief 기존 내용을 버리고 InPrimitives로 트리를 한 번에 구축
+	 * 중심의 Morton 코드로 정렬한 뒤 위에서부터 구간을 8개로 나누므로 하나씩 Insert하는 것보다 빠르고 메모리가 연속적이다
+	 * @param OutRejected 경계가 NaN이거나 최대 크기를 넘어 넣지 못한 프리미티브 (nullptr이면 무시)
+	 */
+	void Build(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>* OutRejected = nullptr);
+	/** @brief 이미 계산된 월드 AABB로 구축 */
+	void Build(const TArray<FOctreeElement>& InElements, TArray<UPrimitiveComponent*>* OutRejected = nullptr);
+
+	/**
+	 * @brief 노드 풀과 프리미티브 배열을 그대로 저장
+	 * 프리미티브는 포인터 대신 InPrimitives에서의 번호로 저장하므로 불러올 때 같은 순서의 배열이 필요하다
+	 */
+	void Save(FArchive& Ar, const TArray<UPrimitiveComponent*>& InPrimitives) const;
+	/**
+	 * @brief Save한 노드 풀과 프리미티브 배열을 읽어 삽입이나 정렬 없이 그대로 연결
+	 * 저장된 경계가 프리미티브의 현재 경계와 하나라도 다르거나 (메시 에셋이 바뀐 경우 등) 구조가 맞지 않으면 트리를 바꾸지 않고 false
+	 * @param OutRejected 저장 당시 트리에 없던 InPrimitives의 프리미티브 (Build의 OutRejected와 같음, nullptr이면 무시)
+	 */
+	bool Load(FArchive& Ar, const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>* OutRejected = nullptr);
+
+	/** @brief 모든 프리미티브와 노드를 비움 (루트 셀은 유지) */
 	void Clear();
 
 	void DeepCopy(FOctree* OutOctree) const;
 
-	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
-	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount);
+	template<typename AllocatorType>
+	void GetAllPrimitives(TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const;
+	/** @brief InNodeIndex 노드와 하위 노드의 모든 프리미티브 */
+	template<typename AllocatorType>
+	void GetSubtreePrimitives(int32 InNodeIndex, TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const;
+	void FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount, TArray<UPrimitiveComponent*>& OutCandidates);
+
+	/**
+	 * @brief 경계가 QueryBox와 겹치는 프리미티브를 모두 수집
+	 * 노드와 프리미티브 모두 저장된 AABB로 걸러내므로 결과는 AABB가 실제로 겹치는 프리미티브뿐이다
+	 * 할당자와 무관하게 받으므로 TInlineAllocator 임시 배열에도 바로 모을 수 있다
+	 */
+	template<typename AllocatorType>
+	void QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*, AllocatorType>& OutResults) const;
 
-	// Query all primitives overlapping the given AABB (for collision queries)
-	void QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*>& OutResults) const;
+	/** @brief 루트의 느슨한 경계 */
+	const FAABB& GetBoundingBox() const { return Nodes[RootIndex].Bounds; }
+	const FVector& GetCenter() const { return Nodes[RootIndex].Center; }
+	float GetSize() const { return Nodes[RootIndex].HalfSize * 2.0f; }
+	int32 GetNumPrimitives() const { return Nodes[RootIndex].NumSubtreeElements; }
 
-	const FAABB& GetBoundingBox() const { return BoundingBox; }
-	void SetBoundingBox(const FAABB& InAABB) { BoundingBox = InAABB; }
-	bool IsLeafNode() const { return IsLeaf(); }
-	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
-	TArray<FOctree*>& GetChildren() { return Children; }
-	const TArray<FOctree*>& GetChildren() const { return Children; } 
+	int32 GetRootIndex() const { return RootIndex; }
+	int32 GetNodeCount() const { return Nodes.Num(); }
+	const FOctreeNode& GetNode(int32 InIndex) const { return Nodes[InIndex]; }
+	/** @brief InNode의 프리미티브 구간 시작 (InNode.NumElements개) */
+	const FOctreeElement* GetNodeElements(const FOctreeNode& InNode) const { return Elements.GetData() + InNode.FirstElement; }
 
 private:
-	bool IsLeaf() const { return Children[0] == nullptr; }
-	void Subdivide(UPrimitiveComponent* InPrimitive);
-	void TryMerge();
-
-	FAABB BoundingBox;
-	int Depth;                       
-	TArray<UPrimitiveComponent*> Primitives;
-	TArray<FOctree*> Children;
+	void InitNode(int32 InNodeIndex, const FVector& InCenter, float InHalfSize);
+	static bool IsInCell(const FOctreeNode& InNode, const FVector& InPosition);
+	/** @brief 위치가 속한 자식 번호 (X, Y, Z 각 축이 중심 이상이면 1, 2, 4 비트) */
+	static int32 GetChildIndex(const FOctreeNode& InNode, const FVector& InPosition);
+
+	/** @brief 자식 8개 블록을 할당하고 InNodeIndex 셀의 8분할로 초기화 */
+	int32 AllocateChildren(int32 InNodeIndex);
+	void FreeChildren(int32 InNodeIndex);
+
+	/** @brief InTarget 쪽으로 루트 셀을 두 배로 키우고, 기존 내용은 새 자식 하나로 옮김 */
+	void Grow(const FVector& InTarget);
+	/** @brief InStartNodeIndex부터 내려가며 삽입 (시작 노드의 개수도 함께 늘림) */
+	void InsertFromNode(int32 InStartNodeIndex, const FOctreeElement& InElement);
+	void Subdivide(int32 InNodeIndex);
+	void TryMerge(int32 InNodeIndex);
+
+	void AddElement(int32 InNodeIndex, const FOctreeElement& InElement);
+	/** @brief 노드 구간에서 InLocalIndex번째 프리미티브를 빼고 마지막 프리미티브로 채움 */
+	void RemoveElementAt(int32 InNodeIndex, int32 InLocalIndex);
+	/** @brief 버려진 칸이 많으면 노드 구간을 깊이 우선 순서로 다시 채움 */
+	void CompactElementsIfNeeded();
+
+	bool RemoveRecursive(int32 InNodeIndex, UPrimitiveComponent* InPrimitive);
+	/** @return 이 노드와 하위 노드에서 제거된 프리미티브 수 */
+	int32 RemovePrimitivesRecursive(int32 InNodeIndex, const TSet<UPrimitiveComponent*>& InPrimitives,
+		TArray<UPrimitiveComponent*>& OutRemoved, int32& InOutNumRemaining);
+
+	struct FBuildItem;
+	void BuildNode(int32 InNodeIndex, FBuildItem* InItems, int32 InNumItems, int32 InDepth);
+
+	TArray<FOctreeNode> Nodes;
+	int32 RootIndex = 0;
+	/** @brief 해제된 자식 블록의 첫 인덱스 */
+	TArray<int32> FreeChildBlocks;
+
+	TArray<FOctreeElement> Elements;
+	/** @brief 구간이 옮겨지며 버려진 Elements 칸 수 */
+	int32 NumWastedElements = 0;
 };
 
+template<typename AllocatorType>
+void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const
+{
+	GetSubtreePrimitives(RootIndex, OutPrimitives);
+}
+
+template<typename AllocatorType>
+void FOctree::GetSubtreePrimitives(int32 InNodeIndex, TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives) const
+{
+	TArray<int32, TInlineAllocator<OCTREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add(InNodeIndex);
+
+	while (!NodeStack.IsEmpty())
+	{
+		const FOctreeNode& Node = Nodes[NodeStack.Last()];
+		NodeStack.Pop();
+
+		// 1. 현재 노드가 가진 프리미티브를 결과 배열에 추가합니다.
+		const FOctreeElement* NodeElements = GetNodeElements(Node);
+		for (int32 Index = 0; Index < Node.NumElements; ++Index)
+		{
+			OutPrimitives.Add(NodeElements[Index].Primitive);
+		}
+
+		// 2. 프리미티브가 있는 자식 노드만 탐색합니다.
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			if (Node.HasChild(Index))
+			{
+				NodeStack.Add(Node.FirstChild + Index);
+			}
+		}
+		assert(NodeStack.Num() <= OCTREE_TRAVERSAL_STACK_SIZE);
+	}
+}
+
+template<typename AllocatorType>
+void FOctree::QueryAABB(const FAABB& QueryBox, TArray<UPrimitiveComponent*, AllocatorType>& OutResults) const
+{
+	TArray<int32, TInlineAllocator<OCTREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add(RootIndex);
+
+	while (!NodeStack.IsEmpty())
+	{
+		const FOctreeNode& Node = Nodes[NodeStack.Last()];
+		NodeStack.Pop();
+
+		// Early out: If this node's AABB doesn't intersect the query box, skip it
+		if (Node.NumSubtreeElements == 0 || !Node.Bounds.IsIntersected(QueryBox))
+		{
+			continue;
+		}
+
+		const FOctreeElement* NodeElements = GetNodeElements(Node);
+		for (int32 Index = 0; Index < Node.NumElements; ++Index)
+		{
+			const FOctreeElement& Element = NodeElements[Index];
+			if (Element.Min.X <= QueryBox.Max.X && Element.Max.X >= QueryBox.Min.X &&
+				Element.Min.Y <= QueryBox.Max.Y && Element.Max.Y >= QueryBox.Min.Y &&
+				Element.Min.Z <= QueryBox.Max.Z && Element.Max.Z >= QueryBox.Min.Z)
+			{
+				OutResults.Add(Element.Primitive);
+			}
+		}
+
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			if (Node.HasChild(Index))
+			{
+				NodeStack.Add(Node.FirstChild + Index);
+			}
+		}
+		assert(NodeStack.Num() <= OCTREE_TRAVERSAL_STACK_SIZE);
+	}
+}
+
+// 탐색 중에만 쓰이는 큐이므로 프레임 메모리 스택에서 할당
 using FNodeQueue = std::priority_queue<
-	std::pair<float, FOctree*>,
-	std::vector<std::pair<float, FOctree*>>,
-	std::greater<std::pair<float, FOctree*>>
+	std::pair<float, int32>,
+	std::vector<std::pair<float, int32>, TMemStackAllocator<std::pair<float, int32>>>,
+	std::greater<std::pair<float, int32>>
 >;
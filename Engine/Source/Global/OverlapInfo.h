@@ -59,3 +59,64 @@ namespace std
 		}
 	};
 }
+
+/**
+ * TMap / TSet hash for FOverlapInfo
+ * Hashes the raw component address directly instead of going through std::hash<T*>
+ */
+template<>
+struct TFlatHash<FOverlapInfo>
+{
+	size_t operator()(const FOverlapInfo& Info) const noexcept
+	{
+		return TFlatHash<UPrimitiveComponent*>{}(Info.OverlapComponent.Get());
+	}
+};
+
+/**
+ * Unordered pair of overlapping components (key of ULevel's overlap pair cache)
+ * A always holds the lower address so (X, Y) and (Y, X) are the same pair
+ */
+struct FOverlapPair
+{
+	UPrimitiveComponent* A = nullptr;
+	UPrimitiveComponent* B = nullptr;
+
+	FOverlapPair() = default;
+
+	FOverlapPair(UPrimitiveComponent* InFirst, UPrimitiveComponent* InSecond)
+		: A(InFirst < InSecond ? InFirst : InSecond)
+		, B(InFirst < InSecond ? InSecond : InFirst)
+	{
+	}
+
+	bool Contains(const UPrimitiveComponent* InComponent) const
+	{
+		return A == InComponent || B == InComponent;
+	}
+
+	bool operator==(const FOverlapPair& Other) const
+	{
+		return A == Other.A && B == Other.B;
+	}
+
+	bool operator!=(const FOverlapPair& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+/**
+ * TMap / TSet hash for FOverlapPair
+ * Folds both addresses into one integer; FHashControl::Mix spreads the bits
+ */
+template<>
+struct TFlatHash<FOverlapPair>
+{
+	size_t operator()(const FOverlapPair& Pair) const noexcept
+	{
+		const size_t HashA = TFlatHash<UPrimitiveComponent*>{}(Pair.A);
+		const size_t HashB = TFlatHash<UPrimitiveComponent*>{}(Pair.B);
+		return HashA ^ (HashB * 0x9E3779B97F4A7C15ull) ^ (HashB >> 29);
+	}
+};
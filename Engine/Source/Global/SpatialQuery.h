@@ -0,0 +1,379 @@
+#pragma once
+
+#include "Global/DynamicAABBTree.h"
+#include "Global/Octree.h"
+
+/**
+ * @brief 경계 상자와 쿼리 모양의 관계
+ * Inside면 그 노드 아래의 모든 프리미티브가 모양 안에 있으므로 하위 검사를 생략한다
+ */
+enum class EBoundCheckResult
+{
+	Outside,
+	Intersect,
+	Inside
+};
+
+/*-----------------------------------------------------------------------------
+	Query Shapes
+	모든 모양은 EBoundCheckResult CheckIntersection(const FAABB&) const 하나로 노드와 프리미티브 경계를 판정한다
+-----------------------------------------------------------------------------*/
+
+struct FFrustum
+{
+    FVector4 Planes[6];
+
+    EBoundCheckResult CheckIntersection(const FAABB& BBox) const
+    {
+        EBoundCheckResult Result = EBoundCheckResult::Inside;
+
+        for (int i = 0; i < 6; ++i)
+        {
+            const FVector4& P = Planes[i];
+
+            // positive vertex: 법선 방향으로 가장 먼 꼭짓점
+            FVector PositiveVertex(
+                (P.X >= 0) ? BBox.Max.X : BBox.Min.X,
+                (P.Y >= 0) ? BBox.Max.Y : BBox.Min.Y,
+                (P.Z >= 0) ? BBox.Max.Z : BBox.Min.Z
+            );
+
+            if (P.Dot3(PositiveVertex) + P.W > 0)
+            {
+                // 박스가 평면 바깥(+측)으로 완전히 나감
+                return EBoundCheckResult::Outside;
+            }
+
+            // negative vertex: 반대쪽 꼭짓점
+            FVector NegativeVertex(
+                (P.X >= 0) ? BBox.Min.X : BBox.Max.X,
+                (P.Y >= 0) ? BBox.Min.Y : BBox.Max.Y,
+                (P.Z >= 0) ? BBox.Min.Z : BBox.Max.Z
+            );
+
+            if (P.Dot3(NegativeVertex) + P.W < 0)
+            {
+                // 박스가 평면 안쪽(-측)으로 완전히 들어옴 → 계속 검사
+                continue;
+            }
+
+            // 완전 안쪽도 아니고 완전 바깥도 아니면 교차
+            Result = EBoundCheckResult::Intersect;
+        }
+
+        return Result;
+
+    }
+
+    void Clear() { for (int i = 0; i < 6; ++i) { Planes[i] = FVector4::Zero(); }; }
+};
+
+/** @brief 축 정렬 상자 (Overlap 검사 등) */
+struct FQueryBox
+{
+	FAABB Box;
+
+	explicit FQueryBox(const FAABB& InBox) : Box(InBox) {}
+
+	EBoundCheckResult CheckIntersection(const FAABB& InBounds) const
+	{
+		if (!Box.IsIntersected(InBounds)) { return EBoundCheckResult::Outside; }
+		return Box.IsContains(InBounds) ? EBoundCheckResult::Inside : EBoundCheckResult::Intersect;
+	}
+};
+
+/** @brief 구 (폭발 범위, 점광원 영향 범위 등) */
+struct FQuerySphere
+{
+	FVector Center;
+	float Radius;
+
+	FQuerySphere(const FVector& InCenter, float InRadius) : Center(InCenter), Radius(InRadius) {}
+
+	EBoundCheckResult CheckIntersection(const FAABB& InBounds) const
+	{
+		// 상자에서 중심까지 가장 가까운 점이 반지름 밖이면 겹치지 않음
+		const FVector Closest(std::clamp(Center.X, InBounds.Min.X, InBounds.Max.X),
+			std::clamp(Center.Y, InBounds.Min.Y, InBounds.Max.Y), std::clamp(Center.Z, InBounds.Min.Z, InBounds.Max.Z));
+		const float RadiusSquared = Radius * Radius;
+		if ((Closest - Center).LengthSquared() > RadiusSquared) { return EBoundCheckResult::Outside; }
+
+		// 가장 먼 꼭짓점까지 반지름 안이면 상자 전체가 구 안에 있음
+		const FVector Farthest(std::max(fabsf(Center.X - InBounds.Min.X), fabsf(Center.X - InBounds.Max.X)),
+			std::max(fabsf(Center.Y - InBounds.Min.Y), fabsf(Center.Y - InBounds.Max.Y)),
+			std::max(fabsf(Center.Z - InBounds.Min.Z), fabsf(Center.Z - InBounds.Max.Z)));
+		return Farthest.LengthSquared() <= RadiusSquared ? EBoundCheckResult::Inside : EBoundCheckResult::Intersect;
+	}
+};
+
+/**
+ * @brief 반직선 또는 선분 (MaxDistance까지)
+ * 방향의 역수를 미리 구해 두고 슬랩 방식으로 검사하며, 선은 부피가 없으므로 Inside는 나오지 않는다
+ */
+struct FQueryRay
+{
+	FVector Origin;
+	FVector Direction;
+	FVector InvDirection;
+	float MaxDistance;
+
+	FQueryRay(const FVector& InOrigin, const FVector& InDirection, float InMaxDistance = FLT_MAX)
+		: Origin(InOrigin), Direction(InDirection), MaxDistance(InMaxDistance)
+	{
+		// 0인 축은 무한대가 되어 그 축의 슬랩은 원점이 안에 있을 때만 통과한다
+		InvDirection = FVector(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+	}
+
+	explicit FQueryRay(const FRay& InRay, float InMaxDistance = FLT_MAX)
+		: FQueryRay(FVector(InRay.Origin.X, InRay.Origin.Y, InRay.Origin.Z),
+			FVector(InRay.Direction.X, InRay.Direction.Y, InRay.Direction.Z), InMaxDistance)
+	{
+	}
+
+	/** @brief 상자에 들어가는 거리 (원점이 상자 안이면 0), MaxDistance 안에서 만나지 않으면 false */
+	bool GetEntryDistance(const FAABB& InBounds, float& OutDistance) const
+	{
+		float TMin = 0.0f;
+		float TMax = MaxDistance;
+
+		const float* RayOrigin = &Origin.X;
+		const float* RayInvDirection = &InvDirection.X;
+		const float* BoundsMin = &InBounds.Min.X;
+		const float* BoundsMax = &InBounds.Max.X;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			float T0 = (BoundsMin[Axis] - RayOrigin[Axis]) * RayInvDirection[Axis];
+			float T1 = (BoundsMax[Axis] - RayOrigin[Axis]) * RayInvDirection[Axis];
+			if (T0 > T1) { std::swap(T0, T1); }
+
+			// NaN(원점이 슬랩 경계 위에 있고 방향이 0)은 비교가 실패해 범위를 좁히지 않음
+			TMin = T0 > TMin ? T0 : TMin;
+			TMax = T1 < TMax ? T1 : TMax;
+			if (TMin > TMax) { return false; }
+		}
+
+		OutDistance = TMin;
+		return true;
+	}
+
+	EBoundCheckResult CheckIntersection(const FAABB& InBounds) const
+	{
+		float EntryDistance;
+		return GetEntryDistance(InBounds, EntryDistance) ? EBoundCheckResult::Intersect : EBoundCheckResult::Outside;
+	}
+};
+
+/**
+ * @brief 선분 묶음 (ULevel::LineTraceBatch)
+ * 노드 하나를 묶음 전체와 한 번에 판정하므로 선분마다 트리를 다시 타지 않는다
+ * 모든 선분을 감싸는 상자로 먼저 거르고, 선분 하나라도 경계를 지나면 교차로 본다
+ */
+struct FQueryRayPacket
+{
+	const FQueryRay* Rays;
+	int32 NumRays;
+	FAABB Bounds;
+
+	FQueryRayPacket(const FQueryRay* InRays, int32 InNumRays)
+		: Rays(InRays), NumRays(InNumRays), Bounds(FVector(FLT_MAX, FLT_MAX, FLT_MAX), FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX))
+	{
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			const FQueryRay& Ray = Rays[Index];
+			const FVector End = Ray.Origin + Ray.Direction * Ray.MaxDistance;
+			Bounds.Min = FVector(std::min({ Bounds.Min.X, Ray.Origin.X, End.X }), std::min({ Bounds.Min.Y, Ray.Origin.Y, End.Y }),
+				std::min({ Bounds.Min.Z, Ray.Origin.Z, End.Z }));
+			Bounds.Max = FVector(std::max({ Bounds.Max.X, Ray.Origin.X, End.X }), std::max({ Bounds.Max.Y, Ray.Origin.Y, End.Y }),
+				std::max({ Bounds.Max.Z, Ray.Origin.Z, End.Z }));
+		}
+	}
+
+	EBoundCheckResult CheckIntersection(const FAABB& InBounds) const
+	{
+		if (!Bounds.IsIntersected(InBounds)) { return EBoundCheckResult::Outside; }
+
+		float EntryDistance;
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			if (Rays[Index].GetEntryDistance(InBounds, EntryDistance))
+			{
+				return EBoundCheckResult::Intersect;
+			}
+		}
+		return EBoundCheckResult::Outside;
+	}
+};
+
+/**
+ * @brief 원뿔 (스포트라이트 영향 범위)
+ * 상자를 외접 구로 근사해 검사하므로 보수적이며 (겹치지 않는 상자를 통과시킬 수는 있어도 놓치지는 않음) Inside는 나오지 않는다
+ */
+struct FQueryCone
+{
+	FVector Apex;
+	/** @brief 단위 벡터 */
+	FVector Direction;
+	float Length;
+	float CosHalfAngle;
+	float SinHalfAngle;
+
+	FQueryCone(const FVector& InApex, const FVector& InDirection, float InLength, float InHalfAngleRadians)
+		: Apex(InApex), Direction(InDirection.GetNormalized()), Length(InLength),
+		CosHalfAngle(cosf(InHalfAngleRadians)), SinHalfAngle(sinf(InHalfAngleRadians))
+	{
+	}
+
+	EBoundCheckResult CheckIntersection(const FAABB& InBounds) const
+	{
+		const FVector Center = InBounds.GetCenter();
+		const float Radius = (InBounds.Max - Center).Length();
+
+		const FVector ToCenter = Center - Apex;
+		const float AxisDistance = ToCenter.Dot(Direction);
+		if (AxisDistance > Length + Radius || AxisDistance < -Radius)
+		{
+			return EBoundCheckResult::Outside;
+		}
+
+		// 축에서 떨어진 거리로 구한 원뿔 옆면까지의 거리
+		const float RadialDistance = sqrtf(std::max(ToCenter.LengthSquared() - AxisDistance * AxisDistance, 0.0f));
+		const float SideDistance = CosHalfAngle * RadialDistance - SinHalfAngle * AxisDistance;
+		return SideDistance > Radius ? EBoundCheckResult::Outside : EBoundCheckResult::Intersect;
+	}
+};
+
+/*-----------------------------------------------------------------------------
+	Traversal
+-----------------------------------------------------------------------------*/
+
+/**
+ * @brief 정적 Octree와 동적 AABB 트리를 같은 방식으로 순회하는 공간 쿼리
+ *
+ * 모양과 겹치는 프리미티브마다 bool InVisitor(UPrimitiveComponent*)를 부르고, false를 반환하면 그 자리에서 멈춘다
+ * 노드가 모양 안에 완전히 포함되면 하위 노드와 프리미티브는 검사 없이 방문한다
+ * 탐색 스택은 인라인 저장소를 쓰므로 힙 할당이 없다
+ *
+ * @note 보통은 두 인덱스를 함께 순회하는 ULevel::QueryPrimitives / GatherPrimitives를 사용할 것
+ */
+struct FSpatialQuery
+{
+	/** @return 끝까지 순회했으면 true, 방문자가 멈췄으면 false */
+	template<typename ShapeType, typename VisitorType>
+	static bool QueryOctree(const FOctree& InOctree, const ShapeType& InShape, VisitorType& InVisitor);
+
+	/** @return 끝까지 순회했으면 true, 방문자가 멈췄으면 false */
+	template<typename ShapeType, typename VisitorType>
+	static bool QueryDynamicTree(const FDynamicAABBTree& InTree, const ShapeType& InShape, VisitorType& InVisitor);
+
+private:
+	struct FStackEntry
+	{
+		int32 NodeIndex;
+		/** @brief 조상 노드가 모양 안에 완전히 포함되어 검사를 생략하는지 */
+		bool bInside;
+	};
+};
+
+template<typename ShapeType, typename VisitorType>
+bool FSpatialQuery::QueryOctree(const FOctree& InOctree, const ShapeType& InShape, VisitorType& InVisitor)
+{
+	TArray<FStackEntry, TInlineAllocator<OCTREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add({ InOctree.GetRootIndex(), false });
+
+	while (!NodeStack.IsEmpty())
+	{
+		const FStackEntry Entry = NodeStack.Last();
+		NodeStack.Pop();
+
+		const FOctreeNode& Node = InOctree.GetNode(Entry.NodeIndex);
+		if (Node.NumSubtreeElements == 0)
+		{
+			continue;
+		}
+
+		bool bInside = Entry.bInside;
+		if (!bInside)
+		{
+			const EBoundCheckResult Result = InShape.CheckIntersection(Node.Bounds);
+			if (Result == EBoundCheckResult::Outside)
+			{
+				continue;
+			}
+			bInside = Result == EBoundCheckResult::Inside;
+		}
+
+		// 노드가 겹치기만 하면 저장된 프리미티브 경계로 하나씩 검사
+		const FOctreeElement* NodeElements = InOctree.GetNodeElements(Node);
+		for (int32 Index = 0; Index < Node.NumElements; ++Index)
+		{
+			const FOctreeElement& Element = NodeElements[Index];
+			if (bInside || InShape.CheckIntersection(FAABB(Element.Min, Element.Max)) != EBoundCheckResult::Outside)
+			{
+				if (!InVisitor(Element.Primitive))
+				{
+					return false;
+				}
+			}
+		}
+
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			if (Node.HasChild(Index))
+			{
+				NodeStack.Add({ Node.FirstChild + Index, bInside });
+			}
+		}
+		assert(NodeStack.Num() <= OCTREE_TRAVERSAL_STACK_SIZE);
+	}
+
+	return true;
+}
+
+template<typename ShapeType, typename VisitorType>
+bool FSpatialQuery::QueryDynamicTree(const FDynamicAABBTree& InTree, const ShapeType& InShape, VisitorType& InVisitor)
+{
+	if (InTree.GetRootIndex() < 0)
+	{
+		return true;
+	}
+
+	assert(InTree.GetHeight() < DYNAMIC_TREE_TRAVERSAL_STACK_SIZE);
+	TArray<FStackEntry, TInlineAllocator<DYNAMIC_TREE_TRAVERSAL_STACK_SIZE>> NodeStack;
+	NodeStack.Add({ InTree.GetRootIndex(), false });
+
+	while (!NodeStack.IsEmpty())
+	{
+		const FStackEntry Entry = NodeStack.Last();
+		NodeStack.Pop();
+
+		const FDynamicTreeNode& Node = InTree.GetNode(Entry.NodeIndex);
+
+		bool bInside = Entry.bInside;
+		if (!bInside)
+		{
+			// 리프는 실제 경계로, 내부 노드는 뚱뚱한 경계의 합으로 검사
+			const EBoundCheckResult Result = Node.IsLeaf()
+				? InShape.CheckIntersection(FAABB(Node.TightMin, Node.TightMax))
+				: InShape.CheckIntersection(Node.Bounds);
+			if (Result == EBoundCheckResult::Outside)
+			{
+				continue;
+			}
+			bInside = Result == EBoundCheckResult::Inside;
+		}
+
+		if (Node.IsLeaf())
+		{
+			if (!InVisitor(Node.Primitive))
+			{
+				return false;
+			}
+			continue;
+		}
+
+		NodeStack.Add({ Node.Child1, bInside });
+		NodeStack.Add({ Node.Child2, bInside });
+	}
+
+	return true;
+}
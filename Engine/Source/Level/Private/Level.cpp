@@ -7,22 +7,141 @@
 #include "Component/Public/AmbientLightComponent.h"
 #include "Component/Public/SpotLightComponent.h"
 #include "Core/Public/Object.h"
+#include "Core/Public/WindowsBinReader.h"
+#include "Core/Public/WindowsBinWriter.h"
 #include "Editor/Public/Editor.h"
+#include "Global/DynamicAABBTree.h"
 #include "Global/Octree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Manager/UI/Public/ViewportManager.h"
+#include "Physics/Public/CollisionHelper.h"
+#include "Physics/Public/HitResult.h"
+#include "Runtime/Core/Public/Memory/MemStack.h"
 #include <json.hpp>
 
 IMPLEMENT_CLASS(ULevel, UObject)
 
+namespace
+{
+	/** @brief 라인 트레이스 후보 (경계 상자에 들어가는 거리 순으로 정렬해 가까운 프리미티브부터 판정) */
+	struct FLineTraceCandidate
+	{
+		UPrimitiveComponent* Primitive;
+		float EntryDistance;
+	};
+
+	/** @brief LineTraceBatch가 한 번에 순회하는 선분 수 (후보마다 선분을 64비트 마스크의 한 비트로 추적) */
+	constexpr int32 LINE_TRACE_PACKET_SIZE = 64;
+
+	/** @brief LineTraceBatch 정렬 키 (방향 팔분면 3비트 + 중점의 축당 9비트 Morton 코드) */
+	struct FSortedLineTrace
+	{
+		uint32 Key;
+		int32 SegmentIndex;
+	};
+
+	/** @brief 9비트 값을 3비트 간격으로 펼침 */
+	uint32 ExpandLineTraceMortonBits(uint32 InValue)
+	{
+		uint32 Bits = InValue & 0x1ff;
+		Bits = (Bits | Bits << 16) & 0x030000ff;
+		Bits = (Bits | Bits << 8) & 0x0300f00f;
+		Bits = (Bits | Bits << 4) & 0x030c30c3;
+		Bits = (Bits | Bits << 2) & 0x09249249;
+		return Bits;
+	}
+
+	/** @brief 묶음의 후보 프리미티브 (월드 경계와 그 경계를 지나는 선분 마스크) */
+	struct FLineTracePacketCandidate
+	{
+		UPrimitiveComponent* Primitive;
+		FAABB Bounds;
+		uint64 RayMask;
+		float EntryDistance;
+	};
+
+	/** @brief 라인 트레이스에서 제외할 프리미티브 (무시할 액터, UUID 텍스트 / 아이콘 같은 에디터 시각화 전용 쿼드) */
+	bool ShouldSkipLineTrace(const UPrimitiveComponent* InPrimitive, const AActor* InIgnoredActor)
+	{
+		if (InIgnoredActor && InPrimitive->GetOwner() == InIgnoredActor)
+		{
+			return true;
+		}
+		return InPrimitive->IsEditorOnly() || InPrimitive->IsVisualizationComponent();
+	}
+
+	template<typename AllocatorType>
+	void GatherLineTraceCandidates(ULevel& InLevel, const FQueryRay& InRay, const AActor* InIgnoredActor,
+		TArray<FLineTraceCandidate, AllocatorType>& OutCandidates)
+	{
+		InLevel.QueryPrimitives(InRay, [&](UPrimitiveComponent* InPrimitive)
+		{
+			if (ShouldSkipLineTrace(InPrimitive, InIgnoredActor))
+			{
+				return true;
+			}
+
+			FVector WorldMin, WorldMax;
+			InPrimitive->GetWorldAABB(WorldMin, WorldMax);
+			float EntryDistance;
+			if (InRay.GetEntryDistance(FAABB(WorldMin, WorldMax), EntryDistance))
+			{
+				OutCandidates.Add({ InPrimitive, EntryDistance });
+			}
+			return true;
+		});
+
+		OutCandidates.Sort([](const FLineTraceCandidate& A, const FLineTraceCandidate& B)
+		{
+			return A.EntryDistance < B.EntryDistance;
+		});
+	}
+
+	constexpr uint32 SPATIAL_INDEX_CACHE_MAGIC = 0x4F435442; // "OCTB"
+	/** @brief 저장 형식이나 Octree 구축 규칙이 바뀌면 올려서 이전 캐시를 버림 */
+	constexpr uint32 SPATIAL_INDEX_CACHE_VERSION = 1;
+
+	/** @brief 정적 Octree 캐시 파일 헤더 (뒤에 FOctree::Save의 내용이 이어짐) */
+	struct FSpatialIndexCacheHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 ContentHash;
+		int32 NumPrimitives;
+	};
+
+	/** @brief 파일 내용의 64비트 FNV-1a 해시, 읽지 못하면 0 */
+	uint64 HashFileContents(const std::filesystem::path& InFilePath)
+	{
+		std::ifstream File(InFilePath, std::ios::binary);
+		if (!File)
+		{
+			return 0;
+		}
+
+		uint64 Hash = 0xcbf29ce484222325ULL;
+		char Buffer[64 * 1024];
+		while (File.read(Buffer, sizeof(Buffer)) || File.gcount() > 0)
+		{
+			const std::streamsize NumRead = File.gcount();
+			for (std::streamsize Index = 0; Index < NumRead; ++Index)
+			{
+				Hash ^= static_cast<uint8>(Buffer[Index]);
+				Hash *= 0x100000001b3ULL;
+			}
+		}
+		return Hash;
+	}
+}
+
 ULevel::ULevel()
 {
-	// Octree covering -500 to 500 on each axis (1000 unit range)
-	// With MAX_DEPTH=9, minimum node size is ~1.95 (similar to old 2.34)
-	StaticOctree = new FOctree(FVector(0, 0, 0), 1000, 0);
+	// 초기 루트는 각 축 -500 ~ 500, 벗어나는 프리미티브가 들어오면 그 방향으로 커진다
+	StaticOctree = new FOctree(FVector(0, 0, 0), 1000);
+	DynamicTree = new FDynamicAABBTree();
 }
 
 ULevel::~ULevel()
@@ -37,6 +156,7 @@ ULevel::~ULevel()
 
 	// 모든 액터 객체가 삭제되었으므로, 포인터를 담고 있던 컨테이너들을 비웁니다.
 	SafeDelete(StaticOctree);
+	SafeDelete(DynamicTree);
 }
 
 void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -92,9 +212,10 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 void ULevel::Init()
 {
-	for (AActor* Actor: LevelActors)
+	// BeginPlay에서 생성된 액터가 LevelActors 뒤에 추가될 수 있으므로 위치로 순회
+	for (int32 Index = 0; Index < LevelActors.Num(); ++Index)
 	{
-		if (Actor)
+		if (AActor* Actor = LevelActors[Index])
 		{
 			Actor->BeginPlay();
 		}
@@ -120,7 +241,11 @@ AActor* ULevel::SpawnActorToLevel(UClass* InActorClass, JSON* ActorJsonData)
 		{
 			NewActor->InitializeComponents();
 		}
-		NewActor->BeginPlay();
+		// 레벨 로드 중에는 공간 인덱스가 만들어진 뒤 Init에서 한꺼번에 BeginPlay
+		if (!bDeferPrimitiveRegistration)
+		{
+			NewActor->BeginPlay();
+		}
 		AddLevelComponent(NewActor);
 		return NewActor;
 	}
@@ -142,12 +267,7 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
-		// StaticOctree에 먼저 삽입 시도
-		if (!(StaticOctree->Insert(PrimitiveComponent)))
-		{
-			// 실패하면 DynamicPrimitiveQueue 목록에 추가
-			OnPrimitiveUpdated(PrimitiveComponent);
-		}
+		InsertPrimitive(PrimitiveComponent);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
 	{
@@ -190,8 +310,16 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
-		// StaticOctree에서 제거 시도
-		StaticOctree->Remove(PrimitiveComponent);
+		// 움직인 적이 있다면 동적 트리에서, 아니면 StaticOctree에서 제거
+		if (PrimitiveComponent->DynamicTreeProxyId >= 0)
+		{
+			DynamicTree->DestroyProxy(PrimitiveComponent->DynamicTreeProxyId);
+			PrimitiveComponent->DynamicTreeProxyId = -1;
+		}
+		else
+		{
+			StaticOctree->Remove(PrimitiveComponent);
+		}
 	
 		OnPrimitiveUnregistered(PrimitiveComponent);
 	}
@@ -223,12 +351,7 @@ void ULevel::AddLevelComponent(AActor* Actor)
 	{
 		if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
 		{
-			// Octree Insert 시도
-			if (!(StaticOctree->Insert(PrimitiveComponent)))
-			{
-				// 실패하면 DynamicPrimitiveQueue에 추가
-				OnPrimitiveUpdated(PrimitiveComponent);
-			}
+			InsertPrimitive(PrimitiveComponent);
 		}
 		else if (auto LightComponent = Cast<ULightComponent>(Component))
 		{
@@ -289,11 +412,248 @@ bool ULevel::DestroyActor(AActor* InActor)
 
 void ULevel::UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent)
 {
-	if (!StaticOctree->Remove(InComponent))
+	if (InComponent)
+	{
+		PendingOctreePrimitives.Add(InComponent);
+	}
+}
+
+void ULevel::MarkPrimitiveDirty(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent)
 	{
 		return;
 	}
-	OnPrimitiveUpdated(InComponent);
+
+	PendingOctreePrimitives.Add(InComponent);
+	if (PendingOverlapSet.Add(InComponent))
+	{
+		PendingOverlapPrimitives.Add(InComponent);
+	}
+}
+
+bool ULevel::LineTraceSingle(FHitResult& OutHit, const FVector& InStart, const FVector& InEnd, const AActor* InIgnoredActor)
+{
+	const FVector Delta = InEnd - InStart;
+	const float Length = Delta.Length();
+	if (Length <= 0.0f)
+	{
+		return false;
+	}
+
+	FMemMark Mark(FMemStack::Get());
+	TArray<FLineTraceCandidate, TMemStackAllocator<>> Candidates;
+	const FVector Direction = Delta / Length;
+	GatherLineTraceCandidates(*this, FQueryRay(InStart, Direction, Length), InIgnoredActor, Candidates);
+
+	bool bHit = false;
+	float ClosestDistance = Length;
+	for (const FLineTraceCandidate& Candidate : Candidates)
+	{
+		// 후보는 들어가는 거리 순이므로 이미 찾은 교차보다 멀리서 시작하는 후보부터는 더 가까울 수 없음
+		if (Candidate.EntryDistance > ClosestDistance)
+		{
+			break;
+		}
+
+		FHitResult Hit;
+		if (Candidate.Primitive->LineTraceComponent(FQueryRay(InStart, Direction, ClosestDistance), Hit))
+		{
+			bHit = true;
+			ClosestDistance = Hit.Distance;
+			OutHit = Hit;
+		}
+	}
+
+	return bHit;
+}
+
+bool ULevel::LineTraceMulti(TArray<FHitResult>& OutHits, const FVector& InStart, const FVector& InEnd, const AActor* InIgnoredActor)
+{
+	OutHits.Empty();
+
+	const FVector Delta = InEnd - InStart;
+	const float Length = Delta.Length();
+	if (Length <= 0.0f)
+	{
+		return false;
+	}
+
+	FMemMark Mark(FMemStack::Get());
+	TArray<FLineTraceCandidate, TMemStackAllocator<>> Candidates;
+	const FQueryRay Ray(InStart, Delta / Length, Length);
+	GatherLineTraceCandidates(*this, Ray, InIgnoredActor, Candidates);
+
+	for (const FLineTraceCandidate& Candidate : Candidates)
+	{
+		FHitResult Hit;
+		if (Candidate.Primitive->LineTraceComponent(Ray, Hit))
+		{
+			OutHits.Add(Hit);
+		}
+	}
+
+	// 경계 상자에 들어가는 순서와 실제 교차 순서는 다를 수 있음
+	OutHits.Sort([](const FHitResult& A, const FHitResult& B)
+	{
+		return A.Distance < B.Distance;
+	});
+
+	return !OutHits.IsEmpty();
+}
+
+int32 ULevel::LineTraceBatch(const TArray<FLineTraceSegment>& InSegments, TArray<FHitResult>& OutHits, const AActor* InIgnoredActor)
+{
+	const int32 NumSegments = InSegments.Num();
+	OutHits.SetNum(NumSegments);
+	for (FHitResult& Hit : OutHits)
+	{
+		Hit = FHitResult();
+	}
+
+	FMemMark Mark(FMemStack::Get());
+
+	// 1. 길이가 있는 선분의 중점 범위를 구해 정렬 키를 양자화할 기준으로 삼음
+	FVector MidMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector MidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (const FLineTraceSegment& Segment : InSegments)
+	{
+		const FVector Mid = (Segment.Start + Segment.End) * 0.5f;
+		MidMin = FVector(std::min(MidMin.X, Mid.X), std::min(MidMin.Y, Mid.Y), std::min(MidMin.Z, Mid.Z));
+		MidMax = FVector(std::max(MidMax.X, Mid.X), std::max(MidMax.Y, Mid.Y), std::max(MidMax.Z, Mid.Z));
+	}
+	const FVector MidExtent = MidMax - MidMin;
+	const float MidScale = 511.0f / std::max({ MidExtent.X, MidExtent.Y, MidExtent.Z, 1e-6f });
+
+	// 2. 같은 팔분면을 향하고 중점이 가까운 선분이 이웃하도록 정렬 (화면 사각형의 레이는 타일로, 흩어진 레이는 지역별로 모임)
+	TArray<FSortedLineTrace, TMemStackAllocator<>> Order;
+	Order.Reserve(NumSegments);
+	for (int32 Index = 0; Index < NumSegments; ++Index)
+	{
+		const FLineTraceSegment& Segment = InSegments[Index];
+		const FVector Delta = Segment.End - Segment.Start;
+		if (Delta.LengthSquared() <= 0.0f)
+		{
+			continue;
+		}
+
+		const FVector Mid = (Segment.Start + Segment.End) * 0.5f - MidMin;
+		const uint32 Octant = (Delta.X < 0.0f ? 1u : 0u) | (Delta.Y < 0.0f ? 2u : 0u) | (Delta.Z < 0.0f ? 4u : 0u);
+		const uint32 Morton = ExpandLineTraceMortonBits(static_cast<uint32>(Mid.X * MidScale)) |
+			(ExpandLineTraceMortonBits(static_cast<uint32>(Mid.Y * MidScale)) << 1) |
+			(ExpandLineTraceMortonBits(static_cast<uint32>(Mid.Z * MidScale)) << 2);
+		Order.Add({ (Octant << 27) | Morton, Index });
+	}
+	Order.Sort([](const FSortedLineTrace& A, const FSortedLineTrace& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	TArray<FQueryRay, TMemStackAllocator<>> Rays;
+	Rays.Reserve(Order.Num());
+	for (const FSortedLineTrace& Sorted : Order)
+	{
+		const FLineTraceSegment& Segment = InSegments[Sorted.SegmentIndex];
+		const FVector Delta = Segment.End - Segment.Start;
+		const float Length = Delta.Length();
+		Rays.Add(FQueryRay(Segment.Start, Delta / Length, Length));
+	}
+
+	// 3. 묶음마다 상위 트리를 한 번 순회해 후보와 그 경계를 지나는 선분을 모으고, 가까운 후보부터 하위 BVH를 묶음으로 순회
+	TArray<FLineTracePacketCandidate, TMemStackAllocator<>> Candidates;
+	TArray<FQueryRay, TInlineAllocator<LINE_TRACE_PACKET_SIZE>> ClippedRays;
+	TArray<int32, TInlineAllocator<LINE_TRACE_PACKET_SIZE>> ClippedIndices;
+	FHitResult PacketHits[LINE_TRACE_PACKET_SIZE];
+	int32 NumHits = 0;
+	for (int32 Begin = 0; Begin < Rays.Num(); Begin += LINE_TRACE_PACKET_SIZE)
+	{
+		const int32 NumRays = std::min(Rays.Num() - Begin, LINE_TRACE_PACKET_SIZE);
+		const FQueryRay* PacketRays = &Rays[Begin];
+		float ClosestDistances[LINE_TRACE_PACKET_SIZE];
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			ClosestDistances[Index] = PacketRays[Index].MaxDistance;
+		}
+
+		Candidates.Empty();
+		QueryPrimitives(FQueryRayPacket(PacketRays, NumRays), [&](UPrimitiveComponent* InPrimitive)
+		{
+			if (ShouldSkipLineTrace(InPrimitive, InIgnoredActor))
+			{
+				return true;
+			}
+
+			FVector WorldMin, WorldMax;
+			InPrimitive->GetWorldAABB(WorldMin, WorldMax);
+			const FAABB Bounds(WorldMin, WorldMax);
+			uint64 RayMask = 0;
+			float MinEntryDistance = FLT_MAX;
+			for (int32 Index = 0; Index < NumRays; ++Index)
+			{
+				float EntryDistance;
+				if (PacketRays[Index].GetEntryDistance(Bounds, EntryDistance))
+				{
+					RayMask |= 1ull << Index;
+					MinEntryDistance = std::min(MinEntryDistance, EntryDistance);
+				}
+			}
+			if (RayMask != 0)
+			{
+				Candidates.Add({ InPrimitive, Bounds, RayMask, MinEntryDistance });
+			}
+			return true;
+		});
+
+		Candidates.Sort([](const FLineTracePacketCandidate& A, const FLineTracePacketCandidate& B)
+		{
+			return A.EntryDistance < B.EntryDistance;
+		});
+
+		for (const FLineTracePacketCandidate& Candidate : Candidates)
+		{
+			// 앞선 후보에서 더 가까운 교차를 찾은 선분은 그 거리로 잘라 경계를 다시 지나는지 확인
+			ClippedRays.Empty();
+			ClippedIndices.Empty();
+			for (int32 Index = 0; Index < NumRays; ++Index)
+			{
+				if ((Candidate.RayMask & (1ull << Index)) == 0)
+				{
+					continue;
+				}
+
+				const FQueryRay ClippedRay(PacketRays[Index].Origin, PacketRays[Index].Direction, ClosestDistances[Index]);
+				float EntryDistance;
+				if (ClippedRay.GetEntryDistance(Candidate.Bounds, EntryDistance))
+				{
+					ClippedRays.Add(ClippedRay);
+					ClippedIndices.Add(Index);
+				}
+			}
+
+			if (ClippedRays.IsEmpty() ||
+				Candidate.Primitive->LineTraceComponentPacket(ClippedRays.GetData(), ClippedRays.Num(), PacketHits) == 0)
+			{
+				continue;
+			}
+
+			for (int32 Clipped = 0; Clipped < ClippedRays.Num(); ++Clipped)
+			{
+				if (PacketHits[Clipped].bBlockingHit)
+				{
+					const int32 Index = ClippedIndices[Clipped];
+					ClosestDistances[Index] = PacketHits[Clipped].Distance;
+					OutHits[Order[Begin + Index].SegmentIndex] = PacketHits[Clipped];
+				}
+			}
+		}
+
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			NumHits += OutHits[Order[Begin + Index].SegmentIndex].bBlockingHit ? 1 : 0;
+		}
+	}
+
+	return NumHits;
 }
 
 UObject* ULevel::Duplicate()
@@ -321,131 +681,364 @@ void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 	Octree Management
 -----------------------------------------------------------------------------*/
 
-void ULevel::UpdateOctree()
+void ULevel::UpdateOctreeImmediate()
 {
 	if (!StaticOctree)
 	{
+		PendingOctreePrimitives.Reset();
 		return;
 	}
-	
-	uint32 Count = 0;
-	FDynamicPrimitiveQueue NotInsertedQueue;
-	
-	while (!DynamicPrimitiveQueue.empty() && Count < MAX_OBJECTS_TO_INSERT_PER_FRAME)
-	{
-		auto [Component, TimePoint] = DynamicPrimitiveQueue.front();
-		DynamicPrimitiveQueue.pop();
 
-		auto* FoundTimestampPtr = DynamicPrimitiveMap.Find(Component);
-		if (FoundTimestampPtr)
-		{
-			if (*FoundTimestampPtr <= TimePoint)
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 시간 이후로 변경이 없었다면 Octree에 재삽입한다.
-				if (StaticOctree->Insert(Component))
-				{
-					DynamicPrimitiveMap.Remove(Component);
-				}
-				// 삽입이 안됐다면 다시 Queue에 들어가기 위해 저장
-				else
-				{
-					NotInsertedQueue.push({Component, *FoundTimestampPtr});
-				}
-				// TODO: 오브젝트의 유일성을 보장하기 위해 StaticOctree->Remove(Component)가 필요한가?
-				++Count;
-			}
-			else
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 이후 새로운 변경이 존재했다면 다시 큐에 삽입한다.
-				DynamicPrimitiveQueue.push({Component, *FoundTimestampPtr});
-			}
-		}
+	// 하나씩 삽입하며 만들어진 트리를 Morton 순서로 다시 만들어 노드와 프리미티브 배열을 연속으로 배치
+	// 동적 트리에 있던 프리미티브, 대기 중인 재배치와 삽입하지 못했던 프리미티브도 현재 경계로 함께 반영된다
+	ProcessingPrimitives.Empty();
+	StaticOctree->GetAllPrimitives(ProcessingPrimitives);
+	DynamicTree->GetAllPrimitives(ProcessingPrimitives);
+	for (UPrimitiveComponent* Primitive : UnindexedPrimitives)
+	{
+		ProcessingPrimitives.Add(Primitive);
 	}
-	
-	DynamicPrimitiveQueue = NotInsertedQueue;
-	if (Count != 0)
+	for (UPrimitiveComponent* Primitive : ProcessingPrimitives)
 	{
-		// UE_LOG("UpdateOctree: %d개의 컴포넌트가 업데이트 되었습니다.", Count);
+		Primitive->DynamicTreeProxyId = -1;
 	}
+	DynamicTree->Clear();
+	PendingOctreePrimitives.Reset();
+	UnindexedPrimitives.Reset();
+
+	RemovedPrimitives.Empty();
+	StaticOctree->Build(ProcessingPrimitives, &RemovedPrimitives);
+	for (UPrimitiveComponent* Primitive : RemovedPrimitives)
+	{
+		InsertDynamicPrimitive(Primitive);
+	}
+
+	ProcessingPrimitives.Empty();
+	RemovedPrimitives.Empty();
 }
 
-void ULevel::UpdateOctreeImmediate()
+void ULevel::BeginDeferredPrimitiveRegistration()
 {
+	bDeferPrimitiveRegistration = true;
+	DeferredPrimitives.Empty();
+	DeferredPrimitiveIndices.Empty();
+	NumRemovedDeferredPrimitives = 0;
+}
+
+void ULevel::LoadStaticSpatialIndex(const std::filesystem::path& InLevelFilePath)
+{
+	bDeferPrimitiveRegistration = false;
+	DeferredPrimitiveIndices.Empty();
+
+	// 로드 중에 해제되어 비어 있는 자리를 등록 순서를 유지하며 당김
+	if (NumRemovedDeferredPrimitives > 0)
+	{
+		DeferredPrimitives.RemoveAll([](const UPrimitiveComponent* InPrimitive) { return InPrimitive == nullptr; });
+		NumRemovedDeferredPrimitives = 0;
+	}
+
 	if (!StaticOctree)
 	{
+		DeferredPrimitives.Empty();
 		return;
 	}
 
-	uint32 TotalCount = 0;
-	FDynamicPrimitiveQueue NotInsertedQueue;
+	// 로드 중에 움직인 프리미티브도 지금 경계로 반영되므로 대기 중인 재배치는 필요 없음
+	PendingOctreePrimitives.Reset();
+
+	const uint64 ContentHash = HashFileContents(InLevelFilePath);
+	std::filesystem::path CachePath = InLevelFilePath;
+	CachePath.replace_extension(".octreebin");
 
-	// MAX_OBJECTS_TO_INSERT_PER_FRAME 제한 없이 모든 큐 비우기
-	while (!DynamicPrimitiveQueue.empty())
+	RemovedPrimitives.Empty();
+	bool bLoadedFromCache = false;
+	if (ContentHash != 0 && std::filesystem::exists(CachePath))
 	{
-		auto [Component, TimePoint] = DynamicPrimitiveQueue.front();
-		DynamicPrimitiveQueue.pop();
+		FWindowsBinReader Reader(CachePath);
+		FSpatialIndexCacheHeader Header = {};
+		Reader << Header;
 
-		auto* FoundTimestampPtr = DynamicPrimitiveMap.Find(Component);
-		if (FoundTimestampPtr)
+		bLoadedFromCache = Header.Magic == SPATIAL_INDEX_CACHE_MAGIC
+			&& Header.Version == SPATIAL_INDEX_CACHE_VERSION
+			&& Header.ContentHash == ContentHash
+			&& Header.NumPrimitives == DeferredPrimitives.Num()
+			&& StaticOctree->Load(Reader, DeferredPrimitives, &RemovedPrimitives);
+
+		if (!bLoadedFromCache)
 		{
-			if (*FoundTimestampPtr <= TimePoint)
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 시간 이후로 변경이 없었다면 Octree에 재삽입
-				if (StaticOctree->Insert(Component))
-				{
-					DynamicPrimitiveMap.Remove(Component);
-					++TotalCount;
-				}
-				// 삽입이 안됐다면 다시 Queue에 들어가기 위해 저장
-				else
-				{
-					NotInsertedQueue.push({Component, *FoundTimestampPtr});
-				}
-			}
-			else
-			{
-				// 큐에 기록된 오브젝트의 마지막 변경 이후 새로운 변경이 존재했다면 다시 큐에 삽입
-				DynamicPrimitiveQueue.push({Component, *FoundTimestampPtr});
-			}
+			UE_LOG("Level: 공간 인덱스 캐시가 현재 레벨과 맞지 않아 다시 구축합니다: %s", CachePath.string().c_str());
+			RemovedPrimitives.Empty();
 		}
 	}
 
-	DynamicPrimitiveQueue = NotInsertedQueue;
+	if (!bLoadedFromCache)
+	{
+		StaticOctree->Build(DeferredPrimitives, &RemovedPrimitives);
+
+		if (ContentHash != 0)
+		{
+			FWindowsBinWriter Writer(CachePath);
+			FSpatialIndexCacheHeader Header = {};
+			Header.Magic = SPATIAL_INDEX_CACHE_MAGIC;
+			Header.Version = SPATIAL_INDEX_CACHE_VERSION;
+			Header.ContentHash = ContentHash;
+			Header.NumPrimitives = DeferredPrimitives.Num();
+			Writer << Header;
+			StaticOctree->Save(Writer, DeferredPrimitives);
+		}
+	}
 
-	if (TotalCount > 0)
+	// Octree 최대 크기를 넘거나 경계가 유효하지 않은 프리미티브는 Build와 같이 동적 트리로
+	for (UPrimitiveComponent* Primitive : RemovedPrimitives)
 	{
-		UE_LOG("Level: Octree 즉시 구축 완료 (%u개 컴포넌트)", TotalCount);
+		InsertDynamicPrimitive(Primitive);
 	}
+
+	RemovedPrimitives.Empty();
+	DeferredPrimitives.Empty();
 }
 
-void ULevel::OnPrimitiveUpdated(UPrimitiveComponent* InComponent)
+void ULevel::InsertPrimitive(UPrimitiveComponent* InComponent)
+{
+	if (bDeferPrimitiveRegistration)
+	{
+		DeferredPrimitiveIndices.Add(InComponent, DeferredPrimitives.Num());
+		DeferredPrimitives.Add(InComponent);
+		return;
+	}
+
+	if (!StaticOctree->Insert(InComponent))
+	{
+		// Octree 최대 크기를 넘는 경계는 크기 제한이 없는 동적 트리에 넣음
+		InsertDynamicPrimitive(InComponent);
+	}
+}
+
+void ULevel::InsertDynamicPrimitive(UPrimitiveComponent* InComponent)
+{
+	FVector Min, Max;
+	InComponent->GetWorldAABB(Min, Max);
+
+	InComponent->DynamicTreeProxyId = DynamicTree->CreateProxy(InComponent, FAABB(Min, Max));
+	if (InComponent->DynamicTreeProxyId < 0)
+	{
+		UnindexedPrimitives.Add(InComponent);
+		UE_LOG_WARNING("Level: '%s' 컴포넌트의 경계가 유효하지 않아 공간 인덱스에 넣지 못했습니다.", InComponent->GetName().ToString().data());
+	}
+}
+
+void ULevel::OnPrimitiveUnregistered(UPrimitiveComponent* InComponent)
 {
 	if (!InComponent)
 	{
 		return;
 	}
 
-	float GameTime = UTimeManager::GetInstance().GetGameTime();
-	float* FoundTimePtr = DynamicPrimitiveMap.Find(InComponent);
+	int32 DeferredIndex;
+	if (bDeferPrimitiveRegistration && DeferredPrimitiveIndices.RemoveAndCopyValue(InComponent, DeferredIndex))
+	{
+		DeferredPrimitives[DeferredIndex] = nullptr;
+		++NumRemovedDeferredPrimitives;
+	}
+
+	UnindexedPrimitives.Remove(InComponent);
+	PendingOctreePrimitives.Remove(InComponent);
 
-	if (FoundTimePtr)
+	if (PendingOverlapSet.Remove(InComponent) > 0)
 	{
-		*FoundTimePtr = GameTime;
+		PendingOverlapPrimitives.Remove(InComponent);
 	}
-	else
+
+	// 겹쳐 있던 상대의 목록과 쌍 캐시에서 빼 둠 (해제되는 컴포넌트의 EndOverlap은 보내지 않음)
+	for (const FOverlapInfo& Info : InComponent->OverlappingComponents)
+	{
+		if (UPrimitiveComponent* Other = Info.OverlapComponent.Get())
+		{
+			Other->OverlappingComponents.RemoveSwap(FOverlapInfo(InComponent));
+			OverlapPairs.Remove(FOverlapPair(InComponent, Other));
+		}
+	}
+	InComponent->OverlappingComponents.Empty();
+
+	// Overlap 이벤트 처리 중에 해제되었다면 남은 이벤트에서 건너뛰도록 비워 둠
+	for (FOverlapPair& Pair : EndedPairs)
 	{
-		DynamicPrimitiveMap.Add(InComponent, GameTime);
+		if (Pair.Contains(InComponent))
+		{
+			Pair = FOverlapPair();
+		}
+	}
+	for (FOverlapPair& Pair : BegunPairs)
+	{
+		if (Pair.Contains(InComponent))
+		{
+			Pair = FOverlapPair();
+		}
+	}
+}
+
+void ULevel::RefitPendingPrimitives()
+{
+	if (!StaticOctree || !DynamicTree)
+	{
+		PendingOctreePrimitives.Reset();
+		return;
+	}
+
+	RemovedPrimitives.Empty();
+	for (UPrimitiveComponent* Primitive : PendingOctreePrimitives)
+	{
+		if (Primitive->DynamicTreeProxyId >= 0)
+		{
+			// 뚱뚱한 경계 안에서 움직였다면 트리 구조는 그대로 두고 실제 경계만 갱신됨
+			FVector Min, Max;
+			Primitive->GetWorldAABB(Min, Max);
+			DynamicTree->MoveProxy(Primitive->DynamicTreeProxyId, FAABB(Min, Max));
+		}
+		else if (UnindexedPrimitives.Remove(Primitive) > 0)
+		{
+			// 삽입하지 못했던 프리미티브가 다시 움직였다면 재삽입 시도
+			RemovedPrimitives.Add(Primitive);
+		}
+		else
+		{
+			PromotingPrimitives.Add(Primitive);
+		}
+	}
+	PendingOctreePrimitives.Reset();
+
+	// 처음 움직인 프리미티브는 Octree를 한 번 순회해 모두 빼낸 뒤 동적 트리로 옮김
+	if (!PromotingPrimitives.IsEmpty())
+	{
+		StaticOctree->RemovePrimitives(PromotingPrimitives, RemovedPrimitives);
+		PromotingPrimitives.Reset();
+	}
 
-		DynamicPrimitiveQueue.push({InComponent, GameTime});
+	for (UPrimitiveComponent* Primitive : RemovedPrimitives)
+	{
+		InsertDynamicPrimitive(Primitive);
 	}
+	RemovedPrimitives.Empty();
 }
 
-void ULevel::OnPrimitiveUnregistered(UPrimitiveComponent* InComponent)
+void ULevel::FlushPrimitiveUpdates()
 {
-	if (!InComponent)
+	if (!PendingOctreePrimitives.IsEmpty())
+	{
+		RefitPendingPrimitives();
+	}
+
+	if (PendingOverlapPrimitives.IsEmpty())
 	{
 		return;
 	}
 
-	DynamicPrimitiveMap.Remove(InComponent);
+	// 모두 최종 위치로 옮겨진 상태에서 Overlap 검사
+	// 이벤트 처리 중에 움직인 프리미티브는 다음 프레임에 처리되도록 목록을 먼저 비워 둠
+	std::swap(ProcessingPrimitives, PendingOverlapPrimitives);
+	PendingOverlapSet.Reset();
+
+	UpdateOverlapPairs();
+}
+
+void ULevel::UpdateOverlapPairs()
+{
+	// 1. Broad phase: 움직인 프리미티브마다 공간 인덱스를 한 번 쿼리해 경계가 겹치는 쌍 수집
+	// 둘 다 움직인 쌍은 양쪽 쿼리에서 모두 나오므로 여기서는 중복될 수 있음
+	CandidatePairs.Reset();
+	for (UPrimitiveComponent* Primitive : ProcessingPrimitives)
+	{
+		const AActor* Owner = Primitive->GetOwner();
+		if (!Owner)
+		{
+			continue;
+		}
+
+		FVector Min, Max;
+		Primitive->GetWorldAABB(Min, Max);
+		QueryPrimitives(FQueryBox(FAABB(Min, Max)), [this, Primitive, Owner](UPrimitiveComponent* InCandidate)
+		{
+			// 같은 액터의 컴포넌트끼리는 겹침으로 보지 않음
+			if (InCandidate != Primitive && InCandidate->GetOwner() != Owner)
+			{
+				CandidatePairs.Add(FOverlapPair(Primitive, InCandidate));
+			}
+			return true;
+		});
+	}
+
+	// 2. Narrow phase: 처음 발견된 순서대로 쌍마다 충돌 모양 검사를 한 번만 수행
+	TestedPairs.Reset();
+	CurrentPairs.Reset();
+	BegunPairs.Reset();
+	for (const FOverlapPair& Pair : CandidatePairs)
+	{
+		if (!TestedPairs.Add(Pair))
+		{
+			continue;
+		}
+
+		if (FCollisionHelper::TestOverlap(Pair.A->GetCollisionShape(), Pair.B->GetCollisionShape()))
+		{
+			CurrentPairs.Add(Pair);
+			if (!OverlapPairs.Contains(Pair))
+			{
+				BegunPairs.Add(Pair);
+			}
+		}
+	}
+	CandidatePairs.Reset();
+
+	// 3. 쌍 캐시와 비교: 움직인 프리미티브가 겹쳐 있던 상대 중 이번에 겹치지 않은 쌍은 끝남
+	// 캐시에서 바로 빼므로 둘 다 움직인 쌍도 한 번만 끝난다
+	EndedPairs.Reset();
+	for (UPrimitiveComponent* Primitive : ProcessingPrimitives)
+	{
+		for (const FOverlapInfo& Info : Primitive->OverlappingComponents)
+		{
+			const FOverlapPair Pair(Primitive, Info.OverlapComponent.Get());
+			if (!CurrentPairs.Contains(Pair) && OverlapPairs.Remove(Pair) > 0)
+			{
+				EndedPairs.Add(Pair);
+			}
+		}
+	}
+	ProcessingPrimitives.Empty();
+
+	// 이벤트 전에 캐시와 컴포넌트의 겹침 목록을 갱신해 핸들러의 IsOverlappingComponent가 새 상태를 보게 함
+	for (const FOverlapPair& Pair : EndedPairs)
+	{
+		Pair.A->OverlappingComponents.RemoveSwap(FOverlapInfo(Pair.B));
+		Pair.B->OverlappingComponents.RemoveSwap(FOverlapInfo(Pair.A));
+	}
+	for (const FOverlapPair& Pair : BegunPairs)
+	{
+		OverlapPairs.Add(Pair);
+		Pair.A->OverlappingComponents.Add(FOverlapInfo(Pair.B));
+		Pair.B->OverlappingComponents.Add(FOverlapInfo(Pair.A));
+	}
+
+	// 4. 끝난 쌍부터 이벤트 발생 (양방향으로 보내므로 쌍마다 한 번만 호출)
+	// 핸들러가 컴포넌트를 해제하면 OnPrimitiveUnregistered가 남은 쌍을 비워 두므로 매번 다시 읽음
+	for (int32 Index = 0; Index < EndedPairs.Num(); ++Index)
+	{
+		const FOverlapPair Pair = EndedPairs[Index];
+		if (Pair.A)
+		{
+			Pair.A->NotifyComponentEndOverlap(Pair.B);
+		}
+	}
+	for (int32 Index = 0; Index < BegunPairs.Num(); ++Index)
+	{
+		const FOverlapPair Pair = BegunPairs[Index];
+		if (Pair.A)
+		{
+			FHitResult HitResult;
+			HitResult.Actor = Pair.B->GetOwner();
+			HitResult.Component = Pair.B;
+			Pair.A->NotifyComponentBeginOverlap(Pair.B, HitResult);
+		}
+	}
+	EndedPairs.Reset();
+	BegunPairs.Reset();
 }
@@ -0,0 +1,496 @@
+#include "pch.h"
+#include "Level/Public/MovementBatchManager.h"
+#include "Level/Public/World.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Public/ProjectileMovementComponent.h"
+#include "Component/Public/RotatingMovementComponent.h"
+#include "Component/Public/SceneComponent.h"
+
+namespace
+{
+	int32 RoundUpToSimdWidth(int32 InNum)
+	{
+		return (InNum + 3) & ~3;
+	}
+
+	/** @brief 4개의 벡터 (AX, AY, AZ) x (BX, BY, BZ) */
+	void CrossSimd(__m128 AX, __m128 AY, __m128 AZ, __m128 BX, __m128 BY, __m128 BZ,
+		__m128& OutX, __m128& OutY, __m128& OutZ)
+	{
+		OutX = _mm_sub_ps(_mm_mul_ps(AY, BZ), _mm_mul_ps(AZ, BY));
+		OutY = _mm_sub_ps(_mm_mul_ps(AZ, BX), _mm_mul_ps(AX, BZ));
+		OutZ = _mm_sub_ps(_mm_mul_ps(AX, BY), _mm_mul_ps(AY, BX));
+	}
+
+	/** @brief 4개의 쿼터니언 A * B (FQuaternion::operator*와 같은 식) */
+	void MultiplyQuaternionSimd(__m128 AX, __m128 AY, __m128 AZ, __m128 AW, __m128 BX, __m128 BY, __m128 BZ, __m128 BW,
+		__m128& OutX, __m128& OutY, __m128& OutZ, __m128& OutW)
+	{
+		OutX = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(AW, BX), _mm_mul_ps(AX, BW)), _mm_mul_ps(AY, BZ)), _mm_mul_ps(AZ, BY));
+		OutY = _mm_add_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(AW, BY), _mm_mul_ps(AX, BZ)), _mm_mul_ps(AY, BW)), _mm_mul_ps(AZ, BX));
+		OutZ = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(AW, BZ), _mm_mul_ps(AX, BY)), _mm_mul_ps(AY, BX)), _mm_mul_ps(AZ, BW));
+		OutW = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(AW, BW), _mm_mul_ps(AX, BX)), _mm_mul_ps(AY, BY)), _mm_mul_ps(AZ, BZ));
+	}
+
+	/** @brief 4개의 벡터를 각각의 쿼터니언으로 회전 (FQuaternion::RotateVector와 같은 식) */
+	void RotateVectorSimd(__m128 QX, __m128 QY, __m128 QZ, __m128 QW, __m128 VX, __m128 VY, __m128 VZ,
+		__m128& OutX, __m128& OutY, __m128& OutZ)
+	{
+		const __m128 Two = _mm_set1_ps(2.0f);
+
+		__m128 TX, TY, TZ;
+		CrossSimd(QX, QY, QZ, VX, VY, VZ, TX, TY, TZ);
+		TX = _mm_mul_ps(TX, Two);
+		TY = _mm_mul_ps(TY, Two);
+		TZ = _mm_mul_ps(TZ, Two);
+
+		__m128 CX, CY, CZ;
+		CrossSimd(QX, QY, QZ, TX, TY, TZ, CX, CY, CZ);
+
+		OutX = _mm_add_ps(_mm_add_ps(VX, _mm_mul_ps(QW, TX)), CX);
+		OutY = _mm_add_ps(_mm_add_ps(VY, _mm_mul_ps(QW, TY)), CY);
+		OutZ = _mm_add_ps(_mm_add_ps(VZ, _mm_mul_ps(QW, TZ)), CZ);
+	}
+
+	/** @brief Mask의 비트가 켜진 항목은 A, 꺼진 항목은 B */
+	__m128 SelectSimd(__m128 Mask, __m128 A, __m128 B)
+	{
+		return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B));
+	}
+
+	/** @brief 부모가 없는 컴포넌트는 상대 위치가 곧 월드 위치이므로 변환 행렬을 다시 계산하지 않음 */
+	FVector GetUpdatedLocation(const USceneComponent* InComponent)
+	{
+		return InComponent->GetAttachParent() ? InComponent->GetWorldLocation() : InComponent->GetRelativeLocation();
+	}
+}
+
+// === FMovementBatchTickFunction ===
+
+void FMovementBatchTickFunction::ExecuteTick(float DeltaTime)
+{
+	Target->Tick(DeltaTime);
+}
+
+// === SoA 데이터 ===
+
+void FMovementBatchManager::FProjectileData::SetNum(int32 InNum)
+{
+	const int32 PaddedNum = RoundUpToSimdWidth(InNum);
+	for (TArray<float>* Array : { &PositionX, &PositionY, &PositionZ, &VelocityX, &VelocityY, &VelocityZ, &GravityScale, &MaxSpeed })
+	{
+		Array->SetNum(PaddedNum);
+		// 남는 자리는 움직이지 않는 항목으로 채움
+		for (int32 Index = InNum; Index < PaddedNum; ++Index)
+		{
+			(*Array)[Index] = 0.0f;
+		}
+	}
+}
+
+void FMovementBatchManager::FRotatingData::SetNum(int32 InNum)
+{
+	const int32 PaddedNum = RoundUpToSimdWidth(InNum);
+	for (TArray<float>* Array : { &RotationX, &RotationY, &RotationZ, &RotationW, &DeltaX, &DeltaY, &DeltaZ, &DeltaW,
+		&PivotX, &PivotY, &PivotZ, &LocalSpaceMask, &DeltaLocationX, &DeltaLocationY, &DeltaLocationZ })
+	{
+		Array->SetNum(PaddedNum);
+		for (int32 Index = InNum; Index < PaddedNum; ++Index)
+		{
+			(*Array)[Index] = 0.0f;
+		}
+	}
+
+	// 남는 자리는 단위 쿼터니언
+	for (int32 Index = InNum; Index < PaddedNum; ++Index)
+	{
+		RotationW[Index] = 1.0f;
+		DeltaW[Index] = 1.0f;
+	}
+}
+
+// === FMovementBatchManager ===
+
+FMovementBatchManager::FMovementBatchManager(UWorld* InWorld)
+	: World(InWorld)
+{
+	BatchTickFunction.Target = this;
+}
+
+FMovementBatchManager::~FMovementBatchManager()
+{
+	for (UProjectileMovementComponent* Component : Projectiles)
+	{
+		Component->MovementBatch = nullptr;
+		Component->MovementBatchIndex = -1;
+	}
+	for (URotatingMovementComponent* Component : Rotatings)
+	{
+		Component->MovementBatch = nullptr;
+		Component->MovementBatchIndex = -1;
+	}
+
+	BatchTickFunction.UnRegisterTickFunction();
+}
+
+void FMovementBatchManager::RegisterComponent(UProjectileMovementComponent* InComponent)
+{
+	if (!InComponent || InComponent->MovementBatch)
+	{
+		return;
+	}
+
+	InComponent->MovementBatch = this;
+	InComponent->MovementBatchIndex = Projectiles.Num();
+	Projectiles.Add(InComponent);
+	OnComponentRegistered(InComponent);
+}
+
+void FMovementBatchManager::UnregisterComponent(UProjectileMovementComponent* InComponent)
+{
+	if (!InComponent || InComponent->MovementBatch != this)
+	{
+		return;
+	}
+
+	const int32 Index = InComponent->MovementBatchIndex;
+	Projectiles.RemoveAtSwap(Index);
+	if (Index < Projectiles.Num())
+	{
+		Projectiles[Index]->MovementBatchIndex = Index;
+	}
+
+	InComponent->MovementBatch = nullptr;
+	InComponent->MovementBatchIndex = -1;
+	OnComponentUnregistered();
+}
+
+void FMovementBatchManager::RegisterComponent(URotatingMovementComponent* InComponent)
+{
+	if (!InComponent || InComponent->MovementBatch)
+	{
+		return;
+	}
+
+	InComponent->MovementBatch = this;
+	InComponent->MovementBatchIndex = Rotatings.Num();
+	Rotatings.Add(InComponent);
+
+	FTickSchedule Schedule;
+	Schedule.Phase = GetNextStaggerPhase();
+	RotatingSchedules.Add(Schedule);
+	OnComponentRegistered(InComponent);
+}
+
+void FMovementBatchManager::UnregisterComponent(URotatingMovementComponent* InComponent)
+{
+	if (!InComponent || InComponent->MovementBatch != this)
+	{
+		return;
+	}
+
+	const int32 Index = InComponent->MovementBatchIndex;
+	Rotatings.RemoveAtSwap(Index);
+	RotatingSchedules.RemoveAtSwap(Index);
+	if (Index < Rotatings.Num())
+	{
+		Rotatings[Index]->MovementBatchIndex = Index;
+	}
+
+	InComponent->MovementBatch = nullptr;
+	InComponent->MovementBatchIndex = -1;
+	OnComponentUnregistered();
+}
+
+void FMovementBatchManager::OnComponentRegistered(UMovementComponent* InComponent)
+{
+	if (!BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.RegisterTickFunction(&World->GetTickTaskManager());
+	}
+
+	// 컴포넌트별 Tick과 마찬가지로 액터 자신의 Tick은 이동이 끝난 뒤에 실행
+	if (AActor* Owner = InComponent->GetOwner())
+	{
+		Owner->PrimaryActorTick.AddPrerequisite(&BatchTickFunction);
+	}
+}
+
+void FMovementBatchManager::OnComponentUnregistered()
+{
+	// 해제되면서 액터들의 선행 조건에서도 빠짐
+	if (Projectiles.IsEmpty() && Rotatings.IsEmpty())
+	{
+		BatchTickFunction.UnRegisterTickFunction();
+	}
+}
+
+bool FMovementBatchManager::IsComponentEnabled(const UMovementComponent* InComponent) const
+{
+	if (!InComponent->CanEverTick() || !InComponent->GetUpdatedComponent())
+	{
+		return false;
+	}
+
+	const AActor* Owner = InComponent->GetOwner();
+	return Owner && Owner->CanTick() && (World->GetWorldType() != EWorldType::Editor || Owner->CanTickInEditor());
+}
+
+float FMovementBatchManager::GetComponentTickInterval(const UMovementComponent* InComponent) const
+{
+	const FActorComponentTickFunction& TickFunction = InComponent->PrimaryComponentTick;
+	float Interval = TickFunction.TickInterval;
+
+	FVector Location;
+	if (TickFunction.bAllowSignificanceThrottling && TickFunction.GetSignificanceLocation(Location))
+	{
+		const float SignificanceInterval = World->GetTickTaskManager().GetSignificanceTickInterval(Location);
+		Interval = SignificanceInterval > Interval ? SignificanceInterval : Interval;
+	}
+
+	return Interval;
+}
+
+float FMovementBatchManager::GetNextStaggerPhase()
+{
+	// FTickTaskManager와 같은 방식으로 첫 실행 시점을 간격 안에 골고루 흩어 놓음
+	constexpr double GoldenRatioFraction = 0.6180339887498949;
+	return static_cast<float>(std::fmod(static_cast<double>(NumStaggeredComponents++) * GoldenRatioFraction, 1.0));
+}
+
+void FMovementBatchManager::Tick(float DeltaTime)
+{
+	TickProjectiles(DeltaTime);
+	TickRotatings(DeltaTime);
+}
+
+void FMovementBatchManager::TickProjectiles(float DeltaTime)
+{
+	ActiveProjectiles.Empty();
+	for (UProjectileMovementComponent* Component : Projectiles)
+	{
+		if (IsComponentEnabled(Component))
+		{
+			ActiveProjectiles.Add(Component);
+		}
+	}
+
+	const int32 Num = ActiveProjectiles.Num();
+	if (Num == 0)
+	{
+		return;
+	}
+
+	// 1. 컴포넌트의 현재 값으로 SoA 배열 채우기
+	ProjectileData.SetNum(Num);
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const UProjectileMovementComponent* Component = ActiveProjectiles[Index];
+		const FVector Location = GetUpdatedLocation(Component->GetUpdatedComponent());
+		const FVector& Velocity = Component->GetVelocity();
+
+		ProjectileData.PositionX[Index] = Location.X;
+		ProjectileData.PositionY[Index] = Location.Y;
+		ProjectileData.PositionZ[Index] = Location.Z;
+		ProjectileData.VelocityX[Index] = Velocity.X;
+		ProjectileData.VelocityY[Index] = Velocity.Y;
+		ProjectileData.VelocityZ[Index] = Velocity.Z;
+		ProjectileData.GravityScale[Index] = Component->GetGravityScale();
+		ProjectileData.MaxSpeed[Index] = Component->GetMaxSpeed();
+	}
+
+	// 2. 적분
+	IntegrateProjectiles(ProjectileData, Num, DeltaTime);
+
+	// 3. 속도와 변환 되돌려 쓰기 (위치와 회전을 한 번에 설정해 MarkAsDirty도 한 번)
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		UProjectileMovementComponent* Component = ActiveProjectiles[Index];
+		USceneComponent* UpdatedComponent = Component->GetUpdatedComponent();
+
+		const FVector Velocity(ProjectileData.VelocityX[Index], ProjectileData.VelocityY[Index], ProjectileData.VelocityZ[Index]);
+		const FVector Location(ProjectileData.PositionX[Index], ProjectileData.PositionY[Index], ProjectileData.PositionZ[Index]);
+		Component->SetVelocity(Velocity);
+
+		if (Component->GetRotationFollowsVelocity() && !Velocity.IsZero())
+		{
+			UpdatedComponent->SetWorldLocationAndRotation(Location, FQuaternion::MakeFromDirection(Velocity.GetNormalized()));
+		}
+		else
+		{
+			UpdatedComponent->SetWorldLocation(Location);
+		}
+	}
+}
+
+void FMovementBatchManager::TickRotatings(float DeltaTime)
+{
+	ActiveRotatings.Empty();
+	ActiveRotatingDeltaTimes.Empty();
+	for (int32 Index = 0; Index < Rotatings.Num(); ++Index)
+	{
+		URotatingMovementComponent* Component = Rotatings[Index];
+		FTickSchedule& Schedule = RotatingSchedules[Index];
+		if (!IsComponentEnabled(Component))
+		{
+			// 다시 켜졌을 때 꺼져 있던 시간만큼 한 번에 돌지 않도록 비움
+			Schedule.SkippedTime = 0.0f;
+			continue;
+		}
+
+		Schedule.SkippedTime += DeltaTime;
+		Schedule.TimeUntilTick -= DeltaTime;
+		if (Schedule.TimeUntilTick > 0.0f)
+		{
+			continue;
+		}
+
+		// 차례가 된 컴포넌트만 건너뛴 시간을 모아 회전하고, 다음 간격은 이때의 카메라 거리로 정함
+		ActiveRotatings.Add(Component);
+		ActiveRotatingDeltaTimes.Add(Schedule.SkippedTime);
+		Schedule.SkippedTime = 0.0f;
+		Schedule.TimeUntilTick = GetComponentTickInterval(Component) * Schedule.Phase;
+		Schedule.Phase = 1.0f;
+	}
+
+	const int32 Num = ActiveRotatings.Num();
+	if (Num == 0)
+	{
+		return;
+	}
+
+	// 1. 현재 회전과 이번 프레임의 회전량으로 SoA 배열 채우기
+	RotatingData.SetNum(Num);
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const URotatingMovementComponent* Component = ActiveRotatings[Index];
+		const FQuaternion Rotation = Component->GetUpdatedComponent()->GetWorldRotationAsQuaternion();
+		const FQuaternion DeltaRotation = FQuaternion::FromEuler(Component->RotationRate * ActiveRotatingDeltaTimes[Index]);
+
+		RotatingData.RotationX[Index] = Rotation.X;
+		RotatingData.RotationY[Index] = Rotation.Y;
+		RotatingData.RotationZ[Index] = Rotation.Z;
+		RotatingData.RotationW[Index] = Rotation.W;
+		RotatingData.DeltaX[Index] = DeltaRotation.X;
+		RotatingData.DeltaY[Index] = DeltaRotation.Y;
+		RotatingData.DeltaZ[Index] = DeltaRotation.Z;
+		RotatingData.DeltaW[Index] = DeltaRotation.W;
+		RotatingData.PivotX[Index] = Component->PivotTranslation.X;
+		RotatingData.PivotY[Index] = Component->PivotTranslation.Y;
+		RotatingData.PivotZ[Index] = Component->PivotTranslation.Z;
+
+		uint32 Mask = Component->bRotationInLocalSpace ? 0xFFFFFFFFu : 0u;
+		memcpy(&RotatingData.LocalSpaceMask[Index], &Mask, sizeof(float));
+	}
+
+	// 2. 적분
+	IntegrateRotatings(RotatingData, Num);
+
+	// 3. 변환 되돌려 쓰기 (피벗이 없으면 위치는 그대로)
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const URotatingMovementComponent* Component = ActiveRotatings[Index];
+		USceneComponent* UpdatedComponent = Component->GetUpdatedComponent();
+
+		const FQuaternion NewRotation(RotatingData.RotationX[Index], RotatingData.RotationY[Index],
+			RotatingData.RotationZ[Index], RotatingData.RotationW[Index]);
+
+		if (Component->PivotTranslation.IsZero())
+		{
+			UpdatedComponent->SetWorldRotation(NewRotation);
+		}
+		else
+		{
+			const FVector DeltaLocation(RotatingData.DeltaLocationX[Index], RotatingData.DeltaLocationY[Index],
+				RotatingData.DeltaLocationZ[Index]);
+			UpdatedComponent->SetWorldLocationAndRotation(GetUpdatedLocation(UpdatedComponent) + DeltaLocation, NewRotation);
+		}
+	}
+}
+
+void FMovementBatchManager::IntegrateProjectiles(FProjectileData& InOutData, int32 InNum, float DeltaTime)
+{
+	const __m128 Delta = _mm_set1_ps(DeltaTime);
+	const __m128 Zero = _mm_setzero_ps();
+
+	for (int32 Index = 0; Index < InNum; Index += 4)
+	{
+		__m128 VelocityX = _mm_loadu_ps(&InOutData.VelocityX[Index]);
+		__m128 VelocityY = _mm_loadu_ps(&InOutData.VelocityY[Index]);
+		__m128 VelocityZ = _mm_loadu_ps(&InOutData.VelocityZ[Index]);
+		const __m128 GravityScale = _mm_loadu_ps(&InOutData.GravityScale[Index]);
+		const __m128 MaxSpeed = _mm_loadu_ps(&InOutData.MaxSpeed[Index]);
+
+		// 중력
+		VelocityZ = _mm_sub_ps(VelocityZ, _mm_mul_ps(GravityScale, Delta));
+
+		// 최대 속도를 넘은 항목만 방향을 유지한 채 MaxSpeed 크기로 줄임
+		const __m128 LengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(VelocityX, VelocityX), _mm_mul_ps(VelocityY, VelocityY)),
+			_mm_mul_ps(VelocityZ, VelocityZ));
+		const __m128 ClampMask = _mm_and_ps(_mm_cmpgt_ps(MaxSpeed, Zero), _mm_cmpgt_ps(LengthSquared, _mm_mul_ps(MaxSpeed, MaxSpeed)));
+		if (_mm_movemask_ps(ClampMask) != 0)
+		{
+			const __m128 Scale = _mm_div_ps(MaxSpeed, _mm_sqrt_ps(LengthSquared));
+			VelocityX = SelectSimd(ClampMask, _mm_mul_ps(VelocityX, Scale), VelocityX);
+			VelocityY = SelectSimd(ClampMask, _mm_mul_ps(VelocityY, Scale), VelocityY);
+			VelocityZ = SelectSimd(ClampMask, _mm_mul_ps(VelocityZ, Scale), VelocityZ);
+		}
+
+		// 위치
+		const __m128 PositionX = _mm_add_ps(_mm_loadu_ps(&InOutData.PositionX[Index]), _mm_mul_ps(VelocityX, Delta));
+		const __m128 PositionY = _mm_add_ps(_mm_loadu_ps(&InOutData.PositionY[Index]), _mm_mul_ps(VelocityY, Delta));
+		const __m128 PositionZ = _mm_add_ps(_mm_loadu_ps(&InOutData.PositionZ[Index]), _mm_mul_ps(VelocityZ, Delta));
+
+		_mm_storeu_ps(&InOutData.VelocityX[Index], VelocityX);
+		_mm_storeu_ps(&InOutData.VelocityY[Index], VelocityY);
+		_mm_storeu_ps(&InOutData.VelocityZ[Index], VelocityZ);
+		_mm_storeu_ps(&InOutData.PositionX[Index], PositionX);
+		_mm_storeu_ps(&InOutData.PositionY[Index], PositionY);
+		_mm_storeu_ps(&InOutData.PositionZ[Index], PositionZ);
+	}
+}
+
+void FMovementBatchManager::IntegrateRotatings(FRotatingData& InOutData, int32 InNum)
+{
+	for (int32 Index = 0; Index < InNum; Index += 4)
+	{
+		const __m128 OldX = _mm_loadu_ps(&InOutData.RotationX[Index]);
+		const __m128 OldY = _mm_loadu_ps(&InOutData.RotationY[Index]);
+		const __m128 OldZ = _mm_loadu_ps(&InOutData.RotationZ[Index]);
+		const __m128 OldW = _mm_loadu_ps(&InOutData.RotationW[Index]);
+		const __m128 DeltaX = _mm_loadu_ps(&InOutData.DeltaX[Index]);
+		const __m128 DeltaY = _mm_loadu_ps(&InOutData.DeltaY[Index]);
+		const __m128 DeltaZ = _mm_loadu_ps(&InOutData.DeltaZ[Index]);
+		const __m128 DeltaW = _mm_loadu_ps(&InOutData.DeltaW[Index]);
+		const __m128 LocalSpaceMask = _mm_loadu_ps(&InOutData.LocalSpaceMask[Index]);
+
+		// 로컬 공간이면 Old * Delta, 월드 공간이면 Delta * Old
+		__m128 LocalX, LocalY, LocalZ, LocalW;
+		MultiplyQuaternionSimd(OldX, OldY, OldZ, OldW, DeltaX, DeltaY, DeltaZ, DeltaW, LocalX, LocalY, LocalZ, LocalW);
+		__m128 WorldX, WorldY, WorldZ, WorldW;
+		MultiplyQuaternionSimd(DeltaX, DeltaY, DeltaZ, DeltaW, OldX, OldY, OldZ, OldW, WorldX, WorldY, WorldZ, WorldW);
+
+		const __m128 NewX = SelectSimd(LocalSpaceMask, LocalX, WorldX);
+		const __m128 NewY = SelectSimd(LocalSpaceMask, LocalY, WorldY);
+		const __m128 NewZ = SelectSimd(LocalSpaceMask, LocalZ, WorldZ);
+		const __m128 NewW = SelectSimd(LocalSpaceMask, LocalW, WorldW);
+
+		// 피벗을 중심으로 돌도록 이전 / 새 회전으로 돌린 피벗의 차이만큼 위치 이동
+		const __m128 PivotX = _mm_loadu_ps(&InOutData.PivotX[Index]);
+		const __m128 PivotY = _mm_loadu_ps(&InOutData.PivotY[Index]);
+		const __m128 PivotZ = _mm_loadu_ps(&InOutData.PivotZ[Index]);
+
+		__m128 OldPivotX, OldPivotY, OldPivotZ;
+		RotateVectorSimd(OldX, OldY, OldZ, OldW, PivotX, PivotY, PivotZ, OldPivotX, OldPivotY, OldPivotZ);
+		__m128 NewPivotX, NewPivotY, NewPivotZ;
+		RotateVectorSimd(NewX, NewY, NewZ, NewW, PivotX, PivotY, PivotZ, NewPivotX, NewPivotY, NewPivotZ);
+
+		_mm_storeu_ps(&InOutData.RotationX[Index], NewX);
+		_mm_storeu_ps(&InOutData.RotationY[Index], NewY);
+		_mm_storeu_ps(&InOutData.RotationZ[Index], NewZ);
+		_mm_storeu_ps(&InOutData.RotationW[Index], NewW);
+		_mm_storeu_ps(&InOutData.DeltaLocationX[Index], _mm_sub_ps(OldPivotX, NewPivotX));
+		_mm_storeu_ps(&InOutData.DeltaLocationY[Index], _mm_sub_ps(OldPivotY, NewPivotY));
+		_mm_storeu_ps(&InOutData.DeltaLocationZ[Index], _mm_sub_ps(OldPivotZ, NewPivotZ));
+	}
+}
@@ -0,0 +1,775 @@
+#include "pch.h"
+#include "Level/Public/TickTaskManager.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Public/ActorComponent.h"
+#include "Component/Public/SceneComponent.h"
+
+namespace
+{
+	uint32 CountTrailingZeros64(uint64 InMask)
+	{
+#ifdef _MSC_VER
+		unsigned long Index;
+		_BitScanForward64(&Index, InMask);
+		return static_cast<uint32>(Index);
+#else
+		return static_cast<uint32>(__builtin_ctzll(InMask));
+#endif
+	}
+}
+
+// === FTickFunction ===
+
+FTickFunction::~FTickFunction()
+{
+	UnRegisterTickFunction();
+
+	// 등록되지 않은 상태로 소멸해도 다른 함수의 목록에 해제된 포인터가 남지 않도록 양쪽 연결을 끊음
+	for (FTickFunction* Dependent : Dependents)
+	{
+		if (Dependent->Prerequisites.Remove(this) > 0 && Dependent->TickTaskManager)
+		{
+			Dependent->TickTaskManager->MarkOrderDirty(Dependent->TickGroup);
+		}
+	}
+	for (FTickFunction* Prerequisite : Prerequisites)
+	{
+		Prerequisite->Dependents.RemoveSwap(this);
+	}
+}
+
+void FTickFunction::RegisterTickFunction(FTickTaskManager* InTickTaskManager)
+{
+	if (!InTickTaskManager || TickTaskManager == InTickTaskManager)
+	{
+		return;
+	}
+
+	UnRegisterTickFunction();
+	InTickTaskManager->AddTickFunction(this);
+}
+
+void FTickFunction::UnRegisterTickFunction()
+{
+	if (TickTaskManager)
+	{
+		TickTaskManager->RemoveTickFunction(this);
+	}
+}
+
+void FTickFunction::SetTickGroup(ETickingGroup InTickGroup)
+{
+	if (TickGroup == InTickGroup)
+	{
+		return;
+	}
+
+	if (TickTaskManager)
+	{
+		TickTaskManager->ChangeTickGroup(this, InTickGroup);
+	}
+	else
+	{
+		TickGroup = InTickGroup;
+	}
+}
+
+void FTickFunction::SetTickInterval(float InTickInterval)
+{
+	const bool bUsedCooldown = UsesCooldown();
+	TickInterval = InTickInterval > 0.0f ? InTickInterval : 0.0f;
+
+	// 매 프레임 목록과 쿨다운 목록 사이를 옮겨야 하는 경우만 다시 정렬
+	if (TickTaskManager && bUsedCooldown != UsesCooldown())
+	{
+		TickTaskManager->MarkOrderDirty(TickGroup);
+	}
+}
+
+void FTickFunction::AddPrerequisite(FTickFunction* InPrerequisite)
+{
+	if (!InPrerequisite || InPrerequisite == this || Prerequisites.Contains(InPrerequisite))
+	{
+		return;
+	}
+
+	Prerequisites.Add(InPrerequisite);
+	InPrerequisite->Dependents.Add(this);
+	if (TickTaskManager)
+	{
+		TickTaskManager->MarkOrderDirty(TickGroup);
+	}
+}
+
+void FTickFunction::RemovePrerequisite(FTickFunction* InPrerequisite)
+{
+	if (Prerequisites.Remove(InPrerequisite) == 0)
+	{
+		return;
+	}
+
+	InPrerequisite->Dependents.RemoveSwap(this);
+	if (TickTaskManager)
+	{
+		TickTaskManager->MarkOrderDirty(TickGroup);
+	}
+}
+
+// === FActorTickFunction / FActorComponentTickFunction ===
+
+bool FActorTickFunction::IsTickFunctionEnabled(bool bInIsEditorWorld) const
+{
+	return Target && Target->CanTick() && (!bInIsEditorWorld || Target->CanTickInEditor());
+}
+
+void FActorTickFunction::ExecuteTick(float DeltaTime)
+{
+	Target->Tick(DeltaTime);
+}
+
+bool FActorTickFunction::GetSignificanceLocation(FVector& OutLocation) const
+{
+	if (!Target || !Target->GetRootComponent())
+	{
+		return false;
+	}
+
+	OutLocation = Target->GetRootComponent()->GetWorldLocation();
+	return true;
+}
+
+bool FActorComponentTickFunction::IsTickFunctionEnabled(bool bInIsEditorWorld) const
+{
+	if (!Target || !Target->CanEverTick())
+	{
+		return false;
+	}
+
+	// 기존 Actor::Tick과 동일하게 소유 액터가 Tick하지 않으면 컴포넌트도 Tick하지 않음
+	const AActor* Owner = Target->GetOwner();
+	return Owner && Owner->CanTick() && (!bInIsEditorWorld || Owner->CanTickInEditor());
+}
+
+void FActorComponentTickFunction::ExecuteTick(float DeltaTime)
+{
+	Target->TickComponent(DeltaTime);
+}
+
+bool FActorComponentTickFunction::GetSignificanceLocation(FVector& OutLocation) const
+{
+	if (!Target)
+	{
+		return false;
+	}
+
+	// 위치가 없는 컴포넌트는 소유 액터의 위치를 사용
+	const USceneComponent* SceneComponent = Cast<USceneComponent>(Target);
+	if (!SceneComponent && Target->GetOwner())
+	{
+		SceneComponent = Target->GetOwner()->GetRootComponent();
+	}
+
+	if (!SceneComponent)
+	{
+		return false;
+	}
+
+	OutLocation = SceneComponent->GetWorldLocation();
+	return true;
+}
+
+// === FTickTaskManager ===
+
+FTickTaskManager::~FTickTaskManager()
+{
+	// 남아 있는 Tick 함수가 소멸할 때 이미 사라진 매니저를 참조하지 않도록 연결만 끊음
+	for (FTickGroup& Group : TickGroups)
+	{
+		for (FTickFunction* TickFunction : Group.TickFunctions)
+		{
+			if (TickFunction)
+			{
+				TickFunction->TickTaskManager = nullptr;
+				TickFunction->RegisteredIndex = -1;
+			}
+		}
+	}
+}
+
+int32 FTickTaskManager::GetNumTickFunctions() const
+{
+	int32 NumTickFunctions = 0;
+	for (const FTickGroup& Group : TickGroups)
+	{
+		NumTickFunctions += Group.TickFunctions.Num() - Group.NumRemovedTickFunctions;
+	}
+	return NumTickFunctions;
+}
+
+int32 FTickTaskManager::GetNumTickFunctions(ETickingGroup InTickGroup) const
+{
+	const FTickGroup& Group = TickGroups[static_cast<int32>(InTickGroup)];
+	return Group.TickFunctions.Num() - Group.NumRemovedTickFunctions;
+}
+
+void FTickTaskManager::AddTickFunction(FTickFunction* InTickFunction)
+{
+	InTickFunction->TickTaskManager = this;
+	AttachToTickGroup(InTickFunction);
+
+	if (InTickFunction->bAllowSignificanceThrottling)
+	{
+		AddSignificanceTickFunction(InTickFunction);
+	}
+}
+
+void FTickTaskManager::RemoveTickFunction(FTickFunction* InTickFunction)
+{
+	DetachFromTickGroup(InTickFunction);
+	RemoveSignificanceTickFunction(InTickFunction);
+
+	// 이 함수를 선행 조건으로 가진 함수들이 해제된 포인터를 참조하지 않도록 역방향 연결을 따라 그 함수들에서만 빼냄
+	for (FTickFunction* Dependent : InTickFunction->Dependents)
+	{
+		if (Dependent->Prerequisites.Remove(InTickFunction) > 0 && Dependent->TickTaskManager)
+		{
+			Dependent->TickTaskManager->MarkOrderDirty(Dependent->TickGroup);
+		}
+	}
+	InTickFunction->Dependents.Empty();
+
+	// 다시 등록되면 첫 실행 시점을 새로 정하도록 쿨다운 상태 초기화
+	InTickFunction->bIsCooldownScheduled = false;
+	InTickFunction->SignificanceTickInterval = 0.0f;
+	InTickFunction->TickTaskManager = nullptr;
+}
+
+void FTickTaskManager::ChangeTickGroup(FTickFunction* InTickFunction, ETickingGroup InTickGroup)
+{
+	DetachFromTickGroup(InTickFunction);
+
+	InTickFunction->TickGroup = InTickGroup;
+	AttachToTickGroup(InTickFunction);
+}
+
+void FTickTaskManager::AttachToTickGroup(FTickFunction* InTickFunction)
+{
+	FTickGroup& Group = TickGroups[static_cast<int32>(InTickFunction->TickGroup)];
+	InTickFunction->RegisteredIndex = Group.TickFunctions.Num();
+	Group.TickFunctions.Add(InTickFunction);
+	MarkOrderDirty(InTickFunction->TickGroup);
+}
+
+void FTickTaskManager::DetachFromTickGroup(FTickFunction* InTickFunction)
+{
+	FTickGroup& Group = TickGroups[static_cast<int32>(InTickFunction->TickGroup)];
+
+	// 다른 Tick 함수(게임 스레드) 안에서 해제되는 경우: 워커에서 실행 중이면 끝날 때까지 기다리고,
+	// 아직 실행되지 않았다면 이번 프레임의 실행 목록에서 빼냄
+	if (bIsTicking)
+	{
+		if (InTickFunction->CompletionEvent.IsValid())
+		{
+			FTaskGraph::Get().Wait(InTickFunction->CompletionEvent);
+			InTickFunction->CompletionEvent = FGraphEventRef();
+		}
+
+		const int32 FrameIndex = InTickFunction->FrameIndex;
+		if (FrameIndex >= 0 && FrameIndex < Group.FrameTickFunctions.Num() && Group.FrameTickFunctions[FrameIndex] == InTickFunction)
+		{
+			Group.FrameTickFunctions[FrameIndex] = nullptr;
+		}
+		InTickFunction->bIsEnabledThisFrame = false;
+	}
+
+	// 등록 순서를 지키기 위해 자리만 비워 두고, 다음 정렬에서 한 번에 당김
+	Group.TickFunctions[InTickFunction->RegisteredIndex] = nullptr;
+	++Group.NumRemovedTickFunctions;
+	InTickFunction->RegisteredIndex = -1;
+	InTickFunction->FrameIndex = -1;
+	MarkOrderDirty(InTickFunction->TickGroup);
+}
+
+void FTickTaskManager::CompactTickGroup(FTickGroup& InGroup)
+{
+	if (InGroup.NumRemovedTickFunctions == 0)
+	{
+		return;
+	}
+
+	int32 NumRemaining = 0;
+	for (int32 Index = 0; Index < InGroup.TickFunctions.Num(); ++Index)
+	{
+		if (FTickFunction* TickFunction = InGroup.TickFunctions[Index])
+		{
+			TickFunction->RegisteredIndex = NumRemaining;
+			InGroup.TickFunctions[NumRemaining++] = TickFunction;
+		}
+	}
+	InGroup.TickFunctions.SetNum(NumRemaining);
+	InGroup.NumRemovedTickFunctions = 0;
+}
+
+void FTickTaskManager::MarkOrderDirty(ETickingGroup InTickGroup)
+{
+	TickGroups[static_cast<int32>(InTickGroup)].bIsOrderDirty = true;
+}
+
+void FTickTaskManager::SortTickGroup(FTickGroup& InGroup, ETickingGroup InTickGroup)
+{
+	if (++SortMark == 0)
+	{
+		// 방문 표시가 한 바퀴 돌면 이전 표시와 겹치지 않도록 초기화
+		for (FTickGroup& Group : TickGroups)
+		{
+			for (FTickFunction* TickFunction : Group.TickFunctions)
+			{
+				if (TickFunction)
+				{
+					TickFunction->VisitMark = 0;
+				}
+			}
+		}
+		SortMark = 1;
+	}
+
+	CompactTickGroup(InGroup);
+
+	InGroup.SortedTickFunctions.Empty();
+	InGroup.SortedTickFunctions.Reserve(InGroup.TickFunctions.Num());
+	InGroup.NumAnyThreadFunctions = 0;
+
+	for (FTickFunction* TickFunction : InGroup.TickFunctions)
+	{
+		VisitTickFunction(TickFunction, InTickGroup, InGroup.SortedTickFunctions);
+		if (TickFunction->bRunOnAnyThread)
+		{
+			++InGroup.NumAnyThreadFunctions;
+		}
+	}
+
+	// 실행 순서를 매 프레임 비트와 타이밍 휠로 나눔 (이미 예약된 함수는 다음 실행 시각을 유지)
+	InGroup.EveryFrameMask.Reset((InGroup.SortedTickFunctions.Num() + 63) / 64);
+	InGroup.NumEveryFrameFunctions = 0;
+	for (TArray<FCooldownEntry>& Slot : InGroup.CooldownSlots)
+	{
+		Slot.Reset();
+	}
+
+	for (int32 Index = 0; Index < InGroup.SortedTickFunctions.Num(); ++Index)
+	{
+		FTickFunction* TickFunction = InGroup.SortedTickFunctions[Index];
+		TickFunction->SortIndex = Index;
+
+		if (TickFunction->UsesCooldown())
+		{
+			if (!TickFunction->bIsCooldownScheduled)
+			{
+				ScheduleCooldown(TickFunction);
+			}
+			AddCooldownEntry(InGroup, { TickFunction->NextTickTime, Index, TickFunction });
+		}
+		else
+		{
+			TickFunction->bIsCooldownScheduled = false;
+			InGroup.EveryFrameMask[Index / 64] |= 1ull << (Index % 64);
+			++InGroup.NumEveryFrameFunctions;
+		}
+	}
+
+	InGroup.bIsOrderDirty = false;
+}
+
+void FTickTaskManager::VisitTickFunction(FTickFunction* InTickFunction, ETickingGroup InTickGroup,
+	TArray<FTickFunction*>& OutSorted)
+{
+	if (InTickFunction->VisitMark == SortMark)
+	{
+		if (InTickFunction->bIsVisiting)
+		{
+			UE_LOG_WARNING("TickTaskManager: Tick 선행 조건에 순환이 있어 일부 순서를 무시합니다");
+		}
+		return;
+	}
+
+	InTickFunction->VisitMark = SortMark;
+	InTickFunction->bIsVisiting = true;
+
+	for (FTickFunction* Prerequisite : InTickFunction->Prerequisites)
+	{
+		if (Prerequisite->TickTaskManager == this && Prerequisite->TickGroup == InTickGroup)
+		{
+			VisitTickFunction(Prerequisite, InTickGroup, OutSorted);
+		}
+	}
+
+	InTickFunction->bIsVisiting = false;
+	OutSorted.Add(InTickFunction);
+}
+
+void FTickTaskManager::ScheduleCooldown(FTickFunction* InTickFunction)
+{
+	// 황금비 수열로 간격 안의 위치를 골고루 흩어, 같은 간격의 함수가 동시에 등록되어도 한 프레임에 몰리지 않게 함
+	constexpr double GoldenRatioFraction = 0.6180339887498949;
+	const double Phase = std::fmod(static_cast<double>(NumStaggeredTickFunctions++) * GoldenRatioFraction, 1.0);
+
+	InTickFunction->NextTickTime = CurrentTime + InTickFunction->GetEffectiveTickInterval() * Phase;
+	InTickFunction->LastTickTime = CurrentTime - FrameDeltaTime;
+	InTickFunction->bIsCooldownScheduled = true;
+}
+
+void FTickTaskManager::AddCooldownEntry(FTickGroup& InGroup, const FCooldownEntry& InEntry)
+{
+	const int64 Slot = static_cast<int64>(InEntry.NextTickTime / CooldownSlotDuration);
+	InGroup.CooldownSlots[Slot % NumCooldownSlots].Add(InEntry);
+}
+
+void FTickTaskManager::GatherFrameTickFunctions(FTickGroup& InGroup)
+{
+	TArray<uint64>& FrameMask = InGroup.FrameMask;
+	FrameMask = InGroup.EveryFrameMask;
+
+	// 지난번 이후 지나간 슬롯만 확인 (한 바퀴 넘게 밀렸다면 모든 슬롯)
+	// 한 바퀴보다 먼 시각의 항목도 같은 슬롯에 섞여 있으므로 시각을 직접 비교해 차례가 된 것만 꺼냄
+	TArray<FCooldownEntry>& Due = InGroup.DueEntries;
+	Due.Reset();
+
+	const int64 CurrentSlot = static_cast<int64>(CurrentTime / CooldownSlotDuration);
+	const int64 NumSlotsToCheck = CurrentSlot - InGroup.LastCheckedSlot + 1 < NumCooldownSlots ?
+		CurrentSlot - InGroup.LastCheckedSlot + 1 : NumCooldownSlots;
+
+	for (int64 Slot = CurrentSlot - NumSlotsToCheck + 1; Slot <= CurrentSlot; ++Slot)
+	{
+		TArray<FCooldownEntry>& Entries = InGroup.CooldownSlots[Slot % NumCooldownSlots];
+		int32 NumRemaining = 0;
+		for (int32 Index = 0; Index < Entries.Num(); ++Index)
+		{
+			if (Entries[Index].NextTickTime <= CurrentTime)
+			{
+				Due.Add(Entries[Index]);
+			}
+			else
+			{
+				Entries[NumRemaining++] = Entries[Index];
+			}
+		}
+		Entries.SetNum(NumRemaining);
+	}
+	InGroup.LastCheckedSlot = CurrentSlot;
+
+	// 차례가 된 함수의 실행 위치 비트를 켜고 다음 실행 시각의 슬롯으로 옮김
+	// 모두 꺼낸 뒤에 다시 넣으므로 간격이 0인 함수가 같은 프레임에 두 번 실행되지 않음
+	for (FCooldownEntry& Entry : Due)
+	{
+		FrameMask[Entry.SortIndex / 64] |= 1ull << (Entry.SortIndex % 64);
+
+		FTickFunction* TickFunction = Entry.TickFunction;
+		TickFunction->TickDeltaTime = static_cast<float>(CurrentTime - TickFunction->LastTickTime);
+		TickFunction->LastTickTime = CurrentTime;
+
+		// 예정 시각 기준으로 다음 시각을 잡아 주기가 밀리지 않게 하되, 한참 밀렸다면 지금부터 다시 시작
+		const float Interval = TickFunction->GetEffectiveTickInterval();
+		TickFunction->NextTickTime += Interval;
+		if (TickFunction->NextTickTime <= CurrentTime)
+		{
+			TickFunction->NextTickTime = CurrentTime + Interval;
+		}
+		Entry.NextTickTime = TickFunction->NextTickTime;
+
+		AddCooldownEntry(InGroup, Entry);
+	}
+
+	// 켜진 비트를 순서대로 읽어 실행 목록 구성 (함수 객체는 실행할 것만 건드림)
+	TArray<FTickFunction*>& Frame = InGroup.FrameTickFunctions;
+	Frame.Reset();
+	Frame.Reserve(InGroup.NumEveryFrameFunctions + Due.Num());
+
+	for (int32 WordIndex = 0; WordIndex < FrameMask.Num(); ++WordIndex)
+	{
+		uint64 Word = FrameMask[WordIndex];
+		while (Word != 0)
+		{
+			FTickFunction* TickFunction = InGroup.SortedTickFunctions[WordIndex * 64 + CountTrailingZeros64(Word)];
+			TickFunction->FrameIndex = Frame.Num();
+			Frame.Add(TickFunction);
+			Word &= Word - 1;
+		}
+	}
+}
+
+void FTickTaskManager::SetViewLocation(const FVector& InViewLocation)
+{
+	ViewLocation = InViewLocation;
+	bHasViewLocation = true;
+}
+
+void FTickTaskManager::ClearViewLocation()
+{
+	bHasViewLocation = false;
+}
+
+void FTickTaskManager::AddSignificanceTickFunction(FTickFunction* InTickFunction)
+{
+	InTickFunction->SignificanceIndex = SignificanceTickFunctions.Num();
+	SignificanceTickFunctions.Add(InTickFunction);
+}
+
+void FTickTaskManager::RemoveSignificanceTickFunction(FTickFunction* InTickFunction)
+{
+	const int32 Index = InTickFunction->SignificanceIndex;
+	if (Index < 0)
+	{
+		return;
+	}
+
+	FTickFunction* LastTickFunction = SignificanceTickFunctions.Last();
+	SignificanceTickFunctions[Index] = LastTickFunction;
+	LastTickFunction->SignificanceIndex = Index;
+	SignificanceTickFunctions.Pop();
+	InTickFunction->SignificanceIndex = -1;
+}
+
+void FTickTaskManager::UpdateSignificance()
+{
+	const int32 NumTickFunctions = SignificanceTickFunctions.Num();
+	if (NumTickFunctions == 0)
+	{
+		return;
+	}
+
+	// 카메라가 없거나 꺼졌다면 조절했던 간격을 한 번만 되돌림
+	if (!bHasViewLocation || !SignificanceSettings.bEnabled)
+	{
+		if (bIsThrottling)
+		{
+			for (FTickFunction* TickFunction : SignificanceTickFunctions)
+			{
+				TickFunction->SignificanceTickInterval = 0.0f;
+			}
+			bIsThrottling = false;
+		}
+		return;
+	}
+
+	bIsThrottling = true;
+
+	const int32 NumUpdates = SignificanceSettings.MaxUpdatesPerFrame > 0 && SignificanceSettings.MaxUpdatesPerFrame < NumTickFunctions ?
+		SignificanceSettings.MaxUpdatesPerFrame : NumTickFunctions;
+
+	for (int32 Update = 0; Update < NumUpdates; ++Update)
+	{
+		if (NextSignificanceIndex >= NumTickFunctions)
+		{
+			NextSignificanceIndex = 0;
+		}
+
+		FTickFunction* TickFunction = SignificanceTickFunctions[NextSignificanceIndex++];
+
+		FVector Location;
+		if (!TickFunction->GetSignificanceLocation(Location))
+		{
+			TickFunction->SignificanceTickInterval = 0.0f;
+			continue;
+		}
+
+		TickFunction->SignificanceTickInterval = GetSignificanceTickInterval(Location);
+	}
+}
+
+float FTickTaskManager::GetSignificanceTickInterval(const FVector& InLocation) const
+{
+	if (!bHasViewLocation || !SignificanceSettings.bEnabled)
+	{
+		return 0.0f;
+	}
+
+	const float NearDistance = SignificanceSettings.NearDistance;
+	const float Range = SignificanceSettings.FarDistance - NearDistance > 0.001f ?
+		SignificanceSettings.FarDistance - NearDistance : 0.001f;
+
+	float Alpha = ((InLocation - ViewLocation).Length() - NearDistance) / Range;
+	Alpha = Alpha < 0.0f ? 0.0f : (Alpha > 1.0f ? 1.0f : Alpha);
+	return Alpha * SignificanceSettings.MaxTickInterval;
+}
+
+void FTickTaskManager::Tick(float DeltaTime, bool bInIsEditorWorld)
+{
+	// Tick 함수 안에서 다시 World Tick을 호출하는 경우 무시
+	if (bIsTicking)
+	{
+		return;
+	}
+
+	FTaskGraph& TaskGraph = FTaskGraph::Get();
+	const bool bCanRunParallel = TaskGraph.IsInitialized() && TaskGraph.GetNumWorkers() > 0 && TaskGraph.IsInGameThread();
+
+	FrameDeltaTime = DeltaTime;
+	CurrentTime += DeltaTime;
+	NumTickedLastFrame = 0;
+
+	UpdateSignificance();
+
+	bIsTicking = true;
+
+	for (int32 GroupIndex = 0; GroupIndex < static_cast<int32>(ETickingGroup::Max); ++GroupIndex)
+	{
+		const ETickingGroup TickGroup = static_cast<ETickingGroup>(GroupIndex);
+		FTickGroup& Group = TickGroups[GroupIndex];
+
+		if (Group.bIsOrderDirty)
+		{
+			SortTickGroup(Group, TickGroup);
+		}
+
+		GatherFrameTickFunctions(Group);
+		if (Group.FrameTickFunctions.IsEmpty())
+		{
+			continue;
+		}
+		NumTickedLastFrame += Group.FrameTickFunctions.Num();
+
+		if (bCanRunParallel && Group.NumAnyThreadFunctions > 0)
+		{
+			RunTickGroupParallel(Group, TickGroup, DeltaTime, bInIsEditorWorld);
+		}
+		else
+		{
+			RunTickGroupSerial(Group, DeltaTime, bInIsEditorWorld);
+		}
+	}
+
+	bIsTicking = false;
+}
+
+void FTickTaskManager::RunTickGroupSerial(FTickGroup& InGroup, float DeltaTime, bool bInIsEditorWorld)
+{
+	// 실행 중 해제되면 항목이 nullptr로 바뀌므로 매번 인덱스로 다시 읽음
+	for (int32 Index = 0; Index < InGroup.FrameTickFunctions.Num(); ++Index)
+	{
+		FTickFunction* TickFunction = InGroup.FrameTickFunctions[Index];
+		if (TickFunction && TickFunction->IsTickFunctionEnabled(bInIsEditorWorld))
+		{
+			TickFunction->ExecuteTick(TickFunction->bIsCooldownScheduled ? TickFunction->TickDeltaTime : DeltaTime);
+		}
+	}
+}
+
+void FTickTaskManager::RunTickGroupParallel(FTickGroup& InGroup, ETickingGroup InTickGroup, float DeltaTime,
+	bool bInIsEditorWorld)
+{
+	FTaskGraph& TaskGraph = FTaskGraph::Get();
+	TArray<FTickFunction*>& Sorted = InGroup.FrameTickFunctions;
+
+	// 1. 실행 여부를 정하고, 게임 스레드 함수를 기다릴 필요가 없는 워커 함수를 먼저 모두 발행
+	// 정렬 순서상 선행 조건이 항상 먼저 처리되므로 선행 조건의 이벤트와 상태가 이미 정해져 있음
+	for (int32 Index = 0; Index < Sorted.Num(); ++Index)
+	{
+		FTickFunction* TickFunction = Sorted[Index];
+		if (!TickFunction)
+		{
+			continue;
+		}
+
+		TickFunction->bIsEnabledThisFrame = TickFunction->IsTickFunctionEnabled(bInIsEditorWorld);
+		TickFunction->bWaitsForGameThread = false;
+		if (!TickFunction->bIsEnabledThisFrame || !TickFunction->bRunOnAnyThread)
+		{
+			continue;
+		}
+
+		for (const FTickFunction* Prerequisite : TickFunction->Prerequisites)
+		{
+			if (Prerequisite->TickTaskManager == this && Prerequisite->TickGroup == InTickGroup &&
+				Prerequisite->bIsEnabledThisFrame && (!Prerequisite->bRunOnAnyThread || Prerequisite->bWaitsForGameThread))
+			{
+				TickFunction->bWaitsForGameThread = true;
+				break;
+			}
+		}
+
+		if (!TickFunction->bWaitsForGameThread)
+		{
+			FGraphEventArray Prerequisites;
+			GatherPrerequisiteEvents(TickFunction, InTickGroup, Prerequisites);
+			const float TickDeltaTime = TickFunction->bIsCooldownScheduled ? TickFunction->TickDeltaTime : DeltaTime;
+			// 발행 뒤 선행 Tick이 이 함수를 끌 수 있으므로 실행 직전에 다시 확인 (직렬 Tick과 같은 결과)
+			TickFunction->CompletionEvent = TaskGraph.Launch([TickFunction, TickDeltaTime, bInIsEditorWorld]()
+			{
+				if (TickFunction->IsTickFunctionEnabled(bInIsEditorWorld))
+				{
+					TickFunction->ExecuteTick(TickDeltaTime);
+				}
+			}, Prerequisites);
+		}
+	}
+
+	// 2. 게임 스레드 함수를 정렬 순서대로 실행 (직렬 Tick과 같은 순서)
+	// 게임 스레드 함수 뒤에 와야 하는 워커 함수는 그 선행 조건이 끝난 시점에 발행
+	for (int32 Index = 0; Index < Sorted.Num(); ++Index)
+	{
+		FTickFunction* TickFunction = Sorted[Index];
+		if (!TickFunction || !TickFunction->bIsEnabledThisFrame)
+		{
+			continue;
+		}
+
+		FGraphEventArray Prerequisites;
+		if (TickFunction->bRunOnAnyThread)
+		{
+			if (TickFunction->bWaitsForGameThread)
+			{
+				GatherPrerequisiteEvents(TickFunction, InTickGroup, Prerequisites);
+				const float TickDeltaTime = TickFunction->bIsCooldownScheduled ? TickFunction->TickDeltaTime : DeltaTime;
+				TickFunction->CompletionEvent = TaskGraph.Launch([TickFunction, TickDeltaTime, bInIsEditorWorld]()
+				{
+					if (TickFunction->IsTickFunctionEnabled(bInIsEditorWorld))
+					{
+						TickFunction->ExecuteTick(TickDeltaTime);
+					}
+				}, Prerequisites);
+			}
+			continue;
+		}
+
+		GatherPrerequisiteEvents(TickFunction, InTickGroup, Prerequisites);
+		if (!Prerequisites.IsEmpty())
+		{
+			TaskGraph.Wait(Prerequisites);
+		}
+		if (TickFunction->IsTickFunctionEnabled(bInIsEditorWorld))
+		{
+			TickFunction->ExecuteTick(TickFunction->bIsCooldownScheduled ? TickFunction->TickDeltaTime : DeltaTime);
+		}
+	}
+
+	// 3. 그룹의 모든 워커 함수가 끝나야 다음 그룹을 시작
+	// 다음 프레임에 차례가 아닌 함수는 실행 여부를 다시 정하지 않으므로 표시를 지워 둠
+	for (int32 Index = 0; Index < Sorted.Num(); ++Index)
+	{
+		FTickFunction* TickFunction = Sorted[Index];
+		if (!TickFunction)
+		{
+			continue;
+		}
+
+		if (TickFunction->CompletionEvent.IsValid())
+		{
+			TaskGraph.Wait(TickFunction->CompletionEvent);
+			TickFunction->CompletionEvent = FGraphEventRef();
+		}
+		TickFunction->bIsEnabledThisFrame = false;
+	}
+}
+
+void FTickTaskManager::GatherPrerequisiteEvents(const FTickFunction* InTickFunction, ETickingGroup InTickGroup,
+	FGraphEventArray& OutEvents) const
+{
+	for (const FTickFunction* Prerequisite : InTickFunction->Prerequisites)
+	{
+		if (Prerequisite->TickTaskManager == this && Prerequisite->TickGroup == InTickGroup &&
+			Prerequisite->CompletionEvent.IsValid())
+		{
+			OutEvents.Add(Prerequisite->CompletionEvent);
+		}
+	}
+}
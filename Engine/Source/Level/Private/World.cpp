@@ -11,18 +11,21 @@ IMPLEMENT_CLASS(UWorld, UObject)
 UWorld::UWorld()
 	: WorldType(EWorldType::Editor)
 	, bBegunPlay(false)
+	, MovementBatchManager(this)
 {
 }
 
 UWorld::UWorld(EWorldType InWorldType)
 	: WorldType(InWorldType)
 	, bBegunPlay(false)
+	, MovementBatchManager(this)
 {
 }
 
 UWorld::~UWorld()
 {
 	EndPlay();
+	DeferredEvents.Clear();
 	if (Level)
 	{
 		ULevel* CurrentLevel = Level;
@@ -44,6 +47,10 @@ void UWorld::BeginPlay()
 		return;
 	}
 
+	// 게임 / PIE 월드는 충돌 / 오버랩 이벤트를 Overlap 단계가 끝난 뒤 한꺼번에 실행해
+	// 핸들러가 액터를 삭제하거나 옮겨도 진행 중인 Overlap 단계의 쌍 목록이 흔들리지 않게 함
+	SetDeferEvents(WorldType == EWorldType::Game || WorldType == EWorldType::PIE);
+
 	Level->Init();
 	bBegunPlay = true;
 }
@@ -57,6 +64,7 @@ bool UWorld::EndPlay()
 	}
 
 	FlushPendingDestroy();
+	DeferredEvents.Clear();
 	// Level EndPlay
 	bBegunPlay = false;
 	return true;
@@ -64,6 +72,7 @@ bool UWorld::EndPlay()
 
 void UWorld::Tick(float DeltaTimes)
 {
+	LLM_SCOPE(World);
 	WorldTimeSeconds += DeltaTimes;
 	if (!Level || !bBegunPlay)
 	{
@@ -73,40 +82,27 @@ void UWorld::Tick(float DeltaTimes)
 	// 스폰 / 삭제 처리
 	FlushPendingDestroy();
 
-	// TODO: 현재 임시로 OCtree 업데이트 처리
-	Level->UpdateOctree();
-
-	if (WorldType == EWorldType::Editor )
+	if (WorldType == EWorldType::Editor || WorldType == EWorldType::Game || WorldType == EWorldType::PIE)
 	{
-		for (AActor* Actor : Level->GetLevelActors())
-		{
-			if(Actor->CanTickInEditor() && Actor->CanTick())
-			{
-				Actor->Tick(DeltaTimes);
-			}
-			
-			if (Actor->IsPendingDestroy())
-			{
-				DestroyActor(Actor);
-			}
-		}
+		// 등록된 Tick 함수만 그룹 순서대로 실행 (에디터 World는 CanTickInEditor인 액터만)
+		TickTaskManager.Tick(DeltaTimes, WorldType == EWorldType::Editor);
 	}
 
-	if (WorldType == EWorldType::Game || WorldType == EWorldType::PIE)
+	// 프레임 동기화 지점: 액터 Tick 동안 움직인 프리미티브를 Octree에 한 번에 재배치하고 Overlap 검사
+	Level->FlushPrimitiveUpdates();
+
+	// 액터 Tick 동안 쌓인 이벤트 실행
+	DeferredEvents.Dispatch();
+}
+
+void UWorld::SetDeferEvents(bool bInDeferEvents)
+{
+	// 끌 때 남아 있는 이벤트는 유실되지 않도록 바로 실행
+	if (bDeferEvents && !bInDeferEvents)
 	{
-		for (AActor* Actor : Level->GetLevelActors())
-		{
-			if(Actor->CanTick())
-			{
-				Actor->Tick(DeltaTimes);
-			}
-			
-			if (Actor->IsPendingDestroy())
-			{
-				DestroyActor(Actor);
-			}
-		}
+		DeferredEvents.Dispatch();
 	}
+	bDeferEvents = bInDeferEvents;
 }
 
 ULevel* UWorld::GetLevel() const
@@ -122,6 +118,7 @@ ULevel* UWorld::GetLevel() const
 */
 bool UWorld::LoadLevel(path InLevelFilePath)
 {
+	LLM_SCOPE(World);
 	JSON LevelJson;
 	ULevel* NewLevel = nullptr;
 
@@ -140,12 +137,16 @@ bool UWorld::LoadLevel(path InLevelFilePath)
 
 		NewLevel->SetOuter(this);
 		SwitchToLevel(NewLevel);
+
+		// 로드 중에는 프리미티브를 하나씩 삽입하지 않고 모아 두었다가 한 번에 인덱싱
+		NewLevel->BeginDeferredPrimitiveRegistration();
 		NewLevel->Serialize(true, LevelJson);
 
-		BeginPlay();
+		// BeginPlay에서 공간 쿼리가 동작하도록 먼저 저장된 Octree를 연결하거나, 레벨이 바뀌었다면 전체 구축
+		// (BeginPlay에서 생성되는 프리미티브는 평소처럼 바로 삽입된다)
+		NewLevel->LoadStaticSpatialIndex(InLevelFilePath);
 
-		// 레벨 로드 완료 후 Octree 전체 구축
-		NewLevel->UpdateOctreeImmediate();
+		BeginPlay();
 	}
 	catch (const exception& Exception)
 	{
@@ -203,6 +204,7 @@ bool UWorld::SaveCurrentLevel(path InLevelFilePath) const
 
 AActor* UWorld::SpawnActor(UClass* InActorClass, JSON* ActorJsonData)
 {
+	LLM_SCOPE(World);
 	if (!Level)
 	{
 		UE_LOG_ERROR("World: Actor를 Spawn할 수 있는 Level이 없습니다.");
@@ -1,13 +1,22 @@
 #pragma once
 #include "Core/Public/Object.h"
 #include "Global/Enum.h"
+#include "Global/SpatialQuery.h"
+#include "Global/OverlapInfo.h"
 
 class UWorld;
 class AActor;
 class UPrimitiveComponent;
 class UPointLightComponent;
 class ULightComponent;
-class FOctree;
+struct FHitResult;
+
+/** @brief ULevel::LineTraceBatch에 넘기는 선분 하나 */
+struct FLineTraceSegment
+{
+	FVector Start;
+	FVector End;
+};
 
 UCLASS()
 class ULevel :
@@ -36,22 +45,93 @@ public:
 	uint64 GetShowFlags() const { return ShowFlags; }
 	void SetShowFlags(uint64 InShowFlags) { ShowFlags = InShowFlags; }
 
+	/**
+	 * @brief 움직인 프리미티브를 공간 인덱스 갱신 대기 목록에 추가 (여러 번 움직여도 한 번만 처리)
+	 * 실제 갱신은 FlushPrimitiveUpdates 또는 다음 GetStaticOctree / GetDynamicTree 호출 때 한 번에 처리된다
+	 */
 	void UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent);
 
-	FOctree* GetStaticOctree() { return StaticOctree; }
+	/** @brief Octree 재배치와 Overlap 검사를 모두 대기 목록에 추가 (UPrimitiveComponent::MarkAsDirty에서 호출) */
+	void MarkPrimitiveDirty(UPrimitiveComponent* InComponent);
 
-	/** @todo: 효율 개선을 위해 DirtyFlag와 캐시 도입 가능 */
-	TArray<UPrimitiveComponent*>& GetDynamicPrimitives()
+	/**
+	 * @brief 레벨 로드 이후 움직이지 않은 프리미티브의 Octree
+	 * 재배치 대기 중인 프리미티브가 있으면 먼저 재배치하므로 프레임 중간의 쿼리도 현재 위치 기준의 일관된 결과를 얻는다
+	 * @note 모든 프리미티브를 찾으려면 GetDynamicTree도 함께 쿼리할 것
+	 */
+	FOctree* GetStaticOctree()
 	{
-		DynamicPrimitives.Empty();
+		if (!PendingOctreePrimitives.IsEmpty())
+		{
+			RefitPendingPrimitives();
+		}
+		return StaticOctree;
+	}
 
-		for (auto [Component, TimePoint] : DynamicPrimitiveMap)
+	/** @brief 움직인 적이 있는 프리미티브의 동적 AABB 트리 (GetStaticOctree와 같이 대기 중인 갱신을 먼저 반영) */
+	FDynamicAABBTree* GetDynamicTree()
+	{
+		if (!PendingOctreePrimitives.IsEmpty())
 		{
-			DynamicPrimitives.Add(Component);
+			RefitPendingPrimitives();
 		}
-		return DynamicPrimitives;
+		return DynamicTree;
 	}
 
+	/**
+	 * @brief 모양(FFrustum, FQueryBox, FQuerySphere, FQueryRay, FQueryRayPacket, FQueryCone 등)과 겹치는 모든 프리미티브를 방문
+	 * 정적 Octree와 동적 트리를 차례로 순회하며, 방문자 bool(UPrimitiveComponent*)가 false를 반환하면 멈춘다
+	 * 결과 배열을 만들지 않으므로 첫 결과만 필요하거나 바로 처리할 수 있는 쿼리는 할당 없이 끝난다
+	 * @return 끝까지 순회했으면 true, 방문자가 멈췄으면 false
+	 */
+	template<typename ShapeType, typename VisitorType>
+	bool QueryPrimitives(const ShapeType& InShape, VisitorType&& InVisitor)
+	{
+		if (!PendingOctreePrimitives.IsEmpty())
+		{
+			RefitPendingPrimitives();
+		}
+		if (StaticOctree && !FSpatialQuery::QueryOctree(*StaticOctree, InShape, InVisitor))
+		{
+			return false;
+		}
+		return !DynamicTree || FSpatialQuery::QueryDynamicTree(*DynamicTree, InShape, InVisitor);
+	}
+
+	/** @brief 모양과 겹치는 모든 프리미티브를 OutPrimitives 뒤에 추가 (프레임 메모리 스택 할당자와 함께 쓰면 할당이 없음) */
+	template<typename ShapeType, typename AllocatorType>
+	void GatherPrimitives(const ShapeType& InShape, TArray<UPrimitiveComponent*, AllocatorType>& OutPrimitives)
+	{
+		QueryPrimitives(InShape, [&OutPrimitives](UPrimitiveComponent* InPrimitive)
+		{
+			OutPrimitives.Add(InPrimitive);
+			return true;
+		});
+	}
+
+	/**
+	 * @brief InStart에서 InEnd까지의 선분과 가장 먼저 만나는 프리미티브의 교차
+	 * Octree와 동적 트리가 상위 가속 구조 역할을 하여 경계 상자에 들어가는 거리 순으로 후보를 고르고,
+	 * 각 후보는 LineTraceComponent(정적 메시는 공유 BVH)로 판정하며 이미 찾은 교차보다 먼 후보는 건너뛴다
+	 * @param InIgnoredActor 검사에서 제외할 액터 (트레이스를 쏘는 액터 자신 등)
+	 * @return 교차했으면 true
+	 */
+	bool LineTraceSingle(FHitResult& OutHit, const FVector& InStart, const FVector& InEnd, const AActor* InIgnoredActor = nullptr);
+
+	/**
+	 * @brief 선분과 만나는 모든 프리미티브의 교차 (프리미티브마다 가장 가까운 교차 하나, 거리 순 정렬)
+	 * @return 하나라도 교차했으면 true
+	 */
+	bool LineTraceMulti(TArray<FHitResult>& OutHits, const FVector& InStart, const FVector& InEnd, const AActor* InIgnoredActor = nullptr);
+
+	/**
+	 * @brief 여러 선분의 LineTraceSingle을 한 번에 수행 (OutHits[i]는 InSegments[i]의 결과, 교차하지 않으면 bBlockingHit == false)
+	 * 선분을 방향 팔분면과 중점의 Morton 순서로 정렬해 비슷한 선분끼리 묶고,
+	 * 묶음마다 Octree와 동적 트리를 한 번만 순회한 뒤 후보 프리미티브에는 그 경계를 지나는 선분만 묶음으로 넘긴다
+	 * @return 교차한 선분 수
+	 */
+	int32 LineTraceBatch(const TArray<FLineTraceSegment>& InSegments, TArray<FHitResult>& OutHits, const AActor* InIgnoredActor = nullptr);
+
 	friend class UWorld;
 public:
 	virtual UObject* Duplicate() override;
@@ -79,42 +159,92 @@ private:
 		Octree Management
 	-----------------------------------------------------------------------------*/
 public:
-	void UpdateOctree();
+	/**
+	 * @brief 모든 프리미티브의 현재 경계로 Octree를 한 번에 다시 만듦 (레벨 로드 / 생성 직후 호출)
+	 * 동적 트리에 있던 프리미티브도 Octree로 돌아가며, 다시 움직이면 동적 트리로 옮겨진다
+	 */
 	void UpdateOctreeImmediate();
 
+	/**
+	 * @brief 레벨 로드 동안 등록되는 프리미티브를 공간 인덱스에 하나씩 넣지 않고 등록 순서대로 모아 둠
+	 * 모은 프리미티브는 LoadStaticSpatialIndex에서 한 번에 처리된다
+	 * 이 동안 생성되는 액터의 BeginPlay도 미뤄져, 공간 인덱스가 만들어진 뒤 Init에서 실행된다
+	 */
+	void BeginDeferredPrimitiveRegistration();
+
+	/**
+	 * @brief 로드 중 모아 둔 프리미티브로 정적 Octree를 만듦 (UWorld::LoadLevel에서 호출)
+	 * 레벨 파일 옆의 캐시(.octreebin)가 레벨 파일 내용의 해시, 프리미티브 수와 경계까지 모두 맞으면 저장된 노드 풀을 그대로 연결하고,
+	 * 맞지 않으면 Build로 다시 만든 뒤 캐시를 새로 저장한다
+	 */
+	void LoadStaticSpatialIndex(const std::filesystem::path& InLevelFilePath);
+
+	/**
+	 * @brief 프레임 동기화 지점: 이번 프레임에 움직인 프리미티브를 Octree에 한 번에 재배치한 뒤 Overlap 단계를 한 번 실행
+	 * UWorld::Tick에서 액터 Tick이 모두 끝난 뒤 호출되며, Overlap 이벤트 처리 중에 움직인 프리미티브는 다음 프레임에 처리된다
+	 */
+	void FlushPrimitiveUpdates();
+
 private:
+	/**
+	 * @brief 갱신 대기 중인 프리미티브를 반영
+	 * 동적 트리에 있는 프리미티브는 제자리에서 갱신하고, Octree에 있던 프리미티브는 한 번의 순회로 모두 빼내 동적 트리로 옮긴다
+	 */
+	void RefitPendingPrimitives();
 
-	void OnPrimitiveUpdated(UPrimitiveComponent* InComponent);
+	/**
+	 * @brief 프레임 Overlap 단계: ProcessingPrimitives(이번 프레임에 움직인 프리미티브)의 겹침을 갱신하고 이벤트 발생
+	 * 움직인 프리미티브마다 공간 인덱스를 한 번 쿼리해 경계가 겹치는 쌍을 모으고, 중복을 없앤 쌍마다 충돌 모양 검사를 한 번만 한 뒤
+	 * 쌍 캐시(OverlapPairs)와 비교해 끝난 쌍의 EndOverlap, 새 쌍의 BeginOverlap을 차례로 보낸다
+	 * 둘 다 움직인 쌍도 한 번만 검사되고 이벤트도 한 번만 발생한다
+	 */
+	void UpdateOverlapPairs();
 
-	void OnPrimitiveUnregistered(UPrimitiveComponent* InComponent);
+	/** @brief Octree에 삽입, 최대 크기를 넘으면 동적 트리에 삽입 */
+	void InsertPrimitive(UPrimitiveComponent* InComponent);
+	/** @brief 동적 트리에 삽입, 실패하면 UnindexedPrimitives에 보관 */
+	void InsertDynamicPrimitive(UPrimitiveComponent* InComponent);
 
-	/** @brief 한 프레임에 Octree에 삽입할 오브젝트의 최대 크기를 결정해서 부하를 여러 프레임에 분산함. */
-	static constexpr uint32 MAX_OBJECTS_TO_INSERT_PER_FRAME = 256;
-	
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent를 Octree에 삽입하기 위해 필요한 구조체. */
-	struct FDynamicPrimitiveData
-	{
-		UPrimitiveComponent* Primitive;
-		float LastMoveTimePoint;
+	void OnPrimitiveUnregistered(UPrimitiveComponent* InComponent);
 
-		bool operator>(const FDynamicPrimitiveData& Other) const
-		{
-			return LastMoveTimePoint > Other.LastMoveTimePoint;
-		}
-	};
-	
-	using FDynamicPrimitiveQueue = TQueue<FDynamicPrimitiveData>;
-	
+	/** @brief 레벨 로드 이후 움직이지 않은 프리미티브의 느슨한 Octree (로드 시 Morton 순서로 한 번에 구축) */
 	FOctree* StaticOctree = nullptr;
+	/** @brief 움직인 적이 있거나 Octree 최대 크기를 넘는 프리미티브 (뚱뚱한 경계로 작은 이동은 트리를 건드리지 않음) */
+	FDynamicAABBTree* DynamicTree = nullptr;
+
+	/**
+	 * @brief BeginDeferredPrimitiveRegistration 이후 LoadStaticSpatialIndex 전까지 등록된 프리미티브 (등록 순서 = 캐시의 프리미티브 번호)
+	 * 중간에 해제된 자리는 순서를 지키기 위해 nullptr로 남겨 두고 LoadStaticSpatialIndex에서 한 번에 당긴다
+	 */
+	TArray<UPrimitiveComponent*> DeferredPrimitives;
+	/** @brief DeferredPrimitives에서의 위치 (해제할 때 배열을 훑지 않도록) */
+	TMap<UPrimitiveComponent*, int32> DeferredPrimitiveIndices;
+	int32 NumRemovedDeferredPrimitives = 0;
+	bool bDeferPrimitiveRegistration = false;
 
-	/** @deprecated 기존 코드와의 호환성을 위해 유지, 직접 사용하거나 업데이트하는 것을 금지함 */
-	TArray<UPrimitiveComponent*> DynamicPrimitives;
+	/** @brief 경계가 NaN이거나 무한대라 삽입하지 못한 프리미티브 (다시 움직이면 재삽입 시도) */
+	TSet<UPrimitiveComponent*> UnindexedPrimitives;
 
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent부터 순서대로 Octree에 삽입할 수 있도록 보관 */
-	FDynamicPrimitiveQueue DynamicPrimitiveQueue;
+	/** @brief 공간 인덱스 갱신 대기 중인 프리미티브 */
+	TSet<UPrimitiveComponent*> PendingOctreePrimitives;
+	/** @brief RefitPendingPrimitives에서 Octree에서 빼낼 프리미티브 (프레임마다 재사용) */
+	TSet<UPrimitiveComponent*> PromotingPrimitives;
+	/** @brief Overlap 검사 대기 중인 프리미티브 (움직인 순서, 중복 없음) */
+	TArray<UPrimitiveComponent*> PendingOverlapPrimitives;
+	TSet<UPrimitiveComponent*> PendingOverlapSet;
+	/** @brief FlushPrimitiveUpdates / RefitPendingPrimitives에서 쓰는 임시 배열 (프레임마다 재사용) */
+	TArray<UPrimitiveComponent*> ProcessingPrimitives;
+	TArray<UPrimitiveComponent*> RemovedPrimitives;
 
-	/** @brief 각 UPrimitiveComponent가 움직인 가장 마지막 시간을 기록 */
-	TMap<UPrimitiveComponent*, float> DynamicPrimitiveMap;
+	/** @brief 현재 겹쳐 있는 컴포넌트 쌍 (각 컴포넌트의 OverlappingComponents와 항상 같은 내용을 담음) */
+	TSet<FOverlapPair> OverlapPairs;
+	/** @brief UpdateOverlapPairs에서 쓰는 임시 목록 (프레임마다 재사용) */
+	TArray<FOverlapPair> CandidatePairs;
+	TSet<FOverlapPair> TestedPairs;
+	TSet<FOverlapPair> CurrentPairs;
+	/** @brief 이번 Overlap 단계에서 보낼 이벤트 (처리 중에 해제된 컴포넌트의 쌍은 비워 둠) */
+	TArray<FOverlapPair> EndedPairs;
+	TArray<FOverlapPair> BegunPairs;
 	
 	/*-----------------------------------------------------------------------------
 		Lighting Management
@@ -0,0 +1,147 @@
+#pragma once
+#include "Level/Public/TickTaskManager.h"
+
+class UWorld;
+class UMovementComponent;
+class UProjectileMovementComponent;
+class URotatingMovementComponent;
+class FMovementBatchManager;
+
+/**
+ * @brief FMovementBatchManager의 일괄 이동을 실행하는 Tick 함수
+ */
+class FMovementBatchTickFunction : public FTickFunction
+{
+public:
+	FMovementBatchManager* Target = nullptr;
+
+	void ExecuteTick(float DeltaTime) override;
+};
+
+/**
+ * @brief 투사체 / 회전 이동 컴포넌트를 컴포넌트별 Tick 대신 한 번에 처리하는 일괄 이동 시스템
+ *
+ * 등록된 컴포넌트의 속도, 위치, 회전을 종류별 SoA 배열에 모아 SSE로 4개씩 적분한 뒤 변환을 한꺼번에 되돌려 쓴다
+ * 되돌려 쓴 프리미티브는 Level의 갱신 대기 목록에 모였다가 프레임 동기화 지점(ULevel::FlushPrimitiveUpdates)에서
+ * Octree 재배치와 Overlap 검사가 한 번에 처리된다
+ *
+ * 배열은 매 프레임 컴포넌트의 현재 값에서 다시 채우므로 SetVelocity나 위치 이동(텔레포트)이 그대로 반영된다
+ * 회전 이동은 컴포넌트 Tick 함수의 TickInterval과 카메라 거리에 따른 간격(bAllowSignificanceThrottling)을 따르며,
+ * 차례가 아닌 프레임은 건너뛰고 건너뛴 시간만큼 다음 차례에 한 번에 회전한다
+ * Tick 함수 하나로 World의 FTickTaskManager에 등록되며, 컴포넌트를 가진 액터의 Tick은 일괄 이동이 끝난 뒤 실행된다
+ *
+ * @note 등록 / 해제는 게임 스레드에서만 호출할 것
+ */
+class FMovementBatchManager
+{
+public:
+	/**
+	 * @brief 투사체 이동 SoA 데이터 (4개 단위로 채워 SIMD 꼬리 처리를 없앰)
+	 */
+	struct FProjectileData
+	{
+		TArray<float> PositionX, PositionY, PositionZ;
+		TArray<float> VelocityX, VelocityY, VelocityZ;
+		TArray<float> GravityScale;
+		/** @brief 0이면 속도 제한 없음 */
+		TArray<float> MaxSpeed;
+
+		void SetNum(int32 InNum);
+	};
+
+	/**
+	 * @brief 회전 이동 SoA 데이터 (4개 단위로 채워 SIMD 꼬리 처리를 없앰)
+	 */
+	struct FRotatingData
+	{
+		/** @brief 적분 전 월드 회전, 적분 후에는 새 월드 회전 */
+		TArray<float> RotationX, RotationY, RotationZ, RotationW;
+		/** @brief 이번 프레임의 회전량 (RotationRate * DeltaTime) */
+		TArray<float> DeltaX, DeltaY, DeltaZ, DeltaW;
+		TArray<float> PivotX, PivotY, PivotZ;
+		/** @brief 로컬 공간 회전이면 모든 비트가 켜진 값, 아니면 0 */
+		TArray<float> LocalSpaceMask;
+		/** @brief 피벗 회전으로 생기는 위치 변화량 (적분 결과) */
+		TArray<float> DeltaLocationX, DeltaLocationY, DeltaLocationZ;
+
+		void SetNum(int32 InNum);
+	};
+
+	explicit FMovementBatchManager(UWorld* InWorld);
+	~FMovementBatchManager();
+
+	FMovementBatchManager(const FMovementBatchManager&) = delete;
+	FMovementBatchManager& operator=(const FMovementBatchManager&) = delete;
+
+	void RegisterComponent(UProjectileMovementComponent* InComponent);
+	void UnregisterComponent(UProjectileMovementComponent* InComponent);
+	void RegisterComponent(URotatingMovementComponent* InComponent);
+	void UnregisterComponent(URotatingMovementComponent* InComponent);
+
+	/** @brief 등록된 모든 컴포넌트를 DeltaTime만큼 이동 */
+	void Tick(float DeltaTime);
+
+	int32 GetNumProjectiles() const { return Projectiles.Num(); }
+	int32 GetNumRotatings() const { return Rotatings.Num(); }
+	FTickFunction& GetTickFunction() { return BatchTickFunction; }
+
+	/**
+	 * @brief 중력, 최대 속도 제한, 위치 적분을 4개씩 SSE로 처리
+	 * @param InNum 유효한 항목 수 (배열은 4의 배수 크기여야 함)
+	 */
+	static void IntegrateProjectiles(FProjectileData& InOutData, int32 InNum, float DeltaTime);
+
+	/**
+	 * @brief 회전량을 적용한 새 회전과 피벗 이동량을 4개씩 SSE로 계산
+	 * @param InNum 유효한 항목 수 (배열은 4의 배수 크기여야 함)
+	 */
+	static void IntegrateRotatings(FRotatingData& InOutData, int32 InNum);
+
+private:
+	/**
+	 * @brief 컴포넌트별 실행 간격 상태 (같은 위치의 컴포넌트 배열과 짝을 이룸)
+	 */
+	struct FTickSchedule
+	{
+		/** @brief 마지막 이동 이후 흐른 시간 */
+		float SkippedTime = 0.0f;
+		/** @brief 다음 이동까지 남은 시간 (0 이하면 이번 프레임에 이동) */
+		float TimeUntilTick = 0.0f;
+		/** @brief 첫 간격에만 곱해 같은 간격의 컴포넌트가 한 프레임에 몰리지 않게 함 */
+		float Phase = 1.0f;
+	};
+
+	/** @brief 이번 프레임에 움직일 컴포넌트인지 (소유 액터가 Tick하지 않으면 컴포넌트도 움직이지 않음) */
+	bool IsComponentEnabled(const UMovementComponent* InComponent) const;
+
+	/** @brief 첫 컴포넌트가 등록될 때 Tick 함수 등록, 소유 액터의 Tick이 일괄 이동 뒤에 오도록 선행 조건 추가 */
+	void OnComponentRegistered(UMovementComponent* InComponent);
+	/** @brief 마지막 컴포넌트가 빠지면 Tick 함수 해제 */
+	void OnComponentUnregistered();
+
+	/** @brief 컴포넌트 Tick 함수의 TickInterval과 카메라 거리에 따른 간격 중 긴 쪽 */
+	float GetComponentTickInterval(const UMovementComponent* InComponent) const;
+	/** @brief 새로 등록된 컴포넌트의 첫 간격을 흩어 놓을 비율 (황금비 수열) */
+	float GetNextStaggerPhase();
+
+	void TickProjectiles(float DeltaTime);
+	void TickRotatings(float DeltaTime);
+
+	UWorld* World = nullptr;
+	FMovementBatchTickFunction BatchTickFunction;
+
+	/** @brief 등록된 컴포넌트 (컴포넌트의 MovementBatchIndex가 이 배열의 위치) */
+	TArray<UProjectileMovementComponent*> Projectiles;
+	TArray<URotatingMovementComponent*> Rotatings;
+	TArray<FTickSchedule> RotatingSchedules;
+	int32 NumStaggeredComponents = 0;
+
+	/** @brief 이번 프레임에 움직이는 컴포넌트 (SoA 배열의 i번째 항목이 i번째 컴포넌트) */
+	TArray<UProjectileMovementComponent*> ActiveProjectiles;
+	TArray<URotatingMovementComponent*> ActiveRotatings;
+	/** @brief ActiveRotatings 각각이 이번에 회전할 시간 (건너뛴 프레임 포함) */
+	TArray<float> ActiveRotatingDeltaTimes;
+
+	FProjectileData ProjectileData;
+	FRotatingData RotatingData;
+};
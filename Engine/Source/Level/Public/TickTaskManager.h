@@ -0,0 +1,302 @@
+#pragma once
+#include "Runtime/Core/Public/Async/TaskGraph.h"
+
+class AActor;
+class UActorComponent;
+class FTickTaskManager;
+
+/**
+ * @brief Tick 함수가 실행되는 단계 (앞 그룹이 모두 끝나야 다음 그룹이 시작됨)
+ */
+enum class ETickingGroup : uint8
+{
+	PrePhysics,      // 이동 / 게임 로직 (기본값)
+	DuringPhysics,   // 물리와 겹쳐도 되는 작업
+	PostPhysics,     // 충돌 / 물리 결과를 읽는 작업
+	PostUpdateWork,  // 카메라, 이펙트 등 모든 갱신이 끝난 뒤의 작업
+	Max
+};
+
+/**
+ * @brief 카메라 거리에 따른 Tick 간격 조절 설정 (bAllowSignificanceThrottling인 Tick 함수에만 적용)
+ * NearDistance 안은 매 프레임, FarDistance 밖은 MaxTickInterval 간격, 그 사이는 거리에 비례해 간격을 늘린다
+ */
+struct FTickSignificanceSettings
+{
+	bool bEnabled = true;
+	float NearDistance = 50.0f;
+	float FarDistance = 500.0f;
+	float MaxTickInterval = 0.25f;
+	/** @brief 한 프레임에 거리를 다시 계산할 최대 Tick 함수 수 (나머지는 다음 프레임에 이어서 계산) */
+	int32 MaxUpdatesPerFrame = 2048;
+};
+
+/**
+ * @brief World의 FTickTaskManager에 등록되어 매 프레임 실행되는 Tick 단위 (언리얼 FTickFunction 스타일)
+ *
+ * 같은 그룹 안에서는 선행 조건을 만족하는 범위에서 등록 순서대로 실행된다
+ * bRunOnAnyThread가 꺼진 함수는 항상 게임 스레드에서 이 순서 그대로 실행되므로 직렬 Tick과 결과가 같고,
+ * 켜진 함수는 선행 조건만 끝나면 워커 스레드에서 다른 함수와 동시에 실행된다
+ *
+ * TickInterval이나 bAllowSignificanceThrottling이 켜진 함수는 쿨다운 목록에서 관리되어 실행할 차례가 된 프레임에만 방문하며,
+ * 같은 간격의 함수끼리 한 프레임에 몰리지 않도록 등록 시 첫 실행 시점을 간격 안에서 골고루 흩어 놓는다
+ * 이때 ExecuteTick에는 마지막 실행 이후 흐른 시간이 전달된다
+ *
+ * @note bRunOnAnyThread는 자기 대상의 상태만 바꾸고 선행 조건의 결과만 읽는 Tick에만 켤 것
+ * (Octree / Overlap 갱신, Delegate Broadcast, 로그, 오브젝트 생성 / 삭제는 게임 스레드 전용)
+ * @note 등록 / 해제와 선행 조건 변경은 게임 스레드에서만 호출할 것
+ * @note Tick 도중 대상을 지울 때는 먼저 UnRegisterTickFunction을 호출할 것 (워커에서 실행 중이면 끝날 때까지 기다림)
+ */
+class FTickFunction
+{
+public:
+	/** @brief 실행 단계 (등록 중에 바꾸려면 SetTickGroup 사용) */
+	ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+	/** @brief 워커 스레드에서 병렬로 실행해도 되는지 여부 (등록 전에 설정할 것) */
+	bool bRunOnAnyThread = false;
+	/** @brief 카메라에서 멀수록 Tick 간격을 늘려도 되는지 여부 (등록 전에 설정할 것) */
+	bool bAllowSignificanceThrottling = false;
+	/** @brief Tick 간격 (초, 0이면 매 프레임. 등록 중에 바꾸려면 SetTickInterval 사용) */
+	float TickInterval = 0.0f;
+
+	FTickFunction() = default;
+	virtual ~FTickFunction();
+
+	FTickFunction(const FTickFunction&) = delete;
+	FTickFunction& operator=(const FTickFunction&) = delete;
+
+	void RegisterTickFunction(FTickTaskManager* InTickTaskManager);
+	void UnRegisterTickFunction();
+	bool IsTickFunctionRegistered() const { return TickTaskManager != nullptr; }
+
+	void SetTickGroup(ETickingGroup InTickGroup);
+	void SetTickInterval(float InTickInterval);
+
+	/** @brief TickInterval과 카메라 거리로 정해진 간격 중 긴 쪽 */
+	float GetEffectiveTickInterval() const
+	{
+		return TickInterval > SignificanceTickInterval ? TickInterval : SignificanceTickInterval;
+	}
+
+	/**
+	 * @brief InPrerequisite가 끝난 뒤에 이 함수가 실행되도록 선행 조건 추가
+	 * 같은 그룹의 선행 조건만 순서를 강제하며, 앞 그룹의 선행 조건은 그룹 순서로 이미 보장된다
+	 * 선행 조건이 등록 해제되면 목록에서 자동으로 빠진다
+	 */
+	void AddPrerequisite(FTickFunction* InPrerequisite);
+	void RemovePrerequisite(FTickFunction* InPrerequisite);
+	const TArray<FTickFunction*>& GetPrerequisites() const { return Prerequisites; }
+
+	/**
+	 * @brief 이번 프레임에 실행할지 여부 (등록은 유지한 채 일시적으로 끌 때 사용)
+	 * @param bInIsEditorWorld 에디터 World의 Tick인지 여부
+	 */
+	virtual bool IsTickFunctionEnabled(bool bInIsEditorWorld) const { return true; }
+
+	virtual void ExecuteTick(float DeltaTime) = 0;
+
+	/**
+	 * @brief 카메라 거리 계산에 쓸 월드 위치
+	 * @return 위치가 없으면 false (거리에 따른 간격 조절을 하지 않음)
+	 */
+	virtual bool GetSignificanceLocation(FVector& OutLocation) const { return false; }
+
+private:
+	friend class FTickTaskManager;
+
+	/** @brief 쿨다운 목록에서 관리되는지 (정렬 시 TickInterval / bAllowSignificanceThrottling으로 결정) */
+	bool UsesCooldown() const { return TickInterval > 0.0f || bAllowSignificanceThrottling; }
+
+	FTickTaskManager* TickTaskManager = nullptr;
+	TArray<FTickFunction*> Prerequisites;
+	/** @brief 이 함수를 선행 조건으로 가진 함수들 (해제될 때 전체 목록을 훑지 않고 이 함수들에서만 빼냄) */
+	TArray<FTickFunction*> Dependents;
+
+	/** @brief 그룹 등록 목록에서의 위치 (해제되면 자리만 비우고 다음 정렬에서 한 번에 당김, -1이면 미등록) */
+	int32 RegisteredIndex = -1;
+	/** @brief 그룹 안의 실행 순서 */
+	int32 SortIndex = 0;
+	/** @brief 마지막으로 들어간 프레임 실행 목록에서의 위치 (실행 중 해제될 때 그 자리만 비움) */
+	int32 FrameIndex = -1;
+	/** @brief 중요도 목록에서의 위치 (-1이면 목록에 없음) */
+	int32 SignificanceIndex = -1;
+
+	/** @brief 쿨다운 목록에 들어가 첫 실행 시점이 정해졌는지 */
+	bool bIsCooldownScheduled = false;
+	double NextTickTime = 0.0;
+	double LastTickTime = 0.0;
+	float SignificanceTickInterval = 0.0f;
+	/** @brief 이번 실행에 전달할 시간 (쿨다운 함수만 사용) */
+	float TickDeltaTime = 0.0f;
+
+	/** @brief 정렬 중 방문 표시 (FTickTaskManager::SortMark와 비교) */
+	uint32 VisitMark = 0;
+	bool bIsVisiting = false;
+
+	/** @brief 이번 프레임에 실행되는지, 같은 그룹의 게임 스레드 함수가 끝나야 발행할 수 있는지 */
+	bool bIsEnabledThisFrame = false;
+	bool bWaitsForGameThread = false;
+	/** @brief 워커에서 실행 중인 이번 프레임의 태스크 */
+	FGraphEventRef CompletionEvent;
+};
+
+/**
+ * @brief AActor::Tick을 실행하는 Tick 함수
+ */
+class FActorTickFunction : public FTickFunction
+{
+public:
+	AActor* Target = nullptr;
+
+	bool IsTickFunctionEnabled(bool bInIsEditorWorld) const override;
+	void ExecuteTick(float DeltaTime) override;
+	bool GetSignificanceLocation(FVector& OutLocation) const override;
+};
+
+/**
+ * @brief UActorComponent::TickComponent를 실행하는 Tick 함수
+ */
+class FActorComponentTickFunction : public FTickFunction
+{
+public:
+	UActorComponent* Target = nullptr;
+
+	bool IsTickFunctionEnabled(bool bInIsEditorWorld) const override;
+	void ExecuteTick(float DeltaTime) override;
+	bool GetSignificanceLocation(FVector& OutLocation) const override;
+};
+
+/**
+ * @brief World에 등록된 Tick 함수들을 그룹 순서대로 실행 (언리얼 FTickTaskManager 스타일)
+ *
+ * Tick이 필요한 액터 / 컴포넌트만 등록되므로 매 프레임 모든 액터와 컴포넌트를 순회하지 않는다
+ * 그룹마다 선행 조건을 반영한 실행 순서를 등록이 바뀔 때만 다시 계산하고,
+ * 워커 스레드가 있으면 bRunOnAnyThread 함수를 TaskGraph 태스크로, 나머지는 게임 스레드에서 순서대로 실행한다
+ * 간격이 있는 함수는 다음 실행 시각별 슬롯(해시 타이밍 휠)에 두고 지난 슬롯만 확인하므로,
+ * 쉬고 있는 함수는 휠이 한 바퀴 돌 때 한 번 시각만 비교될 뿐 함수 객체를 건드리지 않는다
+ */
+class FTickTaskManager
+{
+public:
+	FTickTaskManager() = default;
+	~FTickTaskManager();
+
+	FTickTaskManager(const FTickTaskManager&) = delete;
+	FTickTaskManager& operator=(const FTickTaskManager&) = delete;
+
+	/**
+	 * @brief 모든 그룹을 순서대로 실행하고 끝날 때까지 대기
+	 * @param DeltaTime 프레임 시간
+	 * @param bInIsEditorWorld 에디터 World 여부 (IsTickFunctionEnabled로 전달)
+	 */
+	void Tick(float DeltaTime, bool bInIsEditorWorld);
+
+	bool IsTicking() const { return bIsTicking; }
+	int32 GetNumTickFunctions() const;
+	int32 GetNumTickFunctions(ETickingGroup InTickGroup) const;
+	/** @brief 마지막 Tick에서 실제로 실행 대상이 된 함수 수 */
+	int32 GetNumTickedLastFrame() const { return NumTickedLastFrame; }
+
+	/**
+	 * @brief 거리 계산 기준이 되는 카메라 위치 설정 (매 프레임 Tick 전에 호출)
+	 * 설정하지 않으면 거리에 따른 간격 조절을 하지 않는다
+	 */
+	void SetViewLocation(const FVector& InViewLocation);
+	void ClearViewLocation();
+
+	FTickSignificanceSettings& GetSignificanceSettings() { return SignificanceSettings; }
+	/** @brief InLocation의 카메라 거리에 따른 간격 (카메라가 없거나 조절이 꺼져 있으면 0) */
+	float GetSignificanceTickInterval(const FVector& InLocation) const;
+
+private:
+	friend class FTickFunction;
+
+	/** @brief 타이밍 휠 슬롯 하나가 맡는 시간 (초)과 슬롯 수 (한 바퀴 약 2초) */
+	static constexpr double CooldownSlotDuration = 1.0 / 120.0;
+	static constexpr int32 NumCooldownSlots = 256;
+
+	struct FCooldownEntry
+	{
+		double NextTickTime;
+		int32 SortIndex;
+		FTickFunction* TickFunction;
+	};
+
+	struct FTickGroup
+	{
+		/** @brief 등록 순서 (해제된 자리는 다음 정렬까지 nullptr) */
+		TArray<FTickFunction*> TickFunctions;
+		/** @brief TickFunctions에서 비어 있는 자리 수 */
+		int32 NumRemovedTickFunctions = 0;
+		/** @brief 선행 조건을 반영한 실행 순서 */
+		TArray<FTickFunction*> SortedTickFunctions;
+		/** @brief 실행 순서 위치별로 매 프레임 실행하는 함수인지 표시한 비트 */
+		TArray<uint64> EveryFrameMask;
+		int32 NumEveryFrameFunctions = 0;
+		/** @brief 쿨다운 함수를 다음 실행 시각의 슬롯에 나눠 담은 타이밍 휠 */
+		TArray<FCooldownEntry> CooldownSlots[NumCooldownSlots];
+		/** @brief 마지막으로 확인한 슬롯 번호 (누적 시간 / 슬롯 시간) */
+		int64 LastCheckedSlot = 0;
+		/** @brief 이번 프레임에 차례가 된 쿨다운 항목 (임시) */
+		TArray<FCooldownEntry> DueEntries;
+		/** @brief 이번 프레임에 실행할 위치 비트 (임시) */
+		TArray<uint64> FrameMask;
+		/** @brief 이번 프레임에 실행할 함수 (실행 순서, 실행 중 해제된 항목은 nullptr) */
+		TArray<FTickFunction*> FrameTickFunctions;
+		/** @brief 정렬 시점의 bRunOnAnyThread 함수 수 (0이면 병렬 실행 준비를 건너뜀) */
+		int32 NumAnyThreadFunctions = 0;
+		bool bIsOrderDirty = false;
+	};
+
+	void AddTickFunction(FTickFunction* InTickFunction);
+	void RemoveTickFunction(FTickFunction* InTickFunction);
+	void ChangeTickGroup(FTickFunction* InTickFunction, ETickingGroup InTickGroup);
+	/** @brief 그룹 목록 끝에 추가 */
+	void AttachToTickGroup(FTickFunction* InTickFunction);
+	/** @brief 그룹 목록에서만 빼냄 (실행 중이면 끝날 때까지 대기) */
+	void DetachFromTickGroup(FTickFunction* InTickFunction);
+	/** @brief 해제로 비어 있는 자리를 등록 순서를 유지하며 당김 */
+	static void CompactTickGroup(FTickGroup& InGroup);
+	void MarkOrderDirty(ETickingGroup InTickGroup);
+
+	/** @brief 등록 순서를 유지하면서 선행 조건이 먼저 오도록 정렬 */
+	void SortTickGroup(FTickGroup& InGroup, ETickingGroup InTickGroup);
+	void VisitTickFunction(FTickFunction* InTickFunction, ETickingGroup InTickGroup, TArray<FTickFunction*>& OutSorted);
+
+	/** @brief 첫 실행 시각을 간격 안에서 흩어 쿨다운 목록에 넣을 준비 */
+	void ScheduleCooldown(FTickFunction* InTickFunction);
+	static void AddCooldownEntry(FTickGroup& InGroup, const FCooldownEntry& InEntry);
+	/** @brief 매 프레임 함수와 차례가 된 쿨다운 함수를 실행 순서대로 모아 FrameTickFunctions 구성 */
+	void GatherFrameTickFunctions(FTickGroup& InGroup);
+
+	/** @brief 카메라 거리로 쿨다운 간격 갱신 (프레임당 MaxUpdatesPerFrame개씩 돌아가며) */
+	void UpdateSignificance();
+	void AddSignificanceTickFunction(FTickFunction* InTickFunction);
+	void RemoveSignificanceTickFunction(FTickFunction* InTickFunction);
+
+	void RunTickGroupSerial(FTickGroup& InGroup, float DeltaTime, bool bInIsEditorWorld);
+	void RunTickGroupParallel(FTickGroup& InGroup, ETickingGroup InTickGroup, float DeltaTime, bool bInIsEditorWorld);
+
+	/** @brief 같은 그룹에서 이번 프레임에 실행되는 선행 조건들의 태스크 이벤트 수집 */
+	void GatherPrerequisiteEvents(const FTickFunction* InTickFunction, ETickingGroup InTickGroup,
+		FGraphEventArray& OutEvents) const;
+
+	FTickGroup TickGroups[static_cast<int32>(ETickingGroup::Max)];
+	uint32 SortMark = 0;
+	bool bIsTicking = false;
+
+	/** @brief 매니저 기준 누적 시간과 마지막 프레임 시간 */
+	double CurrentTime = 0.0;
+	float FrameDeltaTime = 0.0f;
+	int32 NumTickedLastFrame = 0;
+	/** @brief 첫 실행 시점을 흩는 데 쓰는 일련번호 */
+	uint32 NumStaggeredTickFunctions = 0;
+
+	FTickSignificanceSettings SignificanceSettings;
+	TArray<FTickFunction*> SignificanceTickFunctions;
+	int32 NextSignificanceIndex = 0;
+	FVector ViewLocation;
+	bool bHasViewLocation = false;
+	/** @brief 거리에 따라 늘려 둔 간격이 남아 있는지 */
+	bool bIsThrottling = false;
+};
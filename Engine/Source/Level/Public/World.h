@@ -1,6 +1,9 @@
 #pragma once
 #include <filesystem>
 #include "Core/Public/Object.h"
+#include "Core/Public/Delegate.h"
+#include "Level/Public/TickTaskManager.h"
+#include "Level/Public/MovementBatchManager.h"
 #include "Global/Types.h"
 
 class UEditor;
@@ -58,6 +61,20 @@ public:
 	AActor* SpawnActor(UClass* InActorClass, JSON* ActorJsonData = nullptr);
 	bool DestroyActor(AActor* InActor); // Level의 void MarkActorForDeletion(AActor * InActor) 기능을 DestroyActor가 가짐
 
+	// Deferred Events
+	// 켜져 있으면 충돌 / 오버랩 이벤트를 바로 Broadcast하지 않고 큐에 모았다가 액터 Tick이 끝난 뒤 한꺼번에 실행
+	FDeferredEventQueue& GetDeferredEventQueue() { return DeferredEvents; }
+	bool IsDeferringEvents() const { return bDeferEvents; }
+	void SetDeferEvents(bool bInDeferEvents);
+
+	// Tick Functions
+	// BeginPlay한 액터 / 컴포넌트 중 Tick하는 것만 등록되어 Tick 그룹 순서대로 실행됨
+	FTickTaskManager& GetTickTaskManager() { return TickTaskManager; }
+
+	// Batched Movement
+	// 투사체 / 회전 이동 컴포넌트는 컴포넌트별 Tick 대신 여기에 등록되어 한 번에 이동
+	FMovementBatchManager& GetMovementBatchManager() { return MovementBatchManager; }
+
 	// TODO: World Scope Query Entrypoint
 	// Editor에서 쿼리 요청시 Level에 바로 요청하지 않고 World를 통해 요청하도록 변경 
 
@@ -70,6 +87,11 @@ private:
 	bool bBegunPlay = false;
 	TArray<AActor*> PendingDestroyActors;
 	float WorldTimeSeconds;
+	FDeferredEventQueue DeferredEvents;
+	bool bDeferEvents = false;
+	FTickTaskManager TickTaskManager;
+	// Tick 함수를 TickTaskManager에 등록하므로 TickTaskManager보다 뒤에 선언 (먼저 소멸)
+	FMovementBatchManager MovementBatchManager;
 
 	void FlushPendingDestroy(); // Destroy marking 된 액터들을 실제 삭제
 
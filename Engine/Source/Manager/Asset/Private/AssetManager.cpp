@@ -18,6 +18,7 @@ UAssetManager::~UAssetManager() = default;
 
 void UAssetManager::Initialize()
 {
+	LLM_SCOPE(Assets);
 	TextureManager->LoadAllTexturesFromDirectory(UPathManager::GetInstance().GetDataPath());
 	// Data 폴더 속 모든 .obj 파일 로드 및 캐싱
 	LoadAllObjStaticMesh();
@@ -284,6 +285,7 @@ FAABB UAssetManager::CalculateAABB(const TArray<FNormalVertex>& Vertices)
  */
 UTexture* UAssetManager::LoadTexture(const FName& InFilePath)
 {
+	LLM_SCOPE(Assets);
 	return TextureManager->LoadTexture(InFilePath);
 }
 
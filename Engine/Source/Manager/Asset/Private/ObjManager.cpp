@@ -156,6 +156,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 	FObjectInfo& ObjectInfo = ObjInfo.ObjectInfoList[0];
 
 	TMap<VertexKey, size_t, VertexKeyHash> VertexMap;
+	VertexMap.Reserve(static_cast<int32>(ObjectInfo.VertexIndexList.Num()));
 	for (size_t i = 0; i < ObjectInfo.VertexIndexList.Num(); ++i)
 	{
 		size_t VertexIndex = ObjectInfo.VertexIndexList[i];
@@ -204,6 +205,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 	ComputeTangents(StaticMesh->Vertices, StaticMesh->Indices);
 	/** #3. 오브젝트가 사용하는 머티리얼의 목록을 저장 */
 	TSet<FName> UniqueMaterialNames;
+	UniqueMaterialNames.Reserve(ObjectInfo.MaterialNameList.Num());
 	for (const auto& MaterialName : ObjectInfo.MaterialNameList)
 	{
 		UniqueMaterialNames.Add(MaterialName);
@@ -289,7 +291,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		}
 	}
 
-	//StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
+	StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
 	ObjFStaticMeshMap.Emplace(PathFileName, std::move(StaticMesh));
 
 	return ObjFStaticMeshMap[PathFileName].get();
@@ -419,6 +421,7 @@ void FObjManager::CreateMaterialsFromMTL(UStaticMesh* StaticMesh, FStaticMesh* S
 
 UStaticMesh* FObjManager::LoadObjStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config)
 {
+	LLM_SCOPE(Assets);
 	// 1) Try AssetManager cache first (non-owning lookup)
 	UAssetManager& AssetManager = UAssetManager::GetInstance();
 	if (UStaticMesh* Cached = AssetManager.GetStaticMeshFromCache(PathFileName))
@@ -23,6 +23,7 @@ FTextureManager::~FTextureManager()
 
 UTexture* FTextureManager::LoadTexture(const FName& InFilePath)
 {
+    LLM_SCOPE(Assets);
     // Path 정규화
     path InputPath(InFilePath.ToString());  // 사용자의 원본 입력
     path AbsolutePath;                            // 실제 파일을 찾을 때 사용할 절대 경로
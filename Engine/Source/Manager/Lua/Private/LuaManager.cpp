@@ -1,10 +1,52 @@
 ﻿#include "pch.h"
 #include "Manager/Lua/Public/LuaManager.h"
 #include "Manager/Path/Public/PathManager.h"
+#include "Level/Public/Level.h"
+#include "Level/Public/World.h"
+#include "Physics/Public/HitResult.h"
+#include "Runtime/Core/Public/Memory/MallocBinned.h"
 
 IMPLEMENT_SINGLETON_CLASS(ULuaManager, UObject)
 
+namespace
+{
+    /**
+     * @brief Lua VM 할당 함수 (lua_Alloc)
+     * 기본 realloc 대신 엔진 operator new를 거치게 해서 Lua 힙도 LLM의 Lua 태그로 집계되도록 한다
+     */
+    void* LuaAllocate(void*, void* InPtr, size_t InOldSize, size_t InNewSize)
+    {
+        if (InNewSize == 0)
+        {
+            ::operator delete(InPtr);
+            return nullptr;
+        }
+
+        // 크기 클래스 안에서 해결되는 재할당은 그대로 둔다 (너무 많이 줄어드는 경우는 메모리를 돌려주기 위해 옮김)
+        if (InPtr && InNewSize <= FMallocBinned::GetAllocationSize(InPtr) && InNewSize * 2 >= InOldSize)
+        {
+            return InPtr;
+        }
+
+        LLM_SCOPE(Lua);
+        void* NewPtr = ::operator new(InNewSize, std::nothrow);
+        if (!NewPtr)
+        {
+            // Lua는 축소 요청이 실패하지 않는다고 가정하므로 기존 블록을 그대로 돌려준다
+            return InPtr && InNewSize <= InOldSize ? InPtr : nullptr;
+        }
+
+        if (InPtr)
+        {
+            memcpy(NewPtr, InPtr, min(InOldSize, InNewSize));
+            ::operator delete(InPtr);
+        }
+        return NewPtr;
+    }
+}
+
 ULuaManager::ULuaManager()
+    : MasterLuaState(sol::default_at_panic, &LuaAllocate)
 {
 }
 
@@ -15,6 +57,7 @@ ULuaManager::~ULuaManager()
 
 void ULuaManager::Initialize()
 {
+    LLM_SCOPE(Lua);
     MasterLuaState.open_libraries(sol::lib::base, sol::lib::coroutine, sol::lib::string, sol::lib::io);
     MasterLuaState.script("print('--- [LuaManager] sol2 & Lua link SUCCESS! ---')");
 
@@ -24,6 +67,7 @@ void ULuaManager::Initialize()
 
 void ULuaManager::Update(float DeltaTime)
 {
+    LLM_SCOPE(Lua);
     HotReloadTimer += DeltaTime;
     if (HotReloadTimer >= HotReloadInterval)
     {
@@ -86,6 +130,60 @@ void ULuaManager::BindTypesToLua()
     // -- UScriptComponent -- //
     MasterLuaState.new_usertype<UScriptComponent>("UScriptComponent");
 
+    // -- LineTrace -- //
+    // 교차한 액터(없으면 nil), 교차 위치, 시작점으로부터의 거리를 반환
+    MasterLuaState.set_function("LineTrace",
+        [](const FVector& Start, const FVector& End, sol::optional<AActor*> IgnoredActor) -> std::tuple<AActor*, FVector, float> {
+            FHitResult Hit;
+            ULevel* Level = GWorld ? GWorld->GetLevel() : nullptr;
+            if (!Level || !Level->LineTraceSingle(Hit, Start, End, IgnoredActor.value_or(nullptr)))
+            {
+                return { nullptr, End, (End - Start).Length() };
+            }
+            return { Hit.Actor, Hit.Location, Hit.Distance };
+        }
+    );
+
+    // -- LineTraceBatch -- //
+    // Starts[i]에서 Ends[i]까지의 선분을 한 번에 검사해 i번째에 { Actor, Location, Distance } (교차하지 않으면 false)를 담은 테이블 반환
+    MasterLuaState.set_function("LineTraceBatch",
+        [](sol::table Starts, sol::table Ends, sol::optional<AActor*> IgnoredActor, sol::this_state State) -> sol::table {
+            sol::state_view Lua(State);
+            sol::table Results = Lua.create_table();
+
+            const int32 NumSegments = static_cast<int32>(std::min(Starts.size(), Ends.size()));
+            TArray<FLineTraceSegment> Segments;
+            Segments.Reserve(NumSegments);
+            for (int32 Index = 1; Index <= NumSegments; ++Index)
+            {
+                Segments.Add({ Starts.get<FVector>(Index), Ends.get<FVector>(Index) });
+            }
+
+            TArray<FHitResult> Hits;
+            ULevel* Level = GWorld ? GWorld->GetLevel() : nullptr;
+            if (Level)
+            {
+                Level->LineTraceBatch(Segments, Hits, IgnoredActor.value_or(nullptr));
+            }
+
+            for (int32 Index = 0; Index < NumSegments; ++Index)
+            {
+                if (Index < Hits.Num() && Hits[Index].bBlockingHit)
+                {
+                    Results[Index + 1] = Lua.create_table_with(
+                        "Actor", Hits[Index].Actor,
+                        "Location", Hits[Index].Location,
+                        "Distance", Hits[Index].Distance);
+                }
+                else
+                {
+                    Results[Index + 1] = false;
+                }
+            }
+            return Results;
+        }
+    );
+
     // -- Log -- //
     MasterLuaState.set_function("Log", [](sol::variadic_args Vars) {
             std::stringstream ss;
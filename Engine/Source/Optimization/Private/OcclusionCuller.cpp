@@ -16,11 +16,11 @@ void COcclusionCuller::InitializeCuller(const FMatrix& ViewMatrix, const FMatrix
     CurrentViewProj = ViewMatrix * ProjectionMatrix;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
+const TArray<UPrimitiveComponent*>& COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
 {    
     Frame++;
     // 0. Primitive AABB 데이터 채우기
-    CachedAABBs.Empty();
+    CachedAABBs.Empty(AllPrimitives.Num());
     for (int32 i = 0; i < AllPrimitives.Num(); ++i)
     {
         UPrimitiveComponent* PrimitiveComp = AllPrimitives[i];
@@ -40,14 +40,14 @@ TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrim
 
     // 1. 오클루더 동적 선택
     ULevel* CurrentLevel = GWorld->GetLevel();
-    TArray<UPrimitiveComponent*> OccluderCandidates = CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, static_cast<uint32>(AllPrimitives.Num()) / 10);
-    TArray<UPrimitiveComponent*> SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
+    CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, static_cast<uint32>(AllPrimitives.Num()) / 10, OccluderCandidates);
+    const TArray<UPrimitiveComponent*>& SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
 
     // 2. CPU Z-Buffer 구성
     RasterizeOccluders(SelectedOccluders, CameraPos);
 
     // 3. 가시성 테스트
-    VisibleMeshComponents.Empty();
+    VisibleMeshComponents.Empty(CachedAABBs.Num());
     for (auto& AABBData : CachedAABBs)
     {
         if (IsMeshVisible(AABBData))
@@ -59,7 +59,7 @@ TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrim
     return VisibleMeshComponents;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
+const TArray<UPrimitiveComponent*>& COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
 {
     FilteredOccluders.Empty();
 
@@ -93,7 +93,7 @@ void COcclusionCuller::RasterizeOccluders(const TArray<UPrimitiveComponent*>& Se
             continue;
         }
         // 1. AABB를 12개 삼각형의 월드 정점 리스트로 변환
-        TArray<FVector> BoxTriangles = ConvertAABBToTriangles(OccluderComp);
+        const TArray<FVector>& BoxTriangles = ConvertAABBToTriangles(OccluderComp);
 
         // 2. CPU 래스터라이징
         for (uint32 Idx = 0; Idx < BoxTriangles.Num(); Idx += 3)
@@ -374,7 +374,7 @@ void COcclusionCuller::RasterizeTriangle(const FVector& P1, const FVector& P2, c
     }
 }
 
-TArray<FVector> COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
+const TArray<FVector>& COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
 {
     Triangles.Empty();
 
@@ -23,6 +23,12 @@ struct FHitResult
 	// Penetration depth (positive = overlapping, negative = separated)
 	float PenetrationDepth;
 
+	// Distance from the trace start to Location (line traces only)
+	float Distance;
+
+	// Triangle index of the hit mesh (index buffer / 3), -1 if not a mesh hit
+	int32 FaceIndex;
+
 	// Actor that was hit/overlapped
 	AActor* Actor;
 
@@ -36,6 +42,8 @@ struct FHitResult
 		: Location(0.0f, 0.0f, 0.0f)
 		, Normal(0.0f, 0.0f, 1.0f)
 		, PenetrationDepth(0.0f)
+		, Distance(0.0f)
+		, FaceIndex(-1)
 		, Actor(nullptr)
 		, Component(nullptr)
 		, bBlockingHit(false)
@@ -46,6 +54,8 @@ struct FHitResult
 		: Location(InLocation)
 		, Normal(InNormal)
 		, PenetrationDepth(0.0f)
+		, Distance(0.0f)
+		, FaceIndex(-1)
 		, Actor(nullptr)
 		, Component(nullptr)
 		, bBlockingHit(false)
@@ -3,6 +3,7 @@
 #include "Editor/Public/Camera.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Texture/Public/Texture.h"
+#include "Runtime/Core/Public/Memory/MemStack.h"
 
 FBillboardPass::FBillboardPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferCamera, ID3D11Buffer* InConstantBufferModel,
                                ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS, ID3D11BlendState* InBS)
@@ -36,7 +37,10 @@ void FBillboardPass::Execute(FRenderingContext& Context)
         float DistanceSq;
     };
 
-    std::vector<FDistanceSortedBillboard> SortedBillboards;
+    // 정렬용 임시 배열은 프레임 메모리 스택에서 할당
+    FMemMark Mark(FMemStack::Get());
+    TArray<FDistanceSortedBillboard, TMemStackAllocator<>> SortedBillboards;
+    SortedBillboards.Reserve(Context.BillBoards.Num());
     FVector CameraLocation = Context.CurrentCamera->GetLocation();
 
     for (UBillBoardComponent* BillBoardComp : Context.BillBoards)
@@ -44,11 +48,11 @@ void FBillboardPass::Execute(FRenderingContext& Context)
         BillBoardComp->FaceCamera(Context.CurrentCamera->GetForward());
         FVector BillboardLocation = BillBoardComp->GetWorldLocation();
         float DistanceSq = FVector::DistSquared(CameraLocation, BillboardLocation);
-        SortedBillboards.push_back({ BillBoardComp, DistanceSq });
+        SortedBillboards.Add({ BillBoardComp, DistanceSq });
     }
 
     // DistanceSq가 클수록 앞에 오도록 정렬
-    std::sort(SortedBillboards.begin(), SortedBillboards.end(), [](const FDistanceSortedBillboard& a, const FDistanceSortedBillboard& b) {
+    SortedBillboards.Sort([](const FDistanceSortedBillboard& a, const FDistanceSortedBillboard& b) {
         return a.DistanceSq > b.DistanceSq;
     });
 
@@ -1,6 +1,5 @@
 #include "pch.h"
 #include "Component/Public/DecalComponent.h"
-#include "Global/Octree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/OBB.h"
@@ -128,6 +127,17 @@ namespace
         // 8) 모든 축에서 분리 실패 → 충돌
         return true;
     }
+
+    // 데칼 OBB를 공간 쿼리 모양으로 사용하기 위한 어댑터 (포함 여부는 판정하지 않음)
+    struct FDecalQueryShape
+    {
+        const FOBB* Box;
+
+        EBoundCheckResult CheckIntersection(const FAABB& InBounds) const
+        {
+            return Box->Intersects(InBounds) ? EBoundCheckResult::Intersect : EBoundCheckResult::Outside;
+        }
+    };
 }
 
 FDecalPass::FDecalPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferCamera, ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS_Read, ID3D11BlendState* InBlendState)
@@ -154,8 +164,6 @@ void FDecalPass::Execute(FRenderingContext& Context)
     uint32 RenderedDecal = 0;
     uint32 CollidedComps = 0;
     
-    TArray<UPrimitiveComponent*>& DynamicPrimitives = GWorld->GetLevel()->GetDynamicPrimitives();
-    
     // --- Render Decals ---
     for (UDecalComponent* Decal : Context.Decals)
     {
@@ -199,8 +207,7 @@ void FDecalPass::Execute(FRenderingContext& Context)
         // --- Enable Octree Optimization --- 
         ULevel* CurrentLevel = GWorld->GetLevel();
 
-        Query(CurrentLevel->GetStaticOctree(), Decal, Primitives);
-        Primitives.Append(DynamicPrimitives);
+        Query(CurrentLevel, Decal, Primitives);
 
         // --- Disable Octree Optimization --- 
         // Primitives = Context.DefaultPrimitives;
@@ -248,26 +255,10 @@ void FDecalPass::Release()
     SafeRelease(ConstantBufferDecal);
 }
 
-void FDecalPass::Query(FOctree* InOctree, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives)
+void FDecalPass::Query(ULevel* InLevel, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives)
 {
     /** @todo Use polymorphism to gracefully handle collsion between decal and octree. For now, use explicit casting. */
     auto BoundingBox = static_cast<const FOBB*>(InDecal->GetBoundingBox());
 
-    if (!BoundingBox->Intersects(InOctree->GetBoundingBox()))
-    {
-        return;
-    }
-
-    auto Primitives = InOctree->GetPrimitives();
-    OutPrimitives.Append(Primitives);
-    if (InOctree->IsLeafNode())
-    {
-        return;
-    }
-
-    
-    for (auto Child : InOctree->GetChildren())
-    {
-        Query(Child, InDecal, OutPrimitives);
-    }
+    InLevel->GatherPrimitives(FDecalQueryShape{ BoundingBox }, OutPrimitives);
 }
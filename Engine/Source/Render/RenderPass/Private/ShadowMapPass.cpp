@@ -8,12 +8,57 @@
 #include "Component/Public/PointLightComponent.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Render/Shadow/Public/PSMCalculator.h"
+#include "Global/SpatialQuery.h"
+#include "Level/Public/Level.h"
 
 #define MAX_LIGHT_NUM 8
 #define X_OFFSET 1024.0f
 #define Y_OFFSET 1024.0f
 #define SHADOW_MAP_RESOLUTION 1024.0f
 
+namespace
+{
+	/**
+	 * @brief 광원 영향 범위(InShape)와 겹치는 보이는 메시만 모음
+	 * 영향 범위 밖의 메시는 범위 안으로 들어오는 빛을 가릴 수 없으므로 그림자 맵에 그리지 않아도 된다
+	 * 레벨이 있으면 Octree / 동적 트리로 후보를 좁히고, 없으면 InMeshes를 전부 검사한다
+	 */
+	template<typename ShapeType>
+	void GatherShadowCasters(const ShapeType& InShape, ULevel* InLevel, const TArray<UStaticMeshComponent*>& InMeshes,
+		TArray<UStaticMeshComponent*>& OutCasters)
+	{
+		OutCasters.Empty();
+		if (InLevel)
+		{
+			InLevel->QueryPrimitives(InShape, [&OutCasters](UPrimitiveComponent* InPrimitive)
+			{
+				UStaticMeshComponent* Mesh = Cast<UStaticMeshComponent>(InPrimitive);
+				if (Mesh && Mesh->IsVisible())
+				{
+					OutCasters.Add(Mesh);
+				}
+				return true;
+			});
+			return;
+		}
+
+		for (UStaticMeshComponent* Mesh : InMeshes)
+		{
+			if (!Mesh->IsVisible())
+			{
+				continue;
+			}
+
+			FVector WorldMin, WorldMax;
+			Mesh->GetWorldAABB(WorldMin, WorldMax);
+			if (InShape.CheckIntersection(FAABB(WorldMin, WorldMax)) != EBoundCheckResult::Outside)
+			{
+				OutCasters.Add(Mesh);
+			}
+		}
+	}
+}
+
 // Helper functions for matrix operations
 namespace ShadowMatrixHelper
 {
@@ -272,7 +317,7 @@ void FShadowMapPass::Execute(FRenderingContext& Context)
 	ActiveSpotLightCount = static_cast<uint32>(ValidSpotLights.Num());
 	for (int32 i = 0; i < ValidSpotLights.Num(); i++)
 	{
-		RenderSpotShadowMap(ValidSpotLights[i], i, Context.StaticMeshes);
+		RenderSpotShadowMap(ValidSpotLights[i], i, Context.Level, Context.StaticMeshes);
 	}
 
 	// Phase 3: Point Lights
@@ -291,7 +336,7 @@ void FShadowMapPass::Execute(FRenderingContext& Context)
 	ActivePointLightCount = static_cast<uint32>(ValidPointLights.Num());
 	for (int32 i = 0; i < ValidPointLights.Num(); i++)
 	{
-		RenderPointShadowMap(ValidPointLights[i], i, Context.StaticMeshes);
+		RenderPointShadowMap(ValidPointLights[i], i, Context.Level, Context.StaticMeshes);
 	}
 
 	SetShadowAtlasTilePositionStructuredBuffer();
@@ -453,6 +498,7 @@ void FShadowMapPass::RenderDirectionalShadowMap(
 void FShadowMapPass::RenderSpotShadowMap(
 	USpotLightComponent* Light,
 	uint32 AtlasIndex,
+	ULevel* Level,
 	const TArray<UStaticMeshComponent*>& Meshes
 	)
 {
@@ -530,13 +576,13 @@ void FShadowMapPass::RenderSpotShadowMap(
 	FRenderResourceFactory::UpdateConstantBufferData(PointLightShadowParamsBuffer, Params);
 	Pipeline->SetConstantBuffer(2, EShaderType::PS, PointLightShadowParamsBuffer);
 
-	// 5. 각 메시 렌더링
-	for (auto Mesh : Meshes)
+	// 5. 스포트라이트 원뿔과 겹치는 메시만 렌더링
+	TArray<UStaticMeshComponent*> Casters;
+	GatherShadowCasters(FQueryCone(Light->GetWorldLocation(), Light->GetForwardVector(), Light->GetAttenuationRadius(),
+		Light->GetOuterConeAngle()), Level, Meshes, Casters);
+	for (auto Mesh : Casters)
 	{
-		if (Mesh->IsVisible())
-		{
-			RenderMeshDepth(Mesh, LightView, LightProj);
-		}
+		RenderMeshDepth(Mesh, LightView, LightProj);
 	}
 
 	// 6. 상태 복원
@@ -558,6 +604,7 @@ void FShadowMapPass::RenderSpotShadowMap(
 void FShadowMapPass::RenderPointShadowMap(
 	UPointLightComponent* Light,
 	uint32 AtlasIndex,
+	ULevel* Level,
 	const TArray<UStaticMeshComponent*>& Meshes
 	)
 {
@@ -614,6 +661,10 @@ void FShadowMapPass::RenderPointShadowMap(
 	// RenderTarget은 변경될 일이 없어 먼저 Set한다.
 	Pipeline->SetRenderTargets(1, ShadowAtlas.VarianceShadowRTV.GetAddressOf(), ShadowAtlas.ShadowDSV.Get());
 	
+	// 감쇠 반경과 겹치는 메시만 6개 면에 공통으로 사용
+	TArray<UStaticMeshComponent*> Casters;
+	GatherShadowCasters(FQuerySphere(Light->GetWorldLocation(), Light->GetAttenuationRadius()), Level, Meshes, Casters);
+
 	// 4. 6개 면 렌더링 (+X, -X, +Y, -Y, +Z, -Z)
 	for (int Face = 0; Face < 6; Face++)
 	{
@@ -641,29 +692,26 @@ void FShadowMapPass::RenderPointShadowMap(
 		Pipeline->SetConstantBuffer(1, EShaderType::VS, ShadowViewProjConstantBuffer);
 
 		// 4-3. 메시 렌더링
-		for (auto Mesh : Meshes)
+		for (auto Mesh : Casters)
 		{
-			if (Mesh->IsVisible())
-			{
-				// Model transform 업데이트
-				FMatrix WorldMatrix = Mesh->GetWorldTransformMatrix();
-				FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, WorldMatrix);
-				Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
+			// Model transform 업데이트
+			FMatrix WorldMatrix = Mesh->GetWorldTransformMatrix();
+			FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, WorldMatrix);
+			Pipeline->SetConstantBuffer(0, EShaderType::VS, ConstantBufferModel);
 
-				// Vertex/Index buffer 바인딩
-				ID3D11Buffer* VertexBuffer = Mesh->GetVertexBuffer();
-				ID3D11Buffer* IndexBuffer = Mesh->GetIndexBuffer();
-				uint32 IndexCount = Mesh->GetNumIndices();
+			// Vertex/Index buffer 바인딩
+			ID3D11Buffer* VertexBuffer = Mesh->GetVertexBuffer();
+			ID3D11Buffer* IndexBuffer = Mesh->GetIndexBuffer();
+			uint32 IndexCount = Mesh->GetNumIndices();
 
-				if (!VertexBuffer || !IndexBuffer || IndexCount == 0)
-					continue;
+			if (!VertexBuffer || !IndexBuffer || IndexCount == 0)
+				continue;
 
-				Pipeline->SetVertexBuffer(VertexBuffer, sizeof(FNormalVertex));
-				Pipeline->SetIndexBuffer(IndexBuffer, 0);
+			Pipeline->SetVertexBuffer(VertexBuffer, sizeof(FNormalVertex));
+			Pipeline->SetIndexBuffer(IndexBuffer, 0);
 
-				// Draw call
-				Pipeline->DrawIndexed(IndexCount, 0, 0);
-			}
+			// Draw call
+			Pipeline->DrawIndexed(IndexCount, 0, 0);
 		}
 	}
 
@@ -1,6 +1,8 @@
 #pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
 
+class ULevel;
+
 // Matches the layout in DecalShader.hlsl
 struct FModelConstants
 {
@@ -34,8 +36,8 @@ public:
 	void SetInputLayout(ID3D11InputLayout* InLayout) { InputLayout = InLayout; }
 
 private:
-	// --- Octree Optimization ---
-	void Query(FOctree* InOctree, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives);
+	// --- Spatial Query Optimization ---
+	void Query(ULevel* InLevel, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives);
 
 	ID3D11VertexShader* VS = nullptr;
     ID3D11PixelShader* PS = nullptr;
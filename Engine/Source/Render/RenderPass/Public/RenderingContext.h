@@ -6,6 +6,34 @@ struct FRenderingContext
 
     FRenderingContext(const FCameraConstants* InViewProj, class UCamera* InCurrentCamera, EViewModeIndex InViewMode, uint64 InShowFlags, const D3D11_VIEWPORT& InViewport, const FVector2& InRenderTargetSize)
         : ViewProjConstants(InViewProj), CurrentCamera(InCurrentCamera), ViewMode(InViewMode), ShowFlags(InShowFlags), Viewport(InViewport), RenderTargetSize(InRenderTargetSize) {}
+
+    /**
+     * @brief 새 뷰포트 렌더링을 위해 설정을 교체하고 컴포넌트 목록을 비움
+     * 매 프레임 새 Context를 대입하면 배열이 전부 해제 / 재할당되므로, 용량을 유지한 채 재사용한다
+     */
+    void Reinitialize(const FCameraConstants* InViewProj, class UCamera* InCurrentCamera, EViewModeIndex InViewMode, uint64 InShowFlags, const D3D11_VIEWPORT& InViewport, const FVector2& InRenderTargetSize)
+    {
+        ViewProjConstants = InViewProj;
+        CurrentCamera = InCurrentCamera;
+        ViewMode = InViewMode;
+        ShowFlags = InShowFlags;
+        Viewport = InViewport;
+        RenderTargetSize = InRenderTargetSize;
+        Level = nullptr;
+
+        AllPrimitives.Reset();
+        StaticMeshes.Reset();
+        BillBoards.Reset();
+        EditorIcons.Reset();
+        Texts.Reset();
+        UUIDs.Reset();
+        Decals.Reset();
+        PointLights.Reset();
+        SpotLights.Reset();
+        DirectionalLights.Reset();
+        AmbientLights.Reset();
+        Fogs.Reset();
+    }
     
     const FCameraConstants* ViewProjConstants= nullptr;
     UCamera* CurrentCamera = nullptr;
@@ -13,6 +41,8 @@ struct FRenderingContext
     uint64 ShowFlags;
     D3D11_VIEWPORT Viewport;
     FVector2 RenderTargetSize;
+    // 렌더링 중인 레벨, 화면 밖 그림자 캐스터처럼 컴포넌트 목록 밖의 공간 질의가 필요할 때 사용
+    class ULevel* Level = nullptr;
 
     TArray<class UPrimitiveComponent*> AllPrimitives;
     // Components By Render Pass
@@ -109,11 +109,13 @@ private:
 	/**
 	 * @brief Spot light의 shadow map을 렌더링합니다.
 	 * @param Light Spot light component
+	 * @param Level 그림자 캐스터를 공간 인덱스로 찾을 레벨 (nullptr이면 Meshes를 전부 검사)
 	 * @param Meshes 렌더링할 static mesh 목록
 	 */
 	void RenderSpotShadowMap(
 		USpotLightComponent* Light,
 		uint32 AtlasIndex,
+		class ULevel* Level,
 		const TArray<UStaticMeshComponent*>& Meshes
 		);
 
@@ -121,11 +123,13 @@ private:
 	/**
 	 * @brief Point light의 cube shadow map을 렌더링합니다 (6면).
 	 * @param Light Point light component
+	 * @param Level 그림자 캐스터를 공간 인덱스로 찾을 레벨 (nullptr이면 Meshes를 전부 검사)
 	 * @param Meshes 렌더링할 static mesh 목록
 	 */
 	void RenderPointShadowMap(
 		UPointLightComponent* Light,
 		uint32 AtlasIndex,
+		class ULevel* Level,
 		const TArray<UStaticMeshComponent*>& Meshes
 		);
 
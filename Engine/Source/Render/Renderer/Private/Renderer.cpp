@@ -13,6 +13,7 @@
 #include "Component/Public/UUIDTextComponent.h"
 #include "Editor/Public/Camera.h"
 #include "Editor/Public/Editor.h"
+#include "Global/DynamicAABBTree.h"
 #include "Global/Octree.h"
 #include "Global/Octree.h"
 #include "Level/Public/Level.h"
@@ -43,6 +44,7 @@
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Render/UI/Viewport/Public/Viewport.h"
 #include "Render/UI/Viewport/Public/ViewportClient.h"
+#include "Runtime/Core/Public/Memory/MemStack.h"
 
 IMPLEMENT_SINGLETON_CLASS(URenderer, UObject)
 
@@ -983,25 +985,24 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 
 	const FCameraConstants& ViewProj = InViewport->GetViewportClient()->GetCamera()->GetFViewProjConstants();
 	static bool bCullingEnabled = false; // 임시 토글(초기값: 컬링 비활성)
-	TArray<UPrimitiveComponent*> FinalVisiblePrims;
+
+	// 뷰포트마다 다시 모으는 임시 목록은 프레임 메모리 스택에서 할당 (정상 상태에서 malloc 없음)
+	FMemMark Mark(FMemStack::Get());
+	TArray<UPrimitiveComponent*, TMemStackAllocator<>> FinalVisiblePrims;
 	if (!bCullingEnabled)
 	{
-		// 1) 옥트리(정적 프리미티브) 전부 수집
+		// 1) 옥트리(정적 프리미티브)와 동적 트리(움직인 프리미티브) 전부 수집
+		TArray<UPrimitiveComponent*, TMemStackAllocator<>> AllPrimitives;
 		if (FOctree* StaticOctree = WorldToRender->GetLevel()->GetStaticOctree())
 		{
-			TArray<UPrimitiveComponent*> AllStatics;
-			StaticOctree->GetAllPrimitives(AllStatics);
-			for (UPrimitiveComponent* Primitive : AllStatics)
-			{
-				if (Primitive && Primitive->IsVisible())
-				{
-					FinalVisiblePrims.Add(Primitive);
-				}
-			}
+			StaticOctree->GetAllPrimitives(AllPrimitives);
+		}
+		if (FDynamicAABBTree* DynamicTree = WorldToRender->GetLevel()->GetDynamicTree())
+		{
+			DynamicTree->GetAllPrimitives(AllPrimitives);
 		}
-		// 2) 동적 프리미티브 전부 수집
-		TArray<UPrimitiveComponent*>& DynamicPrimitives = WorldToRender->GetLevel()->GetDynamicPrimitives();
-		for (UPrimitiveComponent* Primitive : DynamicPrimitives)
+		FinalVisiblePrims.Reserve(AllPrimitives.Num());
+		for (UPrimitiveComponent* Primitive : AllPrimitives)
 		{
 			if (Primitive && Primitive->IsVisible())
 			{
@@ -1014,8 +1015,7 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 		FinalVisiblePrims = InViewport->GetViewportClient()->GetCamera()->GetViewVolumeCuller().GetRenderableObjects();
 	}
 
-	RenderingContext = FRenderingContext(
-
+	RenderingContext.Reinitialize(
 		&ViewProj,
 		InViewport->GetViewportClient()->GetCamera(),
 		InViewport->GetViewportClient()->GetViewMode(),
@@ -1023,6 +1023,7 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 		InViewport->GetRenderRect(),
 		{DeviceResources->GetViewportInfo().Width, DeviceResources->GetViewportInfo().Height}
 		);
+	RenderingContext.Level = WorldToRender->GetLevel();
 
 	// 1. Sort visible primitive components
 	RenderingContext.AllPrimitives = FinalVisiblePrims;
@@ -1337,23 +1338,17 @@ void URenderer::RenderHitProxyPass(UCamera* InCamera, const D3D11_VIEWPORT& InVi
 	// 모든 Primitive 컴포넌트 수집
 	TArray<UPrimitiveComponent*> AllVisiblePrims;
 
-	// Static Octree에서 정적 프리미티브 수집
+	// Static Octree와 동적 트리에서 프리미티브 수집
+	TArray<UPrimitiveComponent*> AllPrimitives;
 	if (FOctree* StaticOctree = CurrentLevel->GetStaticOctree())
 	{
-		TArray<UPrimitiveComponent*> AllStatics;
-		StaticOctree->GetAllPrimitives(AllStatics);
-		for (UPrimitiveComponent* Primitive : AllStatics)
-		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				AllVisiblePrims.Add(Primitive);
-			}
-		}
+		StaticOctree->GetAllPrimitives(AllPrimitives);
 	}
-
-	// 동적 프리미티브 수집
-	TArray<UPrimitiveComponent*>& DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
-	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
+	if (FDynamicAABBTree* DynamicTree = CurrentLevel->GetDynamicTree())
+	{
+		DynamicTree->GetAllPrimitives(AllPrimitives);
+	}
+	for (UPrimitiveComponent* Primitive : AllPrimitives)
 	{
 		if (Primitive && Primitive->IsVisible())
 		{
@@ -4,6 +4,7 @@
 #include "Render/Renderer/Public/Renderer.h"
 #include "Render/UI/Overlay/Public/D2DOverlayManager.h"
 #include "Manager/Render/Public/CascadeManager.h"
+#include "Runtime/Core/Public/Memory/MemStack.h"
 
 IMPLEMENT_SINGLETON_CLASS(UStatOverlay, UObject)
 
@@ -46,6 +47,10 @@ void UStatOverlay::Render()
     {
         RenderShadowInfo();
     }
+    if (IsStatEnabled(EStatType::LLM))
+    {
+        RenderLLM();
+    }
 }
 
 void UStatOverlay::RenderFPS()
@@ -67,10 +72,16 @@ void UStatOverlay::RenderFPS()
 
 void UStatOverlay::RenderMemory()
 {
-    float MemoryMB = static_cast<float>(TotalAllocationBytes) / (1024.0f * 1024.0f);
+    float MemoryMB = static_cast<float>(TotalAllocationBytes.load(std::memory_order_relaxed)) / (1024.0f * 1024.0f);
+
+    // 프레임 메모리 스택은 메인 스레드 기준 직전 프레임 / 전체 최대 사용량을 표시
+    const FMemStack& FrameMemStack = FMemStack::Get();
+    const float FrameStackKB = static_cast<float>(FrameMemStack.GetLastFrameHighWaterBytes()) / 1024.0f;
+    const float FrameStackPeakKB = static_cast<float>(FrameMemStack.GetPeakHighWaterBytes()) / 1024.0f;
 
-    char Buf[64];
-    (void)sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount);
+    char Buf[160];
+    (void)sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%llu objects) | Frame Stack: %.1f KB (Peak %.1f KB, %d chunks)",
+        MemoryMB, TotalAllocationCount.load(std::memory_order_relaxed), FrameStackKB, FrameStackPeakKB, FrameMemStack.GetNumChunks());
     FString text = Buf;
 
     float OffsetY = 0.0f;
@@ -314,6 +325,44 @@ void UStatOverlay::RenderShadowInfo()
     }
 }
 
+void UStatOverlay::RenderLLM()
+{
+    // 다른 통계와 겹치지 않도록 오른쪽 열에 태그별 한 줄씩 표시
+    const float ColumnX = OverlayX + 580.0f;
+    float CurrentY = OverlayY;
+    constexpr float LineHeight = 20.0f;
+
+    {
+        char Buf[128];
+        (void)sprintf_s(Buf, sizeof(Buf), "LLM %-9s %10s %10s %9s", "Tag", "Current", "Peak", "Allocs");
+        RenderText(Buf, ColumnX, CurrentY, 1.0f, 0.8f, 0.0f);
+        CurrentY += LineHeight;
+    }
+
+    for (uint32 Tag = 0; Tag < static_cast<uint32>(ELLMTag::Count); ++Tag)
+    {
+        const ELLMTag LLMTag = static_cast<ELLMTag>(Tag);
+        const FLLMTagStats Stats = FLowLevelMemTracker::GetTagStats(LLMTag);
+        const float CurrentMB = static_cast<float>(Stats.CurrentBytes) / (1024.0f * 1024.0f);
+        const float PeakMB = static_cast<float>(Stats.PeakBytes) / (1024.0f * 1024.0f);
+
+        char Buf[128];
+        (void)sprintf_s(Buf, sizeof(Buf), "    %-9s %7.2f MB %7.2f MB %9lld",
+            FLowLevelMemTracker::GetTagName(LLMTag), CurrentMB, PeakMB, Stats.NumAllocations);
+
+        float r = 0.8f, g = 0.8f, b = 0.8f;
+        if (CurrentMB > 100.0f) { r = 1.0f; g = 1.0f; b = 0.0f; }
+
+        RenderText(Buf, ColumnX, CurrentY, r, g, b);
+        CurrentY += LineHeight;
+    }
+
+    if (FLowLevelMemTracker::IsCsvCapturing())
+    {
+        RenderText("    CSV capture in progress", ColumnX, CurrentY, 1.0f, 0.3f, 0.3f);
+    }
+}
+
 void UStatOverlay::RenderText(const FString& Text, float x, float y, float r, float g, float b)
 {
     if (Text.empty())
@@ -10,7 +10,8 @@ enum class EStatType : uint8
 	Decal =		1 << 3,  // 8
 	Time =		1 << 4,	 // 16
 	Shadow =	1 << 5,  // 32
-	All = FPS | Memory | Picking | Time | Decal | Shadow
+	LLM =		1 << 6,  // 64
+	All = FPS | Memory | Picking | Time | Decal | Shadow | LLM
 };
 
 UCLASS()
@@ -31,6 +32,7 @@ public:
 	void ToggleTime() { IsStatEnabled(EStatType::Time) ? DisableStat(EStatType::Time) : EnableStat(EStatType::Time); }
 	void ToggleDecal() { IsStatEnabled(EStatType::Decal) ? DisableStat(EStatType::Decal) : EnableStat(EStatType::Decal); }
 	void ToggleShadow() { IsStatEnabled(EStatType::Shadow) ? DisableStat(EStatType::Shadow) : EnableStat(EStatType::Shadow); }
+	void ToggleLLM() { IsStatEnabled(EStatType::LLM) ? DisableStat(EStatType::LLM) : EnableStat(EStatType::LLM); }
 	void ToggleAll() { IsStatEnabled(EStatType::All) ? DisableStat(EStatType::All) : EnableStat(EStatType::All); }
 
 	// Stat control methods (명시적 켜기/끄기)
@@ -40,6 +42,7 @@ public:
 	void ShowTime() { EnableStat(EStatType::Time); }
 	void ShowDecal() { EnableStat(EStatType::Decal); }
 	void ShowShadow() { EnableStat(EStatType::Shadow); }
+	void ShowLLM() { EnableStat(EStatType::LLM); }
 	void ShowAll() { EnableStat(EStatType::All); }
 	void HideAll() { SetStatType(EStatType::None); }
 
@@ -55,6 +58,7 @@ private:
 	void RenderDecalInfo();
 	void RenderTimeInfo();
 	void RenderShadowInfo();
+	void RenderLLM();
 	void RenderText(const FString& Text, float X, float Y, float R, float G, float B);
 
 	// FPS Stats
@@ -6,6 +6,7 @@
 #include "Manager/Render/Public/CascadeManager.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/UELogParser.h"
+#include "Utility/Public/EngineBenchmark.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 #include "Utility/Public/LogFileWriter.h"
 
@@ -799,6 +800,48 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// Benchmark 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "bench" || (CommandLower.length() > 6 && CommandLower.substr(0, 6) == "bench "))
+	{
+		FString BenchmarkName = CommandLower.length() > 6 ? CommandLower.substr(6) : FString();
+		if (!FEngineBenchmark::Run(BenchmarkName))
+		{
+			FEngineBenchmark::PrintUsage();
+		}
+	}
+
+	// LLM (태그별 메모리) 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "llm" || (CommandLower.length() > 4 && CommandLower.substr(0, 4) == "llm "))
+	{
+		FString LLMCommand = CommandLower.length() > 4 ? CommandLower.substr(4) : FString();
+		if (LLMCommand.empty())
+		{
+			FLowLevelMemTracker::DumpToLog();
+		}
+		else if (LLMCommand == "csv start")
+		{
+			FLowLevelMemTracker::BeginCsvCapture();
+		}
+		else if (LLMCommand == "csv stop")
+		{
+			FLowLevelMemTracker::EndCsvCapture();
+		}
+		else if (LLMCommand == "reset")
+		{
+			FLowLevelMemTracker::ResetPeaks();
+			AddLog(ELogType::Success, "LLM peaks reset");
+		}
+		else
+		{
+			AddLog(ELogType::Error, "Unknown llm command: %s", LLMCommand.data());
+			AddLog(ELogType::Info, "Available: llm, llm csv start, llm csv stop, llm reset");
+		}
+	}
+
 	// shadow_filter 명령어 처리
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -983,7 +1026,10 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
 		AddLog(ELogType::Info, "  STAT PICK - Show picking performance overlay");
 		AddLog(ELogType::Info, "  STAT SHADOW - Show light and shadow map stats");
+		AddLog(ELogType::Info, "  STAT LLM - Show per-tag memory overlay");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  BENCH <name> - Run engine micro benchmark (BENCH for list)");
+		AddLog(ELogType::Info, "  LLM [CSV START | CSV STOP | RESET] - Per-tag memory dump / per-frame CSV capture");
 		AddLog(ELogType::Info, "  SHADOW_FILTER <filter> - Apply shadow filter to all lights");
 		AddLog(ELogType::Debug, "    Available filters: VSM, PCF, UnFiltered, VSM_BOX, VSM_GAUSSIAN, SAVSM");
 		AddLog(ELogType::Debug, "    Example: shadow_filter VSM");
@@ -1049,6 +1095,11 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowShadow();
 		AddLog(ELogType::Success, "Shadow overlay enabled");
 	}
+	else if (StatCommand == "llm")
+	{
+		StatOverlay.ShowLLM();
+		AddLog(ELogType::Success, "LLM overlay enabled");
+	}
 	else if (StatCommand == "all")
 	{
 		StatOverlay.ShowAll();
@@ -1062,7 +1113,7 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	else
 	{
 		AddLog(ELogType::Error, "Unknown stat command: %s", StatCommand.data());
-		AddLog(ELogType::Info, "Available: fps, memory, pick, time, decal, shadow, all, none");
+		AddLog(ELogType::Info, "Available: fps, memory, pick, time, decal, shadow, llm, all, none");
 	}
 }
 
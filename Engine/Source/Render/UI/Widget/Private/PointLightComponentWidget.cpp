@@ -289,7 +289,7 @@ void UPointLightComponentWidget::RenderWidget()
     ImTextureID TextureID = (ImTextureID)ShadowSRV;
     if (ShadowSRV)
     {
-        FRenderingContext RenderingContext = URenderer::GetInstance().GetRenderingContext();
+        const FRenderingContext& RenderingContext = URenderer::GetInstance().GetRenderingContext();
         int32 PointLightIdx = 0;
         for (UPointLightComponent* PointLight : RenderingContext.PointLights)
         {
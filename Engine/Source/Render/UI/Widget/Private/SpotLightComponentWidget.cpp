@@ -312,7 +312,7 @@ void USpotLightComponentWidget::RenderWidget()
     ImTextureID TextureID = (ImTextureID)ShadowSRV;
     if (ShadowSRV)
     {
-        FRenderingContext RenderingContext = URenderer::GetInstance().GetRenderingContext();
+        const FRenderingContext& RenderingContext = URenderer::GetInstance().GetRenderingContext();
         int32 SpotLightIdx = 0;
         for (USpotLightComponent* SpotLight : RenderingContext.SpotLights)
         {
@@ -0,0 +1,540 @@
+#include "pch.h"
+#include "Runtime/Core/Public/Async/TaskGraph.h"
+
+namespace
+{
+	/** @brief 현재 스레드가 사용하는 덱 인덱스 (-1이면 엔진에 등록되지 않은 스레드) */
+	thread_local int32 GTaskQueueIndex = -1;
+
+	/** @brief 덱은 2의 거듭제곱 용량을 가정하고 인덱스를 마스킹 */
+	template<int64 Capacity>
+	constexpr int64 WrapIndex(int64 InIndex)
+	{
+		static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+		return InIndex & (Capacity - 1);
+	}
+
+	/** @brief 잠들기 전에 일을 다시 찾아보는 횟수 (짧은 공백마다 잠들었다 깨는 비용을 피함) */
+	constexpr int32 NumSpinsBeforeSleep = 64;
+
+	/** @brief 워커 수 상한 */
+	constexpr int32 MaxWorkers = 63;
+}
+
+// === FGraphEventRef ===
+
+FGraphEventRef::FGraphEventRef(FGraphTask* InTask)
+	: Task(InTask)
+{
+	if (Task)
+	{
+		Task->AddRef();
+	}
+}
+
+FGraphEventRef::~FGraphEventRef()
+{
+	if (Task)
+	{
+		Task->Release();
+	}
+}
+
+FGraphEventRef::FGraphEventRef(const FGraphEventRef& Other)
+	: FGraphEventRef(Other.Task)
+{
+}
+
+FGraphEventRef::FGraphEventRef(FGraphEventRef&& Other) noexcept
+	: Task(Other.Task)
+{
+	Other.Task = nullptr;
+}
+
+FGraphEventRef& FGraphEventRef::operator=(const FGraphEventRef& Other)
+{
+	if (Task != Other.Task)
+	{
+		FGraphEventRef Copy(Other);
+		std::swap(Task, Copy.Task);
+	}
+	return *this;
+}
+
+FGraphEventRef& FGraphEventRef::operator=(FGraphEventRef&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		if (Task)
+		{
+			Task->Release();
+		}
+		Task = Other.Task;
+		Other.Task = nullptr;
+	}
+	return *this;
+}
+
+bool FGraphEventRef::IsComplete() const
+{
+	return !Task || Task->IsComplete();
+}
+
+// === FGraphTask ===
+
+void FGraphTask::Release()
+{
+	if (RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		delete this;
+	}
+}
+
+bool FGraphTask::AddSubsequent(FGraphTask* InSubsequent)
+{
+	while (SubsequentsLock.test_and_set(std::memory_order_acquire))
+	{
+	}
+
+	const bool bAdded = !bIsComplete.load(std::memory_order_relaxed);
+	if (bAdded)
+	{
+		InSubsequent->AddRef();
+		Subsequents.Add(InSubsequent);
+	}
+
+	SubsequentsLock.clear(std::memory_order_release);
+	return bAdded;
+}
+
+void FGraphTask::Execute()
+{
+	Invoke(Storage);
+
+	// 캡처한 자원은 이벤트 핸들이 남아 있어도 바로 해제
+	DestroyFunction(Storage);
+
+	// 완료 표시와 후속 목록 회수를 같은 잠금 안에서 해야 AddSubsequent와 경쟁하지 않는다
+	TArray<FGraphTask*, TInlineAllocator<4>> ReadySubsequents;
+	while (SubsequentsLock.test_and_set(std::memory_order_acquire))
+	{
+	}
+	bIsComplete.store(true, std::memory_order_release);
+	std::swap(ReadySubsequents, Subsequents);
+	SubsequentsLock.clear(std::memory_order_release);
+
+	FTaskGraph& TaskGraph = FTaskGraph::Get();
+	for (FGraphTask* Subsequent : ReadySubsequents)
+	{
+		if (Subsequent->NumPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			TaskGraph.Schedule(Subsequent);
+		}
+		Subsequent->Release();
+	}
+
+	// 실행 큐가 가지고 있던 참조
+	Release();
+}
+
+// === FTaskGraph::FWorkStealingQueue ===
+
+bool FTaskGraph::FWorkStealingQueue::Push(FGraphTask* InTask)
+{
+	const int64 CurrentBottom = Bottom.load(std::memory_order_relaxed);
+	const int64 CurrentTop = Top.load(std::memory_order_acquire);
+	if (CurrentBottom - CurrentTop >= Capacity)
+	{
+		return false;
+	}
+
+	Buffer[WrapIndex<Capacity>(CurrentBottom)].store(InTask, std::memory_order_relaxed);
+	Bottom.store(CurrentBottom + 1, std::memory_order_release);
+	return true;
+}
+
+FGraphTask* FTaskGraph::FWorkStealingQueue::Pop()
+{
+	const int64 NewBottom = Bottom.load(std::memory_order_relaxed) - 1;
+	Bottom.store(NewBottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64 CurrentTop = Top.load(std::memory_order_relaxed);
+
+	if (CurrentTop > NewBottom)
+	{
+		// 비어 있음
+		Bottom.store(NewBottom + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	FGraphTask* Task = Buffer[WrapIndex<Capacity>(NewBottom)].load(std::memory_order_relaxed);
+	if (CurrentTop == NewBottom)
+	{
+		// 마지막 하나는 훔치려는 스레드와 Top을 두고 경쟁
+		if (!Top.compare_exchange_strong(CurrentTop, CurrentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			Task = nullptr;
+		}
+		Bottom.store(NewBottom + 1, std::memory_order_relaxed);
+	}
+	return Task;
+}
+
+FGraphTask* FTaskGraph::FWorkStealingQueue::Steal()
+{
+	int64 CurrentTop = Top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	const int64 CurrentBottom = Bottom.load(std::memory_order_acquire);
+
+	if (CurrentTop >= CurrentBottom)
+	{
+		return nullptr;
+	}
+
+	FGraphTask* Task = Buffer[WrapIndex<Capacity>(CurrentTop)].load(std::memory_order_relaxed);
+	if (!Top.compare_exchange_strong(CurrentTop, CurrentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+	{
+		return nullptr;
+	}
+	return Task;
+}
+
+bool FTaskGraph::FWorkStealingQueue::IsEmpty() const
+{
+	return Top.load(std::memory_order_acquire) >= Bottom.load(std::memory_order_acquire);
+}
+
+// === FTaskGraph ===
+
+FTaskGraph& FTaskGraph::Get()
+{
+	static FTaskGraph Instance;
+	return Instance;
+}
+
+FTaskGraph::~FTaskGraph()
+{
+	Shutdown();
+}
+
+void FTaskGraph::Initialize(int32 InNumWorkers)
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	if (InNumWorkers <= 0)
+	{
+		const int32 NumCores = static_cast<int32>(thread::hardware_concurrency());
+		InNumWorkers = NumCores > 1 ? NumCores - 1 : 1;
+	}
+	NumWorkers = InNumWorkers < MaxWorkers ? InNumWorkers : MaxWorkers;
+
+	// 마지막 덱은 게임 스레드용
+	for (int32 Index = 0; Index <= NumWorkers; ++Index)
+	{
+		Queues.Add(new FWorkStealingQueue());
+	}
+	GTaskQueueIndex = NumWorkers;
+
+	bShouldStop.store(false);
+	bIsInitialized = true;
+
+	for (int32 Index = 0; Index < NumWorkers; ++Index)
+	{
+		Workers.Emplace(&FTaskGraph::WorkerMain, this, Index);
+	}
+
+	UE_LOG_SYSTEM("TaskGraph: 워커 스레드 %d개로 초기화", NumWorkers);
+}
+
+void FTaskGraph::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	// 남은 태스크를 모두 처리 (게임 스레드 전용 태스크 포함)
+	while (ProcessGameThreadTasks() > 0 || HasQueuedWork())
+	{
+		if (FGraphTask* Task = FindWork(GTaskQueueIndex))
+		{
+			Task->Execute();
+		}
+	}
+
+	{
+		std::lock_guard<mutex> Lock(SleepMutex);
+		bShouldStop.store(true);
+	}
+	SleepCondition.notify_all();
+
+	for (thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+
+	for (FWorkStealingQueue* Queue : Queues)
+	{
+		delete Queue;
+	}
+	Queues.Empty();
+
+	GTaskQueueIndex = -1;
+	NumWorkers = 0;
+	bIsInitialized = false;
+}
+
+bool FTaskGraph::IsInGameThread() const
+{
+	return bIsInitialized && GTaskQueueIndex == NumWorkers;
+}
+
+void FTaskGraph::AddPrerequisitesAndSchedule(FGraphTask* InTask, const FGraphEventArray& InPrerequisites)
+{
+	for (const FGraphEventRef& Prerequisite : InPrerequisites)
+	{
+		FGraphTask* PrerequisiteTask = Prerequisite.GetTask();
+		if (!PrerequisiteTask)
+		{
+			continue;
+		}
+
+		// 등록 전에 먼저 올려 두어야, 선행 태스크가 그 사이에 끝나도 수가 음수로 내려가지 않는다
+		InTask->NumPendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+		if (!PrerequisiteTask->AddSubsequent(InTask))
+		{
+			InTask->NumPendingPrerequisites.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	// 설정 중에 잡아 둔 1을 내려놓음
+	if (InTask->NumPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Schedule(InTask);
+	}
+}
+
+void FTaskGraph::Schedule(FGraphTask* InTask)
+{
+	// 초기화 전(에디터 외 도구 등)에는 호출한 스레드에서 바로 실행
+	if (!bIsInitialized)
+	{
+		InTask->Execute();
+		return;
+	}
+
+	if (InTask->GetThread() == ENamedThread::GameThread)
+	{
+		std::lock_guard<mutex> Lock(GameThreadQueueMutex);
+		GameThreadTasks.Add(InTask);
+		return;
+	}
+
+	const int32 QueueIndex = GTaskQueueIndex;
+	if (QueueIndex < 0 || !Queues[QueueIndex]->Push(InTask))
+	{
+		std::lock_guard<mutex> Lock(SharedQueueMutex);
+		SharedQueue.push(InTask);
+		NumSharedTasks.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	WakeWorker();
+}
+
+FGraphTask* FTaskGraph::FindWork(int32 InQueueIndex)
+{
+	if (InQueueIndex >= 0)
+	{
+		if (FGraphTask* Task = Queues[InQueueIndex]->Pop())
+		{
+			return Task;
+		}
+	}
+
+	if (NumSharedTasks.load(std::memory_order_relaxed) > 0)
+	{
+		std::lock_guard<mutex> Lock(SharedQueueMutex);
+		if (!SharedQueue.empty())
+		{
+			FGraphTask* Task = SharedQueue.front();
+			SharedQueue.pop();
+			NumSharedTasks.fetch_sub(1, std::memory_order_relaxed);
+			return Task;
+		}
+	}
+
+	// 스레드마다 다른 위치에서 시작해 같은 덱으로 몰리지 않도록 함
+	const int32 NumQueues = Queues.Num();
+	const int32 StartIndex = InQueueIndex >= 0 ? InQueueIndex + 1 : 0;
+	for (int32 Offset = 0; Offset < NumQueues; ++Offset)
+	{
+		const int32 VictimIndex = (StartIndex + Offset) % NumQueues;
+		if (VictimIndex == InQueueIndex)
+		{
+			continue;
+		}
+
+		if (FGraphTask* Task = Queues[VictimIndex]->Steal())
+		{
+			return Task;
+		}
+	}
+
+	return nullptr;
+}
+
+bool FTaskGraph::HasQueuedWork() const
+{
+	if (NumSharedTasks.load(std::memory_order_seq_cst) > 0)
+	{
+		return true;
+	}
+
+	for (const FWorkStealingQueue* Queue : Queues)
+	{
+		if (!Queue->IsEmpty())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FTaskGraph::WakeWorker()
+{
+	// 잠들려는 워커는 NumSleepingWorkers를 올린 뒤 큐를 다시 확인하므로, 둘 중 하나는 반드시 상대를 본다
+	// 이미 깨우는 중인 워커가 있으면 그 워커가 일을 가져간 뒤 다음 워커를 깨우므로, 태스크마다 notify하지 않는다
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (NumSleepingWorkers.load(std::memory_order_seq_cst) == 0 || bIsWakingWorker.load(std::memory_order_seq_cst))
+	{
+		return;
+	}
+
+	{
+		// 신호는 SleepMutex 안에서 대기 블록에 워커가 있을 때만 세움
+		// 그 워커는 블록을 나갈 때 같은 잠금 안에서 신호를 받아 가므로 주인 없는 신호가 남지 않는다
+		std::lock_guard<mutex> Lock(SleepMutex);
+		if (NumSleepingWorkers.load(std::memory_order_relaxed) == 0 || bIsWakingWorker.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+		bIsWakingWorker.store(true, std::memory_order_relaxed);
+	}
+	SleepCondition.notify_one();
+}
+
+void FTaskGraph::WorkerMain(int32 InQueueIndex)
+{
+	GTaskQueueIndex = InQueueIndex;
+
+	int32 NumIdleSpins = 0;
+	bool bWasWoken = false;
+	while (true)
+	{
+		if (FGraphTask* Task = FindWork(InQueueIndex))
+		{
+			// 깨어난 워커가 일을 찾았으면, 남은 일을 위해 다음 워커를 깨울 수 있게 함
+			if (bWasWoken)
+			{
+				bWasWoken = false;
+				bIsWakingWorker.store(false, std::memory_order_seq_cst);
+				if (HasQueuedWork())
+				{
+					WakeWorker();
+				}
+			}
+
+			Task->Execute();
+			NumIdleSpins = 0;
+			continue;
+		}
+
+		// 종료 요청이 와도 남은 태스크를 모두 처리한 뒤에 나감
+		if (bShouldStop.load(std::memory_order_relaxed))
+		{
+			break;
+		}
+
+		if (++NumIdleSpins < NumSpinsBeforeSleep)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		if (bWasWoken)
+		{
+			// 깨어났지만 일이 없었음 (다른 스레드가 먼저 가져감)
+			bWasWoken = false;
+			bIsWakingWorker.store(false, std::memory_order_seq_cst);
+		}
+
+		std::unique_lock<mutex> Lock(SleepMutex);
+		NumSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (!HasQueuedWork() && !bShouldStop.load(std::memory_order_relaxed))
+		{
+			SleepCondition.wait(Lock);
+		}
+		NumSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+
+		// 신호는 이 잠금 안에서만 세워지므로, 잠들지 않고 바로 나온 경우에도 블록을 나가는 워커가 신호를 받아 감
+		// (여러 워커가 함께 받아 가도 각자 한 번씩 내릴 뿐이라 신호가 남아 막히지 않는다)
+		bWasWoken = bIsWakingWorker.load(std::memory_order_relaxed);
+		NumIdleSpins = 0;
+	}
+}
+
+void FTaskGraph::Wait(const FGraphEventRef& InEvent)
+{
+	const bool bIsGameThread = IsInGameThread();
+	while (!InEvent.IsComplete())
+	{
+		if (bIsGameThread && ProcessGameThreadTasks() > 0)
+		{
+			continue;
+		}
+
+		if (FGraphTask* Task = bIsInitialized ? FindWork(GTaskQueueIndex) : nullptr)
+		{
+			Task->Execute();
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FTaskGraph::Wait(const FGraphEventArray& InEvents)
+{
+	for (const FGraphEventRef& Event : InEvents)
+	{
+		Wait(Event);
+	}
+}
+
+int32 FTaskGraph::ProcessGameThreadTasks()
+{
+	TArray<FGraphTask*> ReadyTasks;
+	{
+		std::lock_guard<mutex> Lock(GameThreadQueueMutex);
+		if (GameThreadTasks.IsEmpty())
+		{
+			return 0;
+		}
+		std::swap(ReadyTasks, GameThreadTasks);
+	}
+
+	for (FGraphTask* Task : ReadyTasks)
+	{
+		Task->Execute();
+	}
+	return ReadyTasks.Num();
+}
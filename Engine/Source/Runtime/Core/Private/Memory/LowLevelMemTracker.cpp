@@ -0,0 +1,243 @@
+#include "pch.h"
+#include "Runtime/Core/Public/Memory/LowLevelMemTracker.h"
+
+namespace
+{
+	constexpr uint32 NumTags = static_cast<uint32>(ELLMTag::Count);
+
+	constexpr const char* TagNames[] =
+	{
+		"Untagged",
+		"UObject",
+		"Assets",
+		"Renderer",
+		"Lua",
+		"World",
+		"UI",
+		"Editor",
+	};
+
+	static_assert(sizeof(TagNames) / sizeof(TagNames[0]) == NumTags, "ELLMTag와 TagNames의 개수가 같아야 합니다");
+
+	/**
+	 * @brief 스레드 하나의 태그별 카운터
+	 * 소유 스레드만 값을 쓰므로 lock 접두사가 붙는 read-modify-write 없이 load + store로 갱신하고,
+	 * 읽는 쪽(오버레이, CSV)에서 모든 스레드의 값을 합산한다
+	 * 다른 스레드가 할당한 메모리를 해제하면 해제한 스레드의 값이 음수가 될 수 있지만 합계는 정확하다
+	 */
+	struct alignas(64) FThreadTagCounters
+	{
+		std::atomic<int64> CurrentBytes[NumTags];
+		std::atomic<int64> NumAllocations[NumTags];
+		std::atomic<uint64> TotalAllocations[NumTags];
+	};
+
+	/** @brief 스레드별 슬롯 개수. 넘치는 스레드는 마지막 공유 슬롯을 atomic 연산으로 함께 사용 */
+	constexpr uint32 MaxThreadSlots = 64;
+
+	// operator new에서 접근하므로 상수 초기화되는 전역만 사용
+	FThreadTagCounters GThreadCounters[MaxThreadSlots + 1];
+	FThreadTagCounters& GSharedCounters = GThreadCounters[MaxThreadSlots];
+	std::atomic<uint32> GNumThreadSlots{0};
+
+	/** @brief 합산할 때 샘플링한 태그별 최대 사용량 */
+	std::atomic<int64> GPeakBytes[NumTags];
+
+	thread_local ELLMTag GCurrentTag = ELLMTag::Untagged;
+	thread_local FThreadTagCounters* GThreadSlot = nullptr;
+
+	FThreadTagCounters& GetThreadCounters()
+	{
+		if (!GThreadSlot)
+		{
+			const uint32 SlotIndex = GNumThreadSlots.fetch_add(1, std::memory_order_relaxed);
+			GThreadSlot = SlotIndex < MaxThreadSlots ? &GThreadCounters[SlotIndex] : &GSharedCounters;
+		}
+		return *GThreadSlot;
+	}
+
+	template<typename ValueType>
+	void AddCounter(FThreadTagCounters& InCounters, std::atomic<ValueType>& InCounter, ValueType InDelta)
+	{
+		if (&InCounters == &GSharedCounters)
+		{
+			InCounter.fetch_add(InDelta, std::memory_order_relaxed);
+		}
+		else
+		{
+			InCounter.store(InCounter.load(std::memory_order_relaxed) + InDelta, std::memory_order_relaxed);
+		}
+	}
+
+	uint32 GetNumUsedSlots()
+	{
+		const uint32 NumSlots = GNumThreadSlots.load(std::memory_order_relaxed);
+		return NumSlots < MaxThreadSlots ? NumSlots : MaxThreadSlots;
+	}
+
+	/** @brief 모든 스레드 슬롯의 카운터를 합산 (최대 사용량은 합산할 때마다 갱신) */
+	FLLMTagStats SumTagCounters(uint32 InTag)
+	{
+		FLLMTagStats Stats;
+		auto AddSlot = [&Stats, InTag](const FThreadTagCounters& InCounters)
+		{
+			Stats.CurrentBytes += InCounters.CurrentBytes[InTag].load(std::memory_order_relaxed);
+			Stats.NumAllocations += InCounters.NumAllocations[InTag].load(std::memory_order_relaxed);
+			Stats.TotalAllocations += InCounters.TotalAllocations[InTag].load(std::memory_order_relaxed);
+		};
+
+		const uint32 NumSlots = GetNumUsedSlots();
+		for (uint32 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			AddSlot(GThreadCounters[Slot]);
+		}
+		AddSlot(GSharedCounters);
+
+		int64 PeakBytes = GPeakBytes[InTag].load(std::memory_order_relaxed);
+		while (Stats.CurrentBytes > PeakBytes && !GPeakBytes[InTag].compare_exchange_weak(PeakBytes, Stats.CurrentBytes, std::memory_order_relaxed))
+		{
+		}
+		Stats.PeakBytes = Stats.CurrentBytes > PeakBytes ? Stats.CurrentBytes : PeakBytes;
+		return Stats;
+	}
+
+	// CSV 기록 상태 (메인 스레드 전용)
+	FILE* GCsvFile = nullptr;
+	uint64 GCsvFrameNumber = 0;
+	uint64 GCsvPreviousTotalAllocations[NumTags] = {};
+}
+
+ELLMTag FLowLevelMemTracker::GetCurrentTag()
+{
+	return GCurrentTag;
+}
+
+ELLMTag FLowLevelMemTracker::SetCurrentTag(ELLMTag InTag)
+{
+	const ELLMTag PreviousTag = GCurrentTag;
+	GCurrentTag = InTag;
+	return PreviousTag;
+}
+
+void FLowLevelMemTracker::OnAlloc(uint8 InTag, size_t InSize)
+{
+	FThreadTagCounters& Counters = GetThreadCounters();
+	AddCounter<int64>(Counters, Counters.CurrentBytes[InTag], static_cast<int64>(InSize));
+	AddCounter<int64>(Counters, Counters.NumAllocations[InTag], 1);
+	AddCounter<uint64>(Counters, Counters.TotalAllocations[InTag], 1);
+}
+
+void FLowLevelMemTracker::OnFree(uint8 InTag, size_t InSize)
+{
+	FThreadTagCounters& Counters = GetThreadCounters();
+	AddCounter<int64>(Counters, Counters.CurrentBytes[InTag], -static_cast<int64>(InSize));
+	AddCounter<int64>(Counters, Counters.NumAllocations[InTag], -1);
+}
+
+FLLMTagStats FLowLevelMemTracker::GetTagStats(ELLMTag InTag)
+{
+	return SumTagCounters(static_cast<uint32>(InTag));
+}
+
+const char* FLowLevelMemTracker::GetTagName(ELLMTag InTag)
+{
+	return InTag < ELLMTag::Count ? TagNames[static_cast<uint32>(InTag)] : "Invalid";
+}
+
+void FLowLevelMemTracker::ResetPeaks()
+{
+	for (uint32 Tag = 0; Tag < NumTags; ++Tag)
+	{
+		GPeakBytes[Tag].store(0, std::memory_order_relaxed);
+		SumTagCounters(Tag);
+	}
+}
+
+void FLowLevelMemTracker::DumpToLog()
+{
+	UE_LOG_SYSTEM("LLM: %-10s %12s %12s %10s %12s", "Tag", "Current KB", "Peak KB", "Allocs", "Total Allocs");
+	for (uint32 Tag = 0; Tag < NumTags; ++Tag)
+	{
+		const FLLMTagStats Stats = GetTagStats(static_cast<ELLMTag>(Tag));
+		UE_LOG_INFO("     %-10s %12.1f %12.1f %10lld %12llu", TagNames[Tag],
+			static_cast<double>(Stats.CurrentBytes) / 1024.0, static_cast<double>(Stats.PeakBytes) / 1024.0,
+			Stats.NumAllocations, Stats.TotalAllocations);
+	}
+}
+
+bool FLowLevelMemTracker::BeginCsvCapture()
+{
+	if (GCsvFile)
+	{
+		return false;
+	}
+
+	CreateDirectoryA("Log", nullptr);
+
+	SYSTEMTIME LocalTime;
+	GetLocalTime(&LocalTime);
+
+	char FileName[256];
+	(void)sprintf_s(FileName, sizeof(FileName), "Log/LLM_%04d-%02d-%02d_%02d-%02d-%02d.csv",
+		LocalTime.wYear, LocalTime.wMonth, LocalTime.wDay,
+		LocalTime.wHour, LocalTime.wMinute, LocalTime.wSecond);
+
+	if (fopen_s(&GCsvFile, FileName, "w") != 0 || !GCsvFile)
+	{
+		GCsvFile = nullptr;
+		UE_LOG_ERROR("LLM: CSV 파일을 만들 수 없습니다 (%s)", FileName);
+		return false;
+	}
+
+	// 태그마다 현재 KB, 해당 프레임의 할당 횟수 두 열
+	fprintf(GCsvFile, "Frame");
+	for (uint32 Tag = 0; Tag < NumTags; ++Tag)
+	{
+		fprintf(GCsvFile, ",%s KB,%s Allocs/Frame", TagNames[Tag], TagNames[Tag]);
+		GCsvPreviousTotalAllocations[Tag] = SumTagCounters(Tag).TotalAllocations;
+	}
+	fprintf(GCsvFile, "\n");
+
+	GCsvFrameNumber = 0;
+	UE_LOG_SUCCESS("LLM: CSV 기록 시작 (%s)", FileName);
+	return true;
+}
+
+void FLowLevelMemTracker::EndCsvCapture()
+{
+	if (!GCsvFile)
+	{
+		return;
+	}
+
+	fclose(GCsvFile);
+	GCsvFile = nullptr;
+	UE_LOG_SUCCESS("LLM: CSV 기록 종료 (%llu frames)", GCsvFrameNumber);
+}
+
+bool FLowLevelMemTracker::IsCsvCapturing()
+{
+	return GCsvFile != nullptr;
+}
+
+void FLowLevelMemTracker::EndFrame()
+{
+	if (!GCsvFile)
+	{
+		// 기록 중이 아니어도 최대 사용량은 프레임마다 샘플링
+		for (uint32 Tag = 0; Tag < NumTags; ++Tag)
+		{
+			SumTagCounters(Tag);
+		}
+		return;
+	}
+
+	fprintf(GCsvFile, "%llu", GCsvFrameNumber++);
+	for (uint32 Tag = 0; Tag < NumTags; ++Tag)
+	{
+		const FLLMTagStats Stats = SumTagCounters(Tag);
+		fprintf(GCsvFile, ",%.1f,%llu", static_cast<double>(Stats.CurrentBytes) / 1024.0, Stats.TotalAllocations - GCsvPreviousTotalAllocations[Tag]);
+		GCsvPreviousTotalAllocations[Tag] = Stats.TotalAllocations;
+	}
+	fprintf(GCsvFile, "\n");
+}
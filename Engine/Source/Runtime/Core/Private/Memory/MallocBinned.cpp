@@ -0,0 +1,548 @@
+#include "pch.h"
+#include "Runtime/Core/Public/Memory/MallocBinned.h"
+
+namespace
+{
+	std::atomic<uint64> GOSReservedBytes{0};
+	std::atomic<uint64> GNumLargeAllocations{0};
+
+	/** @brief 크기 클래스 (16바이트 단위로 128까지, 이후 2배 구간마다 4단계) */
+	constexpr uint32 SizeClassBytes[] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256,
+		320, 384, 448, 512,
+		640, 768, 896, 1024,
+		1280, 1536, 1792, 2048,
+		2560, 3072, 3584, 4096,
+		5120, 6144, 7168, 8192,
+		10240, 12288, 14336, 16384,
+	};
+
+	constexpr uint32 NumSizeClasses = static_cast<uint32>(sizeof(SizeClassBytes) / sizeof(SizeClassBytes[0]));
+	constexpr uint32 LargeSizeClass = 0xFF;
+
+	static_assert(SizeClassBytes[NumSizeClasses - 1] == FMallocBinned::MaxSmallSize, "마지막 크기 클래스는 MaxSmallSize와 같아야 합니다");
+	static_assert(NumSizeClasses < LargeSizeClass, "크기 클래스 인덱스가 uint8에 들어가야 합니다");
+
+	/** @brief (Size + 15) / 16 -> 크기 클래스 인덱스 조회 테이블 */
+	struct FSizeClassLookup
+	{
+		constexpr FSizeClassLookup()
+			: ClassIndex{}
+		{
+			uint32 Class = 0;
+			for (uint32 Index = 0; Index <= FMallocBinned::MaxSmallSize / 16; ++Index)
+			{
+				while (SizeClassBytes[Class] < Index * 16)
+				{
+					++Class;
+				}
+				ClassIndex[Index] = static_cast<uint8>(Class);
+			}
+		}
+
+		uint8 ClassIndex[FMallocBinned::MaxSmallSize / 16 + 1];
+	};
+
+	constexpr FSizeClassLookup GSizeClassLookup;
+
+	/**
+	 * @brief 모든 블록(작은 할당용 블록, 큰 할당)의 시작에 놓이는 헤더
+	 * 크기를 64바이트로 맞춰 첫 원소가 64바이트 정렬되도록 한다
+	 */
+	struct alignas(64) FBlockHeader
+	{
+		uint32 SizeClass;
+		/** @brief 큰 할당의 요청 크기 */
+		size_t LargeSize;
+		/** @brief 큰 할당이 OS에서 받은 전체 크기 */
+		size_t MappedSize;
+		/** @brief 큰 할당의 LLM 태그 */
+		uint8 LargeTag;
+	};
+
+	static_assert(sizeof(FBlockHeader) == 64, "FBlockHeader는 64바이트여야 합니다");
+
+	/**
+	 * @brief 크기 클래스별 블록 배치
+	 * [헤더][원소마다 1바이트 태그 (64바이트 단위로 올림)][원소...]
+	 * 태그 배열은 할당이 어느 LLM 태그로 집계되었는지 해제할 때까지 기억해 두는 자리
+	 */
+	struct FBlockLayout
+	{
+		constexpr FBlockLayout()
+			: NumElements{}
+			, FirstElementOffset{}
+			, IndexReciprocal{}
+		{
+			for (uint32 Class = 0; Class < NumSizeClasses; ++Class)
+			{
+				const uint32 Size = SizeClassBytes[Class];
+				uint32 Count = static_cast<uint32>((FMallocBinned::BlockSize - sizeof(FBlockHeader)) / (Size + 1));
+				while (sizeof(FBlockHeader) + ((Count + 63) & ~63u) + Count * Size > FMallocBinned::BlockSize)
+				{
+					--Count;
+				}
+
+				NumElements[Class] = Count;
+				FirstElementOffset[Class] = static_cast<uint32>(sizeof(FBlockHeader)) + ((Count + 63) & ~63u);
+				// 원소 오프셋은 항상 Size의 배수이고 BlockSize보다 작으므로 올림한 역수를 곱하면 나눗셈과 같은 값이 나온다
+				IndexReciprocal[Class] = ((1ull << 32) + Size - 1) / Size;
+			}
+		}
+
+		uint32 NumElements[NumSizeClasses];
+		uint32 FirstElementOffset[NumSizeClasses];
+		uint64 IndexReciprocal[NumSizeClasses];
+	};
+
+	constexpr FBlockLayout GBlockLayout;
+
+	struct FFreeNode
+	{
+		FFreeNode* Next;
+	};
+
+	/** @brief 전역 풀 접근용 스핀락 (std::mutex와 달리 상수 초기화가 보장됨) */
+	struct FSpinLock
+	{
+		void Lock()
+		{
+			while (Flag.test_and_set(std::memory_order_acquire))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		void Unlock()
+		{
+			Flag.clear(std::memory_order_release);
+		}
+
+		std::atomic_flag Flag = ATOMIC_FLAG_INIT;
+	};
+
+	/** @brief 크기 클래스 하나의 전역 풀. 스레드 캐시끼리 주고받는 free list와 아직 잘라 쓰지 않은 블록 영역 */
+	struct alignas(64) FSizeClassPool
+	{
+		FSpinLock Lock;
+		FFreeNode* FreeList = nullptr;
+		uint8* BumpCursor = nullptr;
+		uint8* BumpEnd = nullptr;
+	};
+
+	FSizeClassPool GPools[NumSizeClasses];
+
+	/**
+	 * @brief 스레드별 캐시
+	 * 소멸자가 없는 POD라서 스레드 종료 중의 해제에서도 안전하게 접근할 수 있다
+	 */
+	struct FThreadCache
+	{
+		FFreeNode* Head[NumSizeClasses];
+		uint32 Count[NumSizeClasses];
+		bool bFlushRegistered;
+	};
+
+	thread_local FThreadCache GThreadCache;
+
+	/** @brief 한 번에 전역 풀과 주고받는 개수 (작은 클래스일수록 많이) */
+	constexpr uint32 GetBatchCount(uint32 InClass)
+	{
+		const uint32 Count = 16 * 1024 / SizeClassBytes[InClass];
+		return Count < 2 ? 2 : (Count > 64 ? 64 : Count);
+	}
+
+	void* AllocateFromOS(size_t InSize)
+	{
+#ifdef _WIN32
+		return VirtualAlloc(nullptr, InSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+		return std::aligned_alloc(FMallocBinned::BlockSize, (InSize + FMallocBinned::BlockSize - 1) & ~(FMallocBinned::BlockSize - 1));
+#endif
+	}
+
+	void FreeToOS(void* InMemory)
+	{
+#ifdef _WIN32
+		VirtualFree(InMemory, 0, MEM_RELEASE);
+#else
+		std::free(InMemory);
+#endif
+	}
+
+	FBlockHeader* GetBlockHeader(void* InMemory)
+	{
+		return reinterpret_cast<FBlockHeader*>(reinterpret_cast<uintptr_t>(InMemory) & ~static_cast<uintptr_t>(FMallocBinned::BlockSize - 1));
+	}
+
+	/**
+	 * @brief 요청 크기 / 정렬에 맞는 크기 클래스 선택
+	 * @return 크기 클래스 인덱스. 작은 할당으로 처리할 수 없으면 LargeSizeClass
+	 */
+	uint32 SelectSizeClass(size_t InSize, size_t InAlignment)
+	{
+		if (InSize > FMallocBinned::MaxSmallSize)
+		{
+			return LargeSizeClass;
+		}
+
+		uint32 Class = GSizeClassLookup.ClassIndex[(InSize + 15) >> 4];
+		if (InAlignment <= FMallocBinned::DefaultAlignment)
+		{
+			return Class;
+		}
+
+		// 블록의 첫 원소는 64바이트 정렬이므로, 크기가 정렬의 배수인 클래스를 고르면 모든 원소가 정렬된다
+		if (InAlignment <= sizeof(FBlockHeader))
+		{
+			for (; Class < NumSizeClasses; ++Class)
+			{
+				if (SizeClassBytes[Class] % InAlignment == 0)
+				{
+					return Class;
+				}
+			}
+		}
+		return LargeSizeClass;
+	}
+
+	/** @brief 스레드 종료 시 캐시에 남은 원소를 전역 풀로 돌려준다 */
+	struct FThreadCacheFlusher
+	{
+		~FThreadCacheFlusher();
+	};
+
+	/**
+	 * @brief 캐시 리스트 앞쪽 InCount개를 떼어 전역 풀에 반환
+	 */
+	void ReturnToPool(FThreadCache& InCache, uint32 InClass, uint32 InCount)
+	{
+		FFreeNode* First = InCache.Head[InClass];
+		FFreeNode* Last = First;
+		for (uint32 Index = 1; Index < InCount; ++Index)
+		{
+			Last = Last->Next;
+		}
+		InCache.Head[InClass] = Last->Next;
+		InCache.Count[InClass] -= InCount;
+
+		FSizeClassPool& Pool = GPools[InClass];
+		Pool.Lock.Lock();
+		Last->Next = Pool.FreeList;
+		Pool.FreeList = First;
+		Pool.Lock.Unlock();
+	}
+
+	FThreadCacheFlusher::~FThreadCacheFlusher()
+	{
+		FThreadCache& Cache = GThreadCache;
+		for (uint32 Class = 0; Class < NumSizeClasses; ++Class)
+		{
+			if (Cache.Count[Class] > 0)
+			{
+				ReturnToPool(Cache, Class, Cache.Count[Class]);
+			}
+		}
+	}
+
+	/**
+	 * @brief 전역 풀에서 한 묶음을 가져와 스레드 캐시를 채운다
+	 * @return 채운 뒤의 캐시 첫 원소. OS 할당 실패 시 nullptr
+	 */
+	FFreeNode* RefillThreadCache(FThreadCache& InCache, uint32 InClass)
+	{
+		if (!InCache.bFlushRegistered)
+		{
+			// 소멸자가 있는 thread_local은 처음 접근할 때 등록되므로 느린 경로에서 한 번만 건드린다
+			InCache.bFlushRegistered = true;
+			thread_local FThreadCacheFlusher Flusher;
+			(void)Flusher;
+		}
+
+		const uint32 ElementSize = SizeClassBytes[InClass];
+		const uint32 BatchCount = GetBatchCount(InClass);
+
+		FSizeClassPool& Pool = GPools[InClass];
+		FFreeNode* Head = nullptr;
+		uint32 Count = 0;
+
+		Pool.Lock.Lock();
+		while (Count < BatchCount && Pool.FreeList)
+		{
+			FFreeNode* Node = Pool.FreeList;
+			Pool.FreeList = Node->Next;
+			Node->Next = Head;
+			Head = Node;
+			++Count;
+		}
+
+		while (Count < BatchCount)
+		{
+			if (Pool.BumpCursor + ElementSize > Pool.BumpEnd)
+			{
+				if (Count > 0)
+				{
+					break;
+				}
+
+				uint8* Block = static_cast<uint8*>(AllocateFromOS(FMallocBinned::BlockSize));
+				if (!Block)
+				{
+					break;
+				}
+				GOSReservedBytes.fetch_add(FMallocBinned::BlockSize, std::memory_order_relaxed);
+
+				FBlockHeader* Header = reinterpret_cast<FBlockHeader*>(Block);
+				Header->SizeClass = InClass;
+				Header->LargeSize = 0;
+				Header->MappedSize = FMallocBinned::BlockSize;
+				Header->LargeTag = 0;
+				Pool.BumpCursor = Block + GBlockLayout.FirstElementOffset[InClass];
+				Pool.BumpEnd = Pool.BumpCursor + static_cast<size_t>(GBlockLayout.NumElements[InClass]) * ElementSize;
+			}
+
+			FFreeNode* Node = reinterpret_cast<FFreeNode*>(Pool.BumpCursor);
+			Pool.BumpCursor += ElementSize;
+			Node->Next = Head;
+			Head = Node;
+			++Count;
+		}
+		Pool.Lock.Unlock();
+
+		InCache.Head[InClass] = Head;
+		InCache.Count[InClass] = Count;
+		return Head;
+	}
+
+	/**
+	 * @brief 최근 해제된 큰 블록을 OS에 돌려주지 않고 보관하는 캐시
+	 * 큰 배열이 자라거나 프레임마다 큰 임시 버퍼를 만드는 경우처럼 같은 크기대의 큰 블록이 반복해서 할당 / 해제될 때
+	 * 매번 VirtualAlloc / VirtualFree(페이지 커밋과 0 초기화 포함)를 거치지 않게 한다
+	 * 블록 수와 전체 바이트에 상한을 두어, 넘치면 가장 오래된 블록부터 OS에 돌려준다
+	 */
+	struct FLargeBlockCache
+	{
+		static constexpr uint32 MaxBlocks = 32;
+		/** @brief 이보다 큰 블록은 캐시하지 않고 바로 OS에 반환 */
+		static constexpr size_t MaxBlockSize = 4 * 1024 * 1024;
+		static constexpr size_t MaxTotalBytes = 32 * 1024 * 1024;
+
+		FSpinLock Lock;
+		/** @brief 해제된 순서 (뒤쪽이 최근) */
+		FBlockHeader* Blocks[MaxBlocks] = {};
+		uint32 NumBlocks = 0;
+		size_t TotalBytes = 0;
+	};
+
+	FLargeBlockCache GLargeBlockCache;
+
+	/** @brief Lock을 잡은 상태에서 InIndex 블록을 캐시에서 빼고 반환 (해제 순서 유지) */
+	FBlockHeader* RemoveCachedLargeBlock(FLargeBlockCache& InCache, uint32 InIndex)
+	{
+		FBlockHeader* Header = InCache.Blocks[InIndex];
+		InCache.TotalBytes -= Header->MappedSize;
+		--InCache.NumBlocks;
+		for (uint32 Index = InIndex; Index < InCache.NumBlocks; ++Index)
+		{
+			InCache.Blocks[Index] = InCache.Blocks[Index + 1];
+		}
+		return Header;
+	}
+
+	/**
+	 * @brief InMappedSize 이상이면서 남는 크기가 1/4 이하인 캐시 블록을 최근 것부터 찾아 꺼냄
+	 * @return 맞는 블록이 없으면 nullptr
+	 */
+	FBlockHeader* TakeCachedLargeBlock(size_t InMappedSize)
+	{
+		FLargeBlockCache& Cache = GLargeBlockCache;
+		FBlockHeader* Found = nullptr;
+
+		Cache.Lock.Lock();
+		for (uint32 Index = Cache.NumBlocks; Index-- > 0;)
+		{
+			const size_t CachedSize = Cache.Blocks[Index]->MappedSize;
+			if (CachedSize >= InMappedSize && CachedSize - InMappedSize <= InMappedSize / 4)
+			{
+				Found = RemoveCachedLargeBlock(Cache, Index);
+				break;
+			}
+		}
+		Cache.Lock.Unlock();
+		return Found;
+	}
+
+	void ReleaseLargeBlock(FBlockHeader* InHeader)
+	{
+		GOSReservedBytes.fetch_sub(InHeader->MappedSize, std::memory_order_relaxed);
+		FreeToOS(InHeader);
+	}
+
+	/** @brief 해제된 큰 블록을 캐시에 넣고, 상한을 넘는 오래된 블록은 잠금 밖에서 OS에 반환 */
+	void CacheLargeBlock(FBlockHeader* InHeader)
+	{
+		const size_t MappedSize = InHeader->MappedSize;
+		if (MappedSize > FLargeBlockCache::MaxBlockSize)
+		{
+			ReleaseLargeBlock(InHeader);
+			return;
+		}
+
+		FLargeBlockCache& Cache = GLargeBlockCache;
+		FBlockHeader* Evicted[FLargeBlockCache::MaxBlocks];
+		uint32 NumEvicted = 0;
+
+		Cache.Lock.Lock();
+		while (Cache.NumBlocks > 0 &&
+			(Cache.NumBlocks == FLargeBlockCache::MaxBlocks || Cache.TotalBytes + MappedSize > FLargeBlockCache::MaxTotalBytes))
+		{
+			Evicted[NumEvicted++] = RemoveCachedLargeBlock(Cache, 0);
+		}
+		Cache.Blocks[Cache.NumBlocks++] = InHeader;
+		Cache.TotalBytes += MappedSize;
+		Cache.Lock.Unlock();
+
+		for (uint32 Index = 0; Index < NumEvicted; ++Index)
+		{
+			ReleaseLargeBlock(Evicted[Index]);
+		}
+	}
+
+	void* MallocLarge(size_t InSize, size_t InAlignment)
+	{
+		assert(InAlignment < FMallocBinned::BlockSize && "BlockSize 이상의 정렬은 지원하지 않음");
+
+		if (InSize > SIZE_MAX - 2 * FMallocBinned::BlockSize)
+		{
+			return nullptr;
+		}
+
+		// 헤더 뒤를 정렬에 맞춰 띄워도 BlockSize 안쪽이므로 해제 시 같은 방식으로 헤더를 찾을 수 있다
+		const size_t Offset = InAlignment > sizeof(FBlockHeader) ? InAlignment : sizeof(FBlockHeader);
+		// OS 할당 단위(BlockSize)로 올려 두면 크기가 조금씩 다른 요청끼리도 캐시된 블록을 나눠 쓸 수 있다
+		const size_t MappedSize = (Offset + InSize + FMallocBinned::BlockSize - 1) & ~(FMallocBinned::BlockSize - 1);
+
+		FBlockHeader* Header = TakeCachedLargeBlock(MappedSize);
+		if (!Header)
+		{
+			Header = static_cast<FBlockHeader*>(AllocateFromOS(MappedSize));
+			if (!Header)
+			{
+				return nullptr;
+			}
+			Header->MappedSize = MappedSize;
+			GOSReservedBytes.fetch_add(MappedSize, std::memory_order_relaxed);
+		}
+
+		Header->SizeClass = LargeSizeClass;
+		Header->LargeSize = InSize;
+		Header->LargeTag = 0;
+
+		GNumLargeAllocations.fetch_add(1, std::memory_order_relaxed);
+		return reinterpret_cast<uint8*>(Header) + Offset;
+	}
+
+	uint8* GetTagSlot(void* InMemory)
+	{
+		FBlockHeader* Header = GetBlockHeader(InMemory);
+		if (Header->SizeClass == LargeSizeClass)
+		{
+			return &Header->LargeTag;
+		}
+
+		const uint32 Class = Header->SizeClass;
+		const uint64 Offset = static_cast<uint64>(static_cast<uint8*>(InMemory) - reinterpret_cast<uint8*>(Header)) - GBlockLayout.FirstElementOffset[Class];
+		const uint64 Index = (Offset * GBlockLayout.IndexReciprocal[Class]) >> 32;
+		return reinterpret_cast<uint8*>(Header) + sizeof(FBlockHeader) + Index;
+	}
+}
+
+void* FMallocBinned::Malloc(size_t InSize, size_t InAlignment)
+{
+	const uint32 Class = SelectSizeClass(InSize, InAlignment);
+	if (Class == LargeSizeClass)
+	{
+		return MallocLarge(InSize, InAlignment);
+	}
+
+	FThreadCache& Cache = GThreadCache;
+	FFreeNode* Node = Cache.Head[Class];
+	if (!Node)
+	{
+		Node = RefillThreadCache(Cache, Class);
+		if (!Node)
+		{
+			return nullptr;
+		}
+	}
+
+	Cache.Head[Class] = Node->Next;
+	--Cache.Count[Class];
+	return Node;
+}
+
+void FMallocBinned::Free(void* InMemory)
+{
+	if (!InMemory)
+	{
+		return;
+	}
+
+	FBlockHeader* Header = GetBlockHeader(InMemory);
+	const uint32 Class = Header->SizeClass;
+	if (Class == LargeSizeClass)
+	{
+		GNumLargeAllocations.fetch_sub(1, std::memory_order_relaxed);
+		CacheLargeBlock(Header);
+		return;
+	}
+
+	// 다른 스레드에서 할당한 원소도 해제한 스레드의 캐시로 들어간다
+	FThreadCache& Cache = GThreadCache;
+	FFreeNode* Node = static_cast<FFreeNode*>(InMemory);
+	Node->Next = Cache.Head[Class];
+	Cache.Head[Class] = Node;
+
+	const uint32 BatchCount = GetBatchCount(Class);
+	if (++Cache.Count[Class] > BatchCount * 2)
+	{
+		ReturnToPool(Cache, Class, BatchCount);
+	}
+}
+
+size_t FMallocBinned::GetAllocationSize(void* InMemory)
+{
+	const FBlockHeader* Header = GetBlockHeader(InMemory);
+	return Header->SizeClass == LargeSizeClass ? Header->LargeSize : SizeClassBytes[Header->SizeClass];
+}
+
+void FMallocBinned::SetAllocationTag(void* InMemory, uint8 InTag)
+{
+	*GetTagSlot(InMemory) = InTag;
+}
+
+uint8 FMallocBinned::GetAllocationTag(void* InMemory)
+{
+	return *GetTagSlot(InMemory);
+}
+
+uint64 FMallocBinned::GetOSReservedBytes()
+{
+	return GOSReservedBytes.load(std::memory_order_relaxed);
+}
+
+uint64 FMallocBinned::GetNumLargeAllocations()
+{
+	return GNumLargeAllocations.load(std::memory_order_relaxed);
+}
+
+uint64 FMallocBinned::GetCachedLargeBytes()
+{
+	FLargeBlockCache& Cache = GLargeBlockCache;
+	Cache.Lock.Lock();
+	const uint64 CachedBytes = Cache.TotalBytes;
+	Cache.Lock.Unlock();
+	return CachedBytes;
+}
@@ -0,0 +1,116 @@
+#include "pch.h"
+#include "Runtime/Core/Public/Memory/MemStack.h"
+
+FMemStack& FMemStack::Get()
+{
+	thread_local FMemStack ThreadMemStack;
+	return ThreadMemStack;
+}
+
+FMemStack::~FMemStack()
+{
+	for (const FChunk& Chunk : Chunks)
+	{
+		::operator delete(Chunk.Data);
+	}
+	Chunks.Empty();
+}
+
+void* FMemStack::Alloc(size_t InSize, size_t InAlignment)
+{
+	assert(NumMarks > 0 && "FMemStack::Alloc must be called inside an FMemMark scope");
+
+	uintptr_t AlignedTop = (reinterpret_cast<uintptr_t>(Top) + InAlignment - 1) & ~(InAlignment - 1);
+	if (Top == nullptr || AlignedTop + InSize > reinterpret_cast<uintptr_t>(End))
+	{
+		AdvanceChunk(InSize + InAlignment);
+		AlignedTop = (reinterpret_cast<uintptr_t>(Top) + InAlignment - 1) & ~(InAlignment - 1);
+	}
+
+	uint8* Result = reinterpret_cast<uint8*>(AlignedTop);
+	uint8* NewTop = Result + InSize;
+	UsedBytes += static_cast<size_t>(NewTop - Top);
+	Top = NewTop;
+
+	if (UsedBytes > FrameHighWaterBytes)
+	{
+		FrameHighWaterBytes = UsedBytes;
+	}
+	return Result;
+}
+
+void FMemStack::AdvanceChunk(size_t InMinSize)
+{
+	// 현재 청크에 남은 공간은 버려진 것으로 계산
+	if (Top != nullptr)
+	{
+		UsedBytes += static_cast<size_t>(End - Top);
+	}
+
+	++CurrentChunk;
+	if (CurrentChunk < Chunks.Num() && Chunks[CurrentChunk].Size < InMinSize)
+	{
+		// 재사용할 청크가 너무 작으면 더 큰 청크로 교체
+		ReservedBytes -= Chunks[CurrentChunk].Size;
+		::operator delete(Chunks[CurrentChunk].Data);
+		Chunks.RemoveAt(CurrentChunk);
+	}
+
+	if (CurrentChunk >= Chunks.Num())
+	{
+		FChunk NewChunk;
+		NewChunk.Size = std::max(DefaultChunkSize, InMinSize);
+		NewChunk.Data = static_cast<uint8*>(::operator new(NewChunk.Size));
+		ReservedBytes += NewChunk.Size;
+		Chunks.Insert(NewChunk, CurrentChunk);
+	}
+
+	Top = Chunks[CurrentChunk].Data;
+	End = Top + Chunks[CurrentChunk].Size;
+}
+
+void FMemStack::BeginFrame()
+{
+	FrameHighWaterBytes = UsedBytes;
+}
+
+void FMemStack::EndFrame()
+{
+	LastFrameHighWaterBytes = FrameHighWaterBytes;
+	if (FrameHighWaterBytes > PeakHighWaterBytes)
+	{
+		PeakHighWaterBytes = FrameHighWaterBytes;
+	}
+	FrameHighWaterBytes = UsedBytes;
+}
+
+FMemMark::FMemMark(FMemStack& InStack)
+	: Stack(InStack)
+	, SavedChunk(InStack.CurrentChunk)
+	, SavedTop(InStack.Top)
+	, SavedEnd(InStack.End)
+	, SavedUsedBytes(InStack.UsedBytes)
+{
+	++Stack.NumMarks;
+}
+
+FMemMark::~FMemMark()
+{
+	Pop();
+}
+
+void FMemMark::Pop()
+{
+	if (bPopped)
+	{
+		return;
+	}
+	bPopped = true;
+
+	// 마크 이후에 넘어간 청크들은 해제하지 않고 다음 할당에서 재사용
+	Stack.CurrentChunk = SavedChunk;
+	Stack.Top = SavedTop;
+	Stack.End = SavedEnd;
+	Stack.UsedBytes = SavedUsedBytes;
+	--Stack.NumMarks;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Runtime/Core/Public/Async/TaskGraph.h"
+
+/**
+ * @brief [0, InNum) 구간의 Body(Index)를 여러 스레드에 나누어 실행하고 모두 끝날 때까지 대기 (언리얼 ParallelFor 스타일)
+ *
+ * 인덱스마다 태스크를 만들지 않고, 스레드 수만큼의 도우미 태스크가 공용 카운터에서 배치를 하나씩 가져가 처리한다
+ * 호출한 스레드도 배치를 처리하므로 워커가 모두 바쁘더라도 진행이 멈추지 않는다
+ *
+ * 사용 예시:
+ * @code
+ * ParallelFor(Particles.Num(), [&](int32 Index)
+ * {
+ *     Particles[Index].Update(DeltaTime);
+ * });
+ * @endcode
+ *
+ * @param InNum 반복 횟수
+ * @param InBody 인덱스마다 호출할 본문 (void(int32)), 서로 다른 인덱스끼리 동시에 호출될 수 있다
+ * @param InMinBatchSize 배치 하나의 최소 인덱스 수 (본문이 가벼울수록 크게 잡을 것)
+ */
+template<typename BodyType>
+void ParallelFor(int32 InNum, const BodyType& InBody, int32 InMinBatchSize = 1)
+{
+	if (InNum <= 0)
+	{
+		return;
+	}
+
+	FTaskGraph& TaskGraph = FTaskGraph::Get();
+	const int32 NumThreads = TaskGraph.GetNumWorkers() + 1;
+	const int32 MinBatchSize = InMinBatchSize > 1 ? InMinBatchSize : 1;
+
+	if (NumThreads == 1 || InNum <= MinBatchSize)
+	{
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			InBody(Index);
+		}
+		return;
+	}
+
+	// 스레드당 배치 4개 정도로 나누어, 배치마다 걸리는 시간이 달라도 먼저 끝난 스레드가 남은 배치를 가져가게 함
+	int32 BatchSize = InNum / (NumThreads * 4);
+	BatchSize = BatchSize > MinBatchSize ? BatchSize : MinBatchSize;
+	const int32 NumBatches = (InNum + BatchSize - 1) / BatchSize;
+
+	std::atomic<int32> NextBatch{0};
+	auto ProcessBatches = [&InBody, &NextBatch, NumBatches, BatchSize, InNum]()
+	{
+		for (int32 Batch = NextBatch.fetch_add(1, std::memory_order_relaxed); Batch < NumBatches;
+			Batch = NextBatch.fetch_add(1, std::memory_order_relaxed))
+		{
+			const int32 Start = Batch * BatchSize;
+			const int32 End = Start + BatchSize < InNum ? Start + BatchSize : InNum;
+			for (int32 Index = Start; Index < End; ++Index)
+			{
+				InBody(Index);
+			}
+		}
+	};
+
+	const int32 NumHelpers = NumThreads - 1 < NumBatches - 1 ? NumThreads - 1 : NumBatches - 1;
+	TArray<FGraphEventRef, TInlineAllocator<16>> Helpers;
+	for (int32 Helper = 0; Helper < NumHelpers; ++Helper)
+	{
+		Helpers.Add(TaskGraph.Launch([&ProcessBatches]() { ProcessBatches(); }));
+	}
+
+	ProcessBatches();
+
+	for (const FGraphEventRef& Helper : Helpers)
+	{
+		TaskGraph.Wait(Helper);
+	}
+}
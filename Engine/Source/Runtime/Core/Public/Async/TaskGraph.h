@@ -0,0 +1,246 @@
+#pragma once
+
+#include "Runtime/Core/Public/Containers/ContainerAllocationPolicies.h"
+#include <cstddef>
+
+class FGraphTask;
+
+/**
+ * @brief 태스크를 실행할 스레드
+ */
+enum class ENamedThread : uint8
+{
+	AnyThread,   // 워커 스레드 또는 Wait 중인 스레드
+	GameThread,  // 게임 스레드 (ProcessGameThreadTasks 또는 게임 스레드의 Wait에서 실행)
+};
+
+/**
+ * @brief 태스크 완료 이벤트 핸들 (참조 카운팅, 언리얼 FGraphEventRef 스타일)
+ * 핸들이 남아 있는 동안 태스크 객체가 유지되므로 완료 여부를 언제든 확인하거나 선행 조건으로 넘길 수 있다
+ */
+class FGraphEventRef
+{
+public:
+	FGraphEventRef() = default;
+	explicit FGraphEventRef(FGraphTask* InTask);
+	~FGraphEventRef();
+
+	FGraphEventRef(const FGraphEventRef& Other);
+	FGraphEventRef(FGraphEventRef&& Other) noexcept;
+	FGraphEventRef& operator=(const FGraphEventRef& Other);
+	FGraphEventRef& operator=(FGraphEventRef&& Other) noexcept;
+
+	bool IsValid() const { return Task != nullptr; }
+	/** @brief 태스크 본문이 끝났는지 확인 (빈 핸들은 완료로 취급) */
+	bool IsComplete() const;
+
+	FGraphTask* GetTask() const { return Task; }
+
+private:
+	FGraphTask* Task = nullptr;
+};
+
+/** @brief 선행 조건 목록 (대부분 몇 개 이하이므로 인라인 저장) */
+using FGraphEventArray = TArray<FGraphEventRef, TInlineAllocator<4>>;
+
+/**
+ * @brief 태스크 그래프의 노드 하나
+ * 본문(호출 가능 객체)은 InlineSize 이하면 태스크 객체 안에 보관해 추가 할당이 없다
+ * 남은 선행 조건 수가 0이 되는 순간 실행 큐에 들어가고, 완료되면 후속 태스크들의 선행 조건 수를 줄인다
+ * @note 직접 만들지 않고 FTaskGraph::Launch를 사용할 것
+ */
+class FGraphTask
+{
+public:
+	static constexpr size_t InlineSize = 64;
+
+	template<typename FunctionType>
+	static FGraphTask* Create(FunctionType&& InFunction, ENamedThread InThread)
+	{
+		using DecayedType = std::decay_t<FunctionType>;
+
+		FGraphTask* Task = new FGraphTask(InThread);
+		if constexpr (sizeof(DecayedType) <= InlineSize && alignof(DecayedType) <= alignof(std::max_align_t))
+		{
+			new (Task->Storage) DecayedType(std::forward<FunctionType>(InFunction));
+			Task->Invoke = [](void* InStorage) { (*static_cast<DecayedType*>(InStorage))(); };
+			Task->DestroyFunction = [](void* InStorage) { static_cast<DecayedType*>(InStorage)->~DecayedType(); };
+		}
+		else
+		{
+			*reinterpret_cast<DecayedType**>(Task->Storage) = new DecayedType(std::forward<FunctionType>(InFunction));
+			Task->Invoke = [](void* InStorage) { (**static_cast<DecayedType**>(InStorage))(); };
+			Task->DestroyFunction = [](void* InStorage) { delete *static_cast<DecayedType**>(InStorage); };
+		}
+		return Task;
+	}
+
+	void AddRef() { RefCount.fetch_add(1, std::memory_order_relaxed); }
+	void Release();
+
+	bool IsComplete() const { return bIsComplete.load(std::memory_order_acquire); }
+	ENamedThread GetThread() const { return Thread; }
+
+private:
+	friend class FTaskGraph;
+
+	explicit FGraphTask(ENamedThread InThread) : Thread(InThread) {}
+	~FGraphTask() = default;
+
+	/**
+	 * @brief 완료 시 알림을 받을 후속 태스크 등록
+	 * @return 이미 완료되어 등록하지 않았다면 false
+	 */
+	bool AddSubsequent(FGraphTask* InSubsequent);
+
+	/** @brief 본문 실행 후 완료 표시, 후속 태스크의 선행 조건 해제 */
+	void Execute();
+
+	alignas(std::max_align_t) uint8 Storage[InlineSize];
+	void (*Invoke)(void* InStorage) = nullptr;
+	void (*DestroyFunction)(void* InStorage) = nullptr;
+
+	/** @brief 실행 큐가 가진 참조 1 + FGraphEventRef 참조들 */
+	std::atomic<int32> RefCount{1};
+	/** @brief 남은 선행 조건 수. Launch가 설정을 끝낼 때까지 1을 더 잡아 두어 조기 실행을 막는다 */
+	std::atomic<int32> NumPendingPrerequisites{1};
+	std::atomic<bool> bIsComplete{false};
+
+	/** @brief 후속 태스크 목록 보호용 스핀락 (짧은 구간만 잡음) */
+	std::atomic_flag SubsequentsLock = ATOMIC_FLAG_INIT;
+	TArray<FGraphTask*, TInlineAllocator<4>> Subsequents;
+
+	ENamedThread Thread;
+};
+
+/**
+ * @brief 워크 스틸링 태스크 스케줄러 (언리얼 TaskGraph 스타일)
+ *
+ * 코어마다 워커 스레드를 하나씩 두고, 각 스레드(게임 스레드 포함)는 자신만의 Chase-Lev 덱을 가진다
+ * 스레드가 만든 태스크는 자신의 덱 아래쪽에 넣고 꺼내므로(LIFO) 잠금이 없고 캐시에 따뜻한 작업을 먼저 처리하며,
+ * 할 일이 없는 워커는 다른 덱의 위쪽에서 가장 오래된 태스크를 훔쳐 간다
+ * 엔진에 등록되지 않은 스레드가 만든 태스크는 잠금으로 보호되는 공용 큐로 들어간다
+ *
+ * 사용 예시:
+ * @code
+ * FGraphEventRef Load = FTaskGraph::Get().Launch([]() { LoadData(); });
+ * FGraphEventRef Build = FTaskGraph::Get().Launch([]() { BuildData(); }, { Load });
+ * FTaskGraph::Get().Launch([]() { ApplyToWorld(); }, { Build }, ENamedThread::GameThread);
+ * @endcode
+ *
+ * @note Initialize를 호출한 스레드를 게임 스레드로 간주한다
+ */
+class FTaskGraph
+{
+public:
+	static FTaskGraph& Get();
+
+	/**
+	 * @brief 워커 스레드 생성
+	 * @param InNumWorkers 워커 수 (0이면 논리 코어 수 - 1)
+	 */
+	void Initialize(int32 InNumWorkers = 0);
+
+	/** @brief 남은 태스크를 모두 실행한 뒤 워커 스레드 종료 */
+	void Shutdown();
+
+	bool IsInitialized() const { return bIsInitialized; }
+	int32 GetNumWorkers() const { return NumWorkers; }
+	bool IsInGameThread() const;
+
+	/**
+	 * @brief 태스크 실행 예약
+	 * @param InFunction 실행할 본문 (void())
+	 * @param InPrerequisites 모두 완료된 뒤에 실행할 선행 태스크들
+	 * @param InThread 실행할 스레드
+	 * @return 완료 이벤트 (다른 태스크의 선행 조건이나 Wait에 사용)
+	 */
+	template<typename FunctionType>
+	FGraphEventRef Launch(FunctionType&& InFunction, const FGraphEventArray& InPrerequisites = FGraphEventArray(),
+		ENamedThread InThread = ENamedThread::AnyThread)
+	{
+		FGraphTask* Task = FGraphTask::Create(std::forward<FunctionType>(InFunction), InThread);
+		FGraphEventRef Event(Task);
+		AddPrerequisitesAndSchedule(Task, InPrerequisites);
+		return Event;
+	}
+
+	/**
+	 * @brief 이벤트가 완료될 때까지 대기
+	 * 기다리는 동안 호출한 스레드도 큐의 태스크를 실행하며, 게임 스레드라면 게임 스레드 전용 태스크도 처리한다
+	 */
+	void Wait(const FGraphEventRef& InEvent);
+	void Wait(const FGraphEventArray& InEvents);
+
+	/**
+	 * @brief 쌓여 있는 게임 스레드 전용 태스크 실행 (게임 스레드에서 매 프레임 호출)
+	 * @return 실행한 태스크 수
+	 */
+	int32 ProcessGameThreadTasks();
+
+private:
+	friend class FGraphTask;
+
+	FTaskGraph() = default;
+	~FTaskGraph();
+
+	FTaskGraph(const FTaskGraph&) = delete;
+	FTaskGraph& operator=(const FTaskGraph&) = delete;
+
+	/**
+	 * @brief Chase-Lev 워크 스틸링 덱 (고정 용량)
+	 * 소유 스레드만 Push / Pop하고, 다른 스레드는 Steal만 한다
+	 */
+	class FWorkStealingQueue
+	{
+	public:
+		static constexpr int64 Capacity = 4096;
+
+		/** @return 가득 차서 넣지 못했다면 false */
+		bool Push(FGraphTask* InTask);
+		FGraphTask* Pop();
+		FGraphTask* Steal();
+		bool IsEmpty() const;
+
+	private:
+		alignas(64) std::atomic<int64> Top{0};
+		alignas(64) std::atomic<int64> Bottom{0};
+		alignas(64) std::atomic<FGraphTask*> Buffer[Capacity] = {};
+	};
+
+	void AddPrerequisitesAndSchedule(FGraphTask* InTask, const FGraphEventArray& InPrerequisites);
+
+	/** @brief 선행 조건이 모두 풀린 태스크를 실행 큐에 넣음 */
+	void Schedule(FGraphTask* InTask);
+
+	/** @brief 실행할 태스크 찾기 (자신의 덱 -> 공용 큐 -> 다른 덱에서 훔치기) */
+	FGraphTask* FindWork(int32 InQueueIndex);
+	bool HasQueuedWork() const;
+	void WakeWorker();
+	void WorkerMain(int32 InQueueIndex);
+
+	/** @brief 덱 [0, NumWorkers)는 워커, NumWorkers는 게임 스레드용 */
+	TArray<FWorkStealingQueue*> Queues;
+	TArray<thread> Workers;
+	int32 NumWorkers = 0;
+	bool bIsInitialized = false;
+	std::atomic<bool> bShouldStop{false};
+
+	/** @brief 등록되지 않은 스레드가 만든 태스크와 덱이 가득 찼을 때 넘치는 태스크 */
+	mutex SharedQueueMutex;
+	TQueue<FGraphTask*> SharedQueue;
+	std::atomic<int32> NumSharedTasks{0};
+
+	mutex GameThreadQueueMutex;
+	TArray<FGraphTask*> GameThreadTasks;
+
+	/** @brief 할 일이 없는 워커의 대기 */
+	mutex SleepMutex;
+	condition_variable SleepCondition;
+	std::atomic<int32> NumSleepingWorkers{0};
+	/**
+	 * @brief 깨우기 신호를 보낸 뒤 깨어난 워커가 아직 일을 찾지 못한 상태
+	 * SleepMutex 안에서 대기 블록에 워커가 있을 때만 세우고, 블록을 나가며 신호를 받아 간 워커가 내린다
+	 */
+	std::atomic<bool> bIsWakingWorker{false};
+};
@@ -0,0 +1,416 @@
+#pragma once
+
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+
+/**
+ * @brief TArray에 지정하는 인라인 할당 정책 (언리얼 스타일)
+ * TArray<T, TInlineAllocator<N>>로 선언하면 처음 N개의 원소는 배열 객체 안에 저장되고,
+ * N개를 넘어설 때만 힙으로 옮겨간다. 함수 안에서 잠깐 쓰고 버리는 스택 / 후보 목록에 사용한다
+ * @note 인라인 저장소는 배열 객체 크기에 포함되므로 N은 흔한 경우를 담을 정도로만 잡을 것
+ * @tparam NumInlineElements 힙 할당 없이 담을 수 있는 원소 개수
+ */
+template<uint32 NumInlineElements>
+class TInlineAllocator
+{
+public:
+    static constexpr uint32 NumInline = NumInlineElements;
+};
+
+/**
+ * @brief TInlineAllocator용 small-buffer 벡터
+ * TArray가 사용하는 std::vector 인터페이스의 부분집합을 같은 의미로 제공하므로 TArray 구현은 그대로 동작한다
+ * 반복자는 원소 포인터이며, 인라인 구간에 있는 동안에는 이동 시 원소 단위로 옮긴다
+ */
+template<typename T, uint32 NumInlineElements>
+class TInlineVector
+{
+    static_assert(NumInlineElements > 0, "TInlineAllocator needs at least one inline element");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    TInlineVector() = default;
+
+    explicit TInlineVector(size_t InCount)
+    {
+        resize(InCount);
+    }
+
+    TInlineVector(size_t InCount, const T& Value)
+    {
+        resize(InCount, Value);
+    }
+
+    TInlineVector(std::initializer_list<T> InitList)
+    {
+        insert(end(), InitList.begin(), InitList.end());
+    }
+
+    template<typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    TInlineVector(InputIterator First, InputIterator Last)
+    {
+        insert(end(), First, Last);
+    }
+
+    TInlineVector(const TInlineVector& Other)
+    {
+        insert(end(), Other.begin(), Other.end());
+    }
+
+    TInlineVector(TInlineVector&& Other) noexcept
+    {
+        StealFrom(Other);
+    }
+
+    TInlineVector& operator=(const TInlineVector& Other)
+    {
+        if (this != &Other)
+        {
+            clear();
+            insert(end(), Other.begin(), Other.end());
+        }
+        return *this;
+    }
+
+    TInlineVector& operator=(TInlineVector&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            clear();
+            ReleaseHeap();
+            StealFrom(Other);
+        }
+        return *this;
+    }
+
+    ~TInlineVector()
+    {
+        clear();
+        ReleaseHeap();
+    }
+
+    // Element access
+    T& operator[](size_t Index) { return First[Index]; }
+    const T& operator[](size_t Index) const { return First[Index]; }
+    T& front() { return First[0]; }
+    const T& front() const { return First[0]; }
+    T& back() { return First[Count - 1]; }
+    const T& back() const { return First[Count - 1]; }
+    T* data() { return First; }
+    const T* data() const { return First; }
+
+    // Iterators
+    iterator begin() { return First; }
+    const_iterator begin() const { return First; }
+    const_iterator cbegin() const { return First; }
+    iterator end() { return First + Count; }
+    const_iterator end() const { return First + Count; }
+    const_iterator cend() const { return First + Count; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+    // Size and capacity
+    size_t size() const { return Count; }
+    size_t capacity() const { return Capacity; }
+    bool empty() const { return Count == 0; }
+
+    /** @brief 인라인 저장소를 사용 중인지 여부 */
+    bool IsInline() const { return First == GetInlineData(); }
+
+    void reserve(size_t NewCapacity)
+    {
+        if (NewCapacity > Capacity)
+        {
+            Reallocate(NewCapacity);
+        }
+    }
+
+    /** @brief 원소가 인라인 용량에 들어가면 인라인으로 되돌리고, 아니면 딱 맞는 크기로 재할당 */
+    void shrink_to_fit()
+    {
+        if (!IsInline() && Count < Capacity)
+        {
+            Reallocate(Count);
+        }
+    }
+
+    // Modifiers
+    void clear()
+    {
+        std::destroy(First, First + Count);
+        Count = 0;
+    }
+
+    void push_back(const T& Value)
+    {
+        emplace_back(Value);
+    }
+
+    void push_back(T&& Value)
+    {
+        emplace_back(std::move(Value));
+    }
+
+    template<typename... ArgsType>
+    T& emplace_back(ArgsType&&... Args)
+    {
+        if (Count == Capacity)
+        {
+            // 인자가 자기 자신의 원소를 참조할 수 있으므로 새 버퍼에 먼저 생성한 뒤 기존 원소를 옮긴다
+            const size_t NewCapacity = GetGrownCapacity(Count + 1);
+            T* NewData = Allocate(NewCapacity);
+            ::new (static_cast<void*>(NewData + Count)) T(std::forward<ArgsType>(Args)...);
+            MoveToBuffer(NewData, NewCapacity);
+        }
+        else
+        {
+            ::new (static_cast<void*>(First + Count)) T(std::forward<ArgsType>(Args)...);
+        }
+        ++Count;
+        return First[Count - 1];
+    }
+
+    void pop_back()
+    {
+        --Count;
+        std::destroy_at(First + Count);
+    }
+
+    template<typename... ArgsType>
+    iterator emplace(const_iterator Position, ArgsType&&... Args)
+    {
+        const size_t Index = static_cast<size_t>(Position - First);
+        emplace_back(std::forward<ArgsType>(Args)...);
+        std::rotate(First + Index, First + Count - 1, First + Count);
+        return First + Index;
+    }
+
+    iterator insert(const_iterator Position, const T& Value)
+    {
+        return emplace(Position, Value);
+    }
+
+    iterator insert(const_iterator Position, T&& Value)
+    {
+        return emplace(Position, std::move(Value));
+    }
+
+    template<typename ForwardIterator, typename = std::enable_if_t<!std::is_integral_v<ForwardIterator>>>
+    iterator insert(const_iterator Position, ForwardIterator RangeFirst, ForwardIterator RangeLast)
+    {
+        const size_t Index = static_cast<size_t>(Position - First);
+        const size_t NumToInsert = static_cast<size_t>(std::distance(RangeFirst, RangeLast));
+        if (NumToInsert == 0)
+        {
+            return First + Index;
+        }
+
+        const size_t OldCount = Count;
+        if (Count + NumToInsert > Capacity)
+        {
+            // 범위가 자기 자신을 가리킬 수 있으므로 새 버퍼에 범위를 먼저 복사한 뒤 기존 원소를 옮긴다
+            const size_t NewCapacity = GetGrownCapacity(Count + NumToInsert);
+            T* NewData = Allocate(NewCapacity);
+            std::uninitialized_copy(RangeFirst, RangeLast, NewData + OldCount);
+            MoveToBuffer(NewData, NewCapacity);
+        }
+        else
+        {
+            std::uninitialized_copy(RangeFirst, RangeLast, First + OldCount);
+        }
+        Count += NumToInsert;
+
+        if (Index != OldCount)
+        {
+            std::rotate(First + Index, First + OldCount, First + Count);
+        }
+        return First + Index;
+    }
+
+    iterator insert(const_iterator Position, std::initializer_list<T> InitList)
+    {
+        return insert(Position, InitList.begin(), InitList.end());
+    }
+
+    iterator erase(const_iterator Position)
+    {
+        return erase(Position, Position + 1);
+    }
+
+    iterator erase(const_iterator RangeFirst, const_iterator RangeLast)
+    {
+        T* EraseFirst = First + (RangeFirst - First);
+        T* EraseLast = First + (RangeLast - First);
+        if (EraseFirst != EraseLast)
+        {
+            T* NewEnd = std::move(EraseLast, First + Count, EraseFirst);
+            std::destroy(NewEnd, First + Count);
+            Count = static_cast<size_t>(NewEnd - First);
+        }
+        return EraseFirst;
+    }
+
+    void resize(size_t NewCount)
+    {
+        if (NewCount > Count)
+        {
+            reserve(GetGrownCapacity(NewCount));
+            std::uninitialized_value_construct(First + Count, First + NewCount);
+        }
+        else
+        {
+            std::destroy(First + NewCount, First + Count);
+        }
+        Count = NewCount;
+    }
+
+    void resize(size_t NewCount, const T& Value)
+    {
+        if (NewCount > Count)
+        {
+            if (NewCount > Capacity)
+            {
+                // Value가 자기 자신의 원소일 수 있으므로 재할당 전에 복사해 둔다
+                const T ValueCopy = Value;
+                reserve(GetGrownCapacity(NewCount));
+                std::uninitialized_fill(First + Count, First + NewCount, ValueCopy);
+            }
+            else
+            {
+                std::uninitialized_fill(First + Count, First + NewCount, Value);
+            }
+        }
+        else
+        {
+            std::destroy(First + NewCount, First + Count);
+        }
+        Count = NewCount;
+    }
+
+    void swap(TInlineVector& Other) noexcept
+    {
+        TInlineVector Temp(std::move(Other));
+        Other = std::move(*this);
+        *this = std::move(Temp);
+    }
+
+    bool operator==(const TInlineVector& Other) const
+    {
+        return Count == Other.Count && std::equal(begin(), end(), Other.begin());
+    }
+
+    bool operator!=(const TInlineVector& Other) const
+    {
+        return !(*this == Other);
+    }
+
+private:
+    T* GetInlineData() { return reinterpret_cast<T*>(InlineData); }
+    const T* GetInlineData() const { return reinterpret_cast<const T*>(InlineData); }
+
+    size_t GetGrownCapacity(size_t RequiredCapacity) const
+    {
+        // std::vector와 같은 1.5배 성장
+        return std::max(RequiredCapacity, Capacity + Capacity / 2);
+    }
+
+    T* Allocate(size_t InCapacity)
+    {
+        if (InCapacity <= NumInlineElements)
+        {
+            return GetInlineData();
+        }
+        std::allocator<T> HeapAllocator;
+        return HeapAllocator.allocate(InCapacity);
+    }
+
+    void ReleaseHeap()
+    {
+        if (!IsInline())
+        {
+            std::allocator<T> HeapAllocator;
+            HeapAllocator.deallocate(First, Capacity);
+            First = GetInlineData();
+            Capacity = NumInlineElements;
+        }
+    }
+
+    /** @brief 기존 원소를 NewData로 옮기고 이전 버퍼를 해제 (Count는 유지) */
+    void MoveToBuffer(T* NewData, size_t NewCapacity)
+    {
+        if (NewData != First)
+        {
+            std::uninitialized_move(First, First + Count, NewData);
+            std::destroy(First, First + Count);
+            ReleaseHeap();
+        }
+        First = NewData;
+        Capacity = std::max(NewCapacity, static_cast<size_t>(NumInlineElements));
+    }
+
+    void Reallocate(size_t NewCapacity)
+    {
+        if (IsInline() && NewCapacity <= NumInlineElements)
+        {
+            return;
+        }
+        MoveToBuffer(Allocate(NewCapacity), NewCapacity);
+    }
+
+    void StealFrom(TInlineVector& Other)
+    {
+        if (Other.IsInline())
+        {
+            std::uninitialized_move(Other.First, Other.First + Other.Count, First);
+            Count = Other.Count;
+            Other.clear();
+        }
+        else
+        {
+            First = Other.First;
+            Count = Other.Count;
+            Capacity = Other.Capacity;
+            Other.First = Other.GetInlineData();
+            Other.Count = 0;
+            Other.Capacity = NumInlineElements;
+        }
+    }
+
+    alignas(T) unsigned char InlineData[sizeof(T) * NumInlineElements];
+    T* First = GetInlineData();
+    size_t Count = 0;
+    size_t Capacity = NumInlineElements;
+};
+
+/**
+ * @brief TArray의 할당 정책에 따라 실제 저장소 타입을 고르는 trait
+ * 일반 allocator는 std::vector를, TInlineAllocator는 TInlineVector를 사용한다
+ */
+template<typename T, typename AllocatorType>
+struct TArrayStorage
+{
+    using Type = std::vector<T, AllocatorType>;
+};
+
+template<typename T, uint32 NumInlineElements>
+struct TArrayStorage<T, TInlineAllocator<NumInlineElements>>
+{
+    using Type = TInlineVector<T, NumInlineElements>;
+};
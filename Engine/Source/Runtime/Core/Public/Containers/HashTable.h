@@ -0,0 +1,643 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <cstring>
+#include <cstdint>
+#include <functional>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+	#include <emmintrin.h>
+	#define FLAT_HASH_TABLE_SSE2 1
+#else
+	#define FLAT_HASH_TABLE_SSE2 0
+#endif
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+/**
+ * @brief Flat Hash Table의 control byte 상수 모음
+ * 최상위 비트가 1이면 빈 슬롯 또는 삭제된 슬롯이고, 0이면 해시 하위 7비트(H2)를 보관하는 사용 중 슬롯이다
+ * Control 배열은 Capacity + GroupWidth 크기로, 앞쪽 GroupWidth 바이트를 뒤에 복제해 두어 그룹 단위 로드가 배열 끝을 넘어가지 않는다
+ */
+struct FHashControl
+{
+	static constexpr int8 Empty = -128;
+	static constexpr int8 Deleted = -2;
+	static constexpr int32 GroupWidth = 16;
+	static constexpr int32 MinCapacity = 16;
+
+	static bool IsFull(int8 InControl) { return InControl >= 0; }
+
+	/**
+	 * @brief 사용자 해시의 비트를 고르게 섞는 함수
+	 * std::hash<int>나 포인터 해시처럼 하위 비트에 엔트로피가 몰린 해시도 H1/H2로 나눠 쓸 수 있도록 한다
+	 */
+	static uint64 Mix(size_t InHash)
+	{
+		uint64 Hash = static_cast<uint64>(InHash);
+		Hash ^= Hash >> 33;
+		Hash *= 0xff51afd7ed558ccdULL;
+		Hash ^= Hash >> 33;
+		return Hash;
+	}
+
+	static size_t H1(uint64 InMixedHash) { return static_cast<size_t>(InMixedHash >> 7); }
+	static int8 H2(uint64 InMixedHash) { return static_cast<int8>(InMixedHash & 0x7F); }
+
+	static uint32 CountTrailingZeros(uint32 InMask)
+	{
+#ifdef _MSC_VER
+		unsigned long Index;
+		_BitScanForward(&Index, InMask);
+		return static_cast<uint32>(Index);
+#else
+		return static_cast<uint32>(__builtin_ctz(InMask));
+#endif
+	}
+
+	/** @brief 16비트 마스크 기준 leading zero 개수 */
+	static uint32 CountLeadingZeros16(uint32 InMask)
+	{
+		if (InMask == 0)
+		{
+			return 16;
+		}
+#ifdef _MSC_VER
+		unsigned long Index;
+		_BitScanReverse(&Index, InMask);
+		return 15 - static_cast<uint32>(Index);
+#else
+		return static_cast<uint32>(__builtin_clz(InMask)) - 16;
+#endif
+	}
+};
+
+/**
+ * @brief TMap / TSet의 기본 해시 함수
+ * 기본적으로 std::hash를 그대로 사용하고, 자주 쓰이는 키 타입은 특수화해서 가벼운 해시를 제공한다
+ * 최종 비트 분산은 FHashControl::Mix가 담당하므로 특수화는 키를 정수로 옮기기만 하면 된다
+ */
+template<typename KeyType>
+struct TFlatHash
+{
+	size_t operator()(const KeyType& Key) const noexcept(noexcept(std::hash<KeyType>{}(Key)))
+	{
+		return std::hash<KeyType>{}(Key);
+	}
+};
+
+/**
+ * @brief 포인터 키 특수화
+ * MSVC의 std::hash<T*>는 포인터 값을 바이트 단위 FNV-1a로 해시하므로, 주소 값을 그대로 넘겨 Mix에 맡긴다
+ */
+template<typename PointeeType>
+struct TFlatHash<PointeeType*>
+{
+	size_t operator()(PointeeType* Key) const noexcept
+	{
+		return static_cast<size_t>(reinterpret_cast<uintptr_t>(Key));
+	}
+};
+
+/**
+ * @brief Control byte 16개를 한 번에 비교하는 그룹
+ * SSE2가 있으면 한 번의 비교로 16개 슬롯의 일치 여부를 비트마스크로 얻는다
+ */
+struct FHashGroup
+{
+	explicit FHashGroup(const int8* InControl)
+	{
+#if FLAT_HASH_TABLE_SSE2
+		Control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InControl));
+#else
+		memcpy(Control, InControl, FHashControl::GroupWidth);
+#endif
+	}
+
+	/** @brief H2와 일치하는 슬롯의 비트마스크 */
+	uint32 Match(int8 InH2) const
+	{
+#if FLAT_HASH_TABLE_SSE2
+		return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(InH2), Control)));
+#else
+		uint32 Mask = 0;
+		for (int32 i = 0; i < FHashControl::GroupWidth; ++i)
+		{
+			Mask |= (Control[i] == InH2 ? 1u : 0u) << i;
+		}
+		return Mask;
+#endif
+	}
+
+	uint32 MatchEmpty() const
+	{
+		return Match(FHashControl::Empty);
+	}
+
+	/** @brief 비어있거나 삭제된 슬롯 (Control < -1) */
+	uint32 MatchEmptyOrDeleted() const
+	{
+#if FLAT_HASH_TABLE_SSE2
+		return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), Control)));
+#else
+		uint32 Mask = 0;
+		for (int32 i = 0; i < FHashControl::GroupWidth; ++i)
+		{
+			Mask |= (Control[i] < -1 ? 1u : 0u) << i;
+		}
+		return Mask;
+#endif
+	}
+
+#if FLAT_HASH_TABLE_SSE2
+	__m128i Control;
+#else
+	int8 Control[FHashControl::GroupWidth];
+#endif
+};
+
+/**
+ * @brief SwissTable 방식의 open-addressing 해시 테이블
+ * 원소를 하나의 연속된 배열에 보관하고, 별도의 control byte 배열을 16개 단위 그룹으로 SIMD 탐색한다
+ * 노드 단위 할당이 없어서 TMap / TSet의 Find, Add가 malloc과 포인터 추적 없이 동작한다
+ * @note 재해시(rehash)가 일어나면 원소의 주소가 바뀌므로, 원소 포인터를 삽입 이후까지 보관하면 안 된다
+ * @tparam ElementType 슬롯에 저장되는 원소 타입
+ * @tparam KeyType 해시 / 비교에 쓰이는 키 타입
+ * @tparam KeyFuncs 원소에서 키를 꺼내는 정책 (static const KeyType& GetKey(const ElementType&))
+ */
+template<typename ElementType, typename KeyType, typename KeyFuncs, typename HasherType, typename KeyEqualType, typename AllocatorType>
+class TFlatHashTable
+{
+public:
+	using SizeType = int32;
+	static constexpr SizeType INDEX_NONE = -1;
+
+	TFlatHashTable() = default;
+
+	TFlatHashTable(const TFlatHashTable& Other)
+		: Hasher(Other.Hasher), KeyEqual(Other.KeyEqual)
+	{
+		CopyFrom(Other);
+	}
+
+	TFlatHashTable(TFlatHashTable&& Other) noexcept
+		: Hasher(std::move(Other.Hasher)), KeyEqual(std::move(Other.KeyEqual))
+	{
+		StealFrom(Other);
+	}
+
+	TFlatHashTable& operator=(const TFlatHashTable& Other)
+	{
+		if (this != &Other)
+		{
+			Release();
+			Hasher = Other.Hasher;
+			KeyEqual = Other.KeyEqual;
+			CopyFrom(Other);
+		}
+		return *this;
+	}
+
+	TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Release();
+			Hasher = std::move(Other.Hasher);
+			KeyEqual = std::move(Other.KeyEqual);
+			StealFrom(Other);
+		}
+		return *this;
+	}
+
+	~TFlatHashTable()
+	{
+		Release();
+	}
+
+	SizeType Num() const { return Size; }
+	SizeType GetCapacity() const { return Capacity; }
+
+	ElementType& GetSlot(SizeType Index) { return Slots[Index]; }
+	const ElementType& GetSlot(SizeType Index) const { return Slots[Index]; }
+
+	/**
+	 * @brief 키에 해당하는 슬롯 인덱스 탐색
+	 * @return 슬롯 인덱스 (없으면 INDEX_NONE)
+	 */
+	SizeType FindIndex(const KeyType& Key) const
+	{
+		if (Size == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const uint64 Hash = FHashControl::Mix(Hasher(Key));
+		const int8 H2 = FHashControl::H2(Hash);
+		const size_t Mask = static_cast<size_t>(Capacity) - 1;
+		size_t Offset = FHashControl::H1(Hash) & Mask;
+		size_t ProbeIndex = 0;
+
+		while (true)
+		{
+			FHashGroup Group(Control + Offset);
+			for (uint32 Matches = Group.Match(H2); Matches != 0; Matches &= Matches - 1)
+			{
+				const size_t SlotIndex = (Offset + FHashControl::CountTrailingZeros(Matches)) & Mask;
+				if (KeyEqual(KeyFuncs::GetKey(Slots[SlotIndex]), Key))
+				{
+					return static_cast<SizeType>(SlotIndex);
+				}
+			}
+
+			if (Group.MatchEmpty() != 0)
+			{
+				return INDEX_NONE;
+			}
+
+			ProbeIndex += FHashControl::GroupWidth;
+			Offset = (Offset + ProbeIndex) & Mask;
+		}
+	}
+
+	/**
+	 * @brief 키를 찾고, 없으면 원소를 생성할 슬롯을 예약
+	 * bInserted가 true로 반환되면 호출자가 GetSlotStorage(Index)에 원소를 placement new로 생성해야 한다
+	 * @return (슬롯 인덱스, 새로 예약되었는지 여부)
+	 */
+	std::pair<SizeType, bool> FindOrPrepareInsert(const KeyType& Key)
+	{
+		const SizeType FoundIndex = FindIndex(Key);
+		if (FoundIndex != INDEX_NONE)
+		{
+			return { FoundIndex, false };
+		}
+		return { PrepareInsert(FHashControl::Mix(Hasher(Key))), true };
+	}
+
+	void* GetSlotStorage(SizeType Index)
+	{
+		return static_cast<void*>(Slots + Index);
+	}
+
+	/**
+	 * @brief 슬롯의 원소를 파괴하고 슬롯을 비움
+	 * 해당 슬롯을 지나가는 탐색 경로가 있을 수 없는 경우에는 tombstone 대신 Empty로 되돌린다
+	 */
+	void RemoveAtIndex(SizeType Index)
+	{
+		std::destroy_at(Slots + Index);
+		--Size;
+
+		const size_t Mask = static_cast<size_t>(Capacity) - 1;
+		const size_t IndexBefore = (static_cast<size_t>(Index) - FHashControl::GroupWidth) & Mask;
+		const uint32 EmptyAfter = FHashGroup(Control + Index).MatchEmpty();
+		const uint32 EmptyBefore = FHashGroup(Control + IndexBefore).MatchEmpty();
+
+		const bool bWasNeverFull = EmptyBefore != 0 && EmptyAfter != 0 &&
+			FHashControl::CountTrailingZeros(EmptyAfter) + FHashControl::CountLeadingZeros16(EmptyBefore) < static_cast<uint32>(FHashControl::GroupWidth);
+
+		SetControl(Index, bWasNeverFull ? FHashControl::Empty : FHashControl::Deleted);
+		if (bWasNeverFull)
+		{
+			++GrowthLeft;
+		}
+	}
+
+	bool RemoveKey(const KeyType& Key)
+	{
+		const SizeType Index = FindIndex(Key);
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+		RemoveAtIndex(Index);
+		return true;
+	}
+
+	/** @brief 모든 원소를 파괴하되 할당된 공간은 유지 */
+	void Clear()
+	{
+		if (Capacity == 0)
+		{
+			return;
+		}
+		DestroyElements();
+		memset(Control, FHashControl::Empty, static_cast<size_t>(Capacity) + FHashControl::GroupWidth);
+		Size = 0;
+		GrowthLeft = CapacityToGrowth(Capacity);
+	}
+
+	/** @brief 모든 원소를 파괴하고 할당된 공간도 해제 */
+	void Release()
+	{
+		if (Capacity == 0)
+		{
+			return;
+		}
+		DestroyElements();
+		FreeStorage(Control, Slots, Capacity);
+		Control = nullptr;
+		Slots = nullptr;
+		Capacity = 0;
+		Size = 0;
+		GrowthLeft = 0;
+	}
+
+	/** @brief 최소 InNumElements개를 재해시 없이 담을 수 있도록 공간 확보 */
+	void Reserve(SizeType InNumElements)
+	{
+		if (InNumElements <= 0)
+		{
+			return;
+		}
+		const SizeType RequiredCapacity = NormalizeCapacity(GrowthToCapacity(InNumElements));
+		if (RequiredCapacity > Capacity)
+		{
+			Rehash(RequiredCapacity);
+		}
+	}
+
+	/** @brief 현재 원소 수에 맞는 최소 크기로 재해시 */
+	void Shrink()
+	{
+		if (Size == 0)
+		{
+			Release();
+			return;
+		}
+		const SizeType FittingCapacity = NormalizeCapacity(GrowthToCapacity(Size));
+		if (FittingCapacity < Capacity)
+		{
+			Rehash(FittingCapacity);
+		}
+	}
+
+	/** @brief 첫 번째 사용 중 슬롯 인덱스 (없으면 Capacity) */
+	SizeType FirstIndex() const
+	{
+		return NextIndex(-1);
+	}
+
+	SizeType NextIndex(SizeType Index) const
+	{
+		++Index;
+		while (Index < Capacity && !FHashControl::IsFull(Control[Index]))
+		{
+			++Index;
+		}
+		return Index;
+	}
+
+	SizeType EndIndex() const
+	{
+		return Capacity;
+	}
+
+private:
+	using ElementAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<ElementType>;
+	using ControlAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<int8>;
+
+	static SizeType CapacityToGrowth(SizeType InCapacity)
+	{
+		// 최대 load factor 7/8
+		return InCapacity - InCapacity / 8;
+	}
+
+	static SizeType GrowthToCapacity(SizeType InGrowth)
+	{
+		return InGrowth + (InGrowth - 1) / 7 + 1;
+	}
+
+	static SizeType NormalizeCapacity(SizeType InCapacity)
+	{
+		SizeType Result = FHashControl::MinCapacity;
+		while (Result < InCapacity)
+		{
+			Result <<= 1;
+		}
+		return Result;
+	}
+
+	void SetControl(SizeType Index, int8 InControl)
+	{
+		Control[Index] = InControl;
+		// 앞쪽 GroupWidth개의 control byte는 배열 끝에 복제되어 있음
+		if (Index < FHashControl::GroupWidth)
+		{
+			Control[Capacity + Index] = InControl;
+		}
+	}
+
+	SizeType FindFirstNonFull(uint64 InHash) const
+	{
+		const size_t Mask = static_cast<size_t>(Capacity) - 1;
+		size_t Offset = FHashControl::H1(InHash) & Mask;
+		size_t ProbeIndex = 0;
+
+		while (true)
+		{
+			const uint32 Candidates = FHashGroup(Control + Offset).MatchEmptyOrDeleted();
+			if (Candidates != 0)
+			{
+				return static_cast<SizeType>((Offset + FHashControl::CountTrailingZeros(Candidates)) & Mask);
+			}
+			ProbeIndex += FHashControl::GroupWidth;
+			Offset = (Offset + ProbeIndex) & Mask;
+		}
+	}
+
+	SizeType PrepareInsert(uint64 InHash)
+	{
+		SizeType Target = Capacity > 0 ? FindFirstNonFull(InHash) : INDEX_NONE;
+		if (Target == INDEX_NONE || (GrowthLeft == 0 && Control[Target] != FHashControl::Deleted))
+		{
+			// tombstone이 많으면 같은 크기로 재해시해서 정리, 아니면 두 배로 확장
+			if (Capacity > 0 && Size * 32 <= CapacityToGrowth(Capacity) * 25)
+			{
+				Rehash(Capacity);
+			}
+			else
+			{
+				Rehash(Capacity > 0 ? Capacity * 2 : FHashControl::MinCapacity);
+			}
+			Target = FindFirstNonFull(InHash);
+		}
+
+		if (Control[Target] == FHashControl::Empty)
+		{
+			--GrowthLeft;
+		}
+		++Size;
+		SetControl(Target, FHashControl::H2(InHash));
+		return Target;
+	}
+
+	void Rehash(SizeType NewCapacity)
+	{
+		int8* OldControl = Control;
+		ElementType* OldSlots = Slots;
+		const SizeType OldCapacity = Capacity;
+
+		AllocateStorage(NewCapacity);
+
+		for (SizeType i = 0; i < OldCapacity; ++i)
+		{
+			if (FHashControl::IsFull(OldControl[i]))
+			{
+				ElementType& OldElement = OldSlots[i];
+				const uint64 Hash = FHashControl::Mix(Hasher(KeyFuncs::GetKey(OldElement)));
+				const SizeType Target = FindFirstNonFull(Hash);
+				SetControl(Target, FHashControl::H2(Hash));
+				::new (static_cast<void*>(Slots + Target)) ElementType(std::move(OldElement));
+				std::destroy_at(&OldElement);
+			}
+		}
+		GrowthLeft -= Size;
+
+		if (OldCapacity > 0)
+		{
+			FreeStorage(OldControl, OldSlots, OldCapacity);
+		}
+	}
+
+	void AllocateStorage(SizeType NewCapacity)
+	{
+		ElementAllocatorType ElementAllocator;
+		ControlAllocatorType ControlAllocator;
+
+		Control = std::allocator_traits<ControlAllocatorType>::allocate(ControlAllocator, static_cast<size_t>(NewCapacity) + FHashControl::GroupWidth);
+		Slots = std::allocator_traits<ElementAllocatorType>::allocate(ElementAllocator, static_cast<size_t>(NewCapacity));
+		memset(Control, FHashControl::Empty, static_cast<size_t>(NewCapacity) + FHashControl::GroupWidth);
+		Capacity = NewCapacity;
+		GrowthLeft = CapacityToGrowth(NewCapacity);
+	}
+
+	static void FreeStorage(int8* InControl, ElementType* InSlots, SizeType InCapacity)
+	{
+		ElementAllocatorType ElementAllocator;
+		ControlAllocatorType ControlAllocator;
+
+		std::allocator_traits<ControlAllocatorType>::deallocate(ControlAllocator, InControl, static_cast<size_t>(InCapacity) + FHashControl::GroupWidth);
+		std::allocator_traits<ElementAllocatorType>::deallocate(ElementAllocator, InSlots, static_cast<size_t>(InCapacity));
+	}
+
+	void DestroyElements()
+	{
+		if constexpr (!std::is_trivially_destructible_v<ElementType>)
+		{
+			for (SizeType i = 0; i < Capacity; ++i)
+			{
+				if (FHashControl::IsFull(Control[i]))
+				{
+					std::destroy_at(Slots + i);
+				}
+			}
+		}
+	}
+
+	void CopyFrom(const TFlatHashTable& Other)
+	{
+		if (Other.Size == 0)
+		{
+			return;
+		}
+		Reserve(Other.Size);
+		for (SizeType i = 0; i < Other.Capacity; ++i)
+		{
+			if (FHashControl::IsFull(Other.Control[i]))
+			{
+				const ElementType& OtherElement = Other.Slots[i];
+				const SizeType Target = PrepareInsert(FHashControl::Mix(Hasher(KeyFuncs::GetKey(OtherElement))));
+				::new (static_cast<void*>(Slots + Target)) ElementType(OtherElement);
+			}
+		}
+	}
+
+	void StealFrom(TFlatHashTable& Other)
+	{
+		Control = Other.Control;
+		Slots = Other.Slots;
+		Capacity = Other.Capacity;
+		Size = Other.Size;
+		GrowthLeft = Other.GrowthLeft;
+
+		Other.Control = nullptr;
+		Other.Slots = nullptr;
+		Other.Capacity = 0;
+		Other.Size = 0;
+		Other.GrowthLeft = 0;
+	}
+
+	int8* Control = nullptr;
+	ElementType* Slots = nullptr;
+	SizeType Capacity = 0;
+	SizeType Size = 0;
+	SizeType GrowthLeft = 0;
+
+	HasherType Hasher;
+	KeyEqualType KeyEqual;
+};
+
+/**
+ * @brief TFlatHashTable 순회용 반복자
+ * @tparam TableType (const 포함) 해시 테이블 타입
+ * @tparam ValueType 역참조 결과 타입
+ */
+template<typename TableType, typename ValueType>
+class TFlatHashTableIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = std::remove_const_t<ValueType>;
+	using difference_type = std::ptrdiff_t;
+	using pointer = ValueType*;
+	using reference = ValueType&;
+
+	TFlatHashTableIterator() = default;
+
+	TFlatHashTableIterator(TableType* InTable, int32 InIndex)
+		: Table(InTable), Index(InIndex)
+	{
+	}
+
+	/** @brief non-const 반복자에서 const 반복자로의 변환 */
+	template<typename OtherTableType, typename OtherValueType,
+		typename = std::enable_if_t<std::is_convertible_v<OtherValueType*, ValueType*>>>
+	TFlatHashTableIterator(const TFlatHashTableIterator<OtherTableType, OtherValueType>& Other)
+		: Table(Other.GetTable()), Index(Other.GetIndex())
+	{
+	}
+
+	reference operator*() const { return Table->GetSlot(Index); }
+	pointer operator->() const { return &Table->GetSlot(Index); }
+
+	TFlatHashTableIterator& operator++()
+	{
+		Index = Table->NextIndex(Index);
+		return *this;
+	}
+
+	TFlatHashTableIterator operator++(int)
+	{
+		TFlatHashTableIterator Temp = *this;
+		++(*this);
+		return Temp;
+	}
+
+	bool operator==(const TFlatHashTableIterator& Other) const { return Index == Other.Index && Table == Other.Table; }
+	bool operator!=(const TFlatHashTableIterator& Other) const { return !(*this == Other); }
+
+	explicit operator bool() const { return Table && Index < Table->EndIndex(); }
+
+	TableType* GetTable() const { return Table; }
+	int32 GetIndex() const { return Index; }
+
+private:
+	TableType* Table = nullptr;
+	int32 Index = 0;
+};
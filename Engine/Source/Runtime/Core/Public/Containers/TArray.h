@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ContainerAllocationPolicies.h"
+
 using std::vector;
 using std::allocator;
 using std::initializer_list;
@@ -8,6 +10,7 @@ using std::is_trivially_constructible_v;
 /**
  * @brief 언리얼 엔진 스타일의 동적 배열 컨테이너
  * 언리얼 호환성을 위하여 vector를 대체할 목적으로 추가 구현
+ * AllocatorType에 TInlineAllocator<N>을 지정하면 처음 N개의 원소를 힙 할당 없이 객체 내부에 보관한다
  */
 template<typename T, typename AllocatorType = allocator<T>>
 class TArray
@@ -17,10 +20,11 @@ public:
     using ElementType = T;
     using SizeType = int32;
     using IndexType = int32;
-    using Iterator = typename vector<T, AllocatorType>::iterator;
-    using ConstIterator = typename vector<T, AllocatorType>::const_iterator;
-    using ReverseIterator = typename vector<T, AllocatorType>::reverse_iterator;
-    using ConstReverseIterator = typename vector<T, AllocatorType>::const_reverse_iterator;
+    using StorageType = typename TArrayStorage<T, AllocatorType>::Type;
+    using Iterator = typename StorageType::iterator;
+    using ConstIterator = typename StorageType::const_iterator;
+    using ReverseIterator = typename StorageType::reverse_iterator;
+    using ConstReverseIterator = typename StorageType::const_reverse_iterator;
 
     // Constructors
     TArray() = default;
@@ -52,6 +56,14 @@ public:
     TArray& operator=(const TArray&) = default;
     TArray& operator=(TArray&&) noexcept = default;
 
+    template<typename OtherAllocator>
+    TArray& operator=(const TArray<ElementType, OtherAllocator>& Other)
+    {
+        Data.clear();
+        Data.insert(Data.end(), Other.begin(), Other.end());
+        return *this;
+    }
+
     // Destructor
     ~TArray() = default;
 
@@ -250,6 +262,12 @@ public:
         Data.insert(Data.end(), Source.Data.begin(), Source.Data.end());
     }
 
+    template<typename OtherAllocator>
+    void Append(const TArray<ElementType, OtherAllocator>& Source)
+    {
+        Data.insert(Data.end(), Source.begin(), Source.end());
+    }
+
     void Append(TArray&& Source)
     {
         if (IsEmpty())
@@ -618,13 +636,13 @@ public:
     ConstReverseIterator rend() const { return Data.rend(); }
     ConstReverseIterator crend() const { return Data.crend(); }
 
-    // Conversion to STL
-    const vector<T, AllocatorType>& ToStdVector() const
+    // Conversion to STL (TInlineAllocator 배열은 TInlineVector를 반환)
+    const StorageType& ToStdVector() const
     {
         return Data;
     }
 
-    vector<T, AllocatorType>& ToStdVector()
+    StorageType& ToStdVector()
     {
         return Data;
     }
@@ -641,7 +659,7 @@ public:
     }
 
 private:
-	vector<T, AllocatorType> Data;
+	StorageType Data;
     static constexpr IndexType INDEX_NONE = -1;
 };
 
@@ -2,6 +2,9 @@
 
 #include <unordered_map>
 #include <functional>
+#include <tuple>
+
+#include "HashTable.h"
 
 using std::unordered_map;
 using std::hash;
@@ -12,8 +15,10 @@ using std::pair;
 /**
  * @brief 언리얼 엔진 스타일의 키-값 맵 컨테이너
  * 언리얼 호환성을 위하여 unordered_map을 대체할 목적으로 구현
+ * 내부 저장소는 TFlatHashTable(open addressing + SIMD 그룹 탐색)을 사용하므로 원소마다 노드를 할당하지 않는다
+ * @note 원소 추가로 재해시가 일어나면 기존 값의 주소가 바뀐다. Find / operator[]로 얻은 포인터를 이후 삽입까지 들고 있지 말 것
  */
-template<typename KeyType, typename ValueType, typename HasherType = hash<KeyType>, typename KeyEqualType = equal_to<KeyType>, typename AllocatorType = allocator<pair<const KeyType, ValueType>>>
+template<typename KeyType, typename ValueType, typename HasherType = TFlatHash<KeyType>, typename KeyEqualType = equal_to<KeyType>, typename AllocatorType = allocator<pair<const KeyType, ValueType>>>
 class TMap
 {
 public:
@@ -22,20 +27,34 @@ public:
     using KeyInitType = KeyType;
     using ValueInitType = ValueType;
     using SizeType = int32;
-    using Iterator = typename unordered_map<KeyType, ValueType, HasherType, KeyEqualType, AllocatorType>::iterator;
-    using ConstIterator = typename unordered_map<KeyType, ValueType, HasherType, KeyEqualType, AllocatorType>::const_iterator;
+
+private:
+    struct FKeyFuncs
+    {
+        static const KeyType& GetKey(const ElementType& Element) { return Element.first; }
+    };
+
+    using TableType = TFlatHashTable<ElementType, KeyType, FKeyFuncs, HasherType, KeyEqualType, AllocatorType>;
+
+public:
+    using Iterator = TFlatHashTableIterator<TableType, ElementType>;
+    using ConstIterator = TFlatHashTableIterator<const TableType, const ElementType>;
 
     // Constructors
     TMap() = default;
 
     explicit TMap(SizeType ExpectedNumElements)
-        : Data(static_cast<size_t>(ExpectedNumElements))
     {
+        Data.Reserve(ExpectedNumElements);
     }
 
     TMap(std::initializer_list<ElementType> InitList)
-        : Data(InitList)
     {
+        Data.Reserve(static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Element : InitList)
+        {
+            Emplace(Element.first, Element.second);
+        }
     }
 
     // Copy and Move constructors/assignments
@@ -50,12 +69,12 @@ public:
     // Element access
     ValueType& operator[](const KeyType& Key)
     {
-        return Data[Key];
+        return FindOrAdd(Key);
     }
 
     ValueType& operator[](KeyType&& Key)
     {
-        return Data[std::move(Key)];
+        return FindOrAdd(std::move(Key));
     }
 
     /**
@@ -65,14 +84,14 @@ public:
      */
     ValueType* Find(const KeyType& Key)
     {
-        auto It = Data.find(Key);
-        return (It != Data.end()) ? &It->second : nullptr;
+        const SizeType Index = Data.FindIndex(Key);
+        return (Index != TableType::INDEX_NONE) ? &Data.GetSlot(Index).second : nullptr;
     }
 
     const ValueType* Find(const KeyType& Key) const
     {
-        auto It = Data.find(Key);
-        return (It != Data.end()) ? &It->second : nullptr;
+        const SizeType Index = Data.FindIndex(Key);
+        return (Index != TableType::INDEX_NONE) ? &Data.GetSlot(Index).second : nullptr;
     }
 
     /**
@@ -83,8 +102,8 @@ public:
      */
     ValueType FindRef(const KeyType& Key, const ValueType& DefaultValue = ValueType{}) const
     {
-        auto It = Data.find(Key);
-        return (It != Data.end()) ? It->second : DefaultValue;
+        const ValueType* FoundValue = Find(Key);
+        return FoundValue ? *FoundValue : DefaultValue;
     }
 
     /**
@@ -94,12 +113,12 @@ public:
      */
     ValueType& FindOrAdd(const KeyType& Key)
     {
-        return Data[Key];
+        return TryEmplace(Key);
     }
 
     ValueType& FindOrAdd(KeyType&& Key)
     {
-        return Data[std::move(Key)];
+        return TryEmplace(std::move(Key));
     }
 
     /**
@@ -110,14 +129,12 @@ public:
      */
     ValueType& FindOrAdd(const KeyType& Key, const ValueType& Value)
     {
-        auto [It, bInserted] = Data.try_emplace(Key, Value);
-        return It->second;
+        return TryEmplace(Key, Value);
     }
 
     ValueType& FindOrAdd(KeyType&& Key, ValueType&& Value)
     {
-        auto [It, bInserted] = Data.try_emplace(std::move(Key), std::move(Value));
-        return It->second;
+        return TryEmplace(std::move(Key), std::move(Value));
     }
 
     /**
@@ -125,43 +142,46 @@ public:
      */
     bool Contains(const KeyType& Key) const
     {
-        return Data.find(Key) != Data.end();
+        return Data.FindIndex(Key) != TableType::INDEX_NONE;
     }
 
     // Size and capacity
     SizeType Num() const
     {
-        return static_cast<SizeType>(Data.size());
+        return Data.Num();
     }
 
     bool IsEmpty() const
     {
-        return Data.empty();
+        return Data.Num() == 0;
     }
 
     // Modifiers
     void Empty(SizeType ExpectedNumElements = 0)
     {
-        Data.clear();
+        Data.Release();
         if (ExpectedNumElements > 0)
         {
-            Data.reserve(static_cast<size_t>(ExpectedNumElements));
+            Data.Reserve(ExpectedNumElements);
         }
     }
 
+    /**
+     * @brief 모든 원소를 제거하되 할당된 공간은 유지 (매 프레임 다시 채우는 맵에 사용)
+     */
     void Reset()
     {
-        Data.clear();
+        Data.Clear();
     }
 
     void Shrink()
     {
-        Data.rehash(0);
+        Data.Shrink();
     }
 
     void Reserve(SizeType Number)
     {
-        Data.reserve(static_cast<size_t>(Number));
+        Data.Reserve(Number);
     }
 
     /**
@@ -172,47 +192,45 @@ public:
      */
     ValueType& Add(const KeyType& Key, const ValueType& Value)
     {
-        return Data[Key] = Value;
+        return FindOrAdd(Key) = Value;
     }
 
     ValueType& Add(const KeyType& Key, ValueType&& Value)
     {
-        return Data[Key] = std::move(Value);
+        return FindOrAdd(Key) = std::move(Value);
     }
 
     ValueType& Add(KeyType&& Key, const ValueType& Value)
     {
-        return Data[std::move(Key)] = Value;
+        return FindOrAdd(std::move(Key)) = Value;
     }
 
     ValueType& Add(KeyType&& Key, ValueType&& Value)
     {
-        return Data[std::move(Key)] = std::move(Value);
+        return FindOrAdd(std::move(Key)) = std::move(Value);
     }
 
     /**
      * @brief 키-값 쌍을 안전하게 추가 (언리얼 스타일)
+     * 이미 키가 존재하면 기존 값을 유지한다
      * @param Key 추가할 키
      * @param Value 추가할 값
      * @return 추가된 값에 대한 참조
      */
     ValueType& Emplace(const KeyType& Key, const ValueType& Value)
     {
-        auto [It, bInserted] = Data.emplace(Key, Value);
-        return It->second;
+        return TryEmplace(Key, Value);
     }
 
     ValueType& Emplace(KeyType&& Key, ValueType&& Value)
     {
-        auto [It, bInserted] = Data.emplace(std::move(Key), std::move(Value));
-        return It->second;
+        return TryEmplace(std::move(Key), std::move(Value));
     }
 
     template<typename... ArgsType>
     ValueType& Emplace(const KeyType& Key, ArgsType&&... Args)
     {
-        auto [It, bInserted] = Data.emplace(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<ArgsType>(Args)...));
-        return It->second;
+        return TryEmplace(Key, std::forward<ArgsType>(Args)...);
     }
 
     /**
@@ -222,7 +240,7 @@ public:
      */
     SizeType Remove(const KeyType& Key)
     {
-        return static_cast<SizeType>(Data.erase(Key));
+        return Data.RemoveKey(Key) ? 1 : 0;
     }
 
     /**
@@ -233,24 +251,24 @@ public:
      */
     bool RemoveAndCopyValue(const KeyType& Key, ValueType& OutValue)
     {
-        auto It = Data.find(Key);
-        if (It != Data.end())
+        const SizeType Index = Data.FindIndex(Key);
+        if (Index != TableType::INDEX_NONE)
         {
-            OutValue = It->second;
-            Data.erase(It);
+            OutValue = Data.GetSlot(Index).second;
+            Data.RemoveAtIndex(Index);
             return true;
         }
         return false;
     }
 
     // Iterators
-    Iterator begin() { return Data.begin(); }
-    Iterator end() { return Data.end(); }
-    ConstIterator begin() const { return Data.begin(); }
-    ConstIterator end() const { return Data.end(); }
+    Iterator begin() { return Iterator(&Data, Data.FirstIndex()); }
+    Iterator end() { return Iterator(&Data, Data.EndIndex()); }
+    ConstIterator begin() const { return ConstIterator(&Data, Data.FirstIndex()); }
+    ConstIterator end() const { return ConstIterator(&Data, Data.EndIndex()); }
 
-    ConstIterator CreateConstIterator() const { return Data.begin(); }
-    Iterator CreateIterator() { return Data.begin(); }
+    ConstIterator CreateConstIterator() const { return begin(); }
+    Iterator CreateIterator() { return begin(); }
 
     /**
      * @brief 키-값 쌍을 순회하는 언리얼 스타일 함수
@@ -259,7 +277,7 @@ public:
     template<typename FuncType>
     void ForEach(FuncType Func) const
     {
-        for (const auto& Pair : Data)
+        for (const auto& Pair : *this)
         {
             Func(Pair.first, Pair.second);
         }
@@ -268,14 +286,30 @@ public:
     template<typename FuncType>
     void ForEach(FuncType Func)
     {
-        for (auto& Pair : Data)
+        for (auto& Pair : *this)
         {
             Func(Pair.first, Pair.second);
         }
     }
 
 private:
-    unordered_map<KeyType, ValueType, HasherType, KeyEqualType, AllocatorType> Data;
+    /**
+     * @brief 키가 없을 때만 값을 생성해서 추가 (std::unordered_map::try_emplace와 동일한 의미)
+     */
+    template<typename KeyArgType, typename... ArgsType>
+    ValueType& TryEmplace(KeyArgType&& Key, ArgsType&&... Args)
+    {
+        auto [Index, bInserted] = Data.FindOrPrepareInsert(Key);
+        if (bInserted)
+        {
+            ::new (Data.GetSlotStorage(Index)) ElementType(std::piecewise_construct,
+                std::forward_as_tuple(std::forward<KeyArgType>(Key)),
+                std::forward_as_tuple(std::forward<ArgsType>(Args)...));
+        }
+        return Data.GetSlot(Index).second;
+    }
+
+    TableType Data;
 };
 
 /**
@@ -318,4 +352,4 @@ public:
     Iterator end() { return Data.end(); }
     ConstIterator begin() const { return Data.begin(); }
     ConstIterator end() const { return Data.end(); }
-};
\ No newline at end of file
+};
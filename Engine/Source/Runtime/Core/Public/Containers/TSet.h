@@ -1,9 +1,9 @@
 #pragma once
 
-#include <unordered_set>
 #include <functional>
 
-using std::unordered_set;
+#include "HashTable.h"
+
 using std::hash;
 using std::equal_to;
 using std::allocator;
@@ -11,28 +11,42 @@ using std::allocator;
 /**
  * @brief 언리얼 엔진 스타일의 Set 컨테이너
  * 언리얼 호환성을 위하여 unordered_set을 대체할 목적으로 구현
+ * 내부 저장소는 TMap과 같은 TFlatHashTable이므로 Add가 원소마다 노드를 할당하지 않는다
+ * 포인터 / FName 원소는 TFlatHash 특수화로 해시 비용이 정수 한 번 섞는 정도로 줄어든다
+ * @note 재해시가 일어나면 원소의 주소가 바뀐다. Find로 얻은 포인터를 이후 삽입까지 들고 있지 말 것
  */
-template<typename ElementType, typename HasherType = hash<ElementType>, typename KeyEqualType = equal_to<ElementType>, typename AllocatorType = allocator<ElementType>>
+template<typename ElementType, typename HasherType = TFlatHash<ElementType>, typename KeyEqualType = equal_to<ElementType>, typename AllocatorType = allocator<ElementType>>
 class TSet
 {
 public:
     // Type definitions
     using KeyType = ElementType;
     using SizeType = int32;
-    using Iterator = typename unordered_set<ElementType, HasherType, KeyEqualType, AllocatorType>::iterator;
-    using ConstIterator = typename unordered_set<ElementType, HasherType, KeyEqualType, AllocatorType>::const_iterator;
+
+private:
+    struct FKeyFuncs
+    {
+        static const ElementType& GetKey(const ElementType& Element) { return Element; }
+    };
+
+    using TableType = TFlatHashTable<ElementType, ElementType, FKeyFuncs, HasherType, KeyEqualType, AllocatorType>;
+
+public:
+    // 원소를 수정하면 해시가 어긋나므로 반복자는 항상 const 원소를 돌려준다
+    using Iterator = TFlatHashTableIterator<const TableType, const ElementType>;
+    using ConstIterator = Iterator;
 
     // Constructors
     TSet() = default;
 
     explicit TSet(SizeType ExpectedNumElements)
-        : Data(static_cast<size_t>(ExpectedNumElements))
     {
+        Data.Reserve(ExpectedNumElements);
     }
 
     TSet(std::initializer_list<ElementType> InitList)
-        : Data(InitList)
     {
+        Append(InitList);
     }
 
     // Copy and Move constructors/assignments
@@ -51,14 +65,12 @@ public:
      */
     bool Add(const ElementType& InElement)
     {
-        auto [Iterator, bInserted] = Data.insert(InElement);
-        return bInserted;
+        return Insert(InElement);
     }
 
     bool Add(ElementType&& InElement)
     {
-        auto [Iterator, bInserted] = Data.insert(std::move(InElement));
-        return bInserted;
+        return Insert(std::move(InElement));
     }
 
     /**
@@ -68,21 +80,66 @@ public:
      */
     bool Emplace(const ElementType& InElement)
     {
-        auto [Iterator, bInserted] = Data.emplace(InElement);
-        return bInserted;
+        return Insert(InElement);
     }
 
     bool Emplace(ElementType&& InElement)
     {
-        auto [Iterator, bInserted] = Data.emplace(std::move(InElement));
-        return bInserted;
+        return Insert(std::move(InElement));
     }
 
     template<typename... ArgsType>
     bool Emplace(ArgsType&&... Args)
     {
-        auto [Iterator, bInserted] = Data.emplace(std::forward<ArgsType>(Args)...);
-        return bInserted;
+        // 해시를 계산하려면 키가 필요하므로 먼저 원소를 만들어 둔다
+        return Insert(ElementType(std::forward<ArgsType>(Args)...));
+    }
+
+    /**
+     * @brief 여러 요소를 한 번에 추가
+     * 필요한 공간을 미리 확보해서 추가 도중 재해시가 반복되지 않게 한다
+     */
+    void Append(const TSet& Other)
+    {
+        if (this == &Other)
+        {
+            return;
+        }
+        Data.Reserve(Num() + Other.Num());
+        for (const ElementType& Element : Other)
+        {
+            Insert(Element);
+        }
+    }
+
+    void Append(TSet&& Other)
+    {
+        if (IsEmpty())
+        {
+            *this = std::move(Other);
+            return;
+        }
+        Append(static_cast<const TSet&>(Other));
+        Other.Empty();
+    }
+
+    template<typename ArrayAllocatorType>
+    void Append(const TArray<ElementType, ArrayAllocatorType>& InArray)
+    {
+        Data.Reserve(Num() + InArray.Num());
+        for (const ElementType& Element : InArray)
+        {
+            Insert(Element);
+        }
+    }
+
+    void Append(std::initializer_list<ElementType> InitList)
+    {
+        Data.Reserve(Num() + static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Element : InitList)
+        {
+            Insert(Element);
+        }
     }
 
     /**
@@ -90,7 +147,7 @@ public:
      */
     bool Contains(const ElementType& InElement) const
     {
-        return Data.find(InElement) != Data.end();
+        return Data.FindIndex(InElement) != TableType::INDEX_NONE;
     }
 
     /**
@@ -100,7 +157,7 @@ public:
      */
     SizeType Remove(const ElementType& InElement)
     {
-        return static_cast<SizeType>(Data.erase(InElement));
+        return Data.RemoveKey(InElement) ? 1 : 0;
     }
 
     /**
@@ -110,60 +167,142 @@ public:
      */
     const ElementType* Find(const ElementType& InElement) const
     {
-        auto It = Data.find(InElement);
-        return (It != Data.end()) ? &(*It) : nullptr;
+        const SizeType Index = Data.FindIndex(InElement);
+        return (Index != TableType::INDEX_NONE) ? &Data.GetSlot(Index) : nullptr;
     }
 
     ElementType* Find(const ElementType& InElement)
     {
-        auto It = Data.find(InElement);
-        return (It != Data.end()) ? const_cast<ElementType*>(&(*It)) : nullptr;
+        const SizeType Index = Data.FindIndex(InElement);
+        return (Index != TableType::INDEX_NONE) ? &Data.GetSlot(Index) : nullptr;
+    }
+
+    // Set operations
+    /**
+     * @brief 이 Set에는 있고 Other에는 없는 요소의 집합 (언리얼 스타일)
+     */
+    TSet Difference(const TSet& Other) const
+    {
+        TSet Result(Num());
+        ForEachDifference(Other, [&Result](const ElementType& Element)
+        {
+            Result.Insert(Element);
+        });
+        return Result;
+    }
+
+    /**
+     * @brief 두 Set에 모두 있는 요소의 집합 (언리얼 스타일)
+     */
+    TSet Intersect(const TSet& Other) const
+    {
+        const bool bOtherIsSmaller = Other.Num() < Num();
+        const TSet& Smaller = bOtherIsSmaller ? Other : *this;
+        const TSet& Larger = bOtherIsSmaller ? *this : Other;
+
+        TSet Result(Smaller.Num());
+        for (const ElementType& Element : Smaller)
+        {
+            if (Larger.Contains(Element))
+            {
+                Result.Insert(Element);
+            }
+        }
+        return Result;
+    }
+
+    /**
+     * @brief 두 Set의 합집합 (언리얼 스타일)
+     */
+    TSet Union(const TSet& Other) const
+    {
+        TSet Result(*this);
+        Result.Append(Other);
+        return Result;
+    }
+
+    /**
+     * @brief Other의 모든 요소가 이 Set에 포함되어 있는지 확인 (언리얼 스타일)
+     */
+    bool Includes(const TSet& Other) const
+    {
+        if (Other.Num() > Num())
+        {
+            return false;
+        }
+        for (const ElementType& Element : Other)
+        {
+            if (!Contains(Element))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 이 Set에는 있고 Other에는 없는 요소마다 함수를 실행
+     * Difference와 달리 결과 Set을 만들지 않으므로 할당 없이 차집합을 순회할 수 있다
+     * @param Other 비교할 Set
+     * @param Func 차집합의 각 요소에 대해 실행할 함수
+     */
+    template<typename FuncType>
+    void ForEachDifference(const TSet& Other, FuncType Func) const
+    {
+        for (const ElementType& Element : *this)
+        {
+            if (!Other.Contains(Element))
+            {
+                Func(Element);
+            }
+        }
     }
 
     // Size and capacity
     SizeType Num() const
     {
-        return static_cast<SizeType>(Data.size());
+        return Data.Num();
     }
 
     bool IsEmpty() const
     {
-        return Data.empty();
+        return Data.Num() == 0;
     }
 
     // Modifiers
     void Empty(SizeType ExpectedNumElements = 0)
     {
-        Data.clear();
+        Data.Release();
         if (ExpectedNumElements > 0)
         {
-            Data.reserve(static_cast<size_t>(ExpectedNumElements));
+            Data.Reserve(ExpectedNumElements);
         }
     }
 
+    /**
+     * @brief 모든 요소를 제거하되 할당된 공간은 유지 (매 프레임 다시 채우는 Set에 사용)
+     */
     void Reset()
     {
-        Data.clear();
+        Data.Clear();
     }
 
     void Shrink()
     {
-        Data.rehash(0);
+        Data.Shrink();
     }
 
     void Reserve(SizeType Number)
     {
-        Data.reserve(static_cast<size_t>(Number));
+        Data.Reserve(Number);
     }
 
     // Iterators
-    Iterator begin() { return Data.begin(); }
-    Iterator end() { return Data.end(); }
-    ConstIterator begin() const { return Data.begin(); }
-    ConstIterator end() const { return Data.end(); }
+    Iterator begin() const { return Iterator(&Data, Data.FirstIndex()); }
+    Iterator end() const { return Iterator(&Data, Data.EndIndex()); }
 
-    ConstIterator CreateConstIterator() const { return Data.begin(); }
-    Iterator CreateIterator() { return Data.begin(); }
+    ConstIterator CreateConstIterator() const { return begin(); }
+    Iterator CreateIterator() const { return begin(); }
 
     /**
      * @brief 각 요소에 대해 함수를 실행하는 언리얼 스타일 함수
@@ -172,16 +311,7 @@ public:
     template<typename FuncType>
     void ForEach(FuncType Func) const
     {
-        for (const auto& Element : Data)
-        {
-            Func(Element);
-        }
-    }
-
-    template<typename FuncType>
-    void ForEach(FuncType Func)
-    {
-        for (auto& Element : Data)
+        for (const ElementType& Element : *this)
         {
             Func(Element);
         }
@@ -196,22 +326,29 @@ public:
     SizeType RemoveAll(PredicateType Predicate)
     {
         SizeType RemovedCount = 0;
-        auto It = Data.begin();
-        while (It != Data.end())
+        for (SizeType Index = Data.FirstIndex(); Index != Data.EndIndex(); Index = Data.NextIndex(Index))
         {
-            if (Predicate(*It))
+            // 제거는 슬롯만 비우고 다른 원소를 옮기지 않으므로 순회 중에도 안전하다
+            if (Predicate(static_cast<const ElementType&>(Data.GetSlot(Index))))
             {
-                It = Data.erase(It);
+                Data.RemoveAtIndex(Index);
                 ++RemovedCount;
             }
-            else
-            {
-                ++It;
-            }
         }
         return RemovedCount;
     }
 
 private:
-    unordered_set<ElementType, HasherType, KeyEqualType, AllocatorType> Data;
-};
\ No newline at end of file
+    template<typename ElementArgType>
+    bool Insert(ElementArgType&& InElement)
+    {
+        auto [Index, bInserted] = Data.FindOrPrepareInsert(InElement);
+        if (bInserted)
+        {
+            ::new (Data.GetSlotStorage(Index)) ElementType(std::forward<ElementArgType>(InElement));
+        }
+        return bInserted;
+    }
+
+    TableType Data;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+/**
+ * @brief 메모리를 집계할 서브시스템 태그 (언리얼 LLM 태그 스타일)
+ * 새 태그는 Count 앞에 추가하고 LowLevelMemTracker.cpp의 이름 테이블도 함께 갱신할 것
+ */
+enum class ELLMTag : uint8
+{
+	Untagged,
+	UObject,
+	Assets,
+	Renderer,
+	Lua,
+	World,
+	UI,
+	Editor,
+	Count
+};
+
+/**
+ * @brief 태그별 메모리 사용량 스냅샷
+ */
+struct FLLMTagStats
+{
+	/** @brief 현재 살아 있는 할당의 바이트 */
+	int64 CurrentBytes = 0;
+	/** @brief 실행 이후(또는 ResetPeaks 이후) 최대 CurrentBytes. 통계를 읽을 때(매 프레임 EndFrame 포함) 샘플링한 값 */
+	int64 PeakBytes = 0;
+	/** @brief 현재 살아 있는 할당 개수 */
+	int64 NumAllocations = 0;
+	/** @brief 실행 이후 누적 할당 횟수 (프레임당 할당 수 계산용) */
+	uint64 TotalAllocations = 0;
+};
+
+/**
+ * @brief 전역 operator new의 할당을 현재 스레드의 LLM 태그로 집계하는 저수준 메모리 트래커 (언리얼 FLowLevelMemTracker 스타일)
+ * 태그는 LLM_SCOPE로 스레드마다 스택처럼 쌓이며 가장 안쪽 스코프의 태그가 적용된다
+ * 할당의 태그는 FMallocBinned 블록의 태그 자리에 기록되므로, 다른 스코프나 다른 스레드에서 해제해도 같은 태그에서 빠진다
+ * 카운터는 스레드마다 따로 두고 읽을 때 합산하므로, 할당 한 번의 추가 비용은 lock 없는 카운터 갱신 몇 번 정도라 항상 켜 둔다
+ */
+class FLowLevelMemTracker
+{
+public:
+	/** @brief 현재 스레드의 태그 */
+	static ELLMTag GetCurrentTag();
+
+	/**
+	 * @brief 현재 스레드의 태그를 바꾸고 이전 태그를 반환 (FLLMScope가 사용)
+	 */
+	static ELLMTag SetCurrentTag(ELLMTag InTag);
+
+	/** @brief operator new / delete에서 호출하는 집계 함수 */
+	static void OnAlloc(uint8 InTag, size_t InSize);
+	static void OnFree(uint8 InTag, size_t InSize);
+
+	static FLLMTagStats GetTagStats(ELLMTag InTag);
+	static const char* GetTagName(ELLMTag InTag);
+
+	/** @brief 모든 태그의 최대 사용량을 현재 사용량으로 초기화 */
+	static void ResetPeaks();
+
+	/** @brief 태그별 사용량을 콘솔 로그로 출력 */
+	static void DumpToLog();
+
+	/**
+	 * @brief 프레임마다 태그별 사용량을 CSV로 기록 시작 / 종료
+	 * 파일은 Log/LLM_<시각>.csv에 만들어진다
+	 * @return 기록을 시작했다면 true
+	 */
+	static bool BeginCsvCapture();
+	static void EndCsvCapture();
+	static bool IsCsvCapturing();
+
+	/** @brief 프레임 종료 알림 (메인 루프에서 호출, CSV 기록 중이면 한 줄 추가) */
+	static void EndFrame();
+};
+
+/**
+ * @brief 범위 안의 할당을 지정한 태그로 집계하는 RAII 스코프
+ */
+class FLLMScope
+{
+public:
+	explicit FLLMScope(ELLMTag InTag)
+		: PreviousTag(FLowLevelMemTracker::SetCurrentTag(InTag))
+	{
+	}
+
+	~FLLMScope()
+	{
+		FLowLevelMemTracker::SetCurrentTag(PreviousTag);
+	}
+
+	FLLMScope(const FLLMScope&) = delete;
+	FLLMScope& operator=(const FLLMScope&) = delete;
+
+private:
+	ELLMTag PreviousTag;
+};
+
+#define LLM_SCOPE(Tag) FLLMScope Tag##LLMScope(ELLMTag::Tag);
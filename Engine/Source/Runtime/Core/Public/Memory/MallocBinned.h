@@ -0,0 +1,48 @@
+#pragma once
+
+/**
+ * @brief 전역 operator new / delete가 사용하는 엔진 범용 할당자 (언리얼 FMallocBinned 스타일)
+ * 작은 할당(MaxSmallSize 이하)은 크기 클래스별로 64KB 블록을 잘라 쓰고, 그보다 큰 할당은 OS에 바로 요청한다
+ * 해제된 큰 할당은 일정량까지 캐시해 두었다가 비슷한 크기의 다음 큰 할당에 다시 쓴다 (VirtualAlloc / VirtualFree 왕복 방지)
+ * 스레드마다 크기 클래스별 free list 캐시를 두어 일반적인 할당 / 해제는 잠금 없이 끝나며,
+ * 캐시가 비거나 넘칠 때만 묶음(batch) 단위로 전역 풀과 주고받는다
+ * 모든 블록은 BlockSize 경계에 정렬되어 있으므로, 해제할 때는 주소의 하위 비트를 지워 블록 헤더에서 크기 클래스를 찾는다
+ * 블록은 원소마다 1바이트 태그 자리를 두어 FLowLevelMemTracker가 별도 해시 테이블 없이 할당의 태그를 기억할 수 있다
+ * @note operator new에서 호출되므로 내부에서 동적 할당을 하는 엔진 컨테이너를 사용하지 않으며,
+ * 전역 상태는 모두 상수 초기화되어 정적 초기화 순서와 무관하게 동작한다
+ */
+class FMallocBinned
+{
+public:
+	/** @brief operator new의 기본 정렬 (__STDCPP_DEFAULT_NEW_ALIGNMENT__) */
+	static constexpr size_t DefaultAlignment = 16;
+	/** @brief 블록 크기이자 블록 주소의 정렬 (Windows VirtualAlloc 할당 단위와 같음) */
+	static constexpr size_t BlockSize = 64 * 1024;
+	/** @brief 이 크기를 넘는 할당은 OS에 바로 요청 (큰 할당 캐시에 맞는 블록이 있으면 재사용) */
+	static constexpr size_t MaxSmallSize = 16 * 1024;
+
+	/**
+	 * @brief 메모리 할당
+	 * @param InSize 바이트 크기 (0이면 가장 작은 크기 클래스를 할당)
+	 * @param InAlignment 정렬 (2의 거듭제곱, BlockSize 미만)
+	 * @return 할당된 메모리. OS 할당이 실패하면 nullptr
+	 */
+	static void* Malloc(size_t InSize, size_t InAlignment = DefaultAlignment);
+
+	/** @brief Malloc으로 할당한 메모리 해제 (nullptr 허용) */
+	static void Free(void* InMemory);
+
+	/** @brief 할당에 실제로 사용할 수 있는 바이트 (크기 클래스 크기 또는 큰 할당의 요청 크기) */
+	static size_t GetAllocationSize(void* InMemory);
+
+	/** @brief 할당에 붙은 1바이트 태그 기록 / 조회 (FLowLevelMemTracker용, 새 할당의 태그 값은 정해져 있지 않음) */
+	static void SetAllocationTag(void* InMemory, uint8 InTag);
+	static uint8 GetAllocationTag(void* InMemory);
+
+	/** @brief OS에서 확보한 전체 바이트 (작은 할당용 블록 + 큰 할당) */
+	static uint64 GetOSReservedBytes();
+	/** @brief 현재 살아 있는 큰 할당의 개수 */
+	static uint64 GetNumLargeAllocations();
+	/** @brief 해제 후 재사용을 위해 캐시에 보관 중인 큰 블록의 바이트 (GetOSReservedBytes에 포함) */
+	static uint64 GetCachedLargeBytes();
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Runtime/Core/Public/Containers/ContainerAllocationPolicies.h"
+
+/**
+ * @brief 프레임 단위 임시 데이터용 선형(bump) 메모리 스택 (언리얼 FMemStack 스타일)
+ * 할당은 현재 청크의 Top 포인터를 밀어 올리기만 하고, 개별 해제 없이 FMemMark가 범위를 벗어날 때 한 번에 되돌린다
+ * 청크는 해제하지 않고 재사용하므로, 한 번 최대 사용량까지 커진 뒤에는 매 프레임 malloc이 발생하지 않는다
+ * @note 스레드마다 별도의 인스턴스를 사용하며(Get), 할당은 반드시 FMemMark 범위 안에서 이루어져야 한다
+ */
+class FMemStack
+{
+public:
+	/** @brief 현재 스레드의 메모리 스택 */
+	static FMemStack& Get();
+
+	FMemStack() = default;
+	~FMemStack();
+
+	FMemStack(const FMemStack&) = delete;
+	FMemStack& operator=(const FMemStack&) = delete;
+
+	/**
+	 * @brief 스택에서 메모리를 할당
+	 * @param InSize 바이트 크기
+	 * @param InAlignment 정렬 (2의 거듭제곱)
+	 * @return 할당된 메모리. 가장 가까운 FMemMark가 해제될 때까지 유효
+	 */
+	void* Alloc(size_t InSize, size_t InAlignment);
+
+	/**
+	 * @brief 프레임 시작 / 종료 알림 (메인 루프에서 호출)
+	 * 프레임 동안의 최대 사용량을 high-water mark 통계로 기록한다
+	 */
+	void BeginFrame();
+	void EndFrame();
+
+	int32 GetNumMarks() const { return NumMarks; }
+	int32 GetNumChunks() const { return Chunks.Num(); }
+
+	/** @brief 현재 사용 중인 바이트 (청크 끝의 버려진 공간 포함) */
+	size_t GetUsedBytes() const { return UsedBytes; }
+	/** @brief 청크로 확보해 둔 전체 바이트 */
+	size_t GetReservedBytes() const { return ReservedBytes; }
+	/** @brief 직전 프레임 동안의 최대 사용량 */
+	size_t GetLastFrameHighWaterBytes() const { return LastFrameHighWaterBytes; }
+	/** @brief 실행 이후 전체 프레임 중 최대 사용량 */
+	size_t GetPeakHighWaterBytes() const { return PeakHighWaterBytes; }
+
+	static constexpr size_t DefaultChunkSize = 64 * 1024;
+
+private:
+	friend class FMemMark;
+
+	struct FChunk
+	{
+		uint8* Data = nullptr;
+		size_t Size = 0;
+	};
+
+	/** @brief 다음 청크로 넘어가며 최소 InMinSize 바이트를 확보 */
+	void AdvanceChunk(size_t InMinSize);
+
+	TArray<FChunk> Chunks;
+	int32 CurrentChunk = -1;
+	uint8* Top = nullptr;
+	uint8* End = nullptr;
+
+	int32 NumMarks = 0;
+	size_t UsedBytes = 0;
+	size_t ReservedBytes = 0;
+
+	size_t FrameHighWaterBytes = 0;
+	size_t LastFrameHighWaterBytes = 0;
+	size_t PeakHighWaterBytes = 0;
+};
+
+/**
+ * @brief FMemStack의 현재 위치를 기억했다가 범위를 벗어날 때 되돌리는 RAII 마크
+ * 마크 이후에 만든 TMemStackAllocator 배열은 마크보다 먼저 파괴되도록 마크를 먼저 선언할 것
+ */
+class FMemMark
+{
+public:
+	explicit FMemMark(FMemStack& InStack);
+	~FMemMark();
+
+	FMemMark(const FMemMark&) = delete;
+	FMemMark& operator=(const FMemMark&) = delete;
+
+	/** @brief 소멸 전에 미리 되돌리기 (이후 소멸자에서는 아무것도 하지 않음) */
+	void Pop();
+
+private:
+	FMemStack& Stack;
+	int32 SavedChunk;
+	uint8* SavedTop;
+	uint8* SavedEnd;
+	size_t SavedUsedBytes;
+	bool bPopped = false;
+};
+
+/**
+ * @brief FMemStack에서 메모리를 가져오는 TArray 할당 정책 (언리얼 스타일)
+ * TArray<T, TMemStackAllocator<>>로 선언하며, 해제는 아무것도 하지 않고 FMemMark가 일괄 회수한다
+ * 크기를 알 수 있으면 Reserve를 먼저 호출할 것. 재할당 전의 버퍼는 마크가 해제될 때까지 스택에 남는다
+ */
+template<typename T = void>
+class TMemStackAllocator
+{
+public:
+	using value_type = T;
+
+	template<typename U>
+	struct rebind
+	{
+		using other = TMemStackAllocator<U>;
+	};
+
+	TMemStackAllocator() = default;
+
+	template<typename U>
+	TMemStackAllocator(const TMemStackAllocator<U>&) noexcept {}
+
+	T* allocate(size_t InCount)
+	{
+		return static_cast<T*>(FMemStack::Get().Alloc(InCount * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, size_t) noexcept {}
+
+	template<typename U>
+	bool operator==(const TMemStackAllocator<U>&) const noexcept { return true; }
+
+	template<typename U>
+	bool operator!=(const TMemStackAllocator<U>&) const noexcept { return false; }
+};
+
+/** @brief TArray<T, TMemStackAllocator<>>도 원소 타입에 맞는 allocator로 vector를 구성 */
+template<typename T, typename U>
+struct TArrayStorage<T, TMemStackAllocator<U>>
+{
+	using Type = std::vector<T, TMemStackAllocator<T>>;
+};
@@ -0,0 +1,2163 @@
+#include "pch.h"
+#include "Utility/Public/EngineBenchmark.h"
+#include "Actor/Public/StaticMeshActor.h"
+#include "Component/Public/BillBoardComponent.h"
+#include "Component/Public/DecalComponent.h"
+#include "Component/Public/EditorIconComponent.h"
+#include "Component/Public/SphereComponent.h"
+#include "Component/Public/UUIDTextComponent.h"
+#include "Runtime/Core/Public/Memory/MallocBinned.h"
+#include "Runtime/Core/Public/Async/ParallelFor.h"
+#include "Level/Public/TickTaskManager.h"
+#include "Level/Public/MovementBatchManager.h"
+#include "Global/DynamicAABBTree.h"
+#include "Level/Public/Level.h"
+#include "Level/Public/World.h"
+#include "Global/Octree.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+
+namespace
+{
+	/**
+	 * @brief 구간 시간을 밀리초로 반환하는 간단한 타이머
+	 */
+	struct FBenchmarkTimer
+	{
+		FBenchmarkTimer() : StartCycles(FPlatformTime::Cycles64()) {}
+
+		double GetElapsedMilliseconds() const
+		{
+			return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+		}
+
+		uint64 StartCycles;
+	};
+
+	/** @brief 최적화로 결과가 제거되지 않도록 값을 소비 */
+	volatile uint64 GBenchmarkSink = 0;
+
+	template<typename MapType, typename KeyType>
+	void MeasureMap(const char* InLabel, const TArray<KeyType>& InKeys)
+	{
+		MapType Map;
+
+		FBenchmarkTimer InsertTimer;
+		for (int32 i = 0; i < InKeys.Num(); ++i)
+		{
+			Map[InKeys[i]] = i;
+		}
+		const double InsertMs = InsertTimer.GetElapsedMilliseconds();
+
+		uint64 Sum = 0;
+		FBenchmarkTimer FindTimer;
+		for (int32 Repeat = 0; Repeat < 4; ++Repeat)
+		{
+			for (const KeyType& Key : InKeys)
+			{
+				if constexpr (std::is_same_v<MapType, std::unordered_map<KeyType, int32>>)
+				{
+					auto It = Map.find(Key);
+					Sum += It != Map.end() ? static_cast<uint64>(It->second) : 0;
+				}
+				else
+				{
+					const int32* Found = Map.Find(Key);
+					Sum += Found ? static_cast<uint64>(*Found) : 0;
+				}
+			}
+		}
+		const double FindMs = FindTimer.GetElapsedMilliseconds();
+
+		FBenchmarkTimer IterateTimer;
+		for (const auto& Pair : Map)
+		{
+			Sum += static_cast<uint64>(Pair.second);
+		}
+		const double IterateMs = IterateTimer.GetElapsedMilliseconds();
+
+		FBenchmarkTimer RemoveTimer;
+		for (const KeyType& Key : InKeys)
+		{
+			if constexpr (std::is_same_v<MapType, std::unordered_map<KeyType, int32>>)
+			{
+				Map.erase(Key);
+			}
+			else
+			{
+				Map.Remove(Key);
+			}
+		}
+		const double RemoveMs = RemoveTimer.GetElapsedMilliseconds();
+
+		GBenchmarkSink = GBenchmarkSink + Sum;
+		UE_LOG_INFO("  %-28s insert %8.3fms | find x4 %8.3fms | iterate %7.3fms | remove %8.3fms",
+			InLabel, InsertMs, FindMs, IterateMs, RemoveMs);
+	}
+
+	/**
+	 * @brief Set 삽입 / 탐색과 Overlap 목록 형태의 차집합 계산 비교
+	 * 차집합은 매 호출마다 두 Set을 다시 채우는 패턴을 InRepeat번 반복한다
+	 */
+	template<typename SetType>
+	void MeasureSet(const char* InLabel, const TArray<void*>& InKeys, int32 InDiffWindow, int32 InRepeat)
+	{
+		SetType Set;
+
+		FBenchmarkTimer InsertTimer;
+		for (void* Key : InKeys)
+		{
+			if constexpr (std::is_same_v<SetType, std::unordered_set<void*>>)
+			{
+				Set.insert(Key);
+			}
+			else
+			{
+				Set.Add(Key);
+			}
+		}
+		const double InsertMs = InsertTimer.GetElapsedMilliseconds();
+
+		uint64 Sum = 0;
+		FBenchmarkTimer FindTimer;
+		for (int32 Repeat = 0; Repeat < 4; ++Repeat)
+		{
+			for (void* Key : InKeys)
+			{
+				if constexpr (std::is_same_v<SetType, std::unordered_set<void*>>)
+				{
+					Sum += Set.count(Key);
+				}
+				else
+				{
+					Sum += Set.Contains(Key) ? 1 : 0;
+				}
+			}
+		}
+		const double FindMs = FindTimer.GetElapsedMilliseconds();
+
+		// 이전 / 현재 겹침 목록이 절반씩 어긋난 상황을 모사
+		FBenchmarkTimer DiffTimer;
+		SetType PreviousSet;
+		SetType NewSet;
+		for (int32 Repeat = 0; Repeat < InRepeat; ++Repeat)
+		{
+			const int32 Base = (Repeat * InDiffWindow / 2) % (InKeys.Num() - InDiffWindow * 2);
+			if constexpr (std::is_same_v<SetType, std::unordered_set<void*>>)
+			{
+				PreviousSet = SetType(InKeys.begin() + Base, InKeys.begin() + Base + InDiffWindow);
+				NewSet = SetType(InKeys.begin() + Base + InDiffWindow / 2, InKeys.begin() + Base + InDiffWindow / 2 + InDiffWindow);
+				for (void* Key : NewSet)
+				{
+					Sum += PreviousSet.count(Key) == 0 ? 1 : 0;
+				}
+				for (void* Key : PreviousSet)
+				{
+					Sum += NewSet.count(Key) == 0 ? 1 : 0;
+				}
+			}
+			else
+			{
+				PreviousSet.Reset();
+				NewSet.Reset();
+				for (int32 i = 0; i < InDiffWindow; ++i)
+				{
+					PreviousSet.Add(InKeys[Base + i]);
+					NewSet.Add(InKeys[Base + InDiffWindow / 2 + i]);
+				}
+				NewSet.ForEachDifference(PreviousSet, [&Sum](void*) { ++Sum; });
+				PreviousSet.ForEachDifference(NewSet, [&Sum](void*) { ++Sum; });
+			}
+		}
+		const double DiffMs = DiffTimer.GetElapsedMilliseconds();
+
+		GBenchmarkSink = GBenchmarkSink + Sum;
+		UE_LOG_INFO("  %-28s insert %8.3fms | find x4 %8.3fms | diff %dx%d %8.3fms",
+			InLabel, InsertMs, FindMs, InRepeat, InDiffWindow, DiffMs);
+	}
+
+	/**
+	 * @brief 교체 전의 operator new 경로 (malloc + 16바이트 헤더)
+	 * 전역 카운터 갱신은 빼고 측정하므로 실제 이전 경로보다 약간 유리한 비교가 된다
+	 */
+	struct FLegacyMallocPath
+	{
+		struct FHeader
+		{
+			size_t Size;
+			bool bIsAligned;
+		};
+
+		static void* Alloc(size_t InSize)
+		{
+			FHeader* Header = static_cast<FHeader*>(malloc(sizeof(FHeader) + InSize));
+			Header->Size = InSize;
+			Header->bIsAligned = false;
+			return Header + 1;
+		}
+
+		static void Free(void* InMemory)
+		{
+			free(static_cast<FHeader*>(InMemory) - 1);
+		}
+	};
+
+	/** @brief 현재 전역 operator new 경로 (FMallocBinned + atomic 통계) */
+	struct FEngineMallocPath
+	{
+		static void* Alloc(size_t InSize) { return ::operator new(InSize); }
+		static void Free(void* InMemory) { ::operator delete(InMemory); }
+	};
+
+	/** @brief 액터 하나가 스폰 후에도 들고 있는 할당 수 (액터, 이름, 컴포넌트 3개, 컴포넌트 배열) */
+	constexpr int32 AllocationsPerActor = 6;
+
+	/**
+	 * @brief StaticMeshActor 스폰의 할당 패턴을 모사
+	 * 액터 / 컴포넌트는 실제 클래스 크기를 사용하고, OwnedComponents 배열은 컴포넌트가 추가될 때마다 커지며 이전 버퍼를 해제한다
+	 */
+	template<typename PathType>
+	void SpawnActorAllocations(void** OutSlots)
+	{
+		static constexpr size_t ComponentSizes[] = { sizeof(UStaticMeshComponent), sizeof(UEditorIconComponent), sizeof(UUUIDTextComponent) };
+
+		OutSlots[0] = PathType::Alloc(sizeof(AStaticMeshActor));
+		OutSlots[1] = PathType::Alloc(32);
+
+		void* Components = nullptr;
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			OutSlots[2 + Index] = PathType::Alloc(ComponentSizes[Index]);
+
+			void* GrownComponents = PathType::Alloc(sizeof(void*) * (Index + 1));
+			if (Components)
+			{
+				PathType::Free(Components);
+			}
+			Components = GrownComponents;
+		}
+		OutSlots[5] = Components;
+	}
+
+	template<typename PathType>
+	void DestroyActorAllocations(void** InSlots)
+	{
+		for (int32 Index = 0; Index < AllocationsPerActor; ++Index)
+		{
+			PathType::Free(InSlots[Index]);
+		}
+	}
+
+	/**
+	 * @brief [InFirst, InLast) 액터를 스폰 -> 파괴 -> 다시 스폰 -> 파괴
+	 * 두 번째 스폰은 해제된 메모리를 다시 쓰는 경우(레벨 재로드)를 측정한다
+	 */
+	template<typename PathType>
+	void SpawnDestroyActorRange(void** InSlots, int32 InFirst, int32 InLast)
+	{
+		for (int32 Round = 0; Round < 2; ++Round)
+		{
+			for (int32 Actor = InFirst; Actor < InLast; ++Actor)
+			{
+				SpawnActorAllocations<PathType>(InSlots + Actor * AllocationsPerActor);
+			}
+			for (int32 Actor = InFirst; Actor < InLast; ++Actor)
+			{
+				DestroyActorAllocations<PathType>(InSlots + Actor * AllocationsPerActor);
+			}
+		}
+	}
+
+	/**
+	 * @brief 스폰 / 파괴 패턴을 InNumThreads개 스레드로 나눠 측정
+	 */
+	template<typename PathType>
+	void MeasureActorSpawn(const char* InLabel, int32 InNumActors, int32 InNumThreads)
+	{
+		TArray<void*> Slots;
+		Slots.SetNum(InNumActors * AllocationsPerActor);
+
+		FBenchmarkTimer Timer;
+		if (InNumThreads <= 1)
+		{
+			SpawnDestroyActorRange<PathType>(Slots.GetData(), 0, InNumActors);
+		}
+		else
+		{
+			TArray<std::thread> Workers;
+			const int32 ActorsPerThread = InNumActors / InNumThreads;
+			for (int32 Thread = 0; Thread < InNumThreads; ++Thread)
+			{
+				const int32 First = Thread * ActorsPerThread;
+				const int32 Last = Thread == InNumThreads - 1 ? InNumActors : First + ActorsPerThread;
+				Workers.Emplace([&Slots, First, Last]()
+				{
+					SpawnDestroyActorRange<PathType>(Slots.GetData(), First, Last);
+				});
+			}
+			for (std::thread& Worker : Workers)
+			{
+				Worker.join();
+			}
+		}
+		const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+		UE_LOG_INFO("  %-28s %d thread(s) %9.3fms", InLabel, InNumThreads, ElapsedMs);
+	}
+
+	/**
+	 * @brief 큰 배열이 32KB에서 2MB까지 두 배씩 자라며 이전 버퍼를 해제하는 패턴을 반복
+	 * MaxSmallSize를 넘는 할당만 일어나므로 큰 할당 경로(OS 할당 / 큰 블록 캐시)를 측정한다
+	 */
+	template<typename PathType>
+	void MeasureLargeGrowth(const char* InLabel, int32 InNumRounds)
+	{
+		FBenchmarkTimer Timer;
+		for (int32 Round = 0; Round < InNumRounds; ++Round)
+		{
+			void* Buffer = nullptr;
+			for (size_t Size = 32 * 1024; Size <= 2 * 1024 * 1024; Size *= 2)
+			{
+				void* Grown = PathType::Alloc(Size);
+				static_cast<uint8*>(Grown)[Size - 1] = static_cast<uint8>(Round);
+				if (Buffer)
+				{
+					PathType::Free(Buffer);
+				}
+				Buffer = Grown;
+			}
+			PathType::Free(Buffer);
+		}
+		const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+		UE_LOG_INFO("  %-28s %d rounds %9.3fms", InLabel, InNumRounds, ElapsedMs);
+	}
+
+	/**
+	 * @brief 조상 테이블 도입 이전의 IsChildOf (Super 체인을 따라 올라가며 이름 비교)
+	 */
+	bool LegacyIsChildOf(const UClass* InClass, const UClass* InSuperClass)
+	{
+		for (const UClass* CurrentClass = InClass; CurrentClass; CurrentClass = CurrentClass->GetSuperClass())
+		{
+			if (CurrentClass->GetName() == InSuperClass->GetName())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	struct FLegacyCastPath
+	{
+		template<typename T>
+		static T* Cast(UObject* InObject)
+		{
+			return InObject && LegacyIsChildOf(InObject->GetClass(), T::StaticClass()) ? static_cast<T*>(InObject) : nullptr;
+		}
+	};
+
+	struct FEngineCastPath
+	{
+		template<typename T>
+		static T* Cast(UObject* InObject)
+		{
+			return ::Cast<T>(InObject);
+		}
+	};
+
+	/**
+	 * @brief URenderer::RenderLevel의 가시 프리미티브 분류 Cast 체인을 모사
+	 */
+	template<typename PathType>
+	void MeasureCastChain(const char* InLabel, const TArray<UPrimitiveComponent*>& InPrimitives)
+	{
+		uint64 Counts[6] = {};
+
+		FBenchmarkTimer Timer;
+		for (UPrimitiveComponent* Prim : InPrimitives)
+		{
+			if (PathType::template Cast<UStaticMeshComponent>(Prim))
+			{
+				++Counts[0];
+			}
+			else if (PathType::template Cast<UBillBoardComponent>(Prim))
+			{
+				++Counts[1];
+			}
+			else if (PathType::template Cast<UEditorIconComponent>(Prim))
+			{
+				++Counts[2];
+			}
+			else if (UTextComponent* Text = PathType::template Cast<UTextComponent>(Prim))
+			{
+				++Counts[PathType::template Cast<UUUIDTextComponent>(Text) ? 4 : 3];
+			}
+			else if (PathType::template Cast<UDecalComponent>(Prim))
+			{
+				++Counts[5];
+			}
+		}
+		const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+		GBenchmarkSink = GBenchmarkSink + Counts[0] + Counts[1] + Counts[2] + Counts[3] + Counts[4] + Counts[5];
+		UE_LOG_INFO("  %-28s %9.3fms (%.2f ns / primitive)", InLabel, ElapsedMs,
+			ElapsedMs * 1000000.0 / static_cast<double>(InPrimitives.Num()));
+	}
+
+	/**
+	 * @brief 락 없는 청크 테이블 도입 이전의 FNameTable (탐색마다 소문자 FString 생성, TMap 두 개)
+	 */
+	class FLegacyNameTable
+	{
+	public:
+		TPair<int32, int32> FindOrAddName(const FString& InString)
+		{
+			FString LowerString = InString;
+			std::transform(LowerString.begin(), LowerString.end(), LowerString.begin(),
+				[](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+
+			int32 ComparisonIndex;
+			if (const int32* Found = ComparisonMap.Find(LowerString))
+			{
+				ComparisonIndex = *Found;
+			}
+			else
+			{
+				ComparisonIndex = ComparisonStringPool.Num();
+				ComparisonStringPool.Add(LowerString);
+				ComparisonMap[LowerString] = ComparisonIndex;
+			}
+
+			int32 DisplayIndex;
+			if (const int32* Found = DisplayMap.Find(InString))
+			{
+				DisplayIndex = *Found;
+			}
+			else
+			{
+				DisplayIndex = DisplayStringPool.Num();
+				DisplayStringPool.Add(InString);
+				DisplayMap[InString] = DisplayIndex;
+			}
+
+			return { ComparisonIndex, DisplayIndex };
+		}
+
+	private:
+		TArray<FString> ComparisonStringPool;
+		TArray<FString> DisplayStringPool;
+		TMap<FString, int32> ComparisonMap;
+		TMap<FString, int32> DisplayMap;
+	};
+
+	/**
+	 * @brief [InFirst, InLast) 키로 FName 생성 (스레드마다 다른 구간)
+	 */
+	uint64 CreateNames(const TArray<FString>& InKeys, int32 InFirst, int32 InLast)
+	{
+		uint64 Sum = 0;
+		for (int32 Index = InFirst; Index < InLast; ++Index)
+		{
+			Sum += static_cast<uint64>(FName(InKeys[Index].c_str()).GetComparisonIndex());
+		}
+		return Sum;
+	}
+
+	/**
+	 * @brief 인라인 바인딩 도입 이전의 TDelegate (std::function 벡터, 바인딩마다 힙 할당)
+	 */
+	template<typename... Args>
+	class TLegacyDelegate
+	{
+	public:
+		template<typename FunctorType>
+		void Add(FunctorType&& InHandler)
+		{
+			Bindings.push_back(std::function<void(Args...)>(std::forward<FunctorType>(InHandler)));
+		}
+
+		void Broadcast(Args... args)
+		{
+			for (int32 Index = static_cast<int32>(Bindings.size()) - 1; Index >= 0; --Index)
+			{
+				Bindings[Index](args...);
+			}
+		}
+
+	private:
+		std::vector<std::function<void(Args...)>> Bindings;
+	};
+
+	/**
+	 * @brief ScriptComponent의 Lua 핸들러와 같은 형태의 바인딩 (약한 참조 + 델리게이트 이름 캡처)
+	 */
+	struct FBenchmarkOverlapHandler
+	{
+		TWeakObjectPtr<UObject> WeakOwner;
+		FString DelegateName;
+		uint64* Counter;
+
+		void operator()(AActor*, AActor*) const
+		{
+			if (WeakOwner.IsValid())
+			{
+				*Counter += DelegateName.size();
+			}
+		}
+	};
+
+	template<typename DelegateType>
+	void MeasureDelegate(const char* InLabel, AActor* InActor, int32 InNumDelegates, int32 InNumBroadcasts)
+	{
+		constexpr int32 HandlersPerDelegate = 4;
+		uint64 Counter = 0;
+
+		const uint64 AllocationsBefore = FLowLevelMemTracker::GetTagStats(FLowLevelMemTracker::GetCurrentTag()).TotalAllocations;
+		FBenchmarkTimer BindTimer;
+		TArray<DelegateType> Delegates;
+		Delegates.SetNum(InNumDelegates);
+		for (DelegateType& Delegate : Delegates)
+		{
+			for (int32 Handler = 0; Handler < HandlersPerDelegate; ++Handler)
+			{
+				Delegate.Add(FBenchmarkOverlapHandler{ InActor, "OnActorBeginOverlap", &Counter });
+			}
+		}
+		const double BindMs = BindTimer.GetElapsedMilliseconds();
+		const uint64 BindAllocations = FLowLevelMemTracker::GetTagStats(FLowLevelMemTracker::GetCurrentTag()).TotalAllocations - AllocationsBefore;
+
+		FBenchmarkTimer BroadcastTimer;
+		for (int32 Index = 0; Index < InNumBroadcasts; ++Index)
+		{
+			Delegates[Index % InNumDelegates].Broadcast(InActor, InActor);
+		}
+		const double BroadcastMs = BroadcastTimer.GetElapsedMilliseconds();
+
+		GBenchmarkSink = GBenchmarkSink + Counter;
+		UE_LOG_INFO("  %-28s bind %8.3fms (%llu allocs) | broadcast %8.3fms (%.2f ns / broadcast)", InLabel,
+			BindMs, BindAllocations, BroadcastMs, BroadcastMs * 1000000.0 / static_cast<double>(InNumBroadcasts));
+	}
+
+	/**
+	 * @brief 확장성 측정용 CPU 작업 (메모리 접근 없이 연산만 수행)
+	 */
+	uint64 ComputeWorkload(uint64 InFirst, uint64 InLast)
+	{
+		uint64 Hash = 0;
+		for (uint64 Value = InFirst; Value < InLast; ++Value)
+		{
+			uint64 Mixed = Value * 0x9E3779B97F4A7C15ull;
+			Mixed ^= Mixed >> 29;
+			Hash += Mixed * 0xBF58476D1CE4E5B9ull;
+		}
+		return Hash;
+	}
+
+	/**
+	 * @brief 이전 Tick 방식 비교용 컴포넌트 (액터가 모든 컴포넌트를 순회하며 CanEverTick 검사)
+	 */
+	struct FLegacyTickComponent
+	{
+		virtual ~FLegacyTickComponent() = default;
+		virtual void TickComponent(float DeltaTime) { State = ComputeWorkload(State, State + Work); }
+
+		bool bCanEverTick = false;
+		uint64 State = 0;
+		uint64 Work = 0;
+	};
+
+	struct FLegacyTickActor
+	{
+		void Tick(float DeltaTime)
+		{
+			for (FLegacyTickComponent* Component : Components)
+			{
+				if (Component && Component->bCanEverTick)
+				{
+					Component->TickComponent(DeltaTime);
+				}
+			}
+		}
+
+		bool bCanEverTick = true;
+		TArray<FLegacyTickComponent*> Components;
+	};
+
+	/**
+	 * @brief Tick 매니저 측정용 Tick 함수 (자기 상태만 갱신하고, Source가 있으면 그 결과를 이어 받음)
+	 */
+	class FBenchmarkTickFunction : public FTickFunction
+	{
+	public:
+		void ExecuteTick(float DeltaTime) override
+		{
+			const uint64 Seed = Source ? Source->State : State;
+			State = ComputeWorkload(Seed, Seed + Work);
+		}
+
+		FBenchmarkTickFunction* Source = nullptr;
+		uint64 State = 0;
+		uint64 Work = 0;
+	};
+
+	/**
+	 * @brief Tick 함수 InNumFunctions개를 InChainLength개씩 선행 조건으로 묶어 InNumFrames 프레임 실행
+	 * @param InAnyThreadStride N번째마다 bRunOnAnyThread를 켬 (0이면 모두 게임 스레드)
+	 * @param OutChecksum 모든 상태를 등록 순서대로 섞은 값 (직렬 실행과 비교용)
+	 * @return 프레임당 시간 (ms)
+	 */
+	double MeasureTickManager(int32 InNumFunctions, int32 InChainLength, uint64 InWork, int32 InAnyThreadStride,
+		int32 InNumFrames, uint64& OutChecksum)
+	{
+		FTickTaskManager TickTaskManager;
+		TArray<FBenchmarkTickFunction*> TickFunctions;
+		TickFunctions.Reserve(InNumFunctions);
+
+		for (int32 Index = 0; Index < InNumFunctions; ++Index)
+		{
+			FBenchmarkTickFunction* TickFunction = new FBenchmarkTickFunction();
+			TickFunction->State = static_cast<uint64>(Index) * 0x9E3779B97F4A7C15ull;
+			TickFunction->Work = InWork;
+			TickFunction->bRunOnAnyThread = InAnyThreadStride > 0 && Index % InAnyThreadStride == 0;
+			if (Index % InChainLength != 0)
+			{
+				TickFunction->Source = TickFunctions[Index - 1];
+				TickFunction->AddPrerequisite(TickFunction->Source);
+			}
+			TickFunction->RegisterTickFunction(&TickTaskManager);
+			TickFunctions.Add(TickFunction);
+		}
+
+		FBenchmarkTimer Timer;
+		for (int32 Frame = 0; Frame < InNumFrames; ++Frame)
+		{
+			TickTaskManager.Tick(1.0f / 60.0f, false);
+		}
+		const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+		OutChecksum = 0;
+		for (FBenchmarkTickFunction* TickFunction : TickFunctions)
+		{
+			OutChecksum = OutChecksum * 31 + TickFunction->State;
+			delete TickFunction;
+		}
+
+		return ElapsedMs / InNumFrames;
+	}
+
+	/**
+	 * @brief Tick 간격 / 거리 조절 측정용 Tick 함수 (거리 계산에 쓸 위치를 가짐)
+	 */
+	class FBenchmarkScheduledTickFunction : public FBenchmarkTickFunction
+	{
+	public:
+		bool GetSignificanceLocation(FVector& OutLocation) const override
+		{
+			OutLocation = Location;
+			return true;
+		}
+
+		FVector Location;
+	};
+
+	/**
+	 * @brief Tick 함수 InNumFunctions개를 카메라에서 0 ~ 1000 거리에 흩어 두고 InNumFrames 프레임 실행
+	 * @param InTickInterval 모든 함수의 TickInterval
+	 * @param bInThrottle 거리에 따른 간격 조절 사용 여부 (카메라는 원점)
+	 * @param OutMinTicked 예약이 자리 잡은 뒤(처음 1초 이후) 프레임당 실행된 함수 수의 최솟값
+	 * @param OutMaxTicked 같은 구간의 최댓값
+	 * @return 프레임당 시간 (ms)
+	 */
+	double MeasureTickSchedule(int32 InNumFunctions, float InTickInterval, bool bInThrottle, int32 InNumFrames,
+		int32& OutMinTicked, int32& OutMaxTicked)
+	{
+		constexpr int32 NumWarmupFrames = 60;
+
+		FTickTaskManager TickTaskManager;
+		if (bInThrottle)
+		{
+			TickTaskManager.SetViewLocation(FVector(0.0f, 0.0f, 0.0f));
+		}
+
+		TArray<FBenchmarkScheduledTickFunction*> TickFunctions;
+		TickFunctions.Reserve(InNumFunctions);
+		for (int32 Index = 0; Index < InNumFunctions; ++Index)
+		{
+			FBenchmarkScheduledTickFunction* TickFunction = new FBenchmarkScheduledTickFunction();
+			TickFunction->State = static_cast<uint64>(Index);
+			TickFunction->Work = 16;
+			TickFunction->Location = FVector(static_cast<float>(Index % 1000), 0.0f, 0.0f);
+			TickFunction->TickInterval = InTickInterval;
+			TickFunction->bAllowSignificanceThrottling = bInThrottle;
+			TickFunction->RegisterTickFunction(&TickTaskManager);
+			TickFunctions.Add(TickFunction);
+		}
+
+		for (int32 Frame = 0; Frame < NumWarmupFrames; ++Frame)
+		{
+			TickTaskManager.Tick(1.0f / 60.0f, false);
+		}
+
+		OutMinTicked = InNumFunctions;
+		OutMaxTicked = 0;
+		FBenchmarkTimer Timer;
+		for (int32 Frame = 0; Frame < InNumFrames; ++Frame)
+		{
+			TickTaskManager.Tick(1.0f / 60.0f, false);
+			const int32 NumTicked = TickTaskManager.GetNumTickedLastFrame();
+			OutMinTicked = NumTicked < OutMinTicked ? NumTicked : OutMinTicked;
+			OutMaxTicked = NumTicked > OutMaxTicked ? NumTicked : OutMaxTicked;
+		}
+		const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+		for (FBenchmarkScheduledTickFunction* TickFunction : TickFunctions)
+		{
+			GBenchmarkSink = GBenchmarkSink + TickFunction->State;
+			delete TickFunction;
+		}
+
+		return ElapsedMs / InNumFrames;
+	}
+	/**
+	 * @brief 이전 방식의 투사체 이동 (컴포넌트마다 따로 할당되어 TickComponent에서 자신만 적분)
+	 */
+	struct FLegacyProjectile
+	{
+		FVector Location;
+		FVector Velocity;
+		float GravityScale = 0.0f;
+		float MaxSpeed = 0.0f;
+
+		void Tick(float DeltaTime)
+		{
+			Velocity.Z -= GravityScale * DeltaTime;
+			if (MaxSpeed > 0 && Velocity.Length() > MaxSpeed)
+			{
+				Velocity.Normalize();
+				Velocity *= MaxSpeed;
+			}
+			Location = Location + Velocity * DeltaTime;
+		}
+	};
+
+	/**
+	 * @brief 이전 방식의 회전 이동 (RotatingMovementComponent::TickComponent와 같은 계산)
+	 */
+	struct FLegacyRotating
+	{
+		FVector Location;
+		FQuaternion Rotation;
+		FVector RotationRate;
+		FVector PivotTranslation;
+		bool bRotationInLocalSpace = false;
+
+		void Tick(float DeltaTime)
+		{
+			const FQuaternion OldRotation = Rotation;
+			const FQuaternion DeltaRotation = FQuaternion::FromEuler(RotationRate * DeltaTime);
+			Rotation = bRotationInLocalSpace ? (OldRotation * DeltaRotation) : (DeltaRotation * OldRotation);
+			if (!PivotTranslation.IsZero())
+			{
+				Location = Location + (OldRotation.RotateVector(PivotTranslation) - Rotation.RotateVector(PivotTranslation));
+			}
+		}
+	};
+
+	float GetMaxDifference(const FVector& InA, const FVector& InB)
+	{
+		const FVector Difference = InA - InB;
+		const float MaxXY = fabsf(Difference.X) > fabsf(Difference.Y) ? fabsf(Difference.X) : fabsf(Difference.Y);
+		return MaxXY > fabsf(Difference.Z) ? MaxXY : fabsf(Difference.Z);
+	}
+	/** @brief 재현 가능한 벤치마크 입력을 만드는 xorshift 난수 */
+	struct FBenchmarkRandom
+	{
+		uint32 State = 0x9E3779B9u;
+
+		float GetFraction()
+		{
+			State ^= State << 13;
+			State ^= State >> 17;
+			State ^= State << 5;
+			return static_cast<float>(State >> 8) * (1.0f / 16777216.0f);
+		}
+
+		float GetInRange(float InMin, float InMax) { return InMin + (InMax - InMin) * GetFraction(); }
+	};
+
+	/**
+	 * @brief 경계를 미리 계산한 Octree 원소 생성 (밀도가 일정하도록 개수에 맞춰 영역 크기를 키움)
+	 * Octree는 저장한 포인터를 역참조하지 않으므로 컴포넌트를 만들지 않고 번호를 포인터로 사용한다
+	 */
+	void MakeOctreeElements(int32 InNum, TArray<FOctreeElement>& OutElements)
+	{
+		FBenchmarkRandom Random;
+		const float Extent = 50.0f * cbrtf(static_cast<float>(InNum));
+
+		OutElements.SetNum(InNum);
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			const FVector Center(Random.GetInRange(-Extent, Extent), Random.GetInRange(-Extent, Extent),
+				Random.GetInRange(-Extent, Extent));
+			const float HalfSize = Random.GetInRange(0.5f, 4.0f);
+
+			FOctreeElement& Element = OutElements[Index];
+			Element.Min = Center - FVector(HalfSize, HalfSize, HalfSize);
+			Element.Max = Center + FVector(HalfSize, HalfSize, HalfSize);
+			Element.Primitive = reinterpret_cast<UPrimitiveComponent*>(static_cast<uintptr_t>(Index + 1) * 16);
+		}
+	}
+
+	/** @brief InQueries의 상자마다 QueryAABB를 실행하고 찾은 프리미티브 수의 합을 반환 */
+	int32 RunOctreeQueries(const FOctree& InOctree, const TArray<FAABB>& InQueries)
+	{
+		TArray<UPrimitiveComponent*, TInlineAllocator<256>> Results;
+		int32 NumFound = 0;
+		for (const FAABB& Query : InQueries)
+		{
+			Results.Reset();
+			InOctree.QueryAABB(Query, Results);
+			NumFound += Results.Num();
+		}
+		return NumFound;
+	}
+
+	/**
+	 * @brief 물결 모양 높이를 가진 InGridSize x InGridSize 격자 지형 메시 (사각형마다 삼각형 2개)
+	 * 피킹 대상이 되는 큰 정적 메시처럼 삼각형이 이웃끼리 붙어 있는 입력
+	 */
+	void MakeGridMesh(int32 InGridSize, FStaticMesh& OutMesh)
+	{
+		const int32 NumRowVertices = InGridSize + 1;
+		OutMesh.Vertices.SetNum(NumRowVertices * NumRowVertices);
+		for (int32 Y = 0; Y < NumRowVertices; ++Y)
+		{
+			for (int32 X = 0; X < NumRowVertices; ++X)
+			{
+				OutMesh.Vertices[Y * NumRowVertices + X].Position =
+					FVector(static_cast<float>(X), static_cast<float>(Y), 4.0f * sinf(X * 0.05f) * cosf(Y * 0.07f));
+			}
+		}
+
+		OutMesh.Indices.Empty();
+		OutMesh.Indices.Reserve(InGridSize * InGridSize * 6);
+		for (int32 Y = 0; Y < InGridSize; ++Y)
+		{
+			for (int32 X = 0; X < InGridSize; ++X)
+			{
+				const uint32 Corner = Y * NumRowVertices + X;
+				OutMesh.Indices.Append({ Corner, Corner + 1, Corner + NumRowVertices });
+				OutMesh.Indices.Append({ Corner + 1, Corner + NumRowVertices + 1, Corner + NumRowVertices });
+			}
+		}
+	}
+
+	/** @brief 레이와 삼각형의 교차 거리 (Möller–Trumbore, 양면 판정), 전수 검사 비교용 */
+	bool RaycastTriangle(const FVector& InOrigin, const FVector& InDirection, const FVector& InV0, const FVector& InV1, const FVector& InV2,
+		float& OutDistance)
+	{
+		const FVector Edge1 = InV1 - InV0;
+		const FVector Edge2 = InV2 - InV0;
+		const FVector P = InDirection.Cross(Edge2);
+		const float Determinant = Edge1.Dot(P);
+		if (fabsf(Determinant) < 1e-12f)
+		{
+			return false;
+		}
+
+		const FVector S = InOrigin - InV0;
+		const float U = S.Dot(P) / Determinant;
+		if (U < 0.0f || U > 1.0f)
+		{
+			return false;
+		}
+
+		const FVector Q = S.Cross(Edge1);
+		const float V = InDirection.Dot(Q) / Determinant;
+		if (V < 0.0f || U + V > 1.0f)
+		{
+			return false;
+		}
+
+		OutDistance = Edge2.Dot(Q) / Determinant;
+		return OutDistance >= 0.0f;
+	}
+}
+
+bool FEngineBenchmark::Run(const FString& InName)
+{
+	if (InName == "map" || InName == "set" || InName == "container")
+	{
+		RunContainerBenchmark();
+		return true;
+	}
+
+	if (InName == "malloc" || InName == "alloc")
+	{
+		RunMallocBenchmark();
+		return true;
+	}
+
+	if (InName == "name" || InName == "fname")
+	{
+		RunNameBenchmark();
+		return true;
+	}
+
+	if (InName == "cast")
+	{
+		RunCastBenchmark();
+		return true;
+	}
+
+	if (InName == "delegate" || InName == "event")
+	{
+		RunDelegateBenchmark();
+		return true;
+	}
+
+	if (InName == "task" || InName == "tasks" || InName == "taskgraph")
+	{
+		RunTaskGraphBenchmark();
+		return true;
+	}
+
+	if (InName == "tick")
+	{
+		RunTickBenchmark();
+		return true;
+	}
+
+	if (InName == "movement" || InName == "move")
+	{
+		RunMovementBenchmark();
+		return true;
+	}
+
+	if (InName == "octree")
+	{
+		RunOctreeBenchmark();
+		return true;
+	}
+
+	if (InName == "dynamic" || InName == "dyntree")
+	{
+		RunDynamicTreeBenchmark();
+		return true;
+	}
+
+	if (InName == "bvh")
+	{
+		RunBVHBenchmark();
+		return true;
+	}
+
+	if (InName == "linetrace" || InName == "trace")
+	{
+		RunLineTraceBenchmark();
+		return true;
+	}
+
+	return false;
+}
+
+void FEngineBenchmark::PrintUsage()
+{
+	UE_LOG_INFO("Available benchmarks:");
+	UE_LOG_INFO("  bench map - TMap / TSet vs std::unordered_map / unordered_set (1k / 100k / 1M pointer / FString keys)");
+	UE_LOG_INFO("  bench malloc - Engine allocator vs legacy malloc path (100k actor spawn / destroy, large array growth)");
+	UE_LOG_INFO("  bench name - FName table vs legacy lowercase-copy table (1M names, 10%% unique)");
+	UE_LOG_INFO("  bench cast - Cast<T> ancestry table vs legacy super chain walk (1M primitives)");
+	UE_LOG_INFO("  bench delegate - TDelegate inline bindings vs legacy std::function delegate, deferred event queue (1M broadcasts)");
+	UE_LOG_INFO("  bench task - TaskGraph scheduling overhead per task, dependency chain, ParallelFor, scaling 1..N cores");
+	UE_LOG_INFO("  bench tick - Tick manager vs legacy actor / component walk (80k components, 10%% ticking), tick intervals / distance throttling (50k), 50k idle actors, serial vs parallel tick groups");
+	UE_LOG_INFO("  bench movement - Batched SoA / SIMD movement vs per-component integration (100k), bulk octree removal vs per-primitive Remove (20k, 10%% moving)");
+	UE_LOG_INFO("  bench octree - Octree incremental insert vs Morton bulk build, AABB queries (10k / 100k / 1M primitives)");
+	UE_LOG_INFO("  bench dynamic - Dynamic AABB tree MoveProxy vs octree remove / reinsert (20k primitives, 10%% moving), queries on both");
+	UE_LOG_INFO("  bench bvh - Mesh BVH binned SAH build (1M triangle grid), BVH4 closest hit vs brute force, ray packets vs single rays");
+	UE_LOG_INFO("  bench linetrace - Level LineTraceSingle / Multi / Batch through a mesh actor with its UUID text quad (4k rays)");
+}
+
+void FEngineBenchmark::RunContainerBenchmark()
+{
+	const int32 KeyCounts[] = { 1000, 100000, 1000000 };
+
+	for (const int32 NumKeys : KeyCounts)
+	{
+		// 포인터 키: DynamicPrimitiveMap 등 컴포넌트 포인터 키 맵을 모사
+		TArray<void*> PointerKeys;
+		PointerKeys.Reserve(NumKeys);
+		for (int32 i = 0; i < NumKeys; ++i)
+		{
+			PointerKeys.Add(reinterpret_cast<void*>(static_cast<uintptr_t>(0x10000 + static_cast<uintptr_t>(i) * 208)));
+		}
+
+		// 문자열 키: TimeProfileMap, FNameTable 등을 모사
+		TArray<FString> StringKeys;
+		StringKeys.Reserve(NumKeys);
+		for (int32 i = 0; i < NumKeys; ++i)
+		{
+			StringKeys.Add("StaticMeshComponent_" + to_string(i));
+		}
+
+		UE_LOG_SYSTEM("Benchmark: Container (%d keys)", NumKeys);
+		MeasureMap<std::unordered_map<void*, int32>, void*>("std::unordered_map<void*>", PointerKeys);
+		MeasureMap<TMap<void*, int32>, void*>("TMap<void*>", PointerKeys);
+		MeasureMap<std::unordered_map<FString, int32>, FString>("std::unordered_map<FString>", StringKeys);
+		MeasureMap<TMap<FString, int32>, FString>("TMap<FString>", StringKeys);
+		MeasureSet<std::unordered_set<void*>>("std::unordered_set<void*>", PointerKeys, 32, 20000);
+		MeasureSet<TSet<void*>>("TSet<void*>", PointerKeys, 32, 20000);
+	}
+}
+
+void FEngineBenchmark::RunMallocBenchmark()
+{
+	constexpr int32 NumActors = 100000;
+	constexpr int32 NumThreads = 4;
+
+	UE_LOG_SYSTEM("Benchmark: Malloc (%d actors x %d allocations, spawn / destroy x2)", NumActors, AllocationsPerActor + 2);
+	MeasureActorSpawn<FLegacyMallocPath>("malloc + header (legacy)", NumActors, 1);
+	MeasureActorSpawn<FEngineMallocPath>("FMallocBinned", NumActors, 1);
+	MeasureActorSpawn<FLegacyMallocPath>("malloc + header (legacy)", NumActors, NumThreads);
+	MeasureActorSpawn<FEngineMallocPath>("FMallocBinned", NumActors, NumThreads);
+
+	constexpr int32 NumGrowthRounds = 2000;
+	UE_LOG_SYSTEM("Benchmark: Malloc large (array growth 32KB -> 2MB, %d rounds)", NumGrowthRounds);
+	MeasureLargeGrowth<FLegacyMallocPath>("malloc + header (legacy)", NumGrowthRounds);
+	MeasureLargeGrowth<FEngineMallocPath>("FMallocBinned", NumGrowthRounds);
+
+	UE_LOG_INFO("  FMallocBinned OS reserved: %.2f MB (large cache %.2f MB), large allocations alive: %llu",
+		static_cast<double>(FMallocBinned::GetOSReservedBytes()) / (1024.0 * 1024.0),
+		static_cast<double>(FMallocBinned::GetCachedLargeBytes()) / (1024.0 * 1024.0), FMallocBinned::GetNumLargeAllocations());
+}
+
+void FEngineBenchmark::RunCastBenchmark()
+{
+	constexpr int32 NumPrimitives = 1000000;
+
+	// 렌더러가 분류하는 프리미티브 종류를 하나씩 만들고, 1M개의 가시 프리미티브 목록을 섞어서 구성
+	TArray<UPrimitiveComponent*> Sources;
+	Sources.Add(NewObject<UStaticMeshComponent>());
+	Sources.Add(NewObject<UBillBoardComponent>());
+	Sources.Add(NewObject<UEditorIconComponent>());
+	Sources.Add(NewObject<UTextComponent>());
+	Sources.Add(NewObject<UUUIDTextComponent>());
+	Sources.Add(NewObject<UDecalComponent>());
+	Sources.Add(NewObject<USphereComponent>());
+
+	TArray<UPrimitiveComponent*> Primitives;
+	Primitives.Reserve(NumPrimitives);
+	uint32 Seed = 12345;
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		// 스태틱 메시가 대부분인 씬을 가정
+		Seed = Seed * 1664525u + 1013904223u;
+		const uint32 Roll = (Seed >> 8) % 100;
+		const int32 SourceIndex = Roll < 70 ? 0 : 1 + static_cast<int32>(Roll % (Sources.Num() - 1));
+		Primitives.Add(Sources[SourceIndex]);
+	}
+
+	UE_LOG_SYSTEM("Benchmark: Cast (%d primitives, RenderLevel cast chain)", NumPrimitives);
+	MeasureCastChain<FLegacyCastPath>("super chain walk (legacy)", Primitives);
+	MeasureCastChain<FEngineCastPath>("ancestry table", Primitives);
+
+	for (UPrimitiveComponent* Source : Sources)
+	{
+		delete Source;
+	}
+}
+
+void FEngineBenchmark::RunNameBenchmark()
+{
+	constexpr int32 NumNames = 1000000;
+	constexpr int32 NumUniqueNames = NumNames / 10;
+	constexpr int32 NumThreads = 4;
+
+	// 실행할 때마다 새 이름이 등록되도록 접두사에 실행 번호를 붙이고, 대소문자가 다른 표기를 섞는다
+	static int32 RunCount = 0;
+	const FString Prefix = "BenchName" + to_string(RunCount++) + "_";
+
+	TArray<FString> Keys;
+	Keys.Reserve(NumNames);
+	uint32 Seed = 12345;
+	for (int32 Index = 0; Index < NumNames; ++Index)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		const uint32 UniqueIndex = (Seed >> 8) % NumUniqueNames;
+		FString Key = Prefix + "StaticMeshComponent_" + to_string(UniqueIndex);
+		if (Seed & 1)
+		{
+			Key[Prefix.size()] = 's';
+		}
+		Keys.Add(Key);
+	}
+
+	UE_LOG_SYSTEM("Benchmark: FName (%d names, %d unique)", NumNames, NumUniqueNames);
+
+	{
+		FLegacyNameTable LegacyTable;
+		uint64 Sum = 0;
+		FBenchmarkTimer Timer;
+		for (const FString& Key : Keys)
+		{
+			Sum += static_cast<uint64>(LegacyTable.FindOrAddName(Key).first);
+		}
+		GBenchmarkSink = GBenchmarkSink + Sum;
+		UE_LOG_INFO("  %-28s 1 thread(s) %9.3fms", "lowercase copy + TMap (legacy)", Timer.GetElapsedMilliseconds());
+	}
+
+	{
+		FBenchmarkTimer Timer;
+		GBenchmarkSink = GBenchmarkSink + CreateNames(Keys, 0, NumNames);
+		UE_LOG_INFO("  %-28s 1 thread(s) %9.3fms (first pass, registers names)", "FNameTable", Timer.GetElapsedMilliseconds());
+	}
+
+	{
+		FBenchmarkTimer Timer;
+		GBenchmarkSink = GBenchmarkSink + CreateNames(Keys, 0, NumNames);
+		UE_LOG_INFO("  %-28s 1 thread(s) %9.3fms (all names registered)", "FNameTable", Timer.GetElapsedMilliseconds());
+	}
+
+	{
+		// 이전 테이블은 스레드 안전하지 않으므로 새 테이블만 측정
+		for (int32 Index = 0; Index < NumNames; ++Index)
+		{
+			Keys[Index].insert(0, "MT");
+		}
+
+		std::atomic<uint64> Sum{0};
+		FBenchmarkTimer Timer;
+		TArray<std::thread> Workers;
+		const int32 NamesPerThread = NumNames / NumThreads;
+		for (int32 Thread = 0; Thread < NumThreads; ++Thread)
+		{
+			const int32 First = Thread * NamesPerThread;
+			const int32 Last = Thread == NumThreads - 1 ? NumNames : First + NamesPerThread;
+			Workers.Emplace([&Keys, &Sum, First, Last]()
+			{
+				Sum.fetch_add(CreateNames(Keys, First, Last), std::memory_order_relaxed);
+			});
+		}
+		for (std::thread& Worker : Workers)
+		{
+			Worker.join();
+		}
+		GBenchmarkSink = GBenchmarkSink + Sum.load(std::memory_order_relaxed);
+		UE_LOG_INFO("  %-28s %d thread(s) %9.3fms (first pass, registers names)", "FNameTable", NumThreads, Timer.GetElapsedMilliseconds());
+	}
+
+	UE_LOG_INFO("  FNameTable entries: %d", FNameTable::GetInstance().GetNumEntries());
+}
+
+void FEngineBenchmark::RunDelegateBenchmark()
+{
+	constexpr int32 NumDelegates = 10000;
+	constexpr int32 NumBroadcasts = 1000000;
+
+	AActor* Actor = NewObject<AActor>();
+
+	UE_LOG_SYSTEM("Benchmark: Delegate (%d delegates x 4 handlers, %d overlap broadcasts)", NumDelegates, NumBroadcasts);
+	MeasureDelegate<TLegacyDelegate<AActor*, AActor*>>("std::function (legacy)", Actor, NumDelegates, NumBroadcasts);
+	MeasureDelegate<FActorBeginOverlapSignature>("TDelegate", Actor, NumDelegates, NumBroadcasts);
+
+	// 같은 Broadcast를 월드 이벤트 큐에 모았다가 한꺼번에 실행 (두 번째 라운드는 아레나 블록 재사용)
+	{
+		uint64 Counter = 0;
+		TArray<FActorBeginOverlapSignature> Delegates;
+		Delegates.SetNum(NumDelegates);
+		for (FActorBeginOverlapSignature& Delegate : Delegates)
+		{
+			Delegate.Add(FBenchmarkOverlapHandler{ Actor, "OnActorBeginOverlap", &Counter });
+		}
+
+		FDeferredEventQueue Queue;
+		for (int32 Round = 0; Round < 2; ++Round)
+		{
+			FBenchmarkTimer EnqueueTimer;
+			for (int32 Index = 0; Index < NumBroadcasts; ++Index)
+			{
+				Queue.Enqueue(Actor, Delegates[Index % NumDelegates], Actor, Actor);
+			}
+			const double EnqueueMs = EnqueueTimer.GetElapsedMilliseconds();
+
+			FBenchmarkTimer DispatchTimer;
+			Queue.Dispatch();
+			const double DispatchMs = DispatchTimer.GetElapsedMilliseconds();
+
+			UE_LOG_INFO("  %-28s enqueue %8.3fms | dispatch %8.3fms (round %d)", "FDeferredEventQueue", EnqueueMs, DispatchMs, Round + 1);
+		}
+		GBenchmarkSink = GBenchmarkSink + Counter;
+	}
+
+	delete Actor;
+}
+
+void FEngineBenchmark::RunTaskGraphBenchmark()
+{
+	FTaskGraph& TaskGraph = FTaskGraph::Get();
+	if (!TaskGraph.IsInitialized())
+	{
+		UE_LOG_ERROR("Benchmark: TaskGraph가 초기화되지 않았습니다");
+		return;
+	}
+
+	const int32 NumThreads = TaskGraph.GetNumWorkers() + 1;
+	UE_LOG_SYSTEM("Benchmark: TaskGraph (%d workers + game thread)", TaskGraph.GetNumWorkers());
+
+	// 빈 태스크를 게임 스레드에서 발행하고 모두 기다림: 생성 + 큐잉 + 실행 + 완료 처리 비용
+	{
+		constexpr int32 NumTasks = 100000;
+		std::atomic<int32> Counter{0};
+		TArray<FGraphEventRef> Events;
+		Events.Reserve(NumTasks);
+
+		FBenchmarkTimer Timer;
+		for (int32 Index = 0; Index < NumTasks; ++Index)
+		{
+			Events.Add(TaskGraph.Launch([&Counter]() { Counter.fetch_add(1, std::memory_order_relaxed); }));
+		}
+		for (const FGraphEventRef& Event : Events)
+		{
+			TaskGraph.Wait(Event);
+		}
+		const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+		UE_LOG_INFO("  %-28s %9.3fms (%.1f ns / task, %d tasks)", "empty tasks", ElapsedMs,
+			ElapsedMs * 1000000.0 / NumTasks, Counter.load());
+	}
+
+	// 비교용: 작업마다 std::thread를 만드는 경우
+	{
+		constexpr int32 NumThreadTasks = 1000;
+		std::atomic<int32> Counter{0};
+
+		FBenchmarkTimer Timer;
+		for (int32 Index = 0; Index < NumThreadTasks; ++Index)
+		{
+			thread Worker([&Counter]() { Counter.fetch_add(1, std::memory_order_relaxed); });
+			Worker.join();
+		}
+		const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+		UE_LOG_INFO("  %-28s %9.3fms (%.1f ns / task, %d tasks)", "std::thread per task", ElapsedMs,
+			ElapsedMs * 1000000.0 / NumThreadTasks, Counter.load());
+	}
+
+	// 앞 태스크가 끝나야 다음 태스크가 실행되는 의존성 체인: 선행 조건 해제 -> 스케줄 지연
+	{
+		constexpr int32 ChainLength = 10000;
+		int32 Value = 0;
+
+		FBenchmarkTimer Timer;
+		FGraphEventRef Previous;
+		for (int32 Index = 0; Index < ChainLength; ++Index)
+		{
+			FGraphEventArray Prerequisites;
+			if (Previous.IsValid())
+			{
+				Prerequisites.Add(Previous);
+			}
+			Previous = TaskGraph.Launch([&Value]() { ++Value; }, Prerequisites);
+		}
+		TaskGraph.Wait(Previous);
+		const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+		UE_LOG_INFO("  %-28s %9.3fms (%.1f ns / link, value %d)", "dependency chain", ElapsedMs,
+			ElapsedMs * 1000000.0 / ChainLength, Value);
+	}
+
+	// ParallelFor: 가벼운 본문 1M개
+	{
+		constexpr int32 NumItems = 1000000;
+		TArray<uint64> Items;
+		Items.SetNum(NumItems);
+
+		FBenchmarkTimer SerialTimer;
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			Items[Index] = ComputeWorkload(static_cast<uint64>(Index) * 16, static_cast<uint64>(Index) * 16 + 16);
+		}
+		const double SerialMs = SerialTimer.GetElapsedMilliseconds();
+
+		FBenchmarkTimer ParallelTimer;
+		ParallelFor(NumItems, [&Items](int32 Index)
+		{
+			Items[Index] = ComputeWorkload(static_cast<uint64>(Index) * 16, static_cast<uint64>(Index) * 16 + 16);
+		}, 1024);
+		const double ParallelMs = ParallelTimer.GetElapsedMilliseconds();
+
+		GBenchmarkSink = GBenchmarkSink + Items[NumItems - 1];
+		UE_LOG_INFO("  %-28s serial %8.3fms | parallel %8.3fms (x%.2f)", "ParallelFor (1M items)", SerialMs, ParallelMs,
+			SerialMs / ParallelMs);
+	}
+
+	// 확장성: 같은 양의 연산을 N개 태스크로 나누어 1..N 코어에서 실행
+	{
+		constexpr uint64 TotalWork = 64ull * 1024 * 1024;
+		double SingleThreadMs = 0.0;
+
+		for (int32 NumTasks = 1; NumTasks <= NumThreads; ++NumTasks)
+		{
+			TArray<uint64> Results;
+			Results.SetNum(NumTasks);
+			TArray<FGraphEventRef> Events;
+
+			FBenchmarkTimer Timer;
+			for (int32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+			{
+				const uint64 First = TotalWork * TaskIndex / NumTasks;
+				const uint64 Last = TotalWork * (TaskIndex + 1) / NumTasks;
+				uint64* Result = &Results[TaskIndex];
+				Events.Add(TaskGraph.Launch([First, Last, Result]() { *Result = ComputeWorkload(First, Last); }));
+			}
+			for (const FGraphEventRef& Event : Events)
+			{
+				TaskGraph.Wait(Event);
+			}
+			const double ElapsedMs = Timer.GetElapsedMilliseconds();
+
+			if (NumTasks == 1)
+			{
+				SingleThreadMs = ElapsedMs;
+			}
+
+			uint64 Sum = 0;
+			for (uint64 Result : Results)
+			{
+				Sum += Result;
+			}
+			GBenchmarkSink = GBenchmarkSink + Sum;
+
+			const double Speedup = SingleThreadMs / ElapsedMs;
+			UE_LOG_INFO("  %2d core(s) %9.3fms (x%.2f, efficiency %5.1f%%)", NumTasks, ElapsedMs, Speedup,
+				Speedup * 100.0 / NumTasks);
+		}
+	}
+}
+
+void FEngineBenchmark::RunTickBenchmark()
+{
+	UE_LOG_SYSTEM("Benchmark: Tick (%d workers + game thread)", FTaskGraph::Get().GetNumWorkers());
+
+	// 등록 방식: 액터 10k개 x 컴포넌트 8개 중 10%만 Tick하는 경우
+	// 이전 방식은 매 프레임 모든 액터 / 컴포넌트를 순회하고, Tick 매니저는 Tick하는 컴포넌트만 순회
+	{
+		constexpr int32 NumActors = 10000;
+		constexpr int32 NumComponentsPerActor = 8;
+		constexpr int32 NumFrames = 100;
+
+		TArray<FLegacyTickActor> Actors;
+		Actors.SetNum(NumActors);
+		TArray<FLegacyTickComponent> Components;
+		Components.SetNum(NumActors * NumComponentsPerActor);
+
+		FTickTaskManager TickTaskManager;
+		TArray<FBenchmarkTickFunction*> TickFunctions;
+
+		for (int32 Index = 0; Index < Components.Num(); ++Index)
+		{
+			FLegacyTickComponent& Component = Components[Index];
+			Component.bCanEverTick = Index % 10 == 0;
+			Component.State = static_cast<uint64>(Index);
+			Component.Work = 16;
+			Actors[Index / NumComponentsPerActor].Components.Add(&Component);
+
+			if (Component.bCanEverTick)
+			{
+				FBenchmarkTickFunction* TickFunction = new FBenchmarkTickFunction();
+				TickFunction->State = Component.State;
+				TickFunction->Work = Component.Work;
+				TickFunction->RegisterTickFunction(&TickTaskManager);
+				TickFunctions.Add(TickFunction);
+			}
+		}
+
+		FBenchmarkTimer LegacyTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (FLegacyTickActor& Actor : Actors)
+			{
+				if (Actor.bCanEverTick)
+				{
+					Actor.Tick(1.0f / 60.0f);
+				}
+			}
+		}
+		const double LegacyMs = LegacyTimer.GetElapsedMilliseconds() / NumFrames;
+
+		FBenchmarkTimer ManagerTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			TickTaskManager.Tick(1.0f / 60.0f, false);
+		}
+		const double ManagerMs = ManagerTimer.GetElapsedMilliseconds() / NumFrames;
+
+		uint64 LegacyChecksum = 0;
+		for (const FLegacyTickComponent& Component : Components)
+		{
+			if (Component.bCanEverTick)
+			{
+				LegacyChecksum = LegacyChecksum * 31 + Component.State;
+			}
+		}
+
+		uint64 ManagerChecksum = 0;
+		for (FBenchmarkTickFunction* TickFunction : TickFunctions)
+		{
+			ManagerChecksum = ManagerChecksum * 31 + TickFunction->State;
+			delete TickFunction;
+		}
+
+		UE_LOG_INFO("  %-28s legacy %8.3fms | manager %8.3fms (x%.2f, %s)", "80k components, 10% tick", LegacyMs,
+			ManagerMs, LegacyMs / ManagerMs, LegacyChecksum == ManagerChecksum ? "identical" : "MISMATCH");
+	}
+
+	// Tick 간격과 거리 조절: 50k개 Tick 함수를 매 프레임 / 0.5초 간격 / 카메라 거리에 따라 실행
+	// 간격이 있는 함수는 차례가 된 것만 꺼내므로 프레임 비용이 실행되는 함수 수에만 비례하고,
+	// 첫 실행 시점을 흩어 두어 프레임마다 실행 수가 고르게 유지되어야 함
+	{
+		constexpr int32 NumFunctions = 50000;
+		constexpr int32 NumFrames = 120;
+
+		int32 MinTicked = 0;
+		int32 MaxTicked = 0;
+		const double EveryFrameMs = MeasureTickSchedule(NumFunctions, 0.0f, false, NumFrames, MinTicked, MaxTicked);
+		UE_LOG_INFO("  %-28s %8.3fms / frame, ticked %d ~ %d", "50k every frame", EveryFrameMs, MinTicked, MaxTicked);
+
+		const double IntervalMs = MeasureTickSchedule(NumFunctions, 0.5f, false, NumFrames, MinTicked, MaxTicked);
+		UE_LOG_INFO("  %-28s %8.3fms / frame (x%.2f), ticked %d ~ %d", "50k 0.5s interval", IntervalMs,
+			EveryFrameMs / IntervalMs, MinTicked, MaxTicked);
+
+		const double ThrottledMs = MeasureTickSchedule(NumFunctions, 0.0f, true, NumFrames, MinTicked, MaxTicked);
+		UE_LOG_INFO("  %-28s %8.3fms / frame (x%.2f), ticked %d ~ %d", "50k distance throttled", ThrottledMs,
+			EveryFrameMs / ThrottledMs, MinTicked, MaxTicked);
+	}
+
+	// Tick하지 않는 액터: 50k개는 bCanEverTick이 꺼져 있고 100개만 Tick
+	// 이전 방식은 매 프레임 모든 액터를 검사하고, Tick 매니저에는 Tick하는 100개만 등록되므로
+	// 프레임 비용이 Tick하지 않는 액터 수와 무관해야 함
+	{
+		constexpr int32 NumIdleActors = 50000;
+		constexpr int32 NumTickingActors = 100;
+		constexpr int32 NumFrames = 120;
+
+		TArray<FLegacyTickActor> Actors;
+		Actors.SetNum(NumIdleActors + NumTickingActors);
+		TArray<FLegacyTickComponent> Components;
+		Components.SetNum(Actors.Num());
+
+		FTickTaskManager TickTaskManager;
+		TArray<FBenchmarkTickFunction*> TickFunctions;
+
+		for (int32 Index = 0; Index < Actors.Num(); ++Index)
+		{
+			// Tick하는 액터를 고르게 흩어 둠
+			const bool bTicks = Index % ((NumIdleActors + NumTickingActors) / NumTickingActors) == 0 &&
+				TickFunctions.Num() < NumTickingActors;
+
+			FLegacyTickComponent& Component = Components[Index];
+			Component.bCanEverTick = bTicks;
+			Component.State = static_cast<uint64>(Index);
+			Component.Work = 16;
+			Actors[Index].bCanEverTick = bTicks;
+			Actors[Index].Components.Add(&Component);
+
+			if (bTicks)
+			{
+				FBenchmarkTickFunction* TickFunction = new FBenchmarkTickFunction();
+				TickFunction->State = Component.State;
+				TickFunction->Work = Component.Work;
+				TickFunction->RegisterTickFunction(&TickTaskManager);
+				TickFunctions.Add(TickFunction);
+			}
+		}
+
+		FBenchmarkTimer LegacyTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (FLegacyTickActor& Actor : Actors)
+			{
+				if (Actor.bCanEverTick)
+				{
+					Actor.Tick(1.0f / 60.0f);
+				}
+			}
+		}
+		const double LegacyMs = LegacyTimer.GetElapsedMilliseconds() / NumFrames;
+
+		FBenchmarkTimer ManagerTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			TickTaskManager.Tick(1.0f / 60.0f, false);
+		}
+		const double ManagerMs = ManagerTimer.GetElapsedMilliseconds() / NumFrames;
+		const int32 NumTicked = TickTaskManager.GetNumTickedLastFrame();
+
+		for (FBenchmarkTickFunction* TickFunction : TickFunctions)
+		{
+			GBenchmarkSink = GBenchmarkSink + TickFunction->State;
+			delete TickFunction;
+		}
+
+		UE_LOG_INFO("  %-28s legacy %8.3fms | manager %8.3fms (x%.2f), ticked %d", "50k idle + 100 ticking",
+			LegacyMs, ManagerMs, LegacyMs / ManagerMs, NumTicked);
+	}
+
+	// 병렬 실행: 4096개 Tick 함수, 4개씩 선행 조건 체인으로 묶음
+	// 모두 게임 스레드 / 절반만 워커 / 모두 워커로 실행해도 결과가 직렬 순서와 같아야 함
+	{
+		constexpr int32 NumFunctions = 4096;
+		constexpr int32 ChainLength = 4;
+		constexpr uint64 Work = 2048;
+		constexpr int32 NumFrames = 20;
+
+		uint64 SerialChecksum = 0;
+		const double SerialMs = MeasureTickManager(NumFunctions, ChainLength, Work, 0, NumFrames, SerialChecksum);
+		UE_LOG_INFO("  %-28s %8.3fms / frame", "game thread only", SerialMs);
+
+		if (!FTaskGraph::Get().IsInitialized())
+		{
+			UE_LOG_WARNING("  TaskGraph가 초기화되지 않아 병렬 실행은 건너뜁니다");
+			return;
+		}
+
+		uint64 MixedChecksum = 0;
+		const double MixedMs = MeasureTickManager(NumFunctions, ChainLength, Work, 2, NumFrames, MixedChecksum);
+		UE_LOG_INFO("  %-28s %8.3fms / frame (x%.2f, %s)", "half on any thread", MixedMs, SerialMs / MixedMs,
+			MixedChecksum == SerialChecksum ? "identical" : "MISMATCH");
+
+		uint64 ParallelChecksum = 0;
+		const double ParallelMs = MeasureTickManager(NumFunctions, ChainLength, Work, 1, NumFrames, ParallelChecksum);
+		UE_LOG_INFO("  %-28s %8.3fms / frame (x%.2f, %s)", "all on any thread", ParallelMs, SerialMs / ParallelMs,
+			ParallelChecksum == SerialChecksum ? "identical" : "MISMATCH");
+	}
+}
+
+void FEngineBenchmark::RunMovementBenchmark()
+{
+	UE_LOG_SYSTEM("Benchmark: Movement");
+
+	constexpr float DeltaTime = 1.0f / 60.0f;
+
+	// 투사체 100k개: 객체마다 따로 적분 vs SoA 배열에 모아 SSE로 4개씩 적분 (배열 채우기 / 되돌려 쓰기 포함)
+	{
+		constexpr int32 NumProjectiles = 100000;
+		constexpr int32 NumFrames = 60;
+
+		TArray<FLegacyProjectile*> LegacyProjectiles;
+		TArray<FLegacyProjectile*> BatchedProjectiles;
+		for (int32 Index = 0; Index < NumProjectiles; ++Index)
+		{
+			FLegacyProjectile Projectile;
+			Projectile.Location = FVector(static_cast<float>(Index % 1000), static_cast<float>(Index % 7), 0.0f);
+			Projectile.Velocity = FVector(static_cast<float>(Index % 13) - 6.0f, 5.0f, static_cast<float>(Index % 5));
+			Projectile.GravityScale = static_cast<float>(Index % 3);
+			Projectile.MaxSpeed = Index % 2 == 0 ? 8.0f : 0.0f;
+			LegacyProjectiles.Add(new FLegacyProjectile(Projectile));
+			BatchedProjectiles.Add(new FLegacyProjectile(Projectile));
+		}
+
+		FBenchmarkTimer LegacyTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (FLegacyProjectile* Projectile : LegacyProjectiles)
+			{
+				Projectile->Tick(DeltaTime);
+			}
+		}
+		const double LegacyMs = LegacyTimer.GetElapsedMilliseconds() / NumFrames;
+
+		FMovementBatchManager::FProjectileData Data;
+		FBenchmarkTimer BatchedTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Data.SetNum(NumProjectiles);
+			for (int32 Index = 0; Index < NumProjectiles; ++Index)
+			{
+				const FLegacyProjectile* Projectile = BatchedProjectiles[Index];
+				Data.PositionX[Index] = Projectile->Location.X;
+				Data.PositionY[Index] = Projectile->Location.Y;
+				Data.PositionZ[Index] = Projectile->Location.Z;
+				Data.VelocityX[Index] = Projectile->Velocity.X;
+				Data.VelocityY[Index] = Projectile->Velocity.Y;
+				Data.VelocityZ[Index] = Projectile->Velocity.Z;
+				Data.GravityScale[Index] = Projectile->GravityScale;
+				Data.MaxSpeed[Index] = Projectile->MaxSpeed;
+			}
+
+			FMovementBatchManager::IntegrateProjectiles(Data, NumProjectiles, DeltaTime);
+
+			for (int32 Index = 0; Index < NumProjectiles; ++Index)
+			{
+				FLegacyProjectile* Projectile = BatchedProjectiles[Index];
+				Projectile->Location = FVector(Data.PositionX[Index], Data.PositionY[Index], Data.PositionZ[Index]);
+				Projectile->Velocity = FVector(Data.VelocityX[Index], Data.VelocityY[Index], Data.VelocityZ[Index]);
+			}
+		}
+		const double BatchedMs = BatchedTimer.GetElapsedMilliseconds() / NumFrames;
+
+		float MaxDifference = 0.0f;
+		for (int32 Index = 0; Index < NumProjectiles; ++Index)
+		{
+			const float Difference = GetMaxDifference(LegacyProjectiles[Index]->Location, BatchedProjectiles[Index]->Location);
+			MaxDifference = Difference > MaxDifference ? Difference : MaxDifference;
+			delete LegacyProjectiles[Index];
+			delete BatchedProjectiles[Index];
+		}
+
+		UE_LOG_INFO("  %-28s legacy %8.3fms | batched %8.3fms (x%.2f, max diff %.6f)", "100k projectiles", LegacyMs,
+			BatchedMs, LegacyMs / BatchedMs, MaxDifference);
+	}
+
+	// 회전 이동 100k개 (절반은 피벗 회전): 객체마다 쿼터니언 계산 vs SoA 배열에서 4개씩 계산
+	{
+		constexpr int32 NumRotatings = 100000;
+		constexpr int32 NumFrames = 60;
+
+		TArray<FLegacyRotating*> LegacyRotatings;
+		TArray<FLegacyRotating*> BatchedRotatings;
+		for (int32 Index = 0; Index < NumRotatings; ++Index)
+		{
+			FLegacyRotating Rotating;
+			Rotating.Location = FVector(static_cast<float>(Index % 1000), 0.0f, 0.0f);
+			Rotating.RotationRate = FVector(0.0f, static_cast<float>(Index % 7) * 10.0f, 90.0f);
+			Rotating.PivotTranslation = Index % 2 == 0 ? FVector(2.0f, 0.0f, 0.0f) : FVector::ZeroVector();
+			Rotating.bRotationInLocalSpace = Index % 3 == 0;
+			LegacyRotatings.Add(new FLegacyRotating(Rotating));
+			BatchedRotatings.Add(new FLegacyRotating(Rotating));
+		}
+
+		FBenchmarkTimer LegacyTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (FLegacyRotating* Rotating : LegacyRotatings)
+			{
+				Rotating->Tick(DeltaTime);
+			}
+		}
+		const double LegacyMs = LegacyTimer.GetElapsedMilliseconds() / NumFrames;
+
+		FMovementBatchManager::FRotatingData Data;
+		FBenchmarkTimer BatchedTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Data.SetNum(NumRotatings);
+			for (int32 Index = 0; Index < NumRotatings; ++Index)
+			{
+				const FLegacyRotating* Rotating = BatchedRotatings[Index];
+				const FQuaternion DeltaRotation = FQuaternion::FromEuler(Rotating->RotationRate * DeltaTime);
+				Data.RotationX[Index] = Rotating->Rotation.X;
+				Data.RotationY[Index] = Rotating->Rotation.Y;
+				Data.RotationZ[Index] = Rotating->Rotation.Z;
+				Data.RotationW[Index] = Rotating->Rotation.W;
+				Data.DeltaX[Index] = DeltaRotation.X;
+				Data.DeltaY[Index] = DeltaRotation.Y;
+				Data.DeltaZ[Index] = DeltaRotation.Z;
+				Data.DeltaW[Index] = DeltaRotation.W;
+				Data.PivotX[Index] = Rotating->PivotTranslation.X;
+				Data.PivotY[Index] = Rotating->PivotTranslation.Y;
+				Data.PivotZ[Index] = Rotating->PivotTranslation.Z;
+
+				const uint32 Mask = Rotating->bRotationInLocalSpace ? 0xFFFFFFFFu : 0u;
+				memcpy(&Data.LocalSpaceMask[Index], &Mask, sizeof(float));
+			}
+
+			FMovementBatchManager::IntegrateRotatings(Data, NumRotatings);
+
+			for (int32 Index = 0; Index < NumRotatings; ++Index)
+			{
+				FLegacyRotating* Rotating = BatchedRotatings[Index];
+				Rotating->Rotation = FQuaternion(Data.RotationX[Index], Data.RotationY[Index], Data.RotationZ[Index], Data.RotationW[Index]);
+				if (!Rotating->PivotTranslation.IsZero())
+				{
+					Rotating->Location = Rotating->Location + FVector(Data.DeltaLocationX[Index], Data.DeltaLocationY[Index],
+						Data.DeltaLocationZ[Index]);
+				}
+			}
+		}
+		const double BatchedMs = BatchedTimer.GetElapsedMilliseconds() / NumFrames;
+
+		float MaxDifference = 0.0f;
+		for (int32 Index = 0; Index < NumRotatings; ++Index)
+		{
+			const float Difference = GetMaxDifference(LegacyRotatings[Index]->Location, BatchedRotatings[Index]->Location);
+			MaxDifference = Difference > MaxDifference ? Difference : MaxDifference;
+			delete LegacyRotatings[Index];
+			delete BatchedRotatings[Index];
+		}
+
+		UE_LOG_INFO("  %-28s legacy %8.3fms | batched %8.3fms (x%.2f, max diff %.6f)", "100k rotating", LegacyMs,
+			BatchedMs, LegacyMs / BatchedMs, MaxDifference);
+	}
+
+	// Octree 갱신: 20k개 중 2k개가 매 프레임 움직일 때
+	// 이전 방식은 움직인 프리미티브마다 Remove로 트리 전체를 탐색하고, 일괄 이동은 한 번의 순회로 모두 빼냄
+	{
+		constexpr int32 NumPrimitives = 20000;
+		constexpr int32 NumMoving = 2000;
+		constexpr int32 NumFrames = 20;
+
+		TArray<UPrimitiveComponent*> Primitives;
+		FOctree LegacyOctree(FVector(0.0f, 0.0f, 0.0f), 1000.0f);
+		FOctree BatchedOctree(FVector(0.0f, 0.0f, 0.0f), 1000.0f);
+		for (int32 Index = 0; Index < NumPrimitives; ++Index)
+		{
+			USphereComponent* Sphere = NewObject<USphereComponent>();
+			Sphere->InitSphereRadius(0.5f);
+			Sphere->SetRelativeLocation(FVector(static_cast<float>(Index % 40) * 24.0f - 480.0f,
+				static_cast<float>((Index / 40) % 40) * 24.0f - 480.0f, static_cast<float>(Index / 1600) * 70.0f - 450.0f));
+			LegacyOctree.Insert(Sphere);
+			BatchedOctree.Insert(Sphere);
+			Primitives.Add(Sphere);
+		}
+
+		FBenchmarkTimer LegacyTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 Index = 0; Index < NumMoving; ++Index)
+			{
+				UPrimitiveComponent* Primitive = Primitives[(Index * 10 + Frame) % NumPrimitives];
+				if (LegacyOctree.Remove(Primitive))
+				{
+					LegacyOctree.Insert(Primitive);
+				}
+			}
+		}
+		const double LegacyMs = LegacyTimer.GetElapsedMilliseconds() / NumFrames;
+
+		TSet<UPrimitiveComponent*> MovedPrimitives;
+		TArray<UPrimitiveComponent*> RemovedPrimitives;
+		FBenchmarkTimer BatchedTimer;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			MovedPrimitives.Reset();
+			RemovedPrimitives.Empty();
+			for (int32 Index = 0; Index < NumMoving; ++Index)
+			{
+				MovedPrimitives.Add(Primitives[(Index * 10 + Frame) % NumPrimitives]);
+			}
+
+			BatchedOctree.RemovePrimitives(MovedPrimitives, RemovedPrimitives);
+			for (UPrimitiveComponent* Primitive : RemovedPrimitives)
+			{
+				BatchedOctree.Insert(Primitive);
+			}
+		}
+		const double BatchedMs = BatchedTimer.GetElapsedMilliseconds() / NumFrames;
+
+		TArray<UPrimitiveComponent*> LegacyAll;
+		TArray<UPrimitiveComponent*> BatchedAll;
+		LegacyOctree.GetAllPrimitives(LegacyAll);
+		BatchedOctree.GetAllPrimitives(BatchedAll);
+
+		UE_LOG_INFO("  %-28s legacy %8.3fms | batched %8.3fms (x%.2f, %s)", "octree 2k of 20k moved", LegacyMs,
+			BatchedMs, LegacyMs / BatchedMs, LegacyAll.Num() == BatchedAll.Num() ? "all reinserted" : "MISMATCH");
+
+		LegacyOctree.Clear();
+		BatchedOctree.Clear();
+		for (UPrimitiveComponent* Primitive : Primitives)
+		{
+			delete Primitive;
+		}
+	}
+}
+
+void FEngineBenchmark::RunOctreeBenchmark()
+{
+	UE_LOG_SYSTEM("Benchmark: Octree");
+
+	constexpr int32 NumQueries = 1000;
+	const int32 PrimitiveCounts[] = { 10000, 100000, 1000000 };
+
+	for (const int32 NumPrimitives : PrimitiveCounts)
+	{
+		TArray<FOctreeElement> Elements;
+		MakeOctreeElements(NumPrimitives, Elements);
+
+		// 하나씩 삽입 (레벨에 컴포넌트가 등록되는 경로) vs Morton 정렬 후 한 번에 구축 (레벨 로드 경로)
+		FOctree InsertedOctree(FVector(0.0f, 0.0f, 0.0f), 1000.0f);
+		FBenchmarkTimer InsertTimer;
+		for (const FOctreeElement& Element : Elements)
+		{
+			InsertedOctree.Insert(Element.Primitive, FAABB(Element.Min, Element.Max));
+		}
+		const double InsertMs = InsertTimer.GetElapsedMilliseconds();
+
+		FOctree BuiltOctree(FVector(0.0f, 0.0f, 0.0f), 1000.0f);
+		FBenchmarkTimer BuildTimer;
+		BuiltOctree.Build(Elements);
+		const double BuildMs = BuildTimer.GetElapsedMilliseconds();
+
+		// 평균 원소 수십 개를 덮는 크기의 상자 쿼리
+		FBenchmarkRandom Random;
+		const float Extent = 50.0f * cbrtf(static_cast<float>(NumPrimitives));
+		TArray<FAABB> Queries;
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			const FVector Center(Random.GetInRange(-Extent, Extent), Random.GetInRange(-Extent, Extent),
+				Random.GetInRange(-Extent, Extent));
+			Queries.Add(FAABB(Center - FVector(100.0f, 100.0f, 100.0f), Center + FVector(100.0f, 100.0f, 100.0f)));
+		}
+
+		FBenchmarkTimer InsertedQueryTimer;
+		const int32 InsertedFound = RunOctreeQueries(InsertedOctree, Queries);
+		const double InsertedQueryMs = InsertedQueryTimer.GetElapsedMilliseconds();
+
+		FBenchmarkTimer BuiltQueryTimer;
+		const int32 BuiltFound = RunOctreeQueries(BuiltOctree, Queries);
+		const double BuiltQueryMs = BuiltQueryTimer.GetElapsedMilliseconds();
+
+		char Label[32];
+		snprintf(Label, sizeof(Label), "%dk build", NumPrimitives / 1000);
+		UE_LOG_INFO("  %-28s insert %8.3fms | morton %8.3fms (x%.2f, %d / %d nodes)", Label, InsertMs, BuildMs,
+			InsertMs / BuildMs, InsertedOctree.GetNodeCount(), BuiltOctree.GetNodeCount());
+
+		snprintf(Label, sizeof(Label), "%dk query x%d", NumPrimitives / 1000, NumQueries);
+		UE_LOG_INFO("  %-28s insert %8.3fms | morton %8.3fms (x%.2f, %s)", Label, InsertedQueryMs, BuiltQueryMs,
+			InsertedQueryMs / BuiltQueryMs, InsertedFound == BuiltFound ? "same results" : "MISMATCH");
+	}
+}
+
+void FEngineBenchmark::RunDynamicTreeBenchmark()
+{
+	UE_LOG_SYSTEM("Benchmark: Dynamic AABB Tree");
+
+	constexpr int32 NumPrimitives = 20000;
+	constexpr int32 NumMoving = 2000;
+	constexpr int32 NumFrames = 120;
+	constexpr int32 NumQueries = 1000;
+
+	TArray<FOctreeElement> Elements;
+	MakeOctreeElements(NumPrimitives, Elements);
+
+	// 움직이는 프리미티브는 프레임마다 0.3 정도씩 일정한 방향으로 이동 (60fps에서 초속 20 정도)
+	FBenchmarkRandom Random;
+	TArray<FVector> Velocities;
+	for (int32 Index = 0; Index < NumMoving; ++Index)
+	{
+		Velocities.Add(FVector(Random.GetInRange(-0.3f, 0.3f), Random.GetInRange(-0.3f, 0.3f), Random.GetInRange(-0.3f, 0.3f)));
+	}
+
+	// 처음 움직인 뒤의 상태를 비교하도록 움직이는 프리미티브를 미리 각 인덱스에 넣어 둠
+	FOctree Octree(FVector(0.0f, 0.0f, 0.0f), 1000.0f);
+	FDynamicAABBTree DynamicTree;
+	TArray<int32> ProxyIds;
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		const FOctreeElement& Element = Elements[Index];
+		Octree.Insert(Element.Primitive, FAABB(Element.Min, Element.Max));
+		if (Index < NumMoving)
+		{
+			ProxyIds.Add(DynamicTree.CreateProxy(Element.Primitive, FAABB(Element.Min, Element.Max)));
+		}
+	}
+
+	TArray<FOctreeElement> OctreeElements = Elements;
+	TSet<UPrimitiveComponent*> MovedPrimitives;
+	TArray<UPrimitiveComponent*> RemovedPrimitives;
+	FBenchmarkTimer OctreeTimer;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		MovedPrimitives.Reset();
+		RemovedPrimitives.Empty();
+		for (int32 Index = 0; Index < NumMoving; ++Index)
+		{
+			OctreeElements[Index].Min = OctreeElements[Index].Min + Velocities[Index];
+			OctreeElements[Index].Max = OctreeElements[Index].Max + Velocities[Index];
+			MovedPrimitives.Add(OctreeElements[Index].Primitive);
+		}
+
+		Octree.RemovePrimitives(MovedPrimitives, RemovedPrimitives);
+		for (int32 Index = 0; Index < NumMoving; ++Index)
+		{
+			Octree.Insert(OctreeElements[Index].Primitive, FAABB(OctreeElements[Index].Min, OctreeElements[Index].Max));
+		}
+	}
+	const double OctreeMs = OctreeTimer.GetElapsedMilliseconds() / NumFrames;
+
+	TArray<FOctreeElement> DynamicElements = Elements;
+	int32 NumReinserted = 0;
+	FBenchmarkTimer DynamicTimer;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 Index = 0; Index < NumMoving; ++Index)
+		{
+			DynamicElements[Index].Min = DynamicElements[Index].Min + Velocities[Index];
+			DynamicElements[Index].Max = DynamicElements[Index].Max + Velocities[Index];
+			NumReinserted += DynamicTree.MoveProxy(ProxyIds[Index], FAABB(DynamicElements[Index].Min, DynamicElements[Index].Max)) ? 1 : 0;
+		}
+	}
+	const double DynamicMs = DynamicTimer.GetElapsedMilliseconds() / NumFrames;
+
+	UE_LOG_INFO("  %-28s octree %8.3fms | dynamic %8.3fms (x%.2f, %.1f%% reinserted)", "2k of 20k moved", OctreeMs, DynamicMs,
+		OctreeMs / DynamicMs, 100.0 * NumReinserted / (static_cast<double>(NumMoving) * NumFrames));
+	UE_LOG_INFO("  %-28s height %d, area ratio %.1f, %s", "dynamic tree", DynamicTree.GetHeight(), DynamicTree.GetAreaRatio(),
+		DynamicTree.CheckValidity() ? "valid" : "INVALID");
+
+	// 움직이는 프리미티브만 대상으로 한 상자 쿼리 (레벨에서는 정적 Octree와 동적 트리를 함께 쿼리)
+	const float Extent = 50.0f * cbrtf(static_cast<float>(NumPrimitives));
+	TArray<FAABB> Queries;
+	for (int32 Index = 0; Index < NumQueries; ++Index)
+	{
+		const FVector Center(Random.GetInRange(-Extent, Extent), Random.GetInRange(-Extent, Extent),
+			Random.GetInRange(-Extent, Extent));
+		Queries.Add(FAABB(Center - FVector(100.0f, 100.0f, 100.0f), Center + FVector(100.0f, 100.0f, 100.0f)));
+	}
+
+	TArray<UPrimitiveComponent*, TInlineAllocator<256>> Results;
+	int32 NumDynamicFound = 0;
+	FBenchmarkTimer QueryTimer;
+	for (const FAABB& Query : Queries)
+	{
+		Results.Reset();
+		DynamicTree.QueryAABB(Query, Results);
+		NumDynamicFound += Results.Num();
+	}
+	const double QueryMs = QueryTimer.GetElapsedMilliseconds();
+
+	int32 NumExpected = 0;
+	for (const FAABB& Query : Queries)
+	{
+		for (int32 Index = 0; Index < NumMoving; ++Index)
+		{
+			NumExpected += Query.IsIntersected(FAABB(DynamicElements[Index].Min, DynamicElements[Index].Max)) ? 1 : 0;
+		}
+	}
+
+	char Label[32];
+	snprintf(Label, sizeof(Label), "dynamic query x%d", NumQueries);
+	UE_LOG_INFO("  %-28s %8.3fms (%s)", Label, QueryMs, NumDynamicFound == NumExpected ? "matches brute force" : "MISMATCH");
+}
+
+void FEngineBenchmark::RunBVHBenchmark()
+{
+	UE_LOG_SYSTEM("Benchmark: Mesh BVH");
+
+	constexpr int32 GridSize = 708;
+	constexpr int32 NumRays = 100;
+
+	FStaticMesh Mesh;
+	MakeGridMesh(GridSize, Mesh);
+	const int32 NumTriangles = Mesh.Indices.Num() / 3;
+
+	FBVH BVH;
+	FBenchmarkTimer BuildTimer;
+	BVH.Build(&Mesh);
+	const double BuildMs = BuildTimer.GetElapsedMilliseconds();
+
+	char Label[32];
+	snprintf(Label, sizeof(Label), "%dk tri build", NumTriangles / 1000);
+	UE_LOG_INFO("  %-28s %8.3fms (%d workers, %d nodes, cost %.3g, %s)", Label, BuildMs, FTaskGraph::Get().GetNumWorkers(),
+		BVH.GetNodeCount(), BVH.GetTotalCost(), BVH.CheckValidity() ? "valid" : "INVALID");
+
+	// 위에서 지형을 향해 비스듬히 쏘는 레이, 가장 가까운 교차가 모든 삼각형을 검사한 결과와 같은지 비교
+	FBenchmarkRandom Random;
+	TArray<FRay> Rays;
+	for (int32 Index = 0; Index < NumRays; ++Index)
+	{
+		FVector Direction(Random.GetInRange(-0.3f, 0.3f), Random.GetInRange(-0.3f, 0.3f), -1.0f);
+		Direction.Normalize();
+
+		FRay Ray;
+		Ray.Origin = FVector4(Random.GetInRange(0.0f, GridSize), Random.GetInRange(0.0f, GridSize), 50.0f, 1.0f);
+		Ray.Direction = FVector4(Direction, 0.0f);
+		Rays.Add(Ray);
+	}
+
+	TArray<FBVHRayHit> Hits;
+	Hits.SetNum(NumRays);
+	int32 NumHits = 0;
+	FBenchmarkTimer ClosestTimer;
+	for (int32 Index = 0; Index < NumRays; ++Index)
+	{
+		NumHits += BVH.RaycastClosest(Rays[Index], 0.0f, FLT_MAX, Hits[Index]) ? 1 : 0;
+	}
+	const double ClosestMs = ClosestTimer.GetElapsedMilliseconds();
+
+	int32 NumMismatches = 0;
+	FBenchmarkTimer BruteForceTimer;
+	for (int32 Index = 0; Index < NumRays; ++Index)
+	{
+		const FVector Origin(Rays[Index].Origin.X, Rays[Index].Origin.Y, Rays[Index].Origin.Z);
+		const FVector Direction(Rays[Index].Direction.X, Rays[Index].Direction.Y, Rays[Index].Direction.Z);
+		float ClosestDistance = FLT_MAX;
+		for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			const uint32* TriangleIndices = Mesh.Indices.GetData() + Triangle * 3;
+			float Distance;
+			if (RaycastTriangle(Origin, Direction, Mesh.Vertices[TriangleIndices[0]].Position, Mesh.Vertices[TriangleIndices[1]].Position,
+				Mesh.Vertices[TriangleIndices[2]].Position, Distance))
+			{
+				ClosestDistance = std::min(ClosestDistance, Distance);
+			}
+		}
+
+		const bool bBruteForceHit = ClosestDistance < FLT_MAX;
+		const bool bBVHHit = Hits[Index].TriangleIndex >= 0;
+		if (bBruteForceHit != bBVHHit || (bBVHHit && fabsf(ClosestDistance - Hits[Index].Distance) > 1e-3f))
+		{
+			++NumMismatches;
+		}
+	}
+	const double BruteForceMs = BruteForceTimer.GetElapsedMilliseconds();
+
+	snprintf(Label, sizeof(Label), "closest hit x%d", NumRays);
+	UE_LOG_INFO("  %-28s brute %8.3fms | bvh4 %8.3fms (x%.0f, %d / %d hit, %s)", Label, BruteForceMs, ClosestMs,
+		BruteForceMs / ClosestMs, NumHits, NumRays, NumMismatches == 0 ? "same hits" : "MISMATCH");
+
+	// 화면 타일 순서로 만든 카메라 레이 (8 x 8 타일 하나가 한 묶음)와 흩어진 레이를 레이 하나씩 / 묶음으로 순회
+	constexpr int32 ScreenSize = 256;
+	constexpr int32 TileSize = 8;
+	static_assert(TileSize * TileSize == BVH_PACKET_SIZE, "one screen tile per packet");
+	const FVector Eye(-0.25f * GridSize, -0.25f * GridSize, 0.5f * GridSize);
+
+	TArray<FRay> ScreenRays;
+	ScreenRays.Reserve(ScreenSize * ScreenSize);
+	for (int32 TileY = 0; TileY < ScreenSize; TileY += TileSize)
+	{
+		for (int32 TileX = 0; TileX < ScreenSize; TileX += TileSize)
+		{
+			for (int32 PixelIndex = 0; PixelIndex < TileSize * TileSize; ++PixelIndex)
+			{
+				const float U = static_cast<float>(TileX + PixelIndex % TileSize) / ScreenSize;
+				const float V = static_cast<float>(TileY + PixelIndex / TileSize) / ScreenSize;
+				FVector Direction = FVector(U * GridSize, V * GridSize, 0.0f) - Eye;
+				Direction.Normalize();
+
+				FRay Ray;
+				Ray.Origin = FVector4(Eye, 1.0f);
+				Ray.Direction = FVector4(Direction, 0.0f);
+				ScreenRays.Add(Ray);
+			}
+		}
+	}
+
+	TArray<FRay> ScatteredRays;
+	ScatteredRays.Reserve(ScreenRays.Num());
+	for (int32 Index = 0; Index < ScreenRays.Num(); ++Index)
+	{
+		FVector Direction(Random.GetInRange(-1.0f, 1.0f), Random.GetInRange(-1.0f, 1.0f), Random.GetInRange(-1.0f, -0.1f));
+		Direction.Normalize();
+
+		FRay Ray;
+		Ray.Origin = FVector4(Random.GetInRange(0.0f, GridSize), Random.GetInRange(0.0f, GridSize), 20.0f, 1.0f);
+		Ray.Direction = FVector4(Direction, 0.0f);
+		ScatteredRays.Add(Ray);
+	}
+
+	TArray<float> MaxDistances;
+	MaxDistances.SetNum(ScreenRays.Num(), FLT_MAX);
+	TArray<FBVHRayHit> SingleHits;
+	SingleHits.SetNum(ScreenRays.Num());
+	TArray<FBVHRayHit> PacketHits;
+	PacketHits.SetNum(ScreenRays.Num());
+
+	auto ComparePacket = [&](const char* InLabel, const TArray<FRay>& InRays)
+	{
+		FBenchmarkTimer SingleTimer;
+		for (int32 Index = 0; Index < InRays.Num(); ++Index)
+		{
+			SingleHits[Index] = FBVHRayHit();
+			BVH.RaycastClosest(InRays[Index], 0.0f, FLT_MAX, SingleHits[Index]);
+		}
+		const double SingleMs = SingleTimer.GetElapsedMilliseconds();
+
+		FBenchmarkTimer PacketTimer;
+		for (int32 Begin = 0; Begin < InRays.Num(); Begin += BVH_PACKET_SIZE)
+		{
+			BVH.RaycastClosestPacket(&InRays[Begin], std::min(BVH_PACKET_SIZE, InRays.Num() - Begin), 0.0f, &MaxDistances[Begin], &PacketHits[Begin]);
+		}
+		const double PacketMs = PacketTimer.GetElapsedMilliseconds();
+
+		int32 NumPacketMismatches = 0;
+		for (int32 Index = 0; Index < InRays.Num(); ++Index)
+		{
+			NumPacketMismatches += SingleHits[Index].TriangleIndex != PacketHits[Index].TriangleIndex ? 1 : 0;
+		}
+
+		UE_LOG_INFO("  %-28s single %8.3fms | packet %8.3fms (x%.2f, %s)", InLabel, SingleMs, PacketMs, SingleMs / PacketMs,
+			NumPacketMismatches == 0 ? "same hits" : "MISMATCH");
+	};
+
+	snprintf(Label, sizeof(Label), "%dx%d screen tiles", ScreenSize, ScreenSize);
+	ComparePacket(Label, ScreenRays);
+	snprintf(Label, sizeof(Label), "%dk scattered rays", ScatteredRays.Num() / 1000);
+	ComparePacket(Label, ScatteredRays);
+}
+
+void FEngineBenchmark::RunLineTraceBenchmark()
+{
+	UE_LOG_SYSTEM("Benchmark: Level Line Trace");
+
+	ULevel* Level = GWorld ? GWorld->GetLevel() : nullptr;
+	if (!Level)
+	{
+		UE_LOG_WARNING("  레벨이 없어 건너뜁니다");
+		return;
+	}
+
+	constexpr int32 NumRays = 4096;
+
+	// 씬의 다른 지오메트리와 겹치지 않도록 멀리 스폰 (모든 액터는 원점에 Y-Z 평면의 UUID 텍스트 쿼드를 가짐)
+	AActor* Actor = Level->SpawnActorToLevel(AStaticMeshActor::StaticClass());
+	Actor->SetActorLocation(FVector(100000.0f, 100000.0f, 100000.0f));
+	UPrimitiveComponent* Mesh = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+
+	int32 NumUUIDTexts = 0;
+	for (UActorComponent* Component : Actor->GetOwnedComponents())
+	{
+		NumUUIDTexts += Cast<UUUIDTextComponent>(Component) ? 1 : 0;
+	}
+
+	// 메시 안쪽을 X축으로 관통하는 선분 (원점의 UUID 쿼드도 지나감)
+	FVector BoundsMin, BoundsMax;
+	Mesh->GetWorldAABB(BoundsMin, BoundsMax);
+	const FVector Center = (BoundsMin + BoundsMax) * 0.5f;
+	const FVector HalfSize = (BoundsMax - BoundsMin) * 0.4f;
+	FBenchmarkRandom Random;
+	TArray<FLineTraceSegment> Segments;
+	for (int32 Index = 0; Index < NumRays; ++Index)
+	{
+		const float Y = Center.Y + Random.GetInRange(-HalfSize.Y, HalfSize.Y);
+		const float Z = Center.Z + Random.GetInRange(-HalfSize.Z, HalfSize.Z);
+		Segments.Add({ FVector(BoundsMin.X - 50.0f, Y, Z), FVector(BoundsMax.X + 50.0f, Y, Z) });
+	}
+
+	int32 NumSingleMisses = 0;
+	FBenchmarkTimer SingleTimer;
+	for (const FLineTraceSegment& Segment : Segments)
+	{
+		FHitResult Hit;
+		NumSingleMisses += Level->LineTraceSingle(Hit, Segment.Start, Segment.End) && Hit.Component == Mesh ? 0 : 1;
+	}
+	const double SingleMs = SingleTimer.GetElapsedMilliseconds();
+
+	TArray<FHitResult> BatchHits;
+	FBenchmarkTimer BatchTimer;
+	Level->LineTraceBatch(Segments, BatchHits);
+	const double BatchMs = BatchTimer.GetElapsedMilliseconds();
+
+	int32 NumBatchMisses = 0;
+	for (const FHitResult& Hit : BatchHits)
+	{
+		NumBatchMisses += Hit.bBlockingHit && Hit.Component == Mesh ? 0 : 1;
+	}
+
+	int32 NumOtherMultiHits = 0;
+	TArray<FHitResult> MultiHits;
+	for (const FLineTraceSegment& Segment : Segments)
+	{
+		Level->LineTraceMulti(MultiHits, Segment.Start, Segment.End);
+		for (const FHitResult& Hit : MultiHits)
+		{
+			NumOtherMultiHits += Hit.Component != Mesh ? 1 : 0;
+		}
+	}
+
+	Level->DestroyActor(Actor);
+
+	const bool bPassed = NumSingleMisses == 0 && NumBatchMisses == 0 && NumOtherMultiHits == 0;
+	UE_LOG_INFO("  %-28s %d UUID text, single %d / batch %d missed the mesh, multi %d other hits (%s)", "mesh behind UUID quad",
+		NumUUIDTexts, NumSingleMisses, NumBatchMisses, NumOtherMultiHits, bPassed ? "ok" : "FAILED");
+	UE_LOG_INFO("  %-28s single %8.3fms | batch %8.3fms (x%.2f)", "4k rays", SingleMs, BatchMs, SingleMs / BatchMs);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @brief 콘솔에서 실행하는 엔진 내부 마이크로 벤치마크 모음
+ * "bench <name>" 명령어로 실행하며, 결과는 콘솔 로그로 출력된다
+ * 측정 시간은 FPlatformTime 사이클 카운터 기준 밀리초 단위
+ */
+class FEngineBenchmark
+{
+public:
+	/**
+	 * @brief 이름에 해당하는 벤치마크 실행
+	 * @param InName 벤치마크 이름 (소문자)
+	 * @return 해당 벤치마크가 존재해서 실행했다면 true
+	 */
+	static bool Run(const FString& InName);
+
+	/** @brief 실행 가능한 벤치마크 목록 출력 */
+	static void PrintUsage();
+
+private:
+	/** @brief TMap / TSet과 std 컨테이너의 삽입, 탐색, 순회, 삭제, 차집합 비교 */
+	static void RunContainerBenchmark();
+
+	/** @brief 전역 할당자(FMallocBinned)와 이전 malloc 경로의 액터 스폰 / 파괴 할당 패턴 비교 */
+	static void RunMallocBenchmark();
+
+	/** @brief 1M개(10% 고유)의 FName 생성으로 FNameTable과 이전 소문자 복사 테이블 비교 */
+	static void RunNameBenchmark();
+
+	/** @brief RenderLevel 형태의 Cast 체인으로 조상 테이블 IsA와 이전 Super 체인 탐색 비교 */
+	static void RunCastBenchmark();
+
+	/** @brief 오버랩 이벤트 형태의 Broadcast로 인라인 바인딩 TDelegate와 이전 std::function 델리게이트, 지연 이벤트 큐 비교 */
+	static void RunDelegateBenchmark();
+
+	/** @brief TaskGraph의 태스크당 스케줄링 비용, 의존성 체인, ParallelFor, 1..N 코어 확장성 측정 */
+	static void RunTaskGraphBenchmark();
+
+	/** @brief Tick 매니저와 이전 액터 / 컴포넌트 순회 비교, Tick 간격 / 거리 조절 시 프레임 비용, Tick 그룹의 직렬 / 병렬 실행 비교 */
+	static void RunTickBenchmark();
+
+	/** @brief 투사체 / 회전 이동의 SoA SIMD 일괄 적분과 컴포넌트별 적분, Octree 일괄 제거와 프리미티브별 Remove 비교 */
+	static void RunMovementBenchmark();
+
+	/** @brief 10k / 100k / 1M개 프리미티브로 Octree의 하나씩 삽입과 Morton 일괄 구축, 구축된 트리의 AABB 쿼리 비교 */
+	static void RunOctreeBenchmark();
+
+	/** @brief 움직이는 프리미티브의 동적 AABB 트리 MoveProxy와 Octree 제거 / 재삽입 비교, 동적 트리 쿼리 정확도 확인 */
+	static void RunDynamicTreeBenchmark();
+
+	/** @brief 1M 삼각형 격자 메시의 binned SAH BVH 구축 시간과 트리 품질, BVH4 최근접 교차와 전수 검사 비교, 레이 묶음과 레이 하나씩 순회 비교 */
+	static void RunBVHBenchmark();
+
+	/** @brief 레벨의 LineTraceSingle / Multi / Batch가 UUID 텍스트 같은 에디터 시각화 쿼드를 지나 메시에 맞는지 확인, 선분 하나씩과 묶음 비교 */
+	static void RunLineTraceBenchmark();
+};
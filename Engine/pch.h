@@ -51,6 +51,7 @@
 #include "Source/Global/Macro.h"
 #include "Source/Global/Function.h"
 #include "Source/Utility/Public/ScopeCycleCounter.h"
+#include "Source/Runtime/Core/Public/Memory/LowLevelMemTracker.h"
 #include "Source/Editor/Public/EditorEngine.h"
 
 // Pointer